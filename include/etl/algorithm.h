@@ -86,6 +86,12 @@ namespace etl
   template <typename TIterator, typename TCompare>
   ETL_CONSTEXPR14 void insertion_sort(TIterator first, TIterator last, TCompare compare);
 
+  template <typename TIterator>
+  void pdq_sort(TIterator first, TIterator last);
+
+  template <typename TIterator, typename TCompare>
+  void pdq_sort(TIterator first, TIterator last, TCompare compare);
+
   class algorithm_exception : public etl::exception
   {
   public:
@@ -2137,38 +2143,262 @@ namespace etl
     return etl::find_if(begin, end, predicate) == end;
   }
 
+  //***************************************************************************
+  namespace private_merge_sort
+  {
+    // Runs of this length are insertion sorted before merging.
+    static ETL_CONSTANT ptrdiff_t Run_Length = 16;
+
+    //*************************************************************************
+    /// Stable insertion sort of [first, last).
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      if (first == last)
+      {
+        return;
+      }
+
+      for (TIterator current = first + 1; current != last; ++current)
+      {
+        if (compare(*current, *(current - 1)))
+        {
+          value_type temp = ETL_MOVE(*current);
+
+          TIterator sift = current;
+
+          do
+          {
+            *sift = ETL_MOVE(*(sift - 1));
+            --sift;
+          } while ((sift != first) && compare(temp, *(sift - 1)));
+
+          *sift = ETL_MOVE(temp);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Merges the sorted ranges [first, middle) and [middle, last).
+    /// Uses the buffer if either range fits, otherwise splits the ranges
+    /// around a rotation and merges the parts.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare, typename T>
+    void merge(TIterator first, TIterator middle, TIterator last, TCompare compare, T* buffer, size_t buffer_size)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+      const difference_type length1 = middle - first;
+      const difference_type length2 = last - middle;
+
+      if ((length1 == 0) || (length2 == 0))
+      {
+        return;
+      }
+
+      if ((length1 + length2) == 2)
+      {
+        if (compare(*middle, *first))
+        {
+          etl::iter_swap(first, middle);
+        }
+
+        return;
+      }
+
+      if (static_cast<size_t>(length1) <= buffer_size)
+      {
+        // Move the left range out and merge forwards.
+        T* const buffer_end = etl::move(first, middle, buffer);
+        T*       left       = buffer;
+        TIterator right     = middle;
+        TIterator output    = first;
+
+        while ((left != buffer_end) && (right != last))
+        {
+          // Only take from the right if strictly less, to remain stable.
+          if (compare(*right, *left))
+          {
+            *output = ETL_MOVE(*right);
+            ++right;
+          }
+          else
+          {
+            *output = ETL_MOVE(*left);
+            ++left;
+          }
+
+          ++output;
+        }
+
+        etl::move(left, buffer_end, output);
+      }
+      else if (static_cast<size_t>(length2) <= buffer_size)
+      {
+        // Move the right range out and merge backwards.
+        T* const  buffer_end = etl::move(middle, last, buffer);
+        T*        right      = buffer_end;
+        TIterator left       = middle;
+        TIterator output     = last;
+
+        while ((right != buffer) && (left != first))
+        {
+          // Only take from the left if strictly greater, to remain stable.
+          if (compare(*(right - 1), *(left - 1)))
+          {
+            --left;
+            *--output = ETL_MOVE(*left);
+          }
+          else
+          {
+            --right;
+            *--output = ETL_MOVE(*right);
+          }
+        }
+
+        etl::move_backward(buffer, right, output);
+      }
+      else
+      {
+        TIterator cut1;
+        TIterator cut2;
+
+        if (length1 > length2)
+        {
+          cut1 = first + (length1 / 2);
+          cut2 = etl::lower_bound(middle, last, *cut1, compare);
+        }
+        else
+        {
+          cut2 = middle + (length2 / 2);
+          cut1 = etl::upper_bound(first, middle, *cut2, compare);
+        }
+
+        etl::rotate(cut1, middle, cut2);
+
+        TIterator new_middle = cut1 + (cut2 - middle);
+
+        private_merge_sort::merge(first, cut1, new_middle, compare, buffer, buffer_size);
+        private_merge_sort::merge(new_middle, cut2, last, compare, buffer, buffer_size);
+      }
+    }
+
+    //*************************************************************************
+    /// Bottom up merge sort of [first, last).
+    /// The buffer may be empty, in which case the merges are done in place
+    /// with rotations, in O(n log^2 n) time.
+    /// Stable.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare, typename T>
+    void merge_sort(TIterator first, TIterator last, TCompare compare, T* buffer, size_t buffer_size)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+      const difference_type length = last - first;
+
+      for (difference_type i = 0; i < length; i += Run_Length)
+      {
+        private_merge_sort::insertion_sort(first + i, first + etl::min(i + Run_Length, length), compare);
+      }
+
+      for (difference_type width = Run_Length; width < length; width *= 2)
+      {
+        for (difference_type i = 0; i < (length - width); i += 2 * width)
+        {
+          TIterator lower  = first + i;
+          TIterator middle = lower + width;
+          TIterator upper  = first + etl::min(i + (2 * width), length);
+
+          // Already in order?
+          if (compare(*middle, *(middle - 1)))
+          {
+            private_merge_sort::merge(lower, middle, upper, compare, buffer, buffer_size);
+          }
+        }
+      }
+    }
+  }
+
 #if ETL_NOT_USING_STL
+  namespace private_algorithm
+  {
+    //*************************************************************************
+    /// Random access iterators use pattern defeating quicksort.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void sort(TIterator first, TIterator last, TCompare compare, etl::true_type /*is_random_access*/)
+    {
+      etl::pdq_sort(first, last, compare);
+    }
+
+    //*************************************************************************
+    /// Other iterators use shell sort.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void sort(TIterator first, TIterator last, TCompare compare, etl::false_type /*is_random_access*/)
+    {
+      etl::shell_sort(first, last, compare);
+    }
+
+    //*************************************************************************
+    /// Random access iterators use an in place merge sort.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void stable_sort(TIterator first, TIterator last, TCompare compare, etl::true_type /*is_random_access*/)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      private_merge_sort::merge_sort(first, last, compare, static_cast<value_type*>(ETL_NULLPTR), 0U);
+    }
+
+    //*************************************************************************
+    /// Other iterators use insertion sort.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void stable_sort(TIterator first, TIterator last, TCompare compare, etl::false_type /*is_random_access*/)
+    {
+      etl::insertion_sort(first, last, compare);
+    }
+  }
+
   //***************************************************************************
   /// Sorts the elements.
+  /// Uses pattern defeating quicksort for random access iterators, otherwise shell sort.
   /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename TCompare>
   void sort(TIterator first, TIterator last, TCompare compare)
   {
-    etl::shell_sort(first, last, compare);
+    private_algorithm::sort(first, last, compare, etl::integral_constant<bool, etl::is_random_access_iterator<TIterator>::value>());
   }
 
   //***************************************************************************
   /// Sorts the elements.
+  /// Uses pattern defeating quicksort for random access iterators, otherwise shell sort.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator>
   void sort(TIterator first, TIterator last)
   {
-    etl::shell_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    etl::sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 
   //***************************************************************************
   /// Sorts the elements.
   /// Stable.
+  /// Uses an in place merge sort for random access iterators, otherwise insertion sort.
+  /// See etl::merge_sort for a faster version that uses a scratch buffer.
   /// Uses user defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename TCompare>
   void stable_sort(TIterator first, TIterator last, TCompare compare)
   {
-    etl::insertion_sort(first, last, compare);
+    private_algorithm::stable_sort(first, last, compare, etl::integral_constant<bool, etl::is_random_access_iterator<TIterator>::value>());
   }
 
   //***************************************************************************
@@ -2179,7 +2409,7 @@ namespace etl
   template <typename TIterator>
   void stable_sort(TIterator first, TIterator last)
   {
-    etl::insertion_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    etl::stable_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 #else
   //***************************************************************************
@@ -3044,6 +3274,11 @@ namespace etl
           {
             etl::iter_swap(itr1, itr2);
           }
+          else
+          {
+            // The rest of this gap sequence is already in order.
+            break;
+          }
         }
       }
     }
@@ -3208,6 +3443,428 @@ namespace etl
     etl::sort_heap(first, last);
   }
 
+  //***************************************************************************
+  namespace private_pdq_sort
+  {
+    // Partitions smaller than this are insertion sorted.
+    static ETL_CONSTANT ptrdiff_t Insertion_Sort_Threshold = 24;
+
+    // Partitions larger than this use the pseudo median of nine as the pivot.
+    static ETL_CONSTANT ptrdiff_t Ninther_Threshold = 128;
+
+    // The number of moves allowed when opportunistically insertion sorting.
+    static ETL_CONSTANT ptrdiff_t Partial_Insertion_Sort_Limit = 8;
+
+    //*************************************************************************
+    /// Insertion sort of [first, last).
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      if (first == last)
+      {
+        return;
+      }
+
+      for (TIterator current = first + 1; current != last; ++current)
+      {
+        TIterator sift   = current;
+        TIterator sift_1 = current - 1;
+
+        if (compare(*sift, *sift_1))
+        {
+          value_type temp = ETL_MOVE(*sift);
+
+          do
+          {
+            *sift-- = ETL_MOVE(*sift_1);
+          } while ((sift != first) && compare(temp, *--sift_1));
+
+          *sift = ETL_MOVE(temp);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Insertion sort of [first, last).
+    /// The element before 'first' must not be greater than any in the range.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void unguarded_insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      if (first == last)
+      {
+        return;
+      }
+
+      for (TIterator current = first + 1; current != last; ++current)
+      {
+        TIterator sift   = current;
+        TIterator sift_1 = current - 1;
+
+        if (compare(*sift, *sift_1))
+        {
+          value_type temp = ETL_MOVE(*sift);
+
+          do
+          {
+            *sift-- = ETL_MOVE(*sift_1);
+          } while (compare(temp, *--sift_1));
+
+          *sift = ETL_MOVE(temp);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Attempts an insertion sort of [first, last).
+    /// Gives up and returns false if too many elements have to be moved.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    bool partial_insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type      value_type;
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+      if (first == last)
+      {
+        return true;
+      }
+
+      difference_type moves = 0;
+
+      for (TIterator current = first + 1; current != last; ++current)
+      {
+        TIterator sift   = current;
+        TIterator sift_1 = current - 1;
+
+        if (compare(*sift, *sift_1))
+        {
+          value_type temp = ETL_MOVE(*sift);
+
+          do
+          {
+            *sift-- = ETL_MOVE(*sift_1);
+          } while ((sift != first) && compare(temp, *--sift_1));
+
+          *sift = ETL_MOVE(temp);
+
+          moves += current - sift;
+
+          if (moves > Partial_Insertion_Sort_Limit)
+          {
+            return false;
+          }
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Sorts two elements.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void sort2(TIterator a, TIterator b, TCompare compare)
+    {
+      if (compare(*b, *a))
+      {
+        etl::iter_swap(a, b);
+      }
+    }
+
+    //*************************************************************************
+    /// Sorts three elements.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void sort3(TIterator a, TIterator b, TIterator c, TCompare compare)
+    {
+      private_pdq_sort::sort2(a, b, compare);
+      private_pdq_sort::sort2(b, c, compare);
+      private_pdq_sort::sort2(a, b, compare);
+    }
+
+    //*************************************************************************
+    /// Partitions [first, last) around the pivot at *first.
+    /// Elements equal to the pivot go to the right.
+    /// Returns the final position of the pivot, and whether the range was
+    /// already partitioned.
+    /// Requires a median of three, or better, pivot selection.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    ETL_OR_STD::pair<TIterator, bool> partition_right(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      value_type pivot = ETL_MOVE(*first);
+
+      TIterator left  = first;
+      TIterator right = last;
+
+      // Find the first element not less than the pivot.
+      // The median selection guarantees that one exists.
+      while (compare(*++left, pivot))
+      {
+      }
+
+      // Find the last element less than the pivot.
+      // Guard against running off the start if there were none before 'left'.
+      if ((left - 1) == first)
+      {
+        while ((left < right) && !compare(*--right, pivot))
+        {
+        }
+      }
+      else
+      {
+        while (!compare(*--right, pivot))
+        {
+        }
+      }
+
+      const bool already_partitioned = (left >= right);
+
+      while (left < right)
+      {
+        etl::iter_swap(left, right);
+
+        while (compare(*++left, pivot))
+        {
+        }
+
+        while (!compare(*--right, pivot))
+        {
+        }
+      }
+
+      TIterator pivot_position = left - 1;
+      *first          = ETL_MOVE(*pivot_position);
+      *pivot_position = ETL_MOVE(pivot);
+
+      return ETL_OR_STD::pair<TIterator, bool>(pivot_position, already_partitioned);
+    }
+
+    //*************************************************************************
+    /// Partitions [first, last) around the pivot at *first.
+    /// Elements equal to the pivot go to the left.
+    /// Used when the pivot equals the element before the range, so that runs
+    /// of equal elements are dealt with in linear time.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    TIterator partition_left(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      value_type pivot = ETL_MOVE(*first);
+
+      TIterator left  = first;
+      TIterator right = last;
+
+      while (compare(pivot, *--right))
+      {
+      }
+
+      if ((right + 1) == last)
+      {
+        while ((left < right) && !compare(pivot, *++left))
+        {
+        }
+      }
+      else
+      {
+        while (!compare(pivot, *++left))
+        {
+        }
+      }
+
+      while (left < right)
+      {
+        etl::iter_swap(left, right);
+
+        while (compare(pivot, *--right))
+        {
+        }
+
+        while (!compare(pivot, *++left))
+        {
+        }
+      }
+
+      TIterator pivot_position = right;
+      *first          = ETL_MOVE(*pivot_position);
+      *pivot_position = ETL_MOVE(pivot);
+
+      return pivot_position;
+    }
+
+    //*************************************************************************
+    /// Swaps some elements to break up patterns that caused a bad partition.
+    //*************************************************************************
+    template <typename TIterator>
+    void break_patterns(TIterator first, TIterator last)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+      const difference_type size    = last - first;
+      const difference_type quarter = size / 4;
+
+      if (size >= Insertion_Sort_Threshold)
+      {
+        etl::iter_swap(first,    first + quarter);
+        etl::iter_swap(last - 1, last - quarter);
+
+        if (size > Ninther_Threshold)
+        {
+          etl::iter_swap(first + 1, first + (quarter + 1));
+          etl::iter_swap(first + 2, first + (quarter + 2));
+          etl::iter_swap(last - 2,  last - (quarter + 1));
+          etl::iter_swap(last - 3,  last - (quarter + 2));
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// The main sort loop.
+    /// Recurses into the smaller partition and loops on the larger, so the
+    /// stack depth is bounded by log2 of the length.
+    /// \param bad_allowed The number of unbalanced partitions allowed before
+    ///                    falling back to heap sort.
+    /// \param leftmost    'true' if there is no element before 'first'.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void sort(TIterator first, TIterator last, TCompare compare, int bad_allowed, bool leftmost)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+      while (true)
+      {
+        const difference_type size = last - first;
+
+        if (size < Insertion_Sort_Threshold)
+        {
+          if (leftmost)
+          {
+            private_pdq_sort::insertion_sort(first, last, compare);
+          }
+          else
+          {
+            private_pdq_sort::unguarded_insertion_sort(first, last, compare);
+          }
+
+          return;
+        }
+
+        // Move the chosen pivot to the start.
+        const difference_type half = size / 2;
+
+        if (size > Ninther_Threshold)
+        {
+          private_pdq_sort::sort3(first,              first + half,       last - 1,           compare);
+          private_pdq_sort::sort3(first + 1,          first + (half - 1), last - 2,           compare);
+          private_pdq_sort::sort3(first + 2,          first + (half + 1), last - 3,           compare);
+          private_pdq_sort::sort3(first + (half - 1), first + half,       first + (half + 1), compare);
+          etl::iter_swap(first, first + half);
+        }
+        else
+        {
+          private_pdq_sort::sort3(first + half, first, last - 1, compare);
+        }
+
+        // If the pivot equals the element before the range then all equal
+        // elements can be put to the left and need no further sorting.
+        if (!leftmost && !compare(*(first - 1), *first))
+        {
+          first = private_pdq_sort::partition_left(first, last, compare) + 1;
+          continue;
+        }
+
+        ETL_OR_STD::pair<TIterator, bool> partition = private_pdq_sort::partition_right(first, last, compare);
+
+        TIterator pivot_position = partition.first;
+
+        const difference_type left_size  = pivot_position - first;
+        const difference_type right_size = last - (pivot_position + 1);
+
+        if ((left_size < (size / 8)) || (right_size < (size / 8)))
+        {
+          // Too many bad partitions, so guarantee O(n log n).
+          if (--bad_allowed == 0)
+          {
+            etl::make_heap(first, last, compare);
+            etl::sort_heap(first, last, compare);
+            return;
+          }
+
+          private_pdq_sort::break_patterns(first, pivot_position);
+          private_pdq_sort::break_patterns(pivot_position + 1, last);
+        }
+        else if (partition.second &&
+                 private_pdq_sort::partial_insertion_sort(first, pivot_position, compare) &&
+                 private_pdq_sort::partial_insertion_sort(pivot_position + 1, last, compare))
+        {
+          // The range was already, or very nearly, sorted.
+          return;
+        }
+
+        if (left_size < right_size)
+        {
+          private_pdq_sort::sort(first, pivot_position, compare, bad_allowed, leftmost);
+          first    = pivot_position + 1;
+          leftmost = false;
+        }
+        else
+        {
+          private_pdq_sort::sort(pivot_position + 1, last, compare, bad_allowed, false);
+          last = pivot_position;
+        }
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using pattern defeating quicksort.
+  /// O(n log n) worst case, O(n) for sorted, reverse sorted and equal elements.
+  /// Falls back to heap sort if the partitions are repeatedly unbalanced.
+  /// Not stable.
+  /// Uses user defined comparison.
+  /// See https://github.com/orlp/pdqsort for more details.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void pdq_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(etl::is_random_access_iterator<TIterator>::value, "pdq_sort requires random access iterators");
+
+    if ((last - first) < 2)
+    {
+      return;
+    }
+
+    // Allow log2(n) bad partitions.
+    int bad_allowed = 0;
+
+    for (typename etl::iterator_traits<TIterator>::difference_type n = last - first; n > 0; n >>= 1)
+    {
+      ++bad_allowed;
+    }
+
+    private_pdq_sort::sort(first, last, compare, bad_allowed, true);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using pattern defeating quicksort.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void pdq_sort(TIterator first, TIterator last)
+  {
+    etl::pdq_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
   //***************************************************************************
   /// Returns the maximum value.
   //***************************************************************************
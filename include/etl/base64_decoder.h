@@ -41,6 +41,7 @@ SOFTWARE.
 #include "span.h"
 
 #include "base64.h"
+#include "private/base64_blocks.h"
 
 #include <stdint.h>
 
@@ -106,6 +107,8 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
+      input_begin = decode_groups(input_begin, input_end);
+
       while (input_begin != input_end)
       {
         if (!decode(*input_begin++))
@@ -126,6 +129,8 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
+      input_begin = decode_groups(input_begin, input_length);
+
       while (input_length-- != 0)
       {
         if (!decode(*input_begin++))
@@ -342,6 +347,75 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    // Decodes whole groups of input directly to the output buffer.
+    // Only contiguous input is decoded this way. The remainder, padding,
+    // invalid characters, or anything that would overflow the output buffer,
+    // is left for the per value path.
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14
+    TInputIterator decode_groups(TInputIterator input_begin, TInputIterator /*input_end*/)
+    {
+      return input_begin;
+    }
+
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14
+    TInputIterator decode_groups(TInputIterator input_begin, size_t& /*input_length*/)
+    {
+      return input_begin;
+    }
+
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14
+    T* decode_groups(T* input_begin, T* input_end)
+    {
+      size_t input_length = static_cast<size_t>(input_end - input_begin);
+
+      return decode_groups(input_begin, input_length);
+    }
+
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14
+    T* decode_groups(T* input_begin, size_t& input_length)
+    {
+      if ((input_buffer_length == 0U) && !padding_received && !error())
+      {
+        size_t groups = input_length / 4U;
+        size_t space  = (output_buffer_max_size - output_buffer_length) / 3U;
+
+        while ((groups != 0U) && (space != 0U))
+        {
+          const size_t count   = etl::min(groups, space);
+          const size_t decoded = private_base64::decode_groups(input_begin, count, p_output_buffer + output_buffer_length, encoder_table);
+
+          input_begin          += decoded * 4U;
+          input_length         -= decoded * 4U;
+          output_buffer_length += decoded * 3U;
+          groups               -= decoded;
+
+          if (callback.is_valid() && output_buffer_is_full())
+          {
+            callback(span());
+            reset_output_buffer();
+          }
+
+          if (decoded != count)
+          {
+            break;
+          }
+
+          space = (output_buffer_max_size - output_buffer_length) / 3U;
+        }
+      }
+
+      return input_begin;
+    }
+
     //*************************************************************************
     // Translates a sextet into an index 
     //*************************************************************************
@@ -349,12 +423,11 @@ namespace etl
     ETL_CONSTEXPR14
     uint32_t get_index_from_sextet(T sextet)
     {
-      const char* encoder_table_end = encoder_table + 64;
-      const char* p_sextet = etl::find(encoder_table, encoder_table_end, static_cast<char>(sextet));
+      const uint8_t index = private_base64::sextet(sextet, encoder_table);
 
-      if (p_sextet != encoder_table_end)
+      if (index != 0xFFU)
       {
-        return static_cast<uint32_t>(etl::distance(encoder_table, p_sextet));
+        return index;
       }
       else
       {
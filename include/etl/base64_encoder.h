@@ -41,6 +41,7 @@ SOFTWARE.
 #include "span.h"
 
 #include "base64.h"
+#include "private/base64_blocks.h"
 
 #include <stdint.h>
 
@@ -104,6 +105,8 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
+      input_begin = encode_groups(input_begin, input_length);
+
       while (input_length-- != 0)
       {
         if (!encode(*input_begin++))
@@ -124,6 +127,8 @@ namespace etl
     {
       ETL_STATIC_ASSERT(ETL_IS_ITERATOR_TYPE_8_BIT_INTEGRAL(TInputIterator), "Input type must be an 8 bit integral");
 
+      input_begin = encode_groups(input_begin, input_end);
+
       while (input_begin != input_end)
       {
         if (!encode(*input_begin++))
@@ -417,6 +422,70 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    // Encodes whole groups of input directly to the output buffer.
+    // Only contiguous input is encoded this way. The remainder, or anything
+    // that would overflow the output buffer, is left for the per value path.
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14
+    TInputIterator encode_groups(TInputIterator input_begin, TInputIterator /*input_end*/)
+    {
+      return input_begin;
+    }
+
+    //*************************************************************************
+    template <typename TInputIterator>
+    ETL_CONSTEXPR14
+    TInputIterator encode_groups(TInputIterator input_begin, size_t& /*input_length*/)
+    {
+      return input_begin;
+    }
+
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14
+    T* encode_groups(T* input_begin, T* input_end)
+    {
+      size_t input_length = static_cast<size_t>(input_end - input_begin);
+
+      return encode_groups(input_begin, input_length);
+    }
+
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14
+    T* encode_groups(T* input_begin, size_t& input_length)
+    {
+      if ((input_buffer_length == 0U) && !overflowed)
+      {
+        size_t groups = input_length / 3U;
+        size_t space  = (output_buffer_max_size - output_buffer_length) / 4U;
+
+        while ((groups != 0U) && (space != 0U))
+        {
+          const size_t count = etl::min(groups, space);
+
+          private_base64::encode_groups(input_begin, count, p_output_buffer + output_buffer_length, encoder_table);
+
+          input_begin          += count * 3U;
+          input_length         -= count * 3U;
+          output_buffer_length += count * 4U;
+          groups               -= count;
+
+          if (callback.is_valid() && output_buffer_is_full())
+          {
+            callback(span());
+            reset_output_buffer();
+          }
+
+          space = (output_buffer_max_size - output_buffer_length) / 4U;
+        }
+      }
+
+      return input_begin;
+    }
+
     //*************************************************************************
     // Push to the output buffer.
     //*************************************************************************
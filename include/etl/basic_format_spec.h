@@ -40,6 +40,20 @@ SOFTWARE.
 
 namespace etl
 {
+  //***************************************************************************
+  /// Floating point notations.
+  //***************************************************************************
+  struct float_notation
+  {
+    enum enum_type
+    {
+      fixed_precision,    ///< Fixed point with 'precision' fractional digits. The default.
+      shortest,           ///< Shortest round trip digits, fixed or scientific, whichever is shorter.
+      shortest_fixed,     ///< Shortest round trip digits, always fixed point.
+      shortest_scientific ///< Shortest round trip digits, always scientific.
+    };
+  };
+
   namespace private_basic_format_spec
   {
     //*******************************************************
@@ -122,6 +136,17 @@ namespace etl
       const bool show_base;
     };
 
+    //*********************************
+    struct notation_spec
+    {
+      ETL_CONSTEXPR notation_spec(etl::float_notation::enum_type notation_)
+        : notation(notation_)
+      {
+      }
+
+      const etl::float_notation::enum_type notation;
+    };
+
     //*********************************
     struct left_spec
     {
@@ -160,6 +185,12 @@ namespace etl
     return private_basic_format_spec::precision_spec(precision);
   }
 
+  //*********************************
+  static ETL_CONSTEXPR private_basic_format_spec::notation_spec setnotation(etl::float_notation::enum_type notation)
+  {
+    return private_basic_format_spec::notation_spec(notation);
+  }
+
   //*********************************
   static ETL_CONSTANT private_basic_format_spec::base_spec bin(2U);
 
@@ -196,6 +227,9 @@ namespace etl
   //*********************************
   static ETL_CONSTANT private_basic_format_spec::showbase_spec noshowbase(false);
 
+  //*********************************
+  static ETL_CONSTANT private_basic_format_spec::notation_spec shortest(etl::float_notation::shortest);
+
   //***************************************************************************
   /// basic_format_spec
   //***************************************************************************
@@ -216,6 +250,7 @@ namespace etl
       , boolalpha_(false)
       , show_base_(false)
       , fill_(typename TString::value_type(' '))
+      , notation_(etl::float_notation::fixed_precision)
     {
     }
 
@@ -229,7 +264,8 @@ namespace etl
                                     bool left_justified__,
                                     bool boolalpha__,
                                     bool show_base__,
-                                    typename TString::value_type fill__) ETL_NOEXCEPT
+                                    typename TString::value_type fill__,
+                                    etl::float_notation::enum_type notation__ = etl::float_notation::fixed_precision) ETL_NOEXCEPT
       : base_(base__)
       , width_(width__)
       , precision_(precision__)
@@ -238,6 +274,7 @@ namespace etl
       , boolalpha_(boolalpha__)
       , show_base_(show_base__)
       , fill_(fill__)
+      , notation_(notation__)
     {
     }
 
@@ -254,6 +291,7 @@ namespace etl
       boolalpha_      = false;
       show_base_      = false;
       fill_           = typename TString::value_type(' ');
+      notation_       = etl::float_notation::fixed_precision;
     }
 
     //***************************************************************************
@@ -432,6 +470,53 @@ namespace etl
       return precision_;
     }
 
+    //***************************************************************************
+    /// Sets the floating point notation.
+    /// \return A reference to the basic_format_spec.
+    //***************************************************************************
+    ETL_CONSTEXPR14 basic_format_spec& notation(etl::float_notation::enum_type n) ETL_LVALUE_REF_QUALIFIER ETL_NOEXCEPT
+    {
+      notation_ = n;
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    /// @overload
+    ETL_CONSTEXPR14 basic_format_spec&& notation(etl::float_notation::enum_type n) ETL_RVALUE_REF_QUALIFIER ETL_NOEXCEPT
+    {
+      notation_ = n;
+      return etl::move(*this);
+    }
+#endif
+
+    //***************************************************************************
+    /// Sets the shortest round trip floating point notation.
+    /// The precision is ignored.
+    /// \return A reference to the basic_format_spec.
+    //***************************************************************************
+    ETL_CONSTEXPR14 basic_format_spec& shortest() ETL_LVALUE_REF_QUALIFIER ETL_NOEXCEPT
+    {
+      notation_ = etl::float_notation::shortest;
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    /// @overload
+    ETL_CONSTEXPR14 basic_format_spec&& shortest() ETL_RVALUE_REF_QUALIFIER ETL_NOEXCEPT
+    {
+      notation_ = etl::float_notation::shortest;
+      return etl::move(*this);
+    }
+#endif
+
+    //***************************************************************************
+    /// Gets the floating point notation.
+    //***************************************************************************
+    ETL_CONSTEXPR etl::float_notation::enum_type get_notation() const ETL_NOEXCEPT
+    {
+      return notation_;
+    }
+
     //***************************************************************************
     /// Sets the upper case flag.
     /// \return A reference to the basic_format_spec.
@@ -579,7 +664,8 @@ namespace etl
              (lhs.left_justified_ == rhs.left_justified_) &&
              (lhs.boolalpha_ == rhs.boolalpha_) &&
              (lhs.show_base_ == rhs.show_base_) &&
-             (lhs.fill_ == rhs.fill_);
+             (lhs.fill_ == rhs.fill_) &&
+             (lhs.notation_ == rhs.notation_);
     }
 
     //***************************************************************************
@@ -599,6 +685,7 @@ namespace etl
     bool boolalpha_;
     bool show_base_;
     typename TString::value_type fill_;
+    etl::float_notation::enum_type notation_;
   };
 }
 
@@ -195,6 +195,15 @@ namespace etl
       return ss;
     }
 
+    //*********************************
+    /// etl::notation_spec from etl::setnotation & etl::shortest stream manipulators
+    //*********************************
+    friend basic_string_stream& operator <<(basic_string_stream& ss, etl::private_basic_format_spec::notation_spec fmt)
+    {
+      ss.format.notation(fmt.notation);
+      return ss;
+    }
+
     //*********************************
     /// etl::left_spec from etl::left stream manipulator
     //*********************************
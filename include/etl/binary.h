@@ -51,6 +51,17 @@ SOFTWARE.
   #include <bit>
 #endif
 
+//*****************************************************************************
+// The popcount builtin is only used where it maps to an instruction.
+// Elsewhere it becomes a library call, which is slower than the bit counting
+// below.
+//*****************************************************************************
+#if (ETL_USING_BUILTIN_POPCOUNT == 1) && (defined(__POPCNT__) || defined(__ARM_NEON))
+  #define ETL_USING_POPCOUNT_INSTRUCTION 1
+#else
+  #define ETL_USING_POPCOUNT_INSTRUCTION 0
+#endif
+
 namespace etl
 {
   //***************************************************************************
@@ -947,6 +958,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::popcount(value);
+#elif ETL_USING_POPCOUNT_INSTRUCTION == 1
+    return static_cast<uint_least8_t>(__builtin_popcountl(value));
 #else
     uint32_t count = 0U;
 
@@ -972,6 +985,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::popcount(value);
+#elif ETL_USING_POPCOUNT_INSTRUCTION == 1
+    return static_cast<uint_least8_t>(__builtin_popcountll(value));
 #else
     uint64_t count = 0U;
 
@@ -1197,6 +1212,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countr_zero(value);
+#elif ETL_USING_BUILTIN_CTZ == 1
+    return (value == 0U) ? uint_least8_t(32U) : static_cast<uint_least8_t>(__builtin_ctzl(value));
 #else
     uint_least8_t count = 0U;
 
@@ -1258,6 +1275,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countr_zero(value);
+#elif ETL_USING_BUILTIN_CTZ == 1
+    return (value == 0U) ? uint_least8_t(64U) : static_cast<uint_least8_t>(__builtin_ctzll(value));
 #else
       uint_least8_t count = 0U;
 
@@ -1683,6 +1702,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countl_zero(value);
+#elif ETL_USING_BUILTIN_CLZ == 1
+    return (value == 0U) ? uint_least8_t(32U) : static_cast<uint_least8_t>(__builtin_clzl(value) - (etl::integral_limits<unsigned long>::bits - 32U));
 #else
     uint_least8_t count = 0U;
 
@@ -1744,6 +1765,8 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countl_zero(value);
+#elif ETL_USING_BUILTIN_CLZ == 1
+    return (value == 0U) ? uint_least8_t(64U) : static_cast<uint_least8_t>(__builtin_clzll(value) - (etl::integral_limits<unsigned long long>::bits - 64U));
 #else
     uint_least8_t count = 0U;
 
@@ -1755,7 +1778,7 @@ namespace etl
     {
       count = 1U;
 
-      if ((value & 0xFFFFFFFFF0000000ULL) == 0U)
+      if ((value & 0xFFFFFFFF00000000ULL) == 0U)
       {
         value <<= 32U;
         count += 32U;
@@ -49,6 +49,7 @@ SOFTWARE.
 #include "error_handler.h"
 #include "span.h"
 #include "file_error_numbers.h"
+#include "spsc_policy.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -86,9 +87,26 @@ namespace etl
   //***************************************************************************
   /// The common base for a bip_buffer_spsc_atomic_base.
   //***************************************************************************
-  template <size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
-  class bip_buffer_spsc_atomic_base
+  template <size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE, typename TPolicy = etl::spsc_policy_compact>
+  class bip_buffer_spsc_atomic_base : protected etl::private_spsc::spsc_indexes<etl::atomic<typename etl::size_type_lookup<Memory_Model>::type>,
+                                                                                typename etl::size_type_lookup<Memory_Model>::type,
+                                                                                TPolicy::Padded>
   {
+  private:
+
+    typedef etl::private_spsc::spsc_indexes<etl::atomic<typename etl::size_type_lookup<Memory_Model>::type>,
+                                            typename etl::size_type_lookup<Memory_Model>::type,
+                                            TPolicy::Padded> indexes_t;
+
+    using indexes_t::read;
+    using indexes_t::write;
+    using indexes_t::Cached;
+    using indexes_t::producer_read_index;
+    using indexes_t::producer_reload_read_index;
+    using indexes_t::consumer_write_index;
+    using indexes_t::consumer_reload_write_index;
+    using indexes_t::reset_cached_indexes;
+
   public:
 
     /// The type used for determining the size of buffer.
@@ -185,9 +203,7 @@ namespace etl
     /// Constructs the buffer.
     //*************************************************************************
     bip_buffer_spsc_atomic_base(size_type reserved_)
-     : read(0)
-     , write(0)
-     , last(0)
+     : last(0)
      , Reserved(reserved_)
     {
     }
@@ -198,13 +214,94 @@ namespace etl
       read.store(0, etl::memory_order_release);
       write.store(0, etl::memory_order_release);
       last.store(0, etl::memory_order_release);
+      reset_cached_indexes();
     }
 
     //*************************************************************************
     size_type get_write_reserve(size_type* psize, size_type fallback_size = numeric_limits<size_type>::max())
+    {
+      size_type requested_size = *psize;
+      size_type windex = calculate_write_reserve(psize, fallback_size, producer_read_index());
+
+      if ((*psize < requested_size) && Cached)
+      {
+        // The cached read index may be out of date.
+        *psize = requested_size;
+        windex = calculate_write_reserve(psize, fallback_size, producer_reload_read_index());
+      }
+
+      return windex;
+    }
+
+    //*************************************************************************
+    void apply_write_reserve(size_type windex, size_type wsize)
+    {
+      if (wsize > 0)
+      {
+        size_type write_index = write.load(etl::memory_order_relaxed);
+        size_type read_index = producer_read_index();
+
+        // Wrapped around already
+        if (write_index < read_index)
+        {
+          ETL_ASSERT_OR_RETURN((windex == write_index) && ((wsize + 1) <= read_index), ETL_ERROR(bip_buffer_reserve_invalid));
+        }
+        // No wraparound so far, also not wrapping around with this block
+        else if (windex == write_index)
+        {
+          ETL_ASSERT_OR_RETURN(wsize <= (capacity() - write_index), ETL_ERROR(bip_buffer_reserve_invalid));
+
+          // Move both indexes forward
+          last.store(windex + wsize, etl::memory_order_release);
+        }
+        // Wrapping around now
+        else
+        {
+          ETL_ASSERT_OR_RETURN((windex == 0) && ((wsize + 1) <= read_index), ETL_ERROR(bip_buffer_reserve_invalid));
+
+          // Correct wrapping point
+          last.store(write_index, etl::memory_order_release);
+        }
+        
+        // Always update write index
+        write.store(windex + wsize, etl::memory_order_release);
+      }
+    }
+
+    //*************************************************************************
+    size_type get_read_reserve(size_type* psize)
+    {
+      size_type requested_size = *psize;
+      size_type rindex = calculate_read_reserve(psize, consumer_write_index());
+
+      if ((*psize < requested_size) && Cached)
+      {
+        // The cached write index may be out of date.
+        *psize = requested_size;
+        rindex = calculate_read_reserve(psize, consumer_reload_write_index());
+      }
+
+      return rindex;
+    }
+
+    //*************************************************************************
+    void apply_read_reserve(size_type rindex, size_type rsize)
+    {
+      if (rsize > 0)
+      {
+        size_type rsize_checker = rsize;
+        ETL_ASSERT_OR_RETURN((rindex == get_read_reserve(&rsize_checker)) && (rsize == rsize_checker), ETL_ERROR(bip_buffer_reserve_invalid));
+
+        read.store(rindex + rsize, etl::memory_order_release);
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    size_type calculate_write_reserve(size_type* psize, size_type fallback_size, size_type read_index)
     {
       size_type write_index = write.load(etl::memory_order_relaxed);
-      size_type read_index = read.load(etl::memory_order_acquire);
 
       // No wraparound
       if (write_index >= read_index)
@@ -257,45 +354,9 @@ namespace etl
     }
 
     //*************************************************************************
-    void apply_write_reserve(size_type windex, size_type wsize)
-    {
-      if (wsize > 0)
-      {
-        size_type write_index = write.load(etl::memory_order_relaxed);
-        size_type read_index = read.load(etl::memory_order_acquire);
-
-        // Wrapped around already
-        if (write_index < read_index)
-        {
-          ETL_ASSERT_OR_RETURN((windex == write_index) && ((wsize + 1) <= read_index), ETL_ERROR(bip_buffer_reserve_invalid));
-        }
-        // No wraparound so far, also not wrapping around with this block
-        else if (windex == write_index)
-        {
-          ETL_ASSERT_OR_RETURN(wsize <= (capacity() - write_index), ETL_ERROR(bip_buffer_reserve_invalid));
-
-          // Move both indexes forward
-          last.store(windex + wsize, etl::memory_order_release);
-        }
-        // Wrapping around now
-        else
-        {
-          ETL_ASSERT_OR_RETURN((windex == 0) && ((wsize + 1) <= read_index), ETL_ERROR(bip_buffer_reserve_invalid));
-
-          // Correct wrapping point
-          last.store(write_index, etl::memory_order_release);
-        }
-        
-        // Always update write index
-        write.store(windex + wsize, etl::memory_order_release);
-      }
-    }
-
-    //*************************************************************************
-    size_type get_read_reserve(size_type* psize)
+    size_type calculate_read_reserve(size_type* psize, size_type write_index)
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
-      size_type write_index = write.load(etl::memory_order_acquire);
 
       if (read_index > write_index)
       {
@@ -327,22 +388,6 @@ namespace etl
       return read_index;
     }
 
-    //*************************************************************************
-    void apply_read_reserve(size_type rindex, size_type rsize)
-    {
-      if (rsize > 0)
-      {
-        size_type rsize_checker = rsize;
-        ETL_ASSERT_OR_RETURN((rindex == get_read_reserve(&rsize_checker)) && (rsize == rsize_checker), ETL_ERROR(bip_buffer_reserve_invalid));
-
-        read.store(rindex + rsize, etl::memory_order_release);
-      }
-    }
-
-  private:
-
-    etl::atomic<size_type> read;
-    etl::atomic<size_type> write;
     etl::atomic<size_type> last;
     const size_type Reserved;
 
@@ -364,12 +409,12 @@ namespace etl
   //***************************************************************************
   /// A fixed capacity bipartite buffer.
   //***************************************************************************
-  template <typename T, const size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
-  class ibip_buffer_spsc_atomic : public bip_buffer_spsc_atomic_base<Memory_Model>
+  template <typename T, const size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE, typename TPolicy = etl::spsc_policy_compact>
+  class ibip_buffer_spsc_atomic : public bip_buffer_spsc_atomic_base<Memory_Model, TPolicy>
   {
   private:
 
-    typedef typename etl::bip_buffer_spsc_atomic_base<Memory_Model> base_t;
+    typedef typename etl::bip_buffer_spsc_atomic_base<Memory_Model, TPolicy> base_t;
     using base_t::reset;
     using base_t::get_read_reserve;
     using base_t::apply_read_reserve;
@@ -491,13 +536,14 @@ namespace etl
   /// \tparam T            The type this buffer should support.
   /// \tparam Size         The maximum capacity of the buffer.
   /// \tparam Memory_Model The memory model for the buffer. Determines the type of the internal counter variables.
+  /// \tparam TPolicy      The index layout policy. etl::spsc_policy_compact (default) or etl::spsc_policy_cached.
   //***************************************************************************
-  template <typename T, const size_t Size, const size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
-  class bip_buffer_spsc_atomic : public ibip_buffer_spsc_atomic<T, Memory_Model>
+  template <typename T, const size_t Size, const size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE, typename TPolicy = etl::spsc_policy_compact>
+  class bip_buffer_spsc_atomic : public ibip_buffer_spsc_atomic<T, Memory_Model, TPolicy>
   {
   private:
 
-    typedef typename etl::ibip_buffer_spsc_atomic<T, Memory_Model> base_t;
+    typedef typename etl::ibip_buffer_spsc_atomic<T, Memory_Model, TPolicy> base_t;
 
   public:
 
@@ -535,8 +581,8 @@ namespace etl
     etl::uninitialized_buffer_of<T, Reserved_Size> buffer;
   };
 
-  template <typename T, const size_t Size, const size_t Memory_Model> 
-  ETL_CONSTANT typename bip_buffer_spsc_atomic<T, Size, Memory_Model>::size_type bip_buffer_spsc_atomic<T, Size, Memory_Model>::Reserved_Size;
+  template <typename T, const size_t Size, const size_t Memory_Model, typename TPolicy> 
+  ETL_CONSTANT typename bip_buffer_spsc_atomic<T, Size, Memory_Model, TPolicy>::size_type bip_buffer_spsc_atomic<T, Size, Memory_Model, TPolicy>::Reserved_Size;
 }
 
 #endif /* ETL_HAS_ATOMIC && ETL_USING_CPP11 */
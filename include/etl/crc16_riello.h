@@ -73,6 +73,10 @@ namespace etl
   typedef etl::crc16_riello_t<256U> crc16_riello_t256;
   typedef etl::crc16_riello_t<16U>  crc16_riello_t16;
   typedef etl::crc16_riello_t<4U>   crc16_riello_t4;
+#if ETL_USING_CPP14
+  typedef etl::crc16_riello_t<2048U> crc16_riello_t2048;
+  typedef etl::crc16_riello_t<4096U> crc16_riello_t4096;
+#endif
   typedef crc16_riello_t256         crc16_riello;
 }
 #endif
@@ -73,6 +73,10 @@ namespace etl
   typedef etl::crc16_usb_t<256U> crc16_usb_t256;
   typedef etl::crc16_usb_t<16U>  crc16_usb_t16;
   typedef etl::crc16_usb_t<4U>   crc16_usb_t4;
+#if ETL_USING_CPP14
+  typedef etl::crc16_usb_t<2048U> crc16_usb_t2048;
+  typedef etl::crc16_usb_t<4096U> crc16_usb_t4096;
+#endif
   typedef crc16_usb_t256         crc16_usb;
 }
 #endif
@@ -73,6 +73,10 @@ namespace etl
   typedef etl::crc32_xfer_t<256U> crc32_xfer_t256;
   typedef etl::crc32_xfer_t<16U>  crc32_xfer_t16;
   typedef etl::crc32_xfer_t<4U>   crc32_xfer_t4;
+#if ETL_USING_CPP14
+  typedef etl::crc32_xfer_t<2048U> crc32_xfer_t2048;
+  typedef etl::crc32_xfer_t<4096U> crc32_xfer_t4096;
+#endif
   typedef crc32_xfer_t256         crc32_xfer;
 }
 #endif
@@ -111,4 +111,10 @@ SOFTWARE.
 #define ETL_SIGNAL_FILE_ID "78"
 #define ETL_FORMAT_FILE_ID "79"
 #define ETL_INPLACE_FUNCTION_FILE_ID "80"
+#define ETL_FLAT_HASH_MAP_FILE_ID "81"
+#define ETL_FLAT_HASH_SET_FILE_ID "82"
+#define ETL_RADIX_SORT_FILE_ID "83"
+#define ETL_SOA_FLAT_MAP_FILE_ID "84"
+#define ETL_SOA_FLAT_SET_FILE_ID "85"
+#define ETL_MAGAZINE_MEMORY_BLOCK_ALLOCATOR_FILE_ID "86"
 #endif
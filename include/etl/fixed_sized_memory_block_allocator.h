@@ -41,8 +41,11 @@ namespace etl
   //*************************************************************************
   /// The fixed sized memory block pool.
   /// The allocated memory blocks are all the same size.
+  /// The blocks are held in an etl::generic_pool by default. Supply an
+  /// etl::generic_pool_atomic with the same parameters, from pool_atomic.h,
+  /// to share the allocator between threads without a lock.
   //*************************************************************************
-  template <size_t VBlock_Size, size_t VAlignment, size_t VSize>
+  template <size_t VBlock_Size, size_t VAlignment, size_t VSize, typename TPool = etl::generic_pool<VBlock_Size, VAlignment, VSize> >
   class fixed_sized_memory_block_allocator : public imemory_block_allocator
   {
   public:
@@ -110,17 +113,17 @@ namespace etl
     };
 
     /// The generic pool from which allocate memory blocks.
-    etl::generic_pool<Block_Size, Alignment, Size> pool;
+    TPool pool;
   };
 
-  template <size_t VBlock_Size, size_t VAlignment, size_t VSize>
-  ETL_CONSTANT size_t fixed_sized_memory_block_allocator<VBlock_Size, VAlignment, VSize>::Block_Size;
+  template <size_t VBlock_Size, size_t VAlignment, size_t VSize, typename TPool>
+  ETL_CONSTANT size_t fixed_sized_memory_block_allocator<VBlock_Size, VAlignment, VSize, TPool>::Block_Size;
 
-  template <size_t VBlock_Size, size_t VAlignment, size_t VSize>
-  ETL_CONSTANT size_t fixed_sized_memory_block_allocator<VBlock_Size, VAlignment, VSize>::Alignment;
+  template <size_t VBlock_Size, size_t VAlignment, size_t VSize, typename TPool>
+  ETL_CONSTANT size_t fixed_sized_memory_block_allocator<VBlock_Size, VAlignment, VSize, TPool>::Alignment;
 
-  template <size_t VBlock_Size, size_t VAlignment, size_t VSize>
-  ETL_CONSTANT size_t fixed_sized_memory_block_allocator<VBlock_Size, VAlignment, VSize>::Size;
+  template <size_t VBlock_Size, size_t VAlignment, size_t VSize, typename TPool>
+  ETL_CONSTANT size_t fixed_sized_memory_block_allocator<VBlock_Size, VAlignment, VSize, TPool>::Size;
 }
 
 #endif
@@ -0,0 +1,703 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_HASH_MAP_INCLUDED
+#define ETL_FLAT_HASH_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "hash.h"
+#include "type_traits.h"
+#include "nth_type.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "placement_new.h"
+#include "initializer_list.h"
+
+#include "private/flat_hash_table.h"
+#include "private/comparator_is_transparent.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup flat_hash_map flat_hash_map
+/// An open addressing hash map with the capacity defined at compile time.
+/// Has the same interface as etl::unordered_map, except for the bucket interface.
+/// Elements are stored in a flat array and the buckets are searched sixteen
+/// at a time, using SSE2 or NEON where available.
+/// Define ETL_FLAT_HASH_NO_SIMD to use the portable implementation.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the flat_hash_map.
+  ///\ingroup flat_hash_map
+  //***************************************************************************
+  class flat_hash_map_exception : public etl::exception
+  {
+  public:
+
+    flat_hash_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the flat_hash_map.
+  ///\ingroup flat_hash_map
+  //***************************************************************************
+  class flat_hash_map_full : public etl::flat_hash_map_exception
+  {
+  public:
+
+    flat_hash_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::flat_hash_map_exception(ETL_ERROR_TEXT("flat_hash_map:full", ETL_FLAT_HASH_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the flat_hash_map.
+  ///\ingroup flat_hash_map
+  //***************************************************************************
+  class flat_hash_map_out_of_range : public etl::flat_hash_map_exception
+  {
+  public:
+
+    flat_hash_map_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::flat_hash_map_exception(ETL_ERROR_TEXT("flat_hash_map:range", ETL_FLAT_HASH_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Iterator exception for the flat_hash_map.
+  ///\ingroup flat_hash_map
+  //***************************************************************************
+  class flat_hash_map_iterator : public etl::flat_hash_map_exception
+  {
+  public:
+
+    flat_hash_map_iterator(string_type file_name_, numeric_type line_number_)
+      : etl::flat_hash_map_exception(ETL_ERROR_TEXT("flat_hash_map:iterator", ETL_FLAT_HASH_MAP_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_flat_hash
+  {
+    //*************************************************************************
+    /// Gets the key from a map element.
+    //*************************************************************************
+    template <typename TKey, typename TMapped>
+    struct map_key_of
+    {
+      static const TKey& get(const ETL_OR_STD::pair<const TKey, TMapped>& value)
+      {
+        return value.first;
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// The base class for specifically sized flat_hash_map.
+  /// Can be used as a reference type for all flat_hash_map containing a specific type.
+  ///\ingroup flat_hash_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class iflat_hash_map : public etl::private_flat_hash::flat_hash_table<ETL_OR_STD::pair<const TKey, T>,
+                                                                        TKey,
+                                                                        etl::private_flat_hash::map_key_of<TKey, T>,
+                                                                        THash,
+                                                                        TKeyEqual>
+  {
+  private:
+
+    typedef etl::private_flat_hash::flat_hash_table<ETL_OR_STD::pair<const TKey, T>,
+                                                    TKey,
+                                                    etl::private_flat_hash::map_key_of<TKey, T>,
+                                                    THash,
+                                                    TKeyEqual> base;
+
+  public:
+
+    typedef typename base::value_type      value_type;
+    typedef TKey                           key_type;
+    typedef T                              mapped_type;
+    typedef THash                          hasher;
+    typedef TKeyEqual                      key_equal;
+    typedef typename base::reference       reference;
+    typedef typename base::const_reference const_reference;
+#if ETL_USING_CPP11
+    typedef typename base::rvalue_reference rvalue_reference;
+#endif
+    typedef typename base::pointer         pointer;
+    typedef typename base::const_pointer   const_pointer;
+    typedef typename base::size_type       size_type;
+    typedef typename base::difference_type difference_type;
+    typedef typename base::iterator        iterator;
+    typedef typename base::const_iterator  const_iterator;
+
+    typedef const key_type&    const_key_reference;
+#if ETL_USING_CPP11
+    typedef key_type&&         rvalue_key_reference;
+#endif
+    typedef mapped_type&       mapped_reference;
+    typedef const mapped_type& const_mapped_reference;
+
+    using base::find;
+    using base::end;
+    using base::full;
+    using base::max_size;
+    using base::clear;
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits flat_hash_map_full if a new key is added to a full map.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator [](rvalue_key_reference key)
+    {
+      const size_t hash  = this->hash_key(key);
+      size_t       index = this->find_index(key, hash);
+
+      if (index == this->bucket_count())
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(flat_hash_map_full));
+
+        index = this->find_insert_index(hash);
+        ::new (this->slot_address(index)) value_type(etl::move(key), mapped_type());
+        this->set_full(index, hash);
+      }
+
+      return this->slot(index).second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits flat_hash_map_full if a new key is added to a full map.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator [](const_key_reference key)
+    {
+      const size_t hash  = this->hash_key(key);
+      size_t       index = this->find_index(key, hash);
+
+      if (index == this->bucket_count())
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(flat_hash_map_full));
+
+        index = this->find_insert_index(hash);
+        ::new (this->slot_address(index)) value_type(key, mapped_type());
+        this->set_full(index, hash);
+      }
+
+      return this->slot(index).second;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits flat_hash_map_full if a new key is added to a full map.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    mapped_reference operator [](const K& key)
+    {
+      const size_t hash  = this->hash_key(key);
+      size_t       index = this->find_index(key, hash);
+
+      if (index == this->bucket_count())
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(flat_hash_map_full));
+
+        index = this->find_insert_index(hash);
+        ::new (this->slot_address(index)) value_type(key_type(key), mapped_type());
+        this->set_full(index, hash);
+      }
+
+      return this->slot(index).second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::flat_hash_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference at(const_key_reference key)
+    {
+      iterator itr = find(key);
+
+      ETL_ASSERT(itr != end(), ETL_ERROR(flat_hash_map_out_of_range));
+
+      return itr->second;
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::flat_hash_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const_mapped_reference at(const_key_reference key) const
+    {
+      const_iterator itr = find(key);
+
+      ETL_ASSERT(itr != end(), ETL_ERROR(flat_hash_map_out_of_range));
+
+      return itr->second;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::flat_hash_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    mapped_reference at(const K& key)
+    {
+      iterator itr = find(key);
+
+      ETL_ASSERT(itr != end(), ETL_ERROR(flat_hash_map_out_of_range));
+
+      return itr->second;
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::flat_hash_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+    const_mapped_reference at(const K& key) const
+    {
+      const_iterator itr = find(key);
+
+      ETL_ASSERT(itr != end(), ETL_ERROR(flat_hash_map_out_of_range));
+
+      return itr->second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Assigns values to the flat_hash_map.
+    /// If asserts or exceptions are enabled, emits flat_hash_map_full if the flat_hash_map does not have enough free space.
+    /// If asserts or exceptions are enabled, emits flat_hash_map_iterator if the iterators are reversed.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first_, TIterator last_)
+    {
+#if ETL_IS_DEBUG_BUILD
+      difference_type d = etl::distance(first_, last_);
+      ETL_ASSERT(d >= 0, ETL_ERROR(flat_hash_map_iterator));
+      ETL_ASSERT(size_t(d) <= max_size(), ETL_ERROR(flat_hash_map_full));
+#endif
+
+      clear();
+
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_map.
+    /// If asserts or exceptions are enabled, emits flat_hash_map_full if the flat_hash_map is already full.
+    ///\param key_value_pair The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference key_value_pair)
+    {
+      const size_t hash  = this->hash_key(key_value_pair.first);
+      size_t       index = this->find_index(key_value_pair.first, hash);
+
+      if (index != this->bucket_count())
+      {
+        return ETL_OR_STD::pair<iterator, bool>(this->make_iterator(index), false);
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(flat_hash_map_full), (ETL_OR_STD::pair<iterator, bool>(end(), false)));
+
+      index = this->find_insert_index(hash);
+      ::new (this->slot_address(index)) value_type(key_value_pair);
+      this->set_full(index, hash);
+
+      return ETL_OR_STD::pair<iterator, bool>(this->make_iterator(index), true);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_map.
+    /// If asserts or exceptions are enabled, emits flat_hash_map_full if the flat_hash_map is already full.
+    ///\param key_value_pair The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference key_value_pair)
+    {
+      const size_t hash  = this->hash_key(key_value_pair.first);
+      size_t       index = this->find_index(key_value_pair.first, hash);
+
+      if (index != this->bucket_count())
+      {
+        return ETL_OR_STD::pair<iterator, bool>(this->make_iterator(index), false);
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(flat_hash_map_full), (ETL_OR_STD::pair<iterator, bool>(end(), false)));
+
+      index = this->find_insert_index(hash);
+      ::new (this->slot_address(index)) value_type(etl::move(key_value_pair));
+      this->set_full(index, hash);
+
+      return ETL_OR_STD::pair<iterator, bool>(this->make_iterator(index), true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_map.
+    /// If asserts or exceptions are enabled, emits flat_hash_map_full if the flat_hash_map is already full.
+    ///\param position The position to insert at. Ignored.
+    ///\param key_value_pair The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const_reference key_value_pair)
+    {
+      return insert(key_value_pair).first;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the flat_hash_map.
+    /// If asserts or exceptions are enabled, emits flat_hash_map_full if the flat_hash_map is already full.
+    ///\param position The position to insert at. Ignored.
+    ///\param key_value_pair The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, rvalue_reference key_value_pair)
+    {
+      return insert(etl::move(key_value_pair)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the flat_hash_map.
+    /// If asserts or exceptions are enabled, emits flat_hash_map_full if the flat_hash_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first_, TIterator last_)
+    {
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iflat_hash_map& operator = (const iflat_hash_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->set_functions(rhs.hash_function(), rhs.key_eq());
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iflat_hash_map& operator = (iflat_hash_map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        clear();
+        this->set_functions(rhs.hash_function(), rhs.key_eq());
+        this->move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iflat_hash_map(int8_t* pctrl_, pointer pslots_, size_t number_of_groups_, size_t maximum_size_, hasher key_hash_function_, key_equal key_equal_function_)
+      : base(pctrl_, pslots_, number_of_groups_, maximum_size_, key_hash_function_, key_equal_function_)
+    {
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move from a range
+    //*************************************************************************
+    void move(iterator b, iterator e)
+    {
+      while (b != e)
+      {
+        insert(etl::move(*b));
+        ++b;
+      }
+    }
+#endif
+
+  private:
+
+    // Disable copy construction.
+    iflat_hash_map(const iflat_hash_map&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_FLAT_HASH_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iflat_hash_map()
+    {
+    }
+#else
+  protected:
+    ~iflat_hash_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first flat_hash_map.
+  ///\param rhs Reference to the second flat_hash_map.
+  ///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+  ///\ingroup flat_hash_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash, typename TKeyEqual>
+  bool operator ==(const etl::iflat_hash_map<TKey, T, THash, TKeyEqual>& lhs,
+                   const etl::iflat_hash_map<TKey, T, THash, TKeyEqual>& rhs)
+  {
+    if (lhs.size() != rhs.size())
+    {
+      return false;
+    }
+
+    typedef typename etl::iflat_hash_map<TKey, T, THash, TKeyEqual>::const_iterator itr_t;
+
+    for (itr_t l_itr = lhs.begin(); l_itr != lhs.end(); ++l_itr)
+    {
+      // See if the lhs key exists in the rhs.
+      itr_t r_itr = rhs.find(l_itr->first);
+
+      if ((r_itr == rhs.end()) || !(r_itr->second == l_itr->second))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first flat_hash_map.
+  ///\param rhs Reference to the second flat_hash_map.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup flat_hash_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash, typename TKeyEqual>
+  bool operator !=(const etl::iflat_hash_map<TKey, T, THash, TKeyEqual>& lhs,
+                   const etl::iflat_hash_map<TKey, T, THash, TKeyEqual>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated flat_hash_map implementation that uses a fixed size buffer.
+  //*************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class flat_hash_map : public etl::iflat_hash_map<TKey, TValue, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iflat_hash_map<TKey, TValue, THash, TKeyEqual> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE    = MAX_SIZE_;
+    static ETL_CONSTANT size_t MAX_GROUPS  = etl::private_flat_hash::number_of_groups<MAX_SIZE_>::value;
+    static ETL_CONSTANT size_t MAX_BUCKETS = MAX_GROUPS * etl::private_flat_hash::group_width::value;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    flat_hash_map(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(ctrl, reinterpret_cast<typename base::pointer>(&slots), MAX_GROUPS, MAX_SIZE_, hash, equal)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    flat_hash_map(const flat_hash_map& other)
+      : base(ctrl, reinterpret_cast<typename base::pointer>(&slots), MAX_GROUPS, MAX_SIZE_, other.hash_function(), other.key_eq())
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    flat_hash_map(flat_hash_map&& other)
+      : base(ctrl, reinterpret_cast<typename base::pointer>(&slots), MAX_GROUPS, MAX_SIZE_, other.hash_function(), other.key_eq())
+    {
+      if (this != &other)
+      {
+        base::move(other.begin(), other.end());
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_hash_map(TIterator first_, TIterator last_, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(ctrl, reinterpret_cast<typename base::pointer>(&slots), MAX_GROUPS, MAX_SIZE_, hash, equal)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    flat_hash_map(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(ctrl, reinterpret_cast<typename base::pointer>(&slots), MAX_GROUPS, MAX_SIZE_, hash, equal)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~flat_hash_map()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    flat_hash_map& operator = (const flat_hash_map& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    flat_hash_map& operator = (flat_hash_map&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The control bytes.
+    int8_t ctrl[MAX_BUCKETS];
+
+    /// The storage for the elements.
+    typename etl::aligned_storage<sizeof(typename base::value_type) * MAX_BUCKETS, etl::alignment_of<typename base::value_type>::value>::type slots;
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t flat_hash_map<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_SIZE;
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t flat_hash_map<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_GROUPS;
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t flat_hash_map<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_BUCKETS;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... TPairs>
+  flat_hash_map(TPairs...) -> flat_hash_map<typename etl::nth_type_t<0, TPairs...>::first_type,
+                                            typename etl::nth_type_t<0, TPairs...>::second_type,
+                                            sizeof...(TPairs)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename... TPairs>
+  constexpr auto make_flat_hash_map(TPairs&&... pairs) -> etl::flat_hash_map<TKey, T, sizeof...(TPairs), THash, TKeyEqual>
+  {
+    return { etl::forward<TPairs>(pairs)... };
+  }
+#endif
+}
+
+#endif
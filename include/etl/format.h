@@ -40,6 +40,8 @@ SOFTWARE.
 #include "limits.h"
 #include "math.h"
 #include "optional.h"
+#include "private/decimal_digits.h"
+#include "private/floating_point_shortest.h"
 #include "span.h"
 #include "string.h"
 #include "string_view.h"
@@ -74,39 +76,657 @@ namespace etl
     }
   };
 
+  namespace private_format
+  {
+    //*************************************************************************
+    /// The category of a format argument, as far as the presentation type
+    /// validation of a format string is concerned.
+    //*************************************************************************
+    enum class arg_category : char
+    {
+      Other,
+      Bool,
+      Char,
+      Integer,
+      Float,
+      String,
+      Pointer
+    };
+
+    template<class T, class D = typename etl::decay<T>::type>
+    ETL_CONSTEXPR arg_category category_of()
+    {
+      return etl::is_same<D, bool>::value ? arg_category::Bool :
+             (etl::is_same<D, char>::value || etl::is_same<D, signed char>::value || etl::is_same<D, unsigned char>::value) ? arg_category::Char :
+             etl::is_integral<D>::value ? arg_category::Integer :
+             etl::is_floating_point<D>::value ? arg_category::Float :
+             (etl::is_same<D, const char*>::value || etl::is_same<D, char*>::value ||
+              etl::is_same<D, etl::string_view>::value || etl::is_base_of<etl::ibasic_string<char>, D>::value) ? arg_category::String :
+             etl::is_pointer<D>::value ? arg_category::Pointer :
+             arg_category::Other;
+    }
+
+    //*************************************************************************
+    /// One replacement field of a compiled format string.
+    /// literal_begin/literal_length describe the text preceding the field.
+    //*************************************************************************
+    struct compiled_field
+    {
+      enum
+      {
+        Literal_Escaped  = 0x01, // The preceding literal contains '{{' or '}}'
+        Has_Width        = 0x02,
+        Width_Nested     = 0x04,
+        Has_Precision    = 0x08,
+        Precision_Nested = 0x10,
+        Hash             = 0x20,
+        Zero             = 0x40,
+        Locale           = 0x80
+      };
+
+      uint16_t literal_begin{0};
+      uint16_t literal_length{0};
+      uint16_t width{0};     // The arg index if Width_Nested
+      uint16_t precision{0}; // The arg index if Precision_Nested
+      uint8_t  index{0};
+      uint8_t  flags{0};
+      char     align{0};     // '<' / '>' / '^' / 0 (none)
+      char     fill{' '};
+      char     sign{0};      // '+' / '-' / ' ' / 0 (none)
+      char     type{0};      // 0 if none
+    };
+
+    //*************************************************************************
+    /// A format string parsed into a table of literals and replacement fields.
+    /// If the format string does not fit the table, 'compiled' is false and
+    /// the string is parsed at run time instead.
+    //*************************************************************************
+    template<size_t Max_Fields>
+    struct compiled_format
+    {
+      static ETL_CONSTANT size_t Capacity = (Max_Fields == 0U) ? 1U : Max_Fields;
+
+      compiled_field fields[Capacity]{};
+      size_t   n_fields{0};
+      uint16_t tail_begin{0};
+      uint16_t tail_length{0};
+      bool     tail_escaped{false};
+      bool     valid{false};
+      bool     compiled{false};
+    };
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    /// Compile time format string parser.
+    /// Mirrors the run time parser in vformat_to(), including the order in
+    /// which argument ids are claimed, so that both accept the same strings.
+    //*************************************************************************
+    class format_compiler
+    {
+    public:
+
+      ETL_CONSTEXPR14 format_compiler(const char* fmt_, size_t length_, const arg_category* categories_, size_t n_args_)
+        : fmt(fmt_)
+        , length(length_)
+        , categories(categories_)
+        , n_args(n_args_)
+        , pos(0)
+        , current(0)
+        , automatic_mode(false)
+        , manual_mode(false)
+        , fits(true)
+      {
+      }
+
+      //***********************************************************************
+      template<size_t Max_Fields>
+      ETL_CONSTEXPR14 compiled_format<Max_Fields> compile()
+      {
+        compiled_format<Max_Fields> result{};
+
+        size_t literal_begin = 0;
+        bool   escaped = false;
+
+        fits = (length <= 0xFFFFU);
+
+        while (pos < length)
+        {
+          const char c = fmt[pos];
+
+          if ((c == '{') || (c == '}'))
+          {
+            if (((pos + 1) < length) && (fmt[pos + 1] == c))
+            {
+              // Escaped '{{' or '}}'
+              escaped = true;
+              pos += 2;
+              continue;
+            }
+
+            if (c == '}')
+            {
+              // '}' without '{'
+              return result;
+            }
+
+            compiled_field field{};
+            field.literal_begin  = static_cast<uint16_t>(literal_begin);
+            field.literal_length = static_cast<uint16_t>(pos - literal_begin);
+            field.flags          = escaped ? static_cast<uint8_t>(compiled_field::Literal_Escaped) : static_cast<uint8_t>(0U);
+
+            ++pos;
+
+            if (!parse_field(field))
+            {
+              return result;
+            }
+
+            if (result.n_fields < Max_Fields)
+            {
+              result.fields[result.n_fields] = field;
+              ++result.n_fields;
+            }
+            else
+            {
+              fits = false;
+            }
+
+            literal_begin = pos;
+            escaped       = false;
+          }
+          else
+          {
+            ++pos;
+          }
+        }
+
+        result.tail_begin   = static_cast<uint16_t>(literal_begin);
+        result.tail_length  = static_cast<uint16_t>(length - literal_begin);
+        result.tail_escaped = escaped;
+        result.valid        = true;
+        result.compiled     = fits;
+
+        return result;
+      }
+
+    private:
+
+      //***********************************************************************
+      static ETL_CONSTEXPR14 bool is_digit(char c)
+      {
+        return (c >= '0') && (c <= '9');
+      }
+
+      //***********************************************************************
+      static ETL_CONSTEXPR14 bool is_align(char c)
+      {
+        return (c == '<') || (c == '>') || (c == '^');
+      }
+
+      //***********************************************************************
+      static ETL_CONSTEXPR14 bool is_one_of(char c, const char* chars)
+      {
+        while (*chars != 0)
+        {
+          if (*chars == c)
+          {
+            return true;
+          }
+
+          ++chars;
+        }
+
+        return false;
+      }
+
+      //***********************************************************************
+      ETL_CONSTEXPR14 bool at(char c) const
+      {
+        return (pos < length) && (fmt[pos] == c);
+      }
+
+      //***********************************************************************
+      /// Parses an optional number. Returns false on overflow.
+      //***********************************************************************
+      ETL_CONSTEXPR14 bool parse_num(bool& found, size_t& value)
+      {
+        found = false;
+        value = 0;
+
+        while ((pos < length) && is_digit(fmt[pos]))
+        {
+          const size_t new_value = (value * 10U) + static_cast<size_t>(fmt[pos] - '0');
+
+          if (new_value < value)
+          {
+            return false;
+          }
+
+          value = new_value;
+          found = true;
+          ++pos;
+        }
+
+        return true;
+      }
+
+      //***********************************************************************
+      ETL_CONSTEXPR14 bool next_arg_id(size_t& id)
+      {
+        if (manual_mode || (current >= n_args))
+        {
+          return false;
+        }
+
+        automatic_mode = true;
+        id = current++;
+
+        return true;
+      }
+
+      //***********************************************************************
+      ETL_CONSTEXPR14 bool check_arg_id(size_t id)
+      {
+        if (automatic_mode || (id >= n_args))
+        {
+          return false;
+        }
+
+        manual_mode = true;
+
+        return true;
+      }
+
+      //***********************************************************************
+      /// Parses '{}' or '{n}' for a nested width or precision.
+      //***********************************************************************
+      ETL_CONSTEXPR14 bool parse_nested(bool& found, size_t& id)
+      {
+        found = false;
+
+        if (!at('{'))
+        {
+          return true;
+        }
+
+        ++pos;
+
+        bool   has_num = false;
+        size_t num     = 0;
+
+        if (!parse_num(has_num, num))
+        {
+          return false;
+        }
+
+        if (!at('}'))
+        {
+          return false;
+        }
+
+        ++pos;
+
+        if (has_num)
+        {
+          id = num;
+
+          if (!check_arg_id(id))
+          {
+            return false;
+          }
+        }
+        else if (!next_arg_id(id))
+        {
+          return false;
+        }
+
+        found = true;
+
+        return true;
+      }
+
+      //***********************************************************************
+      ETL_CONSTEXPR14 uint16_t narrow(size_t value)
+      {
+        if (value > 0xFFFFU)
+        {
+          fits = false;
+        }
+
+        return static_cast<uint16_t>(value);
+      }
+
+      //***********************************************************************
+      /// Parses the replacement field following '{', up to and including '}'.
+      //***********************************************************************
+      ETL_CONSTEXPR14 bool parse_field(compiled_field& field)
+      {
+        bool   has_index = false;
+        size_t index     = 0;
+        bool   has_precision = false;
+
+        if (!parse_num(has_index, index))
+        {
+          return false;
+        }
+
+        if (at(':'))
+        {
+          ++pos;
+
+          // Fill and align
+          if ((pos < length) && is_align(fmt[pos]))
+          {
+            field.align = fmt[pos];
+            ++pos;
+          }
+          else if (((pos + 1) < length) && is_align(fmt[pos + 1]))
+          {
+            if ((fmt[pos] == '{') || (fmt[pos] == '}'))
+            {
+              return false;
+            }
+
+            field.fill  = fmt[pos];
+            field.align = fmt[pos + 1];
+            pos += 2;
+          }
+
+          // Sign
+          if ((pos < length) && is_one_of(fmt[pos], "+- "))
+          {
+            field.sign = fmt[pos];
+            ++pos;
+          }
+
+          if (at('#'))
+          {
+            field.flags |= compiled_field::Hash;
+            ++pos;
+          }
+
+          if (at('0'))
+          {
+            field.flags |= compiled_field::Zero;
+            ++pos;
+          }
+
+          // Width
+          bool   found = false;
+          size_t value = 0;
+
+          if (!parse_num(found, value))
+          {
+            return false;
+          }
+
+          if (found)
+          {
+            field.flags |= compiled_field::Has_Width;
+          }
+          else
+          {
+            if (!parse_nested(found, value))
+            {
+              return false;
+            }
+
+            if (found)
+            {
+              field.flags |= (compiled_field::Has_Width | compiled_field::Width_Nested);
+            }
+          }
+
+          field.width = narrow(value);
+
+          // Precision
+          if (at('.'))
+          {
+            ++pos;
+
+            if (!parse_num(found, value))
+            {
+              return false;
+            }
+
+            if (found)
+            {
+              field.flags |= compiled_field::Has_Precision;
+            }
+            else
+            {
+              if (!parse_nested(found, value))
+              {
+                return false;
+              }
+
+              if (found)
+              {
+                field.flags |= (compiled_field::Has_Precision | compiled_field::Precision_Nested);
+              }
+            }
+
+            has_precision = found;
+            field.precision = narrow(value);
+          }
+
+          if (at('L'))
+          {
+            field.flags |= compiled_field::Locale;
+            ++pos;
+          }
+
+          // Presentation type
+          if ((pos < length) && is_one_of(fmt[pos], "s?bBcdoxXaAeEfFgGpP"))
+          {
+            field.type = fmt[pos];
+            ++pos;
+          }
+        }
+
+        // The argument id is claimed after any nested ones, as at run time.
+        if (has_index)
+        {
+          if (!check_arg_id(index))
+          {
+            return false;
+          }
+        }
+        else if (!next_arg_id(index))
+        {
+          return false;
+        }
+
+        if (index > 0xFFU)
+        {
+          fits = false;
+        }
+
+        field.index = static_cast<uint8_t>(index);
+
+        if (!at('}'))
+        {
+          return false;
+        }
+
+        ++pos;
+
+        return check_type(field, categories[index], has_precision);
+      }
+
+      //***********************************************************************
+      /// Checks the presentation type against the type of the argument.
+      //***********************************************************************
+      static ETL_CONSTEXPR14 bool check_type(const compiled_field& field, arg_category category, bool has_precision)
+      {
+        const char type = field.type;
+
+        switch (category)
+        {
+          case arg_category::Bool:
+          {
+            return (type == 0) || is_one_of(type, "sbBdoxX");
+          }
+
+          case arg_category::Char:
+          {
+            if ((type == 0) || (type == 'c') || (type == '?'))
+            {
+              const bool plain = ((field.sign == 0) || (field.sign == '-')) &&
+                                 ((field.flags & (compiled_field::Hash | compiled_field::Zero)) == 0) &&
+                                 !has_precision;
+              return plain;
+            }
+
+            return is_one_of(type, "bBdoxX");
+          }
+
+          case arg_category::Integer:
+          {
+            return !has_precision && ((type == 0) || is_one_of(type, "bBcdoxX"));
+          }
+
+          case arg_category::Float:
+          {
+            return (type == 0) || is_one_of(type, "aAeEfFgG");
+          }
+
+          case arg_category::String:
+          {
+            return (type == 0) || (type == 's') || (type == '?');
+          }
+
+          case arg_category::Pointer:
+          {
+            return (type == 0) || (type == 'p') || (type == 'P');
+          }
+
+          case arg_category::Other:
+          default:
+          {
+            return true;
+          }
+        }
+      }
+
+      const char*         fmt;
+      size_t              length;
+      const arg_category* categories;
+      size_t              n_args;
+      size_t              pos;
+      size_t              current;
+      bool                automatic_mode;
+      bool                manual_mode;
+      bool                fits;
+    };
+#endif
+  }
+
+  //***************************************************************************
+  /// Wraps a format string that is only checked at run time.
+  /// Equivalent to std::runtime_format.
+  //***************************************************************************
+  class runtime_format_string
+  {
+  public:
+
+    ETL_CONSTEXPR explicit runtime_format_string(etl::string_view fmt)
+      : _sv(fmt)
+    {
+    }
+
+    ETL_CONSTEXPR string_view get() const
+    {
+      return _sv;
+    }
+
+  private:
+
+    string_view _sv;
+  };
+
+  //***************************************************************************
+  /// Returns a format string that is parsed at run time only.
+  //***************************************************************************
+  inline runtime_format_string runtime_format(etl::string_view fmt)
+  {
+    return runtime_format_string(fmt);
+  }
+
+  //***************************************************************************
+  /// Parses the format string for the argument types.
+  //***************************************************************************
   template<class... Args>
-  ETL_CONSTEXPR14 bool check_f(const char* fmt)
+  ETL_CONSTEXPR14 private_format::compiled_format<sizeof...(Args)> compile_f(etl::string_view fmt)
   {
-    // to be implemented later
-    //return fmt[0] == 0; // actual check
+#if ETL_USING_CPP14
+    const private_format::arg_category categories[sizeof...(Args) + 1U] = { private_format::category_of<Args>()..., private_format::arg_category::Other };
+
+    private_format::format_compiler compiler(fmt.data(), fmt.size(), categories, sizeof...(Args));
 
+    return compiler.template compile<sizeof...(Args)>();
+#else
+    // No compile time parsing. Validated at run time.
     (void)fmt;
-    return true;
+    private_format::compiled_format<sizeof...(Args)> result{};
+    result.valid = true;
+    return result;
+#endif
+  }
+
+  //***************************************************************************
+  /// Checks the format string for the argument types.
+  //***************************************************************************
+  template<class... Args>
+  ETL_CONSTEXPR14 bool check_f(const char* fmt)
+  {
+    return compile_f<Args...>(etl::string_view(fmt)).valid;
   }
 
   inline void please_note_this_is_error_message_1() noexcept {}
 
+  //***************************************************************************
+  /// A format string, checked and parsed into a table of fields when
+  /// constructed in a constant expression. This is always the case from
+  /// C++20. For C++14 and C++17 declare the format string constexpr; if it
+  /// is constructed at run time it is parsed while formatting, as before.
+  //***************************************************************************
   template<class... Args>
   struct basic_format_string
   {
+#if ETL_USING_CPP20
     inline ETL_CONSTEVAL basic_format_string(const char* fmt)
     : _sv(fmt)
+    , _compiled(compile_f<Args...>(_sv))
     {
-      bool format_string_ok = check_f(fmt);
-
-      if (!format_string_ok)
+      if (!_compiled.valid)
+      {
+        // calling a non-constexpr function in a consteval context to trigger a compile error
+        please_note_this_is_error_message_1();
+      }
+    }
+#else
+    inline ETL_CONSTEXPR14 basic_format_string(const char* fmt)
+    : _sv(fmt)
+    , _compiled()
+    {
+      if (etl::is_constant_evaluated())
       {
-        //if (etl::is_constant_evaluated()) // compile time error path
-        //{
-        //  // calling a non-constexpr function in a consteval context to trigger a compile error
-        //  please_note_this_is_error_message_1();
-        //}
-        //else // run time error path
-        //{
+        _compiled = compile_f<Args...>(_sv);
+
+        if (!_compiled.valid)
+        {
           ETL_ASSERT_FAIL_AND_RETURN(ETL_ERROR(bad_format_string_exception));
-        //}
+        }
       }
     }
+#endif
+
+    basic_format_string(const runtime_format_string& fmt)
+    : _sv(fmt.get())
+    , _compiled()
+    {
+    }
 
     ETL_CONSTEXPR basic_format_string(const basic_format_string& other) = default;
     ETL_CONSTEXPR14 basic_format_string& operator=(const basic_format_string& other) = default;
@@ -116,8 +736,18 @@ namespace etl
       return _sv;
     }
 
+    //*************************************************************************
+    /// The parsed format string. Only usable if compiled().valid and
+    /// compiled().compiled are both true.
+    //*************************************************************************
+    ETL_CONSTEXPR const private_format::compiled_format<sizeof...(Args)>& compiled() const
+    {
+      return _compiled;
+    }
+
   private:
     string_view _sv;
+    private_format::compiled_format<sizeof...(Args)> _compiled;
   };
 
   template<class... Args>
@@ -1001,6 +1631,25 @@ namespace etl
       UnsignedT unsigned_value = etl::absolute_unsigned(value);
 
       size_t base = base_from_spec<default_base>(spec);
+
+      if ((width == 0) && (base == 10) && !skip_last_zeros)
+      {
+        // Decimal digits are written backwards into a buffer, two at a time.
+        typedef typename etl::private_decimal::work_type<UnsignedT>::type work_t;
+
+        char buffer[20];
+        char* const end = buffer + sizeof(buffer);
+        const char* p   = etl::private_decimal::write_digits_backward(end, static_cast<work_t>(unsigned_value));
+
+        while (p != end)
+        {
+          *it = static_cast<char_type>(*p++);
+          ++it;
+        }
+
+        return;
+      }
+
       UnsignedT highest_digit = get_highest_digit<UnsignedT>(unsigned_value, base);
       if (width > 0)
       {
@@ -1354,6 +2003,19 @@ namespace etl
       }
     }
 
+#if ETL_USING_64BIT_TYPES
+    // shortest representation that round trips, as std::format does for "{}"
+    template<typename OutputIt, typename T>
+    void format_floating_shortest(OutputIt& it, T value, const format_spec_t& spec)
+    {
+      const private_floating_point::decimal_value      decimal = private_floating_point::to_shortest_decimal(value);
+      const private_floating_point::binary_float_value binary  = private_floating_point::to_binary_float_value(value);
+
+      private_format::format_sign<OutputIt, int>(it, decimal.negative ? -1 : 0, spec);
+      private_floating_point::write_shortest(it, decimal, binary, etl::float_notation::shortest, false);
+    }
+#endif
+
     template<typename OutputIt, typename T>
     void format_floating(OutputIt& it, T value, const format_spec_t& spec)
     {
@@ -1381,7 +2043,17 @@ namespace etl
       }
       else if (!spec.type.has_value())
       {
-        format_floating_default(it, value, spec);
+#if ETL_USING_64BIT_TYPES
+        // long double keeps the default presentation
+        if (!spec.precision.has_value() && !etl::is_same<T, long double>::value)
+        {
+          format_floating_shortest(it, value, spec);
+        }
+        else
+#endif
+        {
+          format_floating_default(it, value, spec);
+        }
       }
       else
       {
@@ -2243,22 +2915,131 @@ namespace etl
     return fmt_context.out();
   }
 
+  namespace private_format
+  {
+    //*************************************************************************
+    /// Outputs a literal part of a compiled format string.
+    //*************************************************************************
+    template<class OutputIt>
+    void output_literal(format_context<OutputIt>& fmt_context, const char* text, size_t length, bool escaped)
+    {
+      OutputIt it = fmt_context.out();
+      const char* const end = text + length;
+
+      while (text != end)
+      {
+        const char c = *text++;
+        *it = c;
+        ++it;
+
+        if (escaped && ((c == '{') || (c == '}')))
+        {
+          // Skip the second character of '{{' or '}}'
+          ++text;
+        }
+      }
+
+      fmt_context.advance_to(it);
+    }
+
+    //*************************************************************************
+    /// Formats using a compiled format string. No parsing is done here.
+    //*************************************************************************
+    template<class OutputIt, size_t Max_Fields>
+    OutputIt vformat_compiled(OutputIt out, etl::string_view fmt, const compiled_format<Max_Fields>& compiled, format_args<OutputIt> args)
+    {
+      format_parse_context parse_context(fmt, args.size());
+      format_context<OutputIt> fmt_context(out, args);
+      format_visitor<OutputIt> v(parse_context, fmt_context);
+
+      const char* const text = fmt.data();
+
+      for (size_t i = 0; i < compiled.n_fields; ++i)
+      {
+        const compiled_field& field = compiled.fields[i];
+
+        output_literal<OutputIt>(fmt_context, text + field.literal_begin, field.literal_length, (field.flags & compiled_field::Literal_Escaped) != 0);
+
+        format_spec_t& spec = fmt_context.format_spec;
+
+        spec = format_spec_t();
+        spec.index = field.index;
+
+        if (field.align != 0)
+        {
+          spec.align = align_from_char(field.align);
+          spec.fill  = field.fill;
+        }
+
+        if (field.sign != 0)
+        {
+          spec.sign = sign_from_char(field.sign);
+        }
+
+        spec.hash = (field.flags & compiled_field::Hash) != 0;
+        spec.zero = (field.flags & compiled_field::Zero) != 0;
+
+        if ((field.flags & compiled_field::Has_Width) != 0)
+        {
+          spec.width = field.width;
+          spec.width_nested_replacement = (field.flags & compiled_field::Width_Nested) != 0;
+        }
+
+        if ((field.flags & compiled_field::Has_Precision) != 0)
+        {
+          spec.precision = field.precision;
+          spec.precision_nested_replacement = (field.flags & compiled_field::Precision_Nested) != 0;
+        }
+
+        spec.locale_specific = (field.flags & compiled_field::Locale) != 0;
+
+        if (field.type != 0)
+        {
+          spec.type = field.type;
+        }
+
+        format_arg<OutputIt> arg = args.get(field.index);
+        arg.template visit<void>(v);
+      }
+
+      output_literal<OutputIt>(fmt_context, text + compiled.tail_begin, compiled.tail_length, compiled.tail_escaped);
+
+      return fmt_context.out();
+    }
+
+    //*************************************************************************
+    /// Uses the compiled format string if available, otherwise parses it.
+    //*************************************************************************
+    template<class OutputIt, class... Args>
+    OutputIt vformat_to_impl(OutputIt out, const basic_format_string<Args...>& fmt, format_args<OutputIt> args)
+    {
+      if (fmt.compiled().valid && fmt.compiled().compiled)
+      {
+        return vformat_compiled(etl::move(out), fmt.get(), fmt.compiled(), args);
+      }
+      else
+      {
+        return etl::vformat_to(etl::move(out), fmt.get(), args);
+      }
+    }
+  }
+
   template<typename OutputIt,
            typename = etl::enable_if_t<!etl::is_base_of<etl::remove_reference<etl::istring>::type, OutputIt>::value>,
            class... Args>
   OutputIt format_to(OutputIt out, format_string<Args...> fmt, Args&&... args)
   {
     auto the_args{make_format_args<OutputIt>(args...)};
-    return vformat_to(etl::move(out), fmt.get(), format_args<OutputIt>(the_args));
+    return private_format::vformat_to_impl(etl::move(out), fmt, format_args<OutputIt>(the_args));
   }
 
   template<typename OutputIt, class WrapperIt = private_format::limit_iterator<OutputIt>, class... Args>
   OutputIt format_to_n(OutputIt out, size_t n, format_string<Args...> fmt, Args&&... args)
   {
     auto the_args{make_format_args<WrapperIt>(args...)};
-    return vformat_to(WrapperIt(out, n),
-                      fmt.get(),
-                      format_args<WrapperIt>(the_args)).get();
+    return private_format::vformat_to_impl(WrapperIt(out, n),
+                                      fmt,
+                                      format_args<WrapperIt>(the_args)).get();
   }
 
   // non std in the following, specific to etl
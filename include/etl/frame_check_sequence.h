@@ -86,6 +86,31 @@ namespace etl
 
       TFrame_Check_Sequence* p_fcs;
     };
+
+    //***************************************************
+    /// Detects a policy that can add a block of bytes at a time.
+    //***************************************************
+    template <typename TPolicy>
+    struct has_block_add
+    {
+    private:
+
+      typedef char yes;
+      struct no { char value[2]; };
+
+      template <typename U>
+      static yes test(char (*)[sizeof(&U::Block_Size)]);
+
+      template <typename>
+      static no test(...);
+
+    public:
+
+      static const bool value = sizeof(test<TPolicy>(0)) == sizeof(yes);
+    };
+
+    template <typename TPolicy>
+    const bool has_block_add<TPolicy>::value;
   }
 
   //***************************************************************************
@@ -145,11 +170,10 @@ namespace etl
     {
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Type not supported");
 
-      while (begin != end)
-      {
-        frame_check = policy.add(frame_check, *begin);
-        ++begin;
-      }
+      typedef etl::integral_constant<bool, private_frame_check_sequence::has_block_add<policy_type>::value &&
+                                           etl::is_random_access_iterator<TIterator>::value> use_block_add;
+
+      add_range(begin, end, use_block_add());
     }
 
     //*************************************************************************
@@ -186,6 +210,38 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a range, one byte at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    ETL_CONSTEXPR14 void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        frame_check = policy.add(frame_check, *begin);
+        ++begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range, a block at a time, then finishes the tail one byte at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    ETL_CONSTEXPR14 void add_range(TIterator begin, const TIterator end, etl::true_type)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+      const difference_type block_size = static_cast<difference_type>(policy_type::Block_Size);
+
+      while ((end - begin) >= block_size)
+      {
+        frame_check = policy.add_block(frame_check, begin);
+        begin += block_size;
+      }
+
+      add_range(begin, end, etl::false_type());
+    }
+
     value_type  frame_check;
     policy_type policy;
   };
@@ -78,9 +78,20 @@ cog.outl("//********************************************************************
 #include "type_traits.h"
 #include "type_list.h"
 #include "array.h"
+#include "smallest.h"
+#include "utility.h"
 
 #include <stdint.h>
 
+//*****************************************************************************
+/// Message ids that are not contiguous are dispatched through a table indexed
+/// by id when the table would be no more than this many times the number of
+/// message types, and through a perfect hash table of up to this size otherwise.
+//*****************************************************************************
+#if !defined(ETL_MESSAGE_ROUTER_DISPATCH_TABLE_FACTOR)
+  #define ETL_MESSAGE_ROUTER_DISPATCH_TABLE_FACTOR 4
+#endif
+
 namespace etl
 {
   //***************************************************************************
@@ -154,6 +165,154 @@ namespace etl
       using sorted_message_types = etl::type_list<>;
 #endif
     };
+
+#if ETL_USING_CPP11
+    //***************************************************************************
+    // Returns the index of 'id' in the sorted ids in the range [first, last),
+    // or N if it is not there.
+    //***************************************************************************
+    template <size_t N>
+    constexpr size_t find_message_id(const etl::message_id_t (&ids)[N], size_t id, size_t first, size_t last)
+    {
+      return (first >= last)                              ? N
+           : (ids[first + ((last - first) / 2U)] == id)  ? first + ((last - first) / 2U)
+           : (ids[first + ((last - first) / 2U)] < id)   ? find_message_id(ids, id, first + ((last - first) / 2U) + 1U, last)
+           :                                               find_message_id(ids, id, first, first + ((last - first) / 2U));
+    }
+
+    //***************************************************************************
+    // Returns the index of the id in the range [first, last) that hashes to
+    // 'slot' for 'modulus', or N if there is none.
+    //***************************************************************************
+    template <size_t N>
+    constexpr size_t find_message_id_slot(const etl::message_id_t (&ids)[N], size_t modulus, size_t slot, size_t first, size_t last)
+    {
+      return (first >= last)         ? N
+           : ((last - first) == 1U)  ? (((ids[first] % modulus) == slot) ? first : N)
+           : (find_message_id_slot(ids, modulus, slot, first, first + ((last - first) / 2U)) != N)
+             ? find_message_id_slot(ids, modulus, slot, first, first + ((last - first) / 2U))
+             : find_message_id_slot(ids, modulus, slot, first + ((last - first) / 2U), last);
+    }
+
+    //***************************************************************************
+    // Checks that no id in the range [first, last) shares a slot with a later id.
+    //***************************************************************************
+    template <size_t N>
+    constexpr bool is_perfect_message_id_hash(const etl::message_id_t (&ids)[N], size_t modulus, size_t first, size_t last)
+    {
+      return (first >= last)        ? true
+           : ((last - first) == 1U) ? (find_message_id_slot(ids, modulus, ids[first] % modulus, first + 1U, N) == N)
+           : is_perfect_message_id_hash(ids, modulus, first, first + ((last - first) / 2U)) &&
+             is_perfect_message_id_hash(ids, modulus, first + ((last - first) / 2U), last);
+    }
+
+    //***************************************************************************
+    // Returns the smallest modulus in the range [first, last] that is a perfect
+    // hash for the ids, or 0 if there is none.
+    //***************************************************************************
+    template <size_t N>
+    constexpr size_t find_message_id_hash_modulus(const etl::message_id_t (&ids)[N], size_t first, size_t last)
+    {
+      return (first > last)  ? 0U
+           : (first == last) ? (is_perfect_message_id_hash(ids, first, 0U, N) ? first : 0U)
+           : (find_message_id_hash_modulus(ids, first, first + ((last - first) / 2U)) != 0U)
+             ? find_message_id_hash_modulus(ids, first, first + ((last - first) / 2U))
+             : find_message_id_hash_modulus(ids, first + ((last - first) / 2U) + 1U, last);
+    }
+
+    //***************************************************************************
+    // Makes a table of indexes for each id offset from the first id.
+    //***************************************************************************
+    template <typename TIndex, size_t N, size_t... Offsets>
+    constexpr etl::array<TIndex, sizeof...(Offsets)> make_message_id_dense_table(const etl::message_id_t (&ids)[N], etl::index_sequence<Offsets...>)
+    {
+      return etl::array<TIndex, sizeof...(Offsets)>{ { static_cast<TIndex>(find_message_id(ids, ids[0] + Offsets, 0U, N))... } };
+    }
+
+    //***************************************************************************
+    // Makes a table of indexes for each hash slot.
+    //***************************************************************************
+    template <typename TIndex, size_t N, size_t... Slots>
+    constexpr etl::array<TIndex, sizeof...(Slots)> make_message_id_hash_table(const etl::message_id_t (&ids)[N], size_t modulus, etl::index_sequence<Slots...>)
+    {
+      return etl::array<TIndex, sizeof...(Slots)>{ { static_cast<TIndex>(find_message_id_slot(ids, modulus, Slots, 0U, N))... } };
+    }
+
+    //***************************************************************************
+    // Compile time tables that map a message id to its index in the sorted
+    // message type list.
+    // Ids that span no more than Max_Table_Size values use a table indexed by
+    // the id offset from the first id.
+    // Otherwise, a table indexed by the id modulo the smallest modulus that
+    // gives each id its own slot is used, if there is one.
+    // Otherwise, the ids are binary searched.
+    //***************************************************************************
+    template <typename TSortedMessageTypes>
+    class message_id_lookup;
+
+    template <typename... TMessageTypes>
+    class message_id_lookup<etl::type_list<TMessageTypes...>>
+    {
+    public:
+
+      static constexpr size_t Number_Of_Messages = sizeof...(TMessageTypes);
+
+      using index_type = etl::smallest_uint_for_value_t<Number_Of_Messages>;
+
+      static constexpr etl::message_id_t ids[Number_Of_Messages] = { TMessageTypes::ID... };
+
+      static constexpr size_t Id_Range         = static_cast<size_t>(ids[Number_Of_Messages - 1U]) - static_cast<size_t>(ids[0]) + 1U;
+      static constexpr size_t Max_Table_Size   = (ETL_MESSAGE_ROUTER_DISPATCH_TABLE_FACTOR * Number_Of_Messages) < 256U ? (ETL_MESSAGE_ROUTER_DISPATCH_TABLE_FACTOR * Number_Of_Messages) : 256U;
+      static constexpr bool   Use_Dense_Table  = (Id_Range <= Max_Table_Size);
+      static constexpr size_t Hash_Modulus     = Use_Dense_Table ? 0U : find_message_id_hash_modulus(ids, Number_Of_Messages, Max_Table_Size);
+      static constexpr bool   Use_Hash_Table   = (Hash_Modulus != 0U);
+      static constexpr size_t Dense_Table_Size = Use_Dense_Table ? Id_Range : 1U;
+      static constexpr size_t Hash_Table_Size  = Use_Hash_Table ? Hash_Modulus : 1U;
+
+      static constexpr etl::array<index_type, Dense_Table_Size> dense_table =
+        make_message_id_dense_table<index_type>(ids, etl::make_index_sequence<Dense_Table_Size>{});
+
+      static constexpr etl::array<index_type, Hash_Table_Size> hash_table =
+        make_message_id_hash_table<index_type>(ids, Use_Hash_Table ? Hash_Modulus : 1U, etl::make_index_sequence<Hash_Table_Size>{});
+    };
+
+  #if !ETL_USING_CPP17
+    template <typename... TMessageTypes>
+    constexpr size_t message_id_lookup<etl::type_list<TMessageTypes...>>::Number_Of_Messages;
+
+    template <typename... TMessageTypes>
+    constexpr size_t message_id_lookup<etl::type_list<TMessageTypes...>>::Id_Range;
+
+    template <typename... TMessageTypes>
+    constexpr size_t message_id_lookup<etl::type_list<TMessageTypes...>>::Max_Table_Size;
+
+    template <typename... TMessageTypes>
+    constexpr bool message_id_lookup<etl::type_list<TMessageTypes...>>::Use_Dense_Table;
+
+    template <typename... TMessageTypes>
+    constexpr size_t message_id_lookup<etl::type_list<TMessageTypes...>>::Hash_Modulus;
+
+    template <typename... TMessageTypes>
+    constexpr bool message_id_lookup<etl::type_list<TMessageTypes...>>::Use_Hash_Table;
+
+    template <typename... TMessageTypes>
+    constexpr size_t message_id_lookup<etl::type_list<TMessageTypes...>>::Dense_Table_Size;
+
+    template <typename... TMessageTypes>
+    constexpr size_t message_id_lookup<etl::type_list<TMessageTypes...>>::Hash_Table_Size;
+
+    template <typename... TMessageTypes>
+    constexpr etl::message_id_t message_id_lookup<etl::type_list<TMessageTypes...>>::ids[message_id_lookup<etl::type_list<TMessageTypes...>>::Number_Of_Messages];
+
+    template <typename... TMessageTypes>
+    constexpr etl::array<typename message_id_lookup<etl::type_list<TMessageTypes...>>::index_type, message_id_lookup<etl::type_list<TMessageTypes...>>::Dense_Table_Size>
+      message_id_lookup<etl::type_list<TMessageTypes...>>::dense_table;
+
+    template <typename... TMessageTypes>
+    constexpr etl::array<typename message_id_lookup<etl::type_list<TMessageTypes...>>::index_type, message_id_lookup<etl::type_list<TMessageTypes...>>::Hash_Table_Size>
+      message_id_lookup<etl::type_list<TMessageTypes...>>::hash_table;
+  #endif
+#endif
   }
 
   //***************************************************************************
@@ -671,6 +830,7 @@ namespace etl
     // The message ids are contiguous if there are 0 or 1 message types, or if each message id is one greater than the previous message id.
     static constexpr bool Message_Ids_Are_Contiguous = (Number_Of_Messages <= 1U) ? true : contiguous_impl<0U>::value;
 
+    using message_id_lookup        = private_message_router::message_id_lookup<sorted_message_types>;   ///< The compile time message id to index lookup tables.
     using handler_ptr              = void (*)(TDerived&, const etl::imessage&);         ///< Pointer to a handler function that takes a reference to the derived class and a reference to the message.
     using message_dispatch_table_t = etl::array<handler_ptr, Number_Of_Messages>;       ///< The dispatch table type. An array of handler pointers, one for each message type.
     using message_id_table_t       = etl::array<etl::message_id_t, Number_Of_Messages>; ///< The message id table type. An array of message ids, one for each message type.
@@ -727,7 +887,8 @@ namespace etl
     //**********************************************
     // Get the dispatch index for a message id.
     // This will be used at runtime to find the handler for a message id.
-    // If the message ids are contiguous, we can calculate the index directly. If they are not contiguous, we need to do a binary search.
+    // If the message ids are contiguous, we can calculate the index directly.
+    // If they are not contiguous, we use a compile time table indexed by id or by perfect hash of the id, or failing that, a binary search.
     // This will return Number_Of_Messages if the message id is not found, which indicates that the message should be passed to the successor.
     //**********************************************
     static size_t get_dispatch_index_from_message_id(etl::message_id_t id)
@@ -737,6 +898,20 @@ namespace etl
         // The IDs are contiguous, so we can calculate the index directly.
         return static_cast<size_t>(id - Message_Id_Start);
       }
+      else if ETL_IF_CONSTEXPR(message_id_lookup::Use_Dense_Table)
+      {
+        // The IDs are dense enough to look up the index by offset.
+        const size_t offset = static_cast<size_t>(id - Message_Id_Start);
+
+        return (offset < message_id_lookup::Dense_Table_Size) ? static_cast<size_t>(message_id_lookup::dense_table[offset]) : Number_Of_Messages;
+      }
+      else if ETL_IF_CONSTEXPR(message_id_lookup::Use_Hash_Table)
+      {
+        // The IDs each hash to a unique slot, so we only need to check that the slot's ID matches.
+        const size_t index = message_id_lookup::hash_table[static_cast<size_t>(id) % message_id_lookup::Hash_Modulus];
+
+        return ((index < Number_Of_Messages) && (message_id_table[index] == id)) ? index : Number_Of_Messages;
+      }
       else
       {
         // The IDs are not contiguous, so we need to do a binary search.
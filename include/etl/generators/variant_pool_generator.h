@@ -74,21 +74,82 @@ cog.outl("//********************************************************************
 namespace etl
 {
 #if ETL_USING_CPP11 && !defined(ETL_VARIANT_POOL_FORCE_CPP03_IMPLEMENTATION)
+  namespace private_variant_pool
+  {
+    //***************************************************************************
+    /// The implementation of variant_pool and variant_pool_with_occupancy.
+    //***************************************************************************
+    template <size_t MAX_SIZE_, bool VOccupancy, typename ... Ts>
+    class variant_pool_base
+      : public etl::generic_pool<etl::largest<Ts...>::size,
+                                 etl::largest<Ts...>::alignment,
+                                 MAX_SIZE_,
+                                 VOccupancy>
+    {
+    public:
+
+      typedef etl::generic_pool<etl::largest<Ts...>::size,
+                                etl::largest<Ts...>::alignment,
+                                MAX_SIZE_,
+                                VOccupancy> base_t;
+
+      static const size_t MAX_SIZE = MAX_SIZE_;
+
+      //*************************************************************************
+      /// Creates the object from a type. Variadic parameter constructor.
+      //*************************************************************************
+      template <typename T, typename... Args>
+      T* create(Args&&... args)
+      {
+        ETL_STATIC_ASSERT((etl::is_one_of<T, Ts...>::value), "Unsupported type");
+
+        return base_t::template create<T>(etl::forward<Args>(args)...);
+      }
+
+      //*************************************************************************
+      /// Destroys the object.
+      //*************************************************************************
+      template <typename T>
+      void destroy(const T* const p)
+      {
+        ETL_STATIC_ASSERT((etl::is_one_of<T, Ts...>::value || etl::is_base_of_any<T, Ts...>::value), "Invalid type");
+
+        base_t::destroy(p);
+      }
+
+      //*************************************************************************
+      /// Returns the maximum number of items in the variant_pool.
+      //*************************************************************************
+      size_t max_size() const
+      {
+        return MAX_SIZE;
+      }
+
+    protected:
+
+      //*************************************************************************
+      /// Default constructor.
+      //*************************************************************************
+      variant_pool_base()
+      {
+      }
+
+    private:
+
+      variant_pool_base(const variant_pool_base&) ETL_DELETE;
+      variant_pool_base& operator =(const variant_pool_base&) ETL_DELETE;
+    };
+  }
+
+  //***************************************************************************
+  /// A pool of objects of any of the types Ts.
   //***************************************************************************
   template <size_t MAX_SIZE_, typename ... Ts>
   class variant_pool
-    : public etl::generic_pool<etl::largest<Ts...>::size,
-                               etl::largest<Ts...>::alignment,
-                               MAX_SIZE_>
+    : public private_variant_pool::variant_pool_base<MAX_SIZE_, false, Ts...>
   {
   public:
 
-    typedef etl::generic_pool<etl::largest<Ts...>::size,
-                              etl::largest<Ts...>::alignment,
-                              MAX_SIZE_> base_t;
-
-    static const size_t MAX_SIZE = MAX_SIZE_;
-
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
@@ -96,40 +157,32 @@ namespace etl
     {
     }
 
-    //*************************************************************************
-    /// Creates the object from a type. Variadic parameter constructor.
-    //*************************************************************************
-    template <typename T, typename... Args>
-    T* create(Args&&... args)
-    {
-      ETL_STATIC_ASSERT((etl::is_one_of<T, Ts...>::value), "Unsupported type");
-
-      return base_t::template create<T>(etl::forward<Args>(args)...);
-    }
+  private:
 
-    //*************************************************************************
-    /// Destroys the object.
-    //*************************************************************************
-    template <typename T>
-    void destroy(const T* const p)
-    {
-      ETL_STATIC_ASSERT((etl::is_one_of<T, Ts...>::value || etl::is_base_of_any<T, Ts...>::value), "Invalid type");
+    variant_pool(const variant_pool&) ETL_DELETE;
+    variant_pool& operator =(const variant_pool&) ETL_DELETE;
+  };
 
-      base_t::destroy(p);
-    }
+  //***************************************************************************
+  /// A pool of objects of any of the types Ts, with an occupancy bitmap.
+  //***************************************************************************
+  template <size_t MAX_SIZE_, typename ... Ts>
+  class variant_pool_with_occupancy
+    : public private_variant_pool::variant_pool_base<MAX_SIZE_, true, Ts...>
+  {
+  public:
 
     //*************************************************************************
-    /// Returns the maximum number of items in the variant_pool.
+    /// Default constructor.
     //*************************************************************************
-    size_t max_size() const
+    variant_pool_with_occupancy()
     {
-      return MAX_SIZE;
     }
 
   private:
 
-    variant_pool(const variant_pool&) ETL_DELETE;
-    variant_pool& operator =(const variant_pool&) ETL_DELETE;
+    variant_pool_with_occupancy(const variant_pool_with_occupancy&) ETL_DELETE;
+    variant_pool_with_occupancy& operator =(const variant_pool_with_occupancy&) ETL_DELETE;
   };
 
   //***************************************************************************
@@ -187,220 +240,295 @@ namespace etl
     variant_pool_ext& operator =(const variant_pool_ext&) ETL_DELETE;
   };
 #else
-  //***************************************************************************
-  /*[[[cog
-  import cog
-  cog.outl("template <size_t MAX_SIZE_,")
-  cog.outl("          typename T1,")
-  for n in range(2, int(NTypes)):
-      cog.outl("          typename T%s = void," % n)
-  cog.outl("          typename T%s = void>" % int(NTypes))
-  cog.outl("class variant_pool")
-  cog.out("  : public etl::generic_pool<")
-  cog.out("etl::largest<")
-  for n in range(1, int(NTypes)):
-      cog.out("T%s, " % n)
-  cog.outl("T%s>::size," % int(NTypes))
-  cog.out("                             etl::largest<")
-  for n in range(1, int(NTypes)):
-      cog.out("T%s, " % n)
-  cog.outl("T%s>::alignment," % int(NTypes))
-  cog.outl("                             MAX_SIZE_>")
-  ]]]*/
-  /*[[[end]]]*/
+  namespace private_variant_pool
   {
-  public:
-
+    //***************************************************************************
+    /// The implementation of variant_pool and variant_pool_with_occupancy.
+    //***************************************************************************
     /*[[[cog
     import cog
-    cog.out("typedef etl::generic_pool<")
+    cog.outl("template <size_t MAX_SIZE_,")
+    cog.outl("          bool VOccupancy,")
+    for n in range(1, int(NTypes)):
+        cog.outl("          typename T%s," % n)
+    cog.outl("          typename T%s>" % int(NTypes))
+    cog.outl("class variant_pool_base")
+    cog.out("  : public etl::generic_pool<")
     cog.out("etl::largest<")
     for n in range(1, int(NTypes)):
         cog.out("T%s, " % n)
     cog.outl("T%s>::size," % int(NTypes))
-    cog.out("                          etl::largest<")
+    cog.out("                             etl::largest<")
     for n in range(1, int(NTypes)):
         cog.out("T%s, " % n)
     cog.outl("T%s>::alignment," % int(NTypes))
-    cog.outl("                          MAX_SIZE_> base_t;")
+    cog.outl("                             MAX_SIZE_,")
+    cog.outl("                             VOccupancy>")
     ]]]*/
     /*[[[end]]]*/
-
-    static const size_t MAX_SIZE = MAX_SIZE_;
-
-    //*************************************************************************
-    /// Default constructor.
-    //*************************************************************************
-    variant_pool()
     {
-    }
+    public:
 
-#if ETL_CPP11_NOT_SUPPORTED || ETL_USING_STLPORT
-    //*************************************************************************
-    /// Creates the object. Default constructor.
-    //*************************************************************************
-    template <typename T>
-    T* create()
-    {
       /*[[[cog
       import cog
-      cog.out("ETL_STATIC_ASSERT((etl::is_one_of<T, ")
+      cog.out("typedef etl::generic_pool<")
+      cog.out("etl::largest<")
       for n in range(1, int(NTypes)):
           cog.out("T%s, " % n)
-          if n % 16 == 0:
-              cog.outl("")
-              cog.out("                              ")
-      cog.outl("T%s>::value), \"Unsupported type\");" % int(NTypes))
-      ]]]*/
-      /*[[[end]]]*/
-
-      return base_t::template create<T>();
-    }
-
-    //*************************************************************************
-    /// Creates the object. One parameter constructor.
-    //*************************************************************************
-    template <typename T, typename TP1>
-    T* create(const TP1& p1)
-    {
-      /*[[[cog
-      import cog
-      cog.out("ETL_STATIC_ASSERT((etl::is_one_of<T, ")
-      for n in range(1, int(NTypes)):
-          cog.out("T%s, " % n)
-          if n % 16 == 0:
-              cog.outl("")
-              cog.out("                              ")
-      cog.outl("T%s>::value), \"Unsupported type\");" % int(NTypes))
-      ]]]*/
-      /*[[[end]]]*/
-
-      return base_t::template create<T>(p1);
-    }
-
-    //*************************************************************************
-    /// Creates the object. Two parameter constructor.
-    //*************************************************************************
-    template <typename T, typename TP1, typename TP2>
-    T* create(const TP1& p1, const TP2& p2)
-    {
-      /*[[[cog
-      import cog
-      cog.out("ETL_STATIC_ASSERT((etl::is_one_of<T, ")
+      cog.outl("T%s>::size," % int(NTypes))
+      cog.out("                          etl::largest<")
       for n in range(1, int(NTypes)):
           cog.out("T%s, " % n)
-          if n % 16 == 0:
-              cog.outl("")
-              cog.out("                              ")
-      cog.outl("T%s>::value), \"Unsupported type\");" % int(NTypes))
+      cog.outl("T%s>::alignment," % int(NTypes))
+      cog.outl("                          MAX_SIZE_,")
+      cog.outl("                          VOccupancy> base_t;")
       ]]]*/
       /*[[[end]]]*/
 
-      return base_t::template create<T>(p1, p2);
-    }
+      static const size_t MAX_SIZE = MAX_SIZE_;
 
-    //*************************************************************************
-    /// Creates the object. Three parameter constructor.
-    //*************************************************************************
-    template <typename T, typename TP1, typename TP2, typename TP3>
-    T* create(const TP1& p1, const TP2& p2, const TP3& p3)
-    {
-      /*[[[cog
-      import cog
-      cog.out("ETL_STATIC_ASSERT((etl::is_one_of<T, ")
-      for n in range(1, int(NTypes)):
-          cog.out("T%s, " % n)
-          if n % 16 == 0:
-              cog.outl("")
-              cog.out("                              ")
-      cog.outl("T%s>::value), \"Unsupported type\");" % int(NTypes))
-      ]]]*/
-      /*[[[end]]]*/
+#if ETL_CPP11_NOT_SUPPORTED || ETL_USING_STLPORT
+      //*************************************************************************
+      /// Creates the object. Default constructor.
+      //*************************************************************************
+      template <typename T>
+      T* create()
+      {
+        /*[[[cog
+        import cog
+        cog.out("ETL_STATIC_ASSERT((etl::is_one_of<T, ")
+        for n in range(1, int(NTypes)):
+            cog.out("T%s, " % n)
+            if n % 16 == 0:
+                cog.outl("")
+                cog.out("                              ")
+        cog.outl("T%s>::value), \"Unsupported type\");" % int(NTypes))
+        ]]]*/
+        /*[[[end]]]*/
+
+        return base_t::template create<T>();
+      }
+
+      //*************************************************************************
+      /// Creates the object. One parameter constructor.
+      //*************************************************************************
+      template <typename T, typename TP1>
+      T* create(const TP1& p1)
+      {
+        /*[[[cog
+        import cog
+        cog.out("ETL_STATIC_ASSERT((etl::is_one_of<T, ")
+        for n in range(1, int(NTypes)):
+            cog.out("T%s, " % n)
+            if n % 16 == 0:
+                cog.outl("")
+                cog.out("                              ")
+        cog.outl("T%s>::value), \"Unsupported type\");" % int(NTypes))
+        ]]]*/
+        /*[[[end]]]*/
+
+        return base_t::template create<T>(p1);
+      }
+
+      //*************************************************************************
+      /// Creates the object. Two parameter constructor.
+      //*************************************************************************
+      template <typename T, typename TP1, typename TP2>
+      T* create(const TP1& p1, const TP2& p2)
+      {
+        /*[[[cog
+        import cog
+        cog.out("ETL_STATIC_ASSERT((etl::is_one_of<T, ")
+        for n in range(1, int(NTypes)):
+            cog.out("T%s, " % n)
+            if n % 16 == 0:
+                cog.outl("")
+                cog.out("                              ")
+        cog.outl("T%s>::value), \"Unsupported type\");" % int(NTypes))
+        ]]]*/
+        /*[[[end]]]*/
+
+        return base_t::template create<T>(p1, p2);
+      }
+
+      //*************************************************************************
+      /// Creates the object. Three parameter constructor.
+      //*************************************************************************
+      template <typename T, typename TP1, typename TP2, typename TP3>
+      T* create(const TP1& p1, const TP2& p2, const TP3& p3)
+      {
+        /*[[[cog
+        import cog
+        cog.out("ETL_STATIC_ASSERT((etl::is_one_of<T, ")
+        for n in range(1, int(NTypes)):
+            cog.out("T%s, " % n)
+            if n % 16 == 0:
+                cog.outl("")
+                cog.out("                              ")
+        cog.outl("T%s>::value), \"Unsupported type\");" % int(NTypes))
+        ]]]*/
+        /*[[[end]]]*/
+
+        return base_t::template create<T>(p1, p2, p3);
+      }
+
+      //*************************************************************************
+      /// Creates the object. Four parameter constructor.
+      //*************************************************************************
+      template <typename T, typename TP1, typename TP2, typename TP3, typename TP4>
+      T* create(const TP1& p1, const TP2& p2, const TP3& p3, const TP4& p4)
+      {
+        /*[[[cog
+        import cog
+        cog.out("ETL_STATIC_ASSERT((etl::is_one_of<T, ")
+        for n in range(1, int(NTypes)):
+            cog.out("T%s, " % n)
+            if n % 16 == 0:
+                cog.outl("")
+                cog.out("                              ")
+        cog.outl("T%s>::value), \"Unsupported type\");" % int(NTypes))
+        ]]]*/
+        /*[[[end]]]*/
+
+        return base_t::template create<T>(p1, p2, p3, p4);
+      }
+#else
+      //*************************************************************************
+      /// Creates the object from a type. Variadic parameter constructor.
+      //*************************************************************************
+      template <typename T, typename... Args>
+      T* create(Args&&... args)
+      {
+        /*[[[cog
+        import cog
+        cog.out("ETL_STATIC_ASSERT((etl::is_one_of<T, ")
+        for n in range(1, int(NTypes)):
+            cog.out("T%s, " % n)
+            if n % 16 == 0:
+                cog.outl("")
+                cog.out("                              ")
+        cog.outl("T%s>::value), \"Unsupported type\");" % int(NTypes))
+        ]]]*/
+        /*[[[end]]]*/
+
+        return base_t::template create<T>(etl::forward<Args>(args)...);
+      }
+#endif
 
-      return base_t::template create<T>(p1, p2, p3);
-    }
+      //*************************************************************************
+      /// Destroys the object.
+      //*************************************************************************
+      template <typename T>
+      void destroy(const T* const p)
+      {
+        /*[[[cog
+        import cog
+        cog.out("ETL_STATIC_ASSERT((etl::is_one_of<T, ")
+        for n in range(1, int(NTypes)):
+            cog.out("T%s, " % n)
+            if n % 16 == 0:
+                cog.outl("")
+                cog.out("                              ")
+        cog.outl("T%s>::value ||" % int(NTypes))
+
+        for n in range(1, int(NTypes)):
+            cog.outl("                   etl::is_base_of<T, T%s>::value ||" % n)
+        cog.outl("                   etl::is_base_of<T, T%s>::value), \"Invalid type\");" % int(NTypes))
+
+        ]]]*/
+        /*[[[end]]]*/
+
+        base_t::destroy(p);
+      }
+
+      //*************************************************************************
+      /// Returns the maximum number of items in the variant_pool.
+      //*************************************************************************
+      size_t max_size() const
+      {
+        return MAX_SIZE;
+      }
+
+    protected:
+
+      //*************************************************************************
+      /// Default constructor.
+      //*************************************************************************
+      variant_pool_base()
+      {
+      }
+
+    private:
+
+      variant_pool_base(const variant_pool_base&) ETL_DELETE;
+      variant_pool_base& operator =(const variant_pool_base&) ETL_DELETE;
+    };
+  }
 
-    //*************************************************************************
-    /// Creates the object. Four parameter constructor.
-    //*************************************************************************
-    template <typename T, typename TP1, typename TP2, typename TP3, typename TP4>
-    T* create(const TP1& p1, const TP2& p2, const TP3& p3, const TP4& p4)
-    {
-      /*[[[cog
-      import cog
-      cog.out("ETL_STATIC_ASSERT((etl::is_one_of<T, ")
-      for n in range(1, int(NTypes)):
-          cog.out("T%s, " % n)
-          if n % 16 == 0:
-              cog.outl("")
-              cog.out("                              ")
-      cog.outl("T%s>::value), \"Unsupported type\");" % int(NTypes))
-      ]]]*/
-      /*[[[end]]]*/
+  //***************************************************************************
+  /// A pool of objects of any of the listed types.
+  //***************************************************************************
+  /*[[[cog
+  import cog
+  cog.outl("template <size_t MAX_SIZE_,")
+  cog.outl("          typename T1,")
+  for n in range(2, int(NTypes)):
+      cog.outl("          typename T%s = void," % n)
+  cog.outl("          typename T%s = void>" % int(NTypes))
+  cog.outl("class variant_pool")
+  cog.out("  : public private_variant_pool::variant_pool_base<MAX_SIZE_, false, ")
+  for n in range(1, int(NTypes)):
+      cog.out("T%s, " % n)
+  cog.outl("T%s>" % int(NTypes))
+  ]]]*/
+  /*[[[end]]]*/
+  {
+  public:
 
-      return base_t::template create<T>(p1, p2, p3, p4);
-    }
-#else
     //*************************************************************************
-    /// Creates the object from a type. Variadic parameter constructor.
+    /// Default constructor.
     //*************************************************************************
-    template <typename T, typename... Args>
-    T* create(Args&&... args)
+    variant_pool()
     {
-      /*[[[cog
-      import cog
-      cog.out("ETL_STATIC_ASSERT((etl::is_one_of<T, ")
-      for n in range(1, int(NTypes)):
-          cog.out("T%s, " % n)
-          if n % 16 == 0:
-              cog.outl("")
-              cog.out("                              ")
-      cog.outl("T%s>::value), \"Unsupported type\");" % int(NTypes))
-      ]]]*/
-      /*[[[end]]]*/
-
-      return base_t::template create<T>(etl::forward<Args>(args)...);
     }
-#endif
 
-    //*************************************************************************
-    /// Destroys the object.
-    //*************************************************************************
-    template <typename T>
-    void destroy(const T* const p)
-    {
-      /*[[[cog
-      import cog
-      cog.out("ETL_STATIC_ASSERT((etl::is_one_of<T, ")
-      for n in range(1, int(NTypes)):
-          cog.out("T%s, " % n)
-          if n % 16 == 0:
-              cog.outl("")
-              cog.out("                              ")
-      cog.outl("T%s>::value ||" % int(NTypes))
-
-      for n in range(1, int(NTypes)):
-          cog.outl("                   etl::is_base_of<T, T%s>::value ||" % n)
-      cog.outl("                   etl::is_base_of<T, T%s>::value), \"Invalid type\");" % int(NTypes))
+  private:
 
-      ]]]*/
-      /*[[[end]]]*/
+    variant_pool(const variant_pool&) ETL_DELETE;
+    variant_pool& operator =(const variant_pool&) ETL_DELETE;
+  };
 
-      base_t::destroy(p);
-    }
+  //***************************************************************************
+  /// A pool of objects of any of the listed types, with an occupancy bitmap.
+  //***************************************************************************
+  /*[[[cog
+  import cog
+  cog.outl("template <size_t MAX_SIZE_,")
+  cog.outl("          typename T1,")
+  for n in range(2, int(NTypes)):
+      cog.outl("          typename T%s = void," % n)
+  cog.outl("          typename T%s = void>" % int(NTypes))
+  cog.outl("class variant_pool_with_occupancy")
+  cog.out("  : public private_variant_pool::variant_pool_base<MAX_SIZE_, true, ")
+  for n in range(1, int(NTypes)):
+      cog.out("T%s, " % n)
+  cog.outl("T%s>" % int(NTypes))
+  ]]]*/
+  /*[[[end]]]*/
+  {
+  public:
 
     //*************************************************************************
-    /// Returns the maximum number of items in the variant_pool.
+    /// Default constructor.
     //*************************************************************************
-    size_t max_size() const
+    variant_pool_with_occupancy()
     {
-      return MAX_SIZE;
     }
 
   private:
 
-    variant_pool(const variant_pool&) ETL_DELETE;
-    variant_pool& operator =(const variant_pool&) ETL_DELETE;
+    variant_pool_with_occupancy(const variant_pool_with_occupancy&) ETL_DELETE;
+    variant_pool_with_occupancy& operator =(const variant_pool_with_occupancy&) ETL_DELETE;
   };
 
   //***************************************************************************
@@ -42,18 +42,84 @@ SOFTWARE.
 //*****************************************************************************
 ///\defgroup pool pool
 /// A fixed capacity pool.
+/// etl::generic_pool and etl::pool with VOccupancy set to true, and
+/// etl::variant_pool_with_occupancy, are etl::ipool_with_occupancy instead of
+/// etl::ipool, and keep a bitmap of allocated items. This gives constant time
+/// is_allocated, iteration that skips free items a word at a time and detection
+/// of double release, for one bit per item plus a pointer. Pools without the
+/// bitmap are the same size as before.
 ///\ingroup containers
 //*****************************************************************************
 
 namespace etl
 {
+  namespace private_generic_pool
+  {
+    //*************************************************************************
+    /// The storage for the occupancy bitmap of a generic_pool.
+    /// A base class, so that it is constructed before etl::ipool_with_occupancy.
+    //*************************************************************************
+    template <size_t VSize>
+    class occupancy_storage
+    {
+    protected:
+
+      uint32_t* occupancy_bitmap()
+      {
+        return occupancy;
+      }
+
+    private:
+
+      uint32_t occupancy[(VSize + 31U) / 32U]; ///< One bit per item, set when allocated.
+    };
+
+    //*************************************************************************
+    /// The pool interface of a generic_pool.
+    /// etl::ipool, or etl::ipool_with_occupancy with its bitmap.
+    //*************************************************************************
+    template <size_t VSize, bool VOccupancy>
+    class pool_base : public etl::ipool
+    {
+    protected:
+
+      pool_base(char* p_buffer_, uint32_t item_size_, uint32_t max_size_)
+        : etl::ipool(p_buffer_, item_size_, max_size_)
+      {
+      }
+    };
+
+    //*************************************************************************
+    /// With an occupancy bitmap.
+    //*************************************************************************
+    template <size_t VSize>
+    class pool_base<VSize, true> : private occupancy_storage<VSize>
+                                 , public etl::ipool_with_occupancy
+    {
+    protected:
+
+      ETL_STATIC_ASSERT(etl::ipool_with_occupancy::Occupancy_Bits == 32U, "The occupancy bitmap storage assumes 32 items per word");
+
+      pool_base(char* p_buffer_, uint32_t item_size_, uint32_t max_size_)
+        : occupancy_storage<VSize>()
+        , etl::ipool_with_occupancy(p_buffer_, item_size_, max_size_, this->occupancy_bitmap())
+      {
+      }
+    };
+  }
+
   //*************************************************************************
   /// A templated abstract pool implementation that uses a fixed size pool.
+  ///\tparam VOccupancy If true, the pool keeps an occupancy bitmap.
   ///\ingroup pool
   //*************************************************************************
-  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
-  class generic_pool : public etl::ipool
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize, bool VOccupancy = false>
+  class generic_pool : public private_generic_pool::pool_base<VSize, VOccupancy>
   {
+  private:
+
+    typedef private_generic_pool::pool_base<VSize, VOccupancy> base_t;
+
   public:
 
     static ETL_CONSTANT size_t SIZE      = VSize;
@@ -64,7 +130,7 @@ namespace etl
     /// Constructor
     //*************************************************************************
     generic_pool()
-      : etl::ipool(reinterpret_cast<char*>(&buffer[0]), Element_Size, VSize)
+      : base_t(reinterpret_cast<char*>(&buffer[0]), Element_Size, VSize)
     {
     }
 
@@ -79,7 +145,7 @@ namespace etl
     {
       ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
       ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
-      return ipool::allocate<U>();
+      return base_t::template allocate<U>();
     }
 
 #if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
@@ -93,7 +159,7 @@ namespace etl
     {
       ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
       ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
-      return ipool::create<U>();
+      return base_t::template create<U>();
     }
 
     //*************************************************************************
@@ -106,7 +172,7 @@ namespace etl
     {
       ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
       ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
-      return ipool::create<U>(value1);
+      return base_t::template create<U>(value1);
     }
 
     //*************************************************************************
@@ -119,7 +185,7 @@ namespace etl
     {
       ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
       ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
-      return ipool::create<U>(value1, value2);
+      return base_t::template create<U>(value1, value2);
     }
 
     //*************************************************************************
@@ -132,7 +198,7 @@ namespace etl
     {
       ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
       ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
-      return ipool::create<U>(value1, value2, value3);
+      return base_t::template create<U>(value1, value2, value3);
     }
 
     //*************************************************************************
@@ -145,7 +211,7 @@ namespace etl
     {
       ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
       ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
-      return ipool::create<U>(value1, value2, value3, value4);
+      return base_t::template create<U>(value1, value2, value3, value4);
     }
 #else
     //*************************************************************************
@@ -156,7 +222,7 @@ namespace etl
     {
       ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
       ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
-      return ipool::create<U>(etl::forward<Args>(args)...);
+      return base_t::template create<U>(etl::forward<Args>(args)...);
     }
 #endif
 
@@ -170,7 +236,7 @@ namespace etl
     {
       ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
       ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
-      ipool::destroy(p_object);
+      base_t::destroy(p_object);
     }
 
   private:
@@ -193,14 +259,14 @@ namespace etl
     generic_pool& operator =(const generic_pool&) ETL_DELETE;
   };
 
-  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
-  ETL_CONSTANT size_t generic_pool<VTypeSize, VAlignment, VSize>::SIZE;
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize, bool VOccupancy>
+  ETL_CONSTANT size_t generic_pool<VTypeSize, VAlignment, VSize, VOccupancy>::SIZE;
   
-  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
-  ETL_CONSTANT size_t generic_pool<VTypeSize, VAlignment, VSize>::ALIGNMENT;
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize, bool VOccupancy>
+  ETL_CONSTANT size_t generic_pool<VTypeSize, VAlignment, VSize, VOccupancy>::ALIGNMENT;
   
-  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
-  ETL_CONSTANT size_t generic_pool<VTypeSize, VAlignment, VSize>::TYPE_SIZE;
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize, bool VOccupancy>
+  ETL_CONSTANT size_t generic_pool<VTypeSize, VAlignment, VSize, VOccupancy>::TYPE_SIZE;
 
   //*************************************************************************
   /// A templated abstract pool implementation that uses a fixed size pool.
@@ -37,6 +37,7 @@ SOFTWARE.
 
 // The default hash calculation.
 #include "fnv_1.h"
+#include "wyhash.h"
 #include "type_traits.h"
 #include "static_assert.h"
 #include "math.h"
@@ -53,6 +54,47 @@ namespace etl
 {
   namespace private_hash
   {
+    // Define ETL_HASH_USE_WYHASH to use the word-at-a-time wyhash in place of FNV-1a.
+    // This changes the hash values of strings, string views and spans.
+#if defined(ETL_HASH_USE_WYHASH) && ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Hash to use when size_t is 16 bits.
+    /// T is always expected to be size_t.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint16_t), size_t>::type
+    generic_hash(const uint8_t* begin, const uint8_t* end)
+    {
+      uint64_t h = private_wyhash::hash(begin, static_cast<size_t>(end - begin), 0U);
+      h ^= (h >> 32U);
+
+      return static_cast<size_t>(h ^ (h >> 16U));
+    }
+
+    //*************************************************************************
+    /// Hash to use when size_t is 32 bits.
+    /// T is always expected to be size_t.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint32_t), size_t>::type
+    generic_hash(const uint8_t* begin, const uint8_t* end)
+    {
+      const uint64_t h = private_wyhash::hash(begin, static_cast<size_t>(end - begin), 0U);
+
+      return static_cast<size_t>(h ^ (h >> 32U));
+    }
+
+    //*************************************************************************
+    /// Hash to use when size_t is 64 bits.
+    /// T is always expected to be size_t.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint64_t), size_t>::type
+    generic_hash(const uint8_t* begin, const uint8_t* end)
+    {
+      return static_cast<size_t>(private_wyhash::hash(begin, static_cast<size_t>(end - begin), 0U));
+    }
+#else
     //*************************************************************************
     /// Hash to use when size_t is 16 bits.
     /// T is always expected to be size_t.
@@ -88,6 +130,8 @@ namespace etl
     {
       return fnv_1a_64(begin, end);
     }
+#endif
+
 #endif
 
     //*************************************************************************
@@ -39,6 +39,9 @@ SOFTWARE.
 #include "utility.h"
 #include "memory.h"
 #include "placement_new.h"
+#include "bit.h"
+
+#include <stdint.h>
 
 #define ETL_POOL_CPP03_CODE 0
 
@@ -96,6 +99,20 @@ namespace etl
     {}
   };
 
+  //***************************************************************************
+  /// The exception thrown when an object is released that is not allocated.
+  /// Only detected by etl::ipool_with_occupancy.
+  ///\ingroup pool
+  //***************************************************************************
+  class pool_object_not_allocated : public pool_exception
+  {
+  public:
+
+    pool_object_not_allocated(string_type file_name_, numeric_type line_number_)
+      : pool_exception(ETL_ERROR_TEXT("pool:not allocated", ETL_POOL_FILE_ID"D"), file_name_, line_number_)
+    {}
+  };
+
   //***************************************************************************
   ///\ingroup pool
   //***************************************************************************
@@ -128,11 +145,12 @@ namespace etl
 
     //***************************************************************************
     /// Iterate free list to confirm specified address is included or not
+    /// The list may end at the first item that has not yet been initialised.
     //***************************************************************************
     bool is_in_free_list(const char* address) const
     {
       const char* i = p_next;
-      while (i != ETL_NULLPTR)
+      while ((i != ETL_NULLPTR) && (i < buffer_end()))
       {
         if (address == i)
         {
@@ -466,6 +484,35 @@ namespace etl
       return is_item_in_pool((const char*)p);
     }
 
+    //*************************************************************************
+    /// Check to see if the object is currently allocated from the pool.
+    /// Searches the free list, so is linear in the number of free items.
+    /// etl::ipool_with_occupancy does this in constant time.
+    /// \param p_object A pointer to the object to be checked.
+    /// \return <b>true<\b> if it is, otherwise <b>false</b>
+    //*************************************************************************
+    bool is_allocated(const void* const p_object) const
+    {
+      const uintptr_t uip = uintptr_t(p_object);
+      const char*     p   = (const char*)uip;
+
+      if (!is_item_in_pool(p))
+      {
+        return false;
+      }
+
+      return (p < buffer_end()) && !is_in_free_list(p);
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the pool maintains an occupancy bitmap.
+    /// Always <b>false</b> for etl::ipool.
+    //*************************************************************************
+    bool has_occupancy_bitmap() const
+    {
+      return false;
+    }
+
     //*************************************************************************
     /// Returns the maximum number of items in the pool.
     //*************************************************************************
@@ -633,6 +680,9 @@ namespace etl
       return is_within_range && is_valid_address;
     }
 
+    // The bitmap pool reuses the free list and the bounds checks.
+    friend class ipool_with_occupancy;
+
     // Disable copy construction and assignment.
     ipool(const ipool&);
     ipool& operator =(const ipool&);
@@ -659,6 +709,472 @@ namespace etl
     ~ipool()
     {
     }
+#endif
+  };
+
+  //***************************************************************************
+  /// A pool that also keeps a bitmap of allocated items, one bit per item.
+  /// This gives constant time is_allocated, iteration that skips free items
+  /// a word at a time and detection of double release.
+  /// The bitmap is supplied by the derived class, so etl::ipool itself does
+  /// not grow. Not convertible to etl::ipool, as allocating or releasing
+  /// through that interface would not update the bitmap.
+  ///\ingroup pool
+  //***************************************************************************
+  class ipool_with_occupancy : private etl::ipool
+  {
+  public:
+
+    typedef etl::ipool::size_type size_type;
+
+    using etl::ipool::is_in_pool;
+    using etl::ipool::max_size;
+    using etl::ipool::max_item_size;
+    using etl::ipool::capacity;
+    using etl::ipool::available;
+    using etl::ipool::size;
+    using etl::ipool::empty;
+    using etl::ipool::full;
+
+    //***************************************************************************
+    template<bool is_const>
+    class occupancy_iterator
+    {
+    public:
+
+      friend class ipool_with_occupancy;
+
+      typedef typename etl::conditional<is_const, const char*, char*>::type   value_type;
+      typedef typename etl::conditional<is_const, const char*&, char*&>::type reference;
+      typedef typename etl::conditional<is_const, const char**, char**>::type pointer;
+      typedef ptrdiff_t                                                       difference_type;
+      typedef ETL_OR_STD::forward_iterator_tag                                iterator_category;
+      typedef typename etl::conditional<is_const, const void*, void*>::type   void_type;
+      typedef typename etl::conditional<is_const, const ipool_with_occupancy, ipool_with_occupancy>::type pool_type;
+
+      //***************************************************************************
+      occupancy_iterator(const occupancy_iterator& other)
+        : index(other.index)
+        , p_pool(other.p_pool)
+      {
+      }
+
+      //***************************************************************************
+      occupancy_iterator& operator ++()
+      {
+        index = p_pool->find_allocated_index(index + 1U);
+        return *this;
+      }
+
+      //***************************************************************************
+      occupancy_iterator operator ++(int)
+      {
+        occupancy_iterator temp(*this);
+        index = p_pool->find_allocated_index(index + 1U);
+        return temp;
+      }
+
+      //***************************************************************************
+      occupancy_iterator& operator =(const occupancy_iterator& other)
+      {
+        index  = other.index;
+        p_pool = other.p_pool;
+        return *this;
+      }
+
+      //***************************************************************************
+      void_type operator *() const
+      {
+        return p_pool->address_of(index);
+      }
+
+      //***************************************************************************
+      template <typename T>
+      T& get() const
+      {
+        return *reinterpret_cast<T*>(p_pool->address_of(index));
+      }
+
+      //***************************************************************************
+      friend bool operator == (const occupancy_iterator& lhs, const occupancy_iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      //***************************************************************************
+      friend bool operator != (const occupancy_iterator& lhs, const occupancy_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //***************************************************************************
+      /// Constructor
+      /// Moves to the first allocated item at or after index_.
+      //***************************************************************************
+      occupancy_iterator(size_t index_, pool_type* pool_)
+        : index(pool_->find_allocated_index(index_))
+        , p_pool(pool_)
+      {
+      }
+
+      size_t     index;
+      pool_type* p_pool;
+    };
+
+    template<bool is_const>
+    friend class occupancy_iterator;
+
+    typedef occupancy_iterator<false> iterator;
+
+    //***************************************************************************
+    class const_iterator : public occupancy_iterator<true>
+    {
+    public:
+      const_iterator(const occupancy_iterator<true>& other) : occupancy_iterator<true>(other) {}
+      const_iterator(const occupancy_iterator<false>& other) : occupancy_iterator<true>(other.index, other.p_pool) {}
+      const_iterator(size_t index_, pool_type* pool_) : occupancy_iterator<true>(index_, pool_) {}
+    };
+
+    //***************************************************************************
+    iterator begin()
+    {
+      return iterator(0U, this);
+    }
+
+    //***************************************************************************
+    iterator end()
+    {
+      return iterator(items_initialised, this);
+    }
+
+    //***************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(0U, this);
+    }
+
+    //***************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(items_initialised, this);
+    }
+
+    //***************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(0U, this);
+    }
+
+    //***************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(items_initialised, this);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate()
+    {
+      T* p = etl::ipool::allocate<T>();
+
+      if (p)
+      {
+        const size_t index = index_of(reinterpret_cast<const char*>(p));
+        p_occupancy[index / Occupancy_Bits] |= (uint32_t(1U) << (index % Occupancy_Bits));
+      }
+
+      return p;
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create default.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(etl::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'T'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename T>
+    void destroy(const T* const p_object)
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      p_object->~T();
+      release(p_object);
+    }
+
+    //*************************************************************************
+    /// Release an object in the pool.
+    /// If asserts or exceptions are enabled and the object does not belong to this
+    /// pool then an etl::pool_object_not_in_pool is thrown, and if it is not
+    /// allocated then an etl::pool_object_not_allocated is thrown.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    void release(const void* const p_object)
+    {
+      const uintptr_t uip = uintptr_t(p_object);
+      const char*     p   = (const char*)uip;
+
+      // Does it belong to us, and is it allocated?
+      ETL_ASSERT_OR_RETURN(is_item_in_pool(p), ETL_ERROR(pool_object_not_in_pool));
+
+      const size_t index = index_of(p);
+
+      ETL_ASSERT_OR_RETURN(is_occupied(index), ETL_ERROR(pool_object_not_allocated));
+
+      p_occupancy[index / Occupancy_Bits] &= ~(uint32_t(1U) << (index % Occupancy_Bits));
+
+      etl::ipool::release(p_object);
+    }
+
+    //*************************************************************************
+    /// Release all objects in the pool.
+    //*************************************************************************
+    void release_all()
+    {
+      etl::ipool::release_all();
+      clear_occupancy();
+    }
+
+    //*************************************************************************
+    /// Check to see if the object is currently allocated from the pool.
+    /// \param p_object A pointer to the object to be checked.
+    /// \return <b>true<\b> if it is, otherwise <b>false</b>
+    //*************************************************************************
+    bool is_allocated(const void* const p_object) const
+    {
+      const uintptr_t uip = uintptr_t(p_object);
+      const char*     p   = (const char*)uip;
+
+      return is_item_in_pool(p) && is_occupied(index_of(p));
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the pool maintains an occupancy bitmap.
+    /// Always <b>true</b> for etl::ipool_with_occupancy.
+    //*************************************************************************
+    bool has_occupancy_bitmap() const
+    {
+      return true;
+    }
+
+  protected:
+
+    static ETL_CONSTANT size_t Occupancy_Bits = 32U; ///< The number of items per bitmap word.
+
+    //*************************************************************************
+    /// The number of bitmap words needed for a pool of 'size' items.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t occupancy_words(size_t size)
+    {
+      return (size + Occupancy_Bits - 1U) / Occupancy_Bits;
+    }
+
+    //*************************************************************************
+    /// Constructor
+    /// The bitmap must have at least occupancy_words(max_size_) words.
+    //*************************************************************************
+    ipool_with_occupancy(char* p_buffer_, uint32_t item_size_, uint32_t max_size_, uint32_t* p_occupancy_)
+      : etl::ipool(p_buffer_, item_size_, max_size_)
+      , p_occupancy(p_occupancy_)
+    {
+      clear_occupancy();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The index of the item at the address.
+    //*************************************************************************
+    size_t index_of(const char* p) const
+    {
+      return uint32_t(p - p_buffer) / Item_Size;
+    }
+
+    //*************************************************************************
+    /// The address of the item at the index.
+    //*************************************************************************
+    char* address_of(size_t index)
+    {
+      return p_buffer + (index * Item_Size);
+    }
+
+    //*************************************************************************
+    /// The address of the item at the index.
+    //*************************************************************************
+    const char* address_of(size_t index) const
+    {
+      return p_buffer + (index * Item_Size);
+    }
+
+    //*************************************************************************
+    /// Is the item at the index marked as allocated in the bitmap?
+    //*************************************************************************
+    bool is_occupied(size_t index) const
+    {
+      return (p_occupancy[index / Occupancy_Bits] & (uint32_t(1U) << (index % Occupancy_Bits))) != 0U;
+    }
+
+    //*************************************************************************
+    /// Finds the first allocated item at or after the index.
+    /// Returns items_initialised if there are none.
+    //*************************************************************************
+    size_t find_allocated_index(size_t index) const
+    {
+      if (index >= items_initialised)
+      {
+        return items_initialised;
+      }
+
+      const size_t last_word = (items_initialised - 1U) / Occupancy_Bits;
+      size_t       word      = index / Occupancy_Bits;
+      uint32_t     bits      = p_occupancy[word] & (~uint32_t(0U) << (index % Occupancy_Bits));
+
+      // Skip whole words of free items.
+      while (bits == 0U)
+      {
+        if (++word > last_word)
+        {
+          return items_initialised;
+        }
+
+        bits = p_occupancy[word];
+      }
+
+      return (word * Occupancy_Bits) + size_t(etl::countr_zero(bits));
+    }
+
+    //*************************************************************************
+    /// Marks all items as free in the bitmap.
+    //*************************************************************************
+    void clear_occupancy()
+    {
+      const size_t words = occupancy_words(Max_Size);
+
+      for (size_t i = 0U; i < words; ++i)
+      {
+        p_occupancy[i] = 0U;
+      }
+    }
+
+    // Disable copy construction and assignment.
+    ipool_with_occupancy(const ipool_with_occupancy&);
+    ipool_with_occupancy& operator =(const ipool_with_occupancy&);
+
+    uint32_t* p_occupancy; ///< Bitmap of allocated items, one bit per item.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_POOL) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ipool_with_occupancy()
+    {
+    }
+#else
+  protected:
+    ~ipool_with_occupancy()
+    {
+    }
 #endif
   };
 }
@@ -0,0 +1,351 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MAGAZINE_MEMORY_BLOCK_ALLOCATOR_INCLUDED
+#define ETL_MAGAZINE_MEMORY_BLOCK_ALLOCATOR_INCLUDED
+
+#include "platform.h"
+#include "imemory_block_allocator.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the magazine_memory_block_allocator.
+  //***************************************************************************
+  class magazine_memory_block_allocator_exception : public etl::exception
+  {
+  public:
+
+    magazine_memory_block_allocator_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The thread index was not less than the number of magazines.
+  //***************************************************************************
+  class magazine_memory_block_allocator_thread_index : public etl::magazine_memory_block_allocator_exception
+  {
+  public:
+
+    magazine_memory_block_allocator_thread_index(string_type file_name_, numeric_type line_number_)
+      : etl::magazine_memory_block_allocator_exception(ETL_ERROR_TEXT("magazine_memory_block_allocator:thread index", ETL_MAGAZINE_MEMORY_BLOCK_ALLOCATOR_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //*************************************************************************
+  /// A cache of free memory blocks in front of a shared allocator, such as
+  /// an etl::fixed_sized_memory_block_allocator.
+  /// Each thread has its own magazine of up to VMagazine_Size blocks.
+  /// Allocations and releases use the calling thread's magazine, without
+  /// locking. The shared allocator is only locked to refill an empty
+  /// magazine, or to return blocks from a full one, half a magazine at a time.
+  ///
+  /// Override thread_index() to return the index of the calling thread,
+  /// from 0 to VThreads - 1, and lock() and unlock() to guard the shared
+  /// allocator. Each magazine must only be used by its own thread.
+  /// A block may be released by a different thread to the one that
+  /// allocated it; it goes to the releasing thread's magazine.
+  ///
+  /// The shared allocator's is_owner_of() is called without the lock.
+  /// This is safe for the allocators in the ETL, which test an address range.
+  ///
+  /// When used by an etl::reference_counted_message_pool, the pool's own
+  /// lock() and unlock() may be left as the default, which does nothing.
+  //*************************************************************************
+  template <size_t VBlock_Size, size_t VAlignment, size_t VThreads, size_t VMagazine_Size>
+  class magazine_memory_block_allocator : public imemory_block_allocator
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VThreads > 0U, "There must be at least one thread");
+    ETL_STATIC_ASSERT(VMagazine_Size > 0U, "The magazine size must be at least one");
+
+    static ETL_CONSTANT size_t Block_Size    = VBlock_Size;
+    static ETL_CONSTANT size_t Alignment     = VAlignment;
+    static ETL_CONSTANT size_t Threads       = VThreads;
+    static ETL_CONSTANT size_t Magazine_Size = VMagazine_Size;
+
+    /// The number of blocks moved to or from the shared allocator at a time.
+    static ETL_CONSTANT size_t Batch_Size = (VMagazine_Size + 1U) / 2U;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param shared_ The allocator shared by all of the threads.
+    //*************************************************************************
+    explicit magazine_memory_block_allocator(etl::imemory_block_allocator& shared_)
+      : shared(shared_)
+    {
+      for (size_t i = 0U; i < VThreads; ++i)
+      {
+        magazines[i].count   = 0U;
+        magazines[i].hits    = 0U;
+        magazines[i].refills = 0U;
+        magazines[i].flushes = 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// Virtual destructor.
+    /// Blocks still held in the magazines are not returned to the shared
+    /// allocator. Call flush() from each thread first, if required.
+    //*************************************************************************
+    virtual ~magazine_memory_block_allocator()
+    {
+    }
+
+    //*************************************************************************
+    /// Returns all of the calling thread's cached blocks to the shared allocator.
+    //*************************************************************************
+    void flush()
+    {
+      const size_t index = thread_index();
+
+      ETL_ASSERT_OR_RETURN(index < VThreads, ETL_ERROR(etl::magazine_memory_block_allocator_thread_index));
+
+      flush_magazine(magazines[index], magazines[index].count);
+    }
+
+    //*************************************************************************
+    /// The number of blocks cached by a thread.
+    //*************************************************************************
+    size_t cached(size_t index) const
+    {
+      return magazines[index].count;
+    }
+
+    //*************************************************************************
+    /// The number of a thread's allocations that were served from its magazine.
+    //*************************************************************************
+    size_t cache_hits(size_t index) const
+    {
+      return magazines[index].hits;
+    }
+
+    //*************************************************************************
+    /// The number of times a thread's magazine was refilled from the shared allocator.
+    /// Attempts that obtained no blocks are not counted.
+    //*************************************************************************
+    size_t refills(size_t index) const
+    {
+      return magazines[index].refills;
+    }
+
+    //*************************************************************************
+    /// The number of times a thread's magazine returned blocks to the shared allocator.
+    //*************************************************************************
+    size_t flushes(size_t index) const
+    {
+      return magazines[index].flushes;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Returns the index of the calling thread, from 0 to VThreads - 1.
+    //*************************************************************************
+    virtual size_t thread_index() const = 0;
+
+    //*************************************************************************
+    /// Locks the shared allocator.
+    //*************************************************************************
+    virtual void lock() = 0;
+
+    //*************************************************************************
+    /// Unlocks the shared allocator.
+    //*************************************************************************
+    virtual void unlock() = 0;
+
+    //*************************************************************************
+    /// The overridden virtual function to allocate a block.
+    //*************************************************************************
+    virtual void* allocate_block(size_t required_size, size_t required_alignment) ETL_OVERRIDE
+    {
+      if ((required_size > Block_Size) || (required_alignment > Alignment))
+      {
+        return ETL_NULLPTR;
+      }
+
+      const size_t index = thread_index();
+
+      ETL_ASSERT_OR_RETURN_VALUE(index < VThreads, ETL_ERROR(etl::magazine_memory_block_allocator_thread_index), ETL_NULLPTR);
+
+      magazine& m = magazines[index];
+
+      if (m.count == 0U)
+      {
+        refill_magazine(m);
+
+        if (m.count == 0U)
+        {
+          return ETL_NULLPTR;
+        }
+      }
+      else
+      {
+        ++m.hits;
+      }
+
+      return m.blocks[--m.count];
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to release a block.
+    //*************************************************************************
+    virtual bool release_block(const void* const pblock) ETL_OVERRIDE
+    {
+      if (!shared.is_owner_of(pblock))
+      {
+        return false;
+      }
+
+      const size_t index = thread_index();
+
+      ETL_ASSERT_OR_RETURN_VALUE(index < VThreads, ETL_ERROR(etl::magazine_memory_block_allocator_thread_index), false);
+
+      magazine& m = magazines[index];
+
+      if (m.count == VMagazine_Size)
+      {
+        flush_magazine(m, Batch_Size);
+      }
+
+      m.blocks[m.count++] = const_cast<void*>(pblock);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Returns true if the shared allocator is the owner of the block.
+    //*************************************************************************
+    virtual bool is_owner_of_block(const void* const pblock) const ETL_OVERRIDE
+    {
+      return shared.is_owner_of(pblock);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// A thread's cache of free blocks.
+    //*************************************************************************
+    struct magazine
+    {
+      void*  blocks[VMagazine_Size];
+      size_t count;
+      size_t hits;
+      size_t refills;
+      size_t flushes;
+
+      // Keeps the magazines of different threads on different cache lines.
+      char padding[ETL_CACHE_LINE_SIZE];
+    };
+
+    //*************************************************************************
+    /// Fills up to half of an empty magazine from the shared allocator.
+    //*************************************************************************
+    void refill_magazine(magazine& m)
+    {
+      lock();
+
+      while (m.count < Batch_Size)
+      {
+        void* p = shared.allocate(Block_Size, Alignment);
+
+        if (p == ETL_NULLPTR)
+        {
+          break;
+        }
+
+        m.blocks[m.count++] = p;
+      }
+
+      unlock();
+
+      // Only count a refill that obtained at least one block.
+      if (m.count != 0U)
+      {
+        ++m.refills;
+      }
+    }
+
+    //*************************************************************************
+    /// Returns up to 'n' blocks from a magazine to the shared allocator.
+    //*************************************************************************
+    void flush_magazine(magazine& m, size_t n)
+    {
+      if (m.count == 0U)
+      {
+        return;
+      }
+
+      lock();
+
+      while ((n != 0U) && (m.count != 0U))
+      {
+        shared.release(m.blocks[--m.count]);
+        --n;
+      }
+
+      unlock();
+
+      ++m.flushes;
+    }
+
+    /// The allocator shared by all of the threads.
+    etl::imemory_block_allocator& shared;
+
+    /// One magazine per thread.
+    magazine magazines[VThreads];
+  };
+
+  template <size_t VBlock_Size, size_t VAlignment, size_t VThreads, size_t VMagazine_Size>
+  ETL_CONSTANT size_t magazine_memory_block_allocator<VBlock_Size, VAlignment, VThreads, VMagazine_Size>::Block_Size;
+
+  template <size_t VBlock_Size, size_t VAlignment, size_t VThreads, size_t VMagazine_Size>
+  ETL_CONSTANT size_t magazine_memory_block_allocator<VBlock_Size, VAlignment, VThreads, VMagazine_Size>::Alignment;
+
+  template <size_t VBlock_Size, size_t VAlignment, size_t VThreads, size_t VMagazine_Size>
+  ETL_CONSTANT size_t magazine_memory_block_allocator<VBlock_Size, VAlignment, VThreads, VMagazine_Size>::Threads;
+
+  template <size_t VBlock_Size, size_t VAlignment, size_t VThreads, size_t VMagazine_Size>
+  ETL_CONSTANT size_t magazine_memory_block_allocator<VBlock_Size, VAlignment, VThreads, VMagazine_Size>::Magazine_Size;
+
+  template <size_t VBlock_Size, size_t VAlignment, size_t VThreads, size_t VMagazine_Size>
+  ETL_CONSTANT size_t magazine_memory_block_allocator<VBlock_Size, VAlignment, VThreads, VMagazine_Size>::Batch_Size;
+}
+
+#endif
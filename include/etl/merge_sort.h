@@ -0,0 +1,84 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MERGE_SORT_INCLUDED
+#define ETL_MERGE_SORT_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "iterator.h"
+#include "span.h"
+#include "static_assert.h"
+
+///\defgroup merge_sort merge_sort
+/// Stable bottom up merge sort, using a caller supplied scratch buffer.
+///\ingroup algorithm
+
+namespace etl
+{
+  //***************************************************************************
+  /// Sorts the elements using a bottom up merge sort.
+  /// A scratch buffer of half the length of the range gives O(n log n).
+  /// A smaller buffer is used where the merge fits, with the rest done in
+  /// place with rotations. An empty buffer sorts entirely in place, in
+  /// O(n log^2 n).
+  /// Stable.
+  /// Uses user defined comparison.
+  ///\param first   The start of the range.
+  ///\param last    The end of the range.
+  ///\param scratch The scratch buffer.
+  ///\param compare The comparison.
+  ///\ingroup merge_sort
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void merge_sort(TIterator first, TIterator last, etl::span<typename etl::iterator_traits<TIterator>::value_type> scratch, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(etl::is_random_access_iterator<TIterator>::value, "merge_sort requires random access iterators");
+
+    private_merge_sort::merge_sort(first, last, compare, scratch.data(), scratch.size());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using a bottom up merge sort.
+  /// Stable.
+  ///\param first   The start of the range.
+  ///\param last    The end of the range.
+  ///\param scratch The scratch buffer.
+  ///\ingroup merge_sort
+  //***************************************************************************
+  template <typename TIterator>
+  void merge_sort(TIterator first, TIterator last, etl::span<typename etl::iterator_traits<TIterator>::value_type> scratch)
+  {
+    etl::merge_sort(first, last, scratch, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+}
+
+#endif
@@ -0,0 +1,148 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MESSAGE_TIMER_WHEEL_LOCKED_INCLUDED
+#define ETL_MESSAGE_TIMER_WHEEL_LOCKED_INCLUDED
+
+#include "platform.h"
+#include "nullptr.h"
+#include "message_types.h"
+#include "message.h"
+#include "message_router.h"
+#include "message_bus.h"
+#include "static_assert.h"
+#include "timer.h"
+#include "power.h"
+#include "placement_new.h"
+#include "private/timer_wheel.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Interface for message timer wheel
+  /// Timers are held in a hashed timing wheel, so starting and stopping a
+  /// timer does not depend on the number of active timers.
+  /// Changes to the wheel are guarded by the lock delegates, and a tick is
+  /// skipped if the lock cannot be taken.
+  //***************************************************************************
+  class imessage_timer_wheel_locked
+    : public etl::private_timer_wheel::timer_wheel_base<etl::private_timer_wheel::message_timer_data<etl::imessage, etl::imessage_router, etl::message_router_id_t>,
+                                                        etl::private_timer_wheel::delegate_access>
+  {
+  public:
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer::id::type register_timer(const etl::imessage&     message_,
+                                        etl::imessage_router&    router_,
+                                        uint32_t                 period_,
+                                        bool                     repeating_,
+                                        etl::message_router_id_t destination_router_id_ = etl::imessage_router::ALL_MESSAGE_ROUTERS)
+    {
+      etl::timer::id::type id = etl::timer::id::NO_TIMER;
+
+      // There's no point adding null message routers.
+      if (!router_.is_null_router())
+      {
+        id = this->allocate_timer();
+
+        if (id != etl::timer::id::NO_TIMER)
+        {
+          // Create in-place.
+          ::new (&this->timer_at(id)) timer_data(id, message_, router_, period_, repeating_, destination_router_id_);
+        }
+      }
+
+      return id;
+    }
+
+  protected:
+
+    typedef etl::private_timer_wheel::message_timer_data<etl::imessage, etl::imessage_router, etl::message_router_id_t> timer_data;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    imessage_timer_wheel_locked(timer_data* const timer_array_, const uint_least8_t Max_Timers_,
+                               etl::timer::id::type* const wheel_slots_, const uint32_t Wheel_Size_)
+      : base_t(timer_array_, Max_Timers_, wheel_slots_, Wheel_Size_)
+    {
+    }
+
+  private:
+
+    typedef etl::private_timer_wheel::timer_wheel_base<etl::private_timer_wheel::message_timer_data<etl::imessage, etl::imessage_router, etl::message_router_id_t>,
+                                                       etl::private_timer_wheel::delegate_access> base_t;
+  };
+
+  //***************************************************************************
+  /// The message timer wheel
+  ///\tparam Wheel_Size_ The number of slots in the wheel. Must be a power of 2.
+  //***************************************************************************
+  template <uint_least8_t Max_Timers_, uint32_t Wheel_Size_ = 32U>
+  class message_timer_wheel_locked : public etl::imessage_timer_wheel_locked
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Timers_ <= 254U, "No more than 254 timers are allowed");
+    ETL_STATIC_ASSERT(etl::is_power_of_2<Wheel_Size_>::value, "The wheel size must be a power of 2");
+
+    typedef etl::imessage_timer_wheel_locked::try_lock_type try_lock_type;
+    typedef etl::imessage_timer_wheel_locked::lock_type     lock_type;
+    typedef etl::imessage_timer_wheel_locked::unlock_type   unlock_type;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_timer_wheel_locked()
+      : etl::imessage_timer_wheel_locked(timer_array, Max_Timers_, wheel_slots, Wheel_Size_)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_timer_wheel_locked(try_lock_type try_lock_, lock_type lock_, unlock_type unlock_)
+      : etl::imessage_timer_wheel_locked(timer_array, Max_Timers_, wheel_slots, Wheel_Size_)
+    {
+      this->set_locks(try_lock_, lock_, unlock_);
+    }
+
+  private:
+
+    etl::imessage_timer_wheel_locked::timer_data timer_array[Max_Timers_];
+    etl::timer::id::type wheel_slots[Wheel_Size_];
+  };
+}
+
+#endif
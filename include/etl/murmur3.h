@@ -34,6 +34,7 @@ SOFTWARE.
 #include "platform.h"
 #include "ihash.h"
 #include "iterator.h"
+#include "type_traits.h"
 #include "binary.h"
 #include "error_handler.h"
 
@@ -237,6 +238,437 @@ namespace etl
     static ETL_CONSTANT value_type MULTIPLY   = 5;
     static ETL_CONSTANT value_type ADD        = 0xE6546B64UL;
   };
+
+#if ETL_USING_64BIT_TYPES
+  namespace private_murmur3
+  {
+    static ETL_CONSTANT uint64_t C1 = 0x87C37B91114253D5ULL;
+    static ETL_CONSTANT uint64_t C2 = 0x4CF5AD432745937FULL;
+
+    //*************************************************************************
+    /// Reads 8 little endian bytes.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 uint64_t read64(TIterator p)
+    {
+      uint64_t value = 0U;
+
+      for (int i = 7; i >= 0; --i)
+      {
+        value = (value << 8U) | static_cast<uint8_t>(p[i]);
+      }
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Mixes the first word of a block.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint64_t mix_k1(uint64_t k1)
+    {
+      k1 *= C1;
+      k1  = etl::rotate_left(k1, 31U);
+      k1 *= C2;
+
+      return k1;
+    }
+
+    //*************************************************************************
+    /// Mixes the second word of a block.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint64_t mix_k2(uint64_t k2)
+    {
+      k2 *= C2;
+      k2  = etl::rotate_left(k2, 33U);
+      k2 *= C1;
+
+      return k2;
+    }
+
+    //*************************************************************************
+    /// The 64 bit finalisation mix.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint64_t fmix64(uint64_t k)
+    {
+      k ^= k >> 33U;
+      k *= 0xFF51AFD7ED558CCDULL;
+      k ^= k >> 33U;
+      k *= 0xC4CEB9FE1A85EC53ULL;
+      k ^= k >> 33U;
+
+      return k;
+    }
+
+    //*************************************************************************
+    /// The state of a MurmurHash3_x64_128 calculation.
+    /// Whole 16 byte blocks are read directly from random access sources;
+    /// anything else goes through a 16 byte buffer.
+    /// The value may be read at any time without finalising the state.
+    //*************************************************************************
+    class murmur3_x64_state
+    {
+    public:
+
+      static ETL_CONSTANT size_t Block_Size = 16U;
+
+      //***********************************
+      ETL_CONSTEXPR14 explicit murmur3_x64_state(uint32_t seed_)
+        : h1(seed_)
+        , h2(seed_)
+        , length(0U)
+        , seed(seed_)
+        , buffer()
+      {
+      }
+
+      //***********************************
+      ETL_CONSTEXPR14 void reset()
+      {
+        h1     = seed;
+        h2     = seed;
+        length = 0U;
+      }
+
+      //***********************************
+      ETL_CONSTEXPR14 void add(uint8_t value_)
+      {
+        buffer[buffered()] = value_;
+        ++length;
+
+        if (buffered() == 0U)
+        {
+          add_block(buffer);
+        }
+      }
+
+      //***********************************
+      template<typename TIterator>
+      ETL_CONSTEXPR14 void add(TIterator begin, const TIterator end, etl::false_type)
+      {
+        while (begin != end)
+        {
+          add(static_cast<uint8_t>(*begin));
+          ++begin;
+        }
+      }
+
+      //***********************************
+      template<typename TIterator>
+      ETL_CONSTEXPR14 void add(TIterator begin, const TIterator end, etl::true_type)
+      {
+        typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+        const difference_type block_size = static_cast<difference_type>(Block_Size);
+
+        // Fill any partial block.
+        while ((buffered() != 0U) && (begin != end))
+        {
+          add(static_cast<uint8_t>(*begin));
+          ++begin;
+        }
+
+        while ((end - begin) >= block_size)
+        {
+          add_block(begin);
+          begin  += block_size;
+          length += Block_Size;
+        }
+
+        add(begin, end, etl::false_type());
+      }
+
+      //***********************************
+      /// Calculates the hash of the data added so far.
+      /// 'low' receives the first eight bytes of the reference output, 'high' the second.
+      //***********************************
+      ETL_CONSTEXPR14 void value(uint64_t& low, uint64_t& high) const
+      {
+        uint64_t r1 = h1;
+        uint64_t r2 = h2;
+        uint64_t k1 = 0U;
+        uint64_t k2 = 0U;
+
+        const size_t remaining = buffered();
+
+        for (size_t i = remaining; i > 8U; --i)
+        {
+          k2 = (k2 << 8U) | buffer[i - 1U];
+        }
+
+        for (size_t i = (remaining < 8U) ? remaining : 8U; i > 0U; --i)
+        {
+          k1 = (k1 << 8U) | buffer[i - 1U];
+        }
+
+        if (remaining > 8U)
+        {
+          r2 ^= mix_k2(k2);
+        }
+
+        if (remaining > 0U)
+        {
+          r1 ^= mix_k1(k1);
+        }
+
+        r1 ^= length;
+        r2 ^= length;
+
+        r1 += r2;
+        r2 += r1;
+
+        r1 = fmix64(r1);
+        r2 = fmix64(r2);
+
+        r1 += r2;
+        r2 += r1;
+
+        low  = r1;
+        high = r2;
+      }
+
+    private:
+
+      //***********************************
+      ETL_CONSTEXPR14 size_t buffered() const
+      {
+        return static_cast<size_t>(length % Block_Size);
+      }
+
+      //***********************************
+      /// Adds a 16 byte block to the state.
+      //***********************************
+      template <typename TIterator>
+      ETL_CONSTEXPR14 void add_block(TIterator p)
+      {
+        h1 ^= mix_k1(read64(p));
+        h1  = etl::rotate_left(h1, 27U);
+        h1 += h2;
+        h1  = (h1 * 5U) + 0x52DCE729ULL;
+
+        h2 ^= mix_k2(read64(p + 8));
+        h2  = etl::rotate_left(h2, 31U);
+        h2 += h1;
+        h2  = (h2 * 5U) + 0x38495AB5ULL;
+      }
+
+      uint64_t h1;
+      uint64_t h2;
+      uint64_t length;
+      uint32_t seed;
+      uint8_t  buffer[Block_Size];
+    };
+  }
+
+  //***************************************************************************
+  /// The 128 bit result of etl::murmur3_x64_128.
+  ///\ingroup murmur3
+  //***************************************************************************
+  struct murmur3_x64_128_value
+  {
+    uint64_t low;  ///< The first eight bytes of the reference output.
+    uint64_t high; ///< The second eight bytes of the reference output.
+
+    //*************************************************************************
+    friend ETL_CONSTEXPR bool operator ==(const murmur3_x64_128_value& lhs, const murmur3_x64_128_value& rhs)
+    {
+      return (lhs.low == rhs.low) && (lhs.high == rhs.high);
+    }
+
+    //*************************************************************************
+    friend ETL_CONSTEXPR bool operator !=(const murmur3_x64_128_value& lhs, const murmur3_x64_128_value& rhs)
+    {
+      return !(lhs == rhs);
+    }
+  };
+
+  //***************************************************************************
+  /// Calculates the 128 bit MurmurHash3_x64_128 hash.
+  /// Random access ranges are hashed a 16 byte block at a time.
+  /// The value may be read at any time and more data added afterwards.
+  /// See https://en.wikipedia.org/wiki/MurmurHash for more details.
+  ///\ingroup murmur3
+  //***************************************************************************
+  class murmur3_x64_128
+  {
+  public:
+
+    typedef murmur3_x64_128_value value_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    ETL_CONSTEXPR14 murmur3_x64_128(uint32_t seed_ = 0U)
+      : state(seed_)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    ETL_CONSTEXPR14 murmur3_x64_128(TIterator begin, const TIterator end, uint32_t seed_ = 0U)
+      : state(seed_)
+    {
+      add(begin, end);
+    }
+
+    //*************************************************************************
+    /// Resets the hash to the initial state.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void reset()
+    {
+      state.reset();
+    }
+
+    //*************************************************************************
+    /// Adds a range.
+    /// \param begin
+    /// \param end
+    //*************************************************************************
+    template<typename TIterator>
+    ETL_CONSTEXPR14 void add(TIterator begin, const TIterator end)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+
+      state.add(begin, end, etl::integral_constant<bool, etl::is_random_access_iterator<TIterator>::value>());
+    }
+
+    //*************************************************************************
+    /// Adds a uint8_t value.
+    /// \param value The char to add to the hash.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void add(uint8_t value_)
+    {
+      state.add(value_);
+    }
+
+    //*************************************************************************
+    /// Gets the hash value.
+    //*************************************************************************
+    ETL_CONSTEXPR14 value_type value() const
+    {
+      value_type result = { 0U, 0U };
+
+      state.value(result.low, result.high);
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Gets the first 64 bits of the hash value.
+    //*************************************************************************
+    ETL_CONSTEXPR14 uint64_t value64() const
+    {
+      return value().low;
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    ETL_CONSTEXPR14 operator value_type () const
+    {
+      return value();
+    }
+
+  private:
+
+    private_murmur3::murmur3_x64_state state;
+  };
+
+  //***************************************************************************
+  /// Calculates a 64 bit hash, the first 64 bits of MurmurHash3_x64_128.
+  /// Random access ranges are hashed a 16 byte block at a time.
+  /// The value may be read at any time and more data added afterwards.
+  ///\ingroup murmur3
+  //***************************************************************************
+  class murmur3_x64_64
+  {
+  public:
+
+    typedef uint64_t value_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    ETL_CONSTEXPR14 murmur3_x64_64(uint32_t seed_ = 0U)
+      : state(seed_)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    ETL_CONSTEXPR14 murmur3_x64_64(TIterator begin, const TIterator end, uint32_t seed_ = 0U)
+      : state(seed_)
+    {
+      add(begin, end);
+    }
+
+    //*************************************************************************
+    /// Resets the hash to the initial state.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void reset()
+    {
+      state.reset();
+    }
+
+    //*************************************************************************
+    /// Adds a range.
+    /// \param begin
+    /// \param end
+    //*************************************************************************
+    template<typename TIterator>
+    ETL_CONSTEXPR14 void add(TIterator begin, const TIterator end)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+
+      state.add(begin, end, etl::integral_constant<bool, etl::is_random_access_iterator<TIterator>::value>());
+    }
+
+    //*************************************************************************
+    /// Adds a uint8_t value.
+    /// \param value The char to add to the hash.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void add(uint8_t value_)
+    {
+      state.add(value_);
+    }
+
+    //*************************************************************************
+    /// Gets the hash value.
+    //*************************************************************************
+    ETL_CONSTEXPR14 value_type value() const
+    {
+      uint64_t low  = 0U;
+      uint64_t high = 0U;
+
+      state.value(low, high);
+
+      return low;
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    ETL_CONSTEXPR14 operator value_type () const
+    {
+      return value();
+    }
+
+  private:
+
+    private_murmur3::murmur3_x64_state state;
+  };
+#endif
 }
 
 #endif
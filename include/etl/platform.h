@@ -310,6 +310,14 @@ SOFTWARE.
   #define ETL_USING_STD_EXCEPTION 0
 #endif
 
+//*************************************
+// Indicate if the slice-by-N CRCs may use hardware CRC instructions.
+#if defined(ETL_USE_CRC_INTRINSICS)
+  #define ETL_USING_CRC_INTRINSICS 1
+#else
+  #define ETL_USING_CRC_INTRINSICS 0
+#endif
+
 //*************************************
 // Indicate if etl::literals::chrono_literals uses ETL verbose style.
 #if defined(ETL_USE_VERBOSE_CHRONO_LITERALS) && ETL_USING_CPP11
@@ -567,6 +575,12 @@ SOFTWARE.
   #endif
 #endif
 
+//*************************************
+// The cache line size used to keep data written by different threads apart.
+#if !defined(ETL_CACHE_LINE_SIZE)
+  #define ETL_CACHE_LINE_SIZE 64
+#endif
+
 //*************************************
 // Determine if the ETL should use std::initializer_list.
 #if (defined(ETL_FORCE_ETL_INITIALIZER_LIST) && defined(ETL_FORCE_STD_INITIALIZER_LIST))
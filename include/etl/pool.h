@@ -47,14 +47,15 @@ namespace etl
 {
   //*************************************************************************
   /// A templated pool implementation that uses a fixed size pool.
+  ///\tparam VOccupancy If true, the pool keeps an occupancy bitmap.
   ///\ingroup pool
   //*************************************************************************
-  template <typename T, const size_t VSize>
-  class pool : public etl::generic_pool<sizeof(T), etl::alignment_of<T>::value, VSize>
+  template <typename T, const size_t VSize, bool VOccupancy = false>
+  class pool : public etl::generic_pool<sizeof(T), etl::alignment_of<T>::value, VSize, VOccupancy>
   {
   private:
 
-    typedef etl::generic_pool<sizeof(T), etl::alignment_of<T>::value, VSize> base_t;
+    typedef etl::generic_pool<sizeof(T), etl::alignment_of<T>::value, VSize, VOccupancy> base_t;
 
   public:
 
@@ -0,0 +1,704 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_POOL_ATOMIC_INCLUDED
+#define ETL_POOL_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "ipool.h"
+#include "alignment.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "utility.h"
+#include "placement_new.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+//*****************************************************************************
+///\defgroup pool_atomic pool_atomic
+/// A fixed capacity pool that may be shared between threads without a lock.
+/// The free items are held in a lock free (Treiber) stack. The top of the
+/// stack holds the index of the first free item with a tag that changes on
+/// every update, so that an item that was allocated and released between a
+/// thread's read of the top and its update is detected (the ABA problem).
+/// The tagged index is the size of a pointer, so that it is lock free
+/// wherever a pointer is. The tag is 32 bits on 64 bit targets and 16 bits
+/// on 32 bit targets, which also limits the capacity to 65534 items.
+/// Unlike etl::ipool, a failed allocation returns a null pointer without
+/// raising an error, as the pool may be refilled by another thread at any time.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for lock free pools.
+  ///\ingroup pool_atomic
+  //***************************************************************************
+  class ipool_atomic
+  {
+  public:
+
+    typedef uintptr_t head_type;
+    typedef uint32_t  index_type;
+
+    /// The number of bits of the top of the stack that hold the index.
+    /// The other half hold the tag.
+    static ETL_CONSTANT size_t Index_Bits = sizeof(head_type) * 4U;
+
+    /// The largest capacity of a pool.
+    static ETL_CONSTANT size_t Max_Capacity = (head_type(1U) << Index_Bits) - 2U;
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool.
+    /// Returns a null pointer if there are no free items.
+    //*************************************************************************
+    template <typename T>
+    T* allocate()
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      return reinterpret_cast<T*>(allocate_item());
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create default.
+    /// Returns a null pointer if there are no free items.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    /// Returns a null pointer if there are no free items.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    /// Returns a null pointer if there are no free items.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(etl::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'T'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename T>
+    void destroy(const T* const p_object)
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      p_object->~T();
+      release(p_object);
+    }
+
+    //*************************************************************************
+    /// Release an object in the pool.
+    /// If asserts or exceptions are enabled and the object does not belong to this
+    /// pool then an etl::pool_object_not_in_pool is thrown.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    void release(const void* const p_object)
+    {
+      const char* p = static_cast<const char*>(p_object);
+
+      ETL_ASSERT_OR_RETURN(is_in_pool(p), ETL_ERROR(etl::pool_object_not_in_pool));
+
+      release_item(index_type((p - p_buffer) / Item_Size));
+    }
+
+    //*************************************************************************
+    /// Check to see if the object belongs to the pool.
+    /// \param p_object A pointer to the object to be checked.
+    /// \return <b>true<\b> if it does, otherwise <b>false</b>
+    //*************************************************************************
+    bool is_in_pool(const void* const p_object) const
+    {
+      const intptr_t distance = static_cast<const char*>(p_object) - p_buffer;
+
+      return (distance >= 0) && (distance <= intptr_t((Item_Size * Max_Size) - Item_Size));
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the pool.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum size of an item in the pool.
+    //*************************************************************************
+    size_t max_item_size() const
+    {
+      return Item_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the pool.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of free items in the pool.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t available() const
+    {
+      return Max_Size - size();
+    }
+
+    //*************************************************************************
+    /// Returns the number of allocated items in the pool.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_t size() const
+    {
+      return items_allocated.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no allocated items in the pool.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no free items in the pool.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool full() const
+    {
+      return index_of(top.load(etl::memory_order_relaxed)) == Null_Index;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    ipool_atomic(char* p_buffer_, etl::atomic<index_type>* p_next_, uint32_t item_size_, uint32_t max_size_)
+      : p_buffer(p_buffer_)
+      , p_next(p_next_)
+      , top(make_head(0U, 0U))
+      , items_allocated(0U)
+      , Item_Size(item_size_)
+      , Max_Size(max_size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Links all of the items into the free stack.
+    /// Called by the derived class once its 'next' array has been constructed.
+    //*************************************************************************
+    void initialise()
+    {
+      for (index_type i = 0U; i < Max_Size; ++i)
+      {
+        p_next[i].store(((i + 1U) < Max_Size) ? (i + 1U) : Null_Index, etl::memory_order_relaxed);
+      }
+
+      top.store(make_head((Max_Size == 0U) ? Null_Index : 0U, 0U), etl::memory_order_release);
+    }
+
+  private:
+
+    static ETL_CONSTANT head_type  Index_Mask = (head_type(1U) << Index_Bits) - 1U;
+    static ETL_CONSTANT index_type Null_Index = index_type(Index_Mask);
+
+    //*************************************************************************
+    /// Packs an index and a tag into the top of the stack.
+    //*************************************************************************
+    static head_type make_head(head_type index, head_type tag)
+    {
+      return (tag << Index_Bits) | index;
+    }
+
+    //*************************************************************************
+    static index_type index_of(head_type head)
+    {
+      return index_type(head & Index_Mask);
+    }
+
+    //*************************************************************************
+    static head_type next_tag(head_type head)
+    {
+      return (head >> Index_Bits) + 1U;
+    }
+
+    //*************************************************************************
+    /// Pops a free item.
+    //*************************************************************************
+    char* allocate_item()
+    {
+      head_type head = top.load(etl::memory_order_acquire);
+
+      while (index_of(head) != Null_Index)
+      {
+        const index_type index = index_of(head);
+
+        // If another thread has taken this item, the tag will have changed
+        // and the exchange will fail, so a stale 'next' is never used.
+        const head_type new_head = make_head(p_next[index].load(etl::memory_order_relaxed), next_tag(head));
+
+        if (top.compare_exchange_weak(head, new_head, etl::memory_order_acquire, etl::memory_order_acquire))
+        {
+          items_allocated.fetch_add(1U, etl::memory_order_relaxed);
+
+          return p_buffer + (size_t(index) * Item_Size);
+        }
+      }
+
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Pushes a released item.
+    //*************************************************************************
+    void release_item(index_type index)
+    {
+      head_type head = top.load(etl::memory_order_relaxed);
+      head_type new_head;
+
+      do
+      {
+        p_next[index].store(index_of(head), etl::memory_order_relaxed);
+        new_head = make_head(index, next_tag(head));
+      } while (!top.compare_exchange_weak(head, new_head, etl::memory_order_release, etl::memory_order_relaxed));
+
+      items_allocated.fetch_sub(1U, etl::memory_order_relaxed);
+    }
+
+    char*                    p_buffer;        ///< The items.
+    etl::atomic<index_type>* p_next;          ///< The index of the next free item, for each free item.
+    etl::atomic<head_type>   top;             ///< The tagged index of the first free item.
+    etl::atomic<uint32_t>    items_allocated; ///< The number of allocated items.
+
+    const uint32_t Item_Size;
+    const uint32_t Max_Size;
+
+    // Disable copy construction and assignment.
+    ipool_atomic(const ipool_atomic&) ETL_DELETE;
+    ipool_atomic& operator =(const ipool_atomic&) ETL_DELETE;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_POOL) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ipool_atomic()
+    {
+    }
+#else
+  protected:
+    ~ipool_atomic()
+    {
+    }
+#endif
+  };
+
+  //*************************************************************************
+  /// A lock free pool of items of a fixed size and alignment.
+  ///\ingroup pool_atomic
+  //*************************************************************************
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  class generic_pool_atomic : public etl::ipool_atomic
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VSize <= etl::ipool_atomic::Max_Capacity, "Too many items for the tagged index");
+
+    static ETL_CONSTANT size_t SIZE      = VSize;
+    static ETL_CONSTANT size_t ALIGNMENT = VAlignment;
+    static ETL_CONSTANT size_t TYPE_SIZE = VTypeSize;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    generic_pool_atomic()
+      : etl::ipool_atomic(reinterpret_cast<char*>(&buffer[0]), next, Element_Size, VSize)
+    {
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Allocate an object from the pool.
+    /// Returns a null pointer if there are no free items.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U>
+    U* allocate()
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::allocate<U>();
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with default.
+    /// Returns a null pointer if there are no free items.
+    //*************************************************************************
+    template <typename U>
+    U* create()
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    /// Returns a null pointer if there are no free items.
+    //*************************************************************************
+    template <typename U, typename T1>
+    U* create(const T1& value1)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>(value1);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 2 parameters.
+    /// Returns a null pointer if there are no free items.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2>
+    U* create(const T1& value1, const T2& value2)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>(value1, value2);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 3 parameters.
+    /// Returns a null pointer if there are no free items.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3>
+    U* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>(value1, value2, value3);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 4 parameters.
+    /// Returns a null pointer if there are no free items.
+    //*************************************************************************
+    template <typename U, typename T1, typename T2, typename T3, typename T4>
+    U* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>(value1, value2, value3, value4);
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    /// Returns a null pointer if there are no free items.
+    //*************************************************************************
+    template <typename U, typename... Args>
+    U* create(Args&&... args)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool_atomic::create<U>(etl::forward<Args>(args)...);
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'U'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename U>
+    void destroy(const U* const p_object)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      ipool_atomic::destroy(p_object);
+    }
+
+  private:
+
+    // The pool element.
+    union Element
+    {
+      char      value[VTypeSize]; ///< Storage for value type.
+      typename  etl::type_with_alignment<VAlignment>::type dummy; ///< Dummy item to get correct alignment.
+    };
+
+    ///< The memory for the pool of objects.
+    typename etl::aligned_storage<sizeof(Element), etl::alignment_of<Element>::value>::type buffer[VSize];
+
+    ///< The free stack links.
+    etl::atomic<etl::ipool_atomic::index_type> next[VSize];
+
+    static ETL_CONSTANT uint32_t Element_Size = sizeof(Element);
+
+    // Should not be copied.
+    generic_pool_atomic(const generic_pool_atomic&) ETL_DELETE;
+    generic_pool_atomic& operator =(const generic_pool_atomic&) ETL_DELETE;
+  };
+
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t generic_pool_atomic<VTypeSize, VAlignment, VSize>::SIZE;
+
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t generic_pool_atomic<VTypeSize, VAlignment, VSize>::ALIGNMENT;
+
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT size_t generic_pool_atomic<VTypeSize, VAlignment, VSize>::TYPE_SIZE;
+
+  template <size_t VTypeSize, size_t VAlignment, size_t VSize>
+  ETL_CONSTANT uint32_t generic_pool_atomic<VTypeSize, VAlignment, VSize>::Element_Size;
+
+  //*************************************************************************
+  /// A lock free pool of 'T'.
+  ///\ingroup pool_atomic
+  //*************************************************************************
+  template <typename T, const size_t VSize>
+  class pool_atomic : public etl::generic_pool_atomic<sizeof(T), etl::alignment_of<T>::value, VSize>
+  {
+  private:
+
+    typedef etl::generic_pool_atomic<sizeof(T), etl::alignment_of<T>::value, VSize> base_t;
+
+  public:
+
+    using base_t::SIZE;
+    using base_t::ALIGNMENT;
+    using base_t::TYPE_SIZE;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    pool_atomic()
+    {
+    }
+
+    //*************************************************************************
+    /// Allocate an object from the pool.
+    /// Returns a null pointer if there are no free items.
+    //*************************************************************************
+    T* allocate()
+    {
+      return base_t::template allocate<T>();
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with default.
+    /// Returns a null pointer if there are no free items.
+    //*************************************************************************
+    T* create()
+    {
+      return base_t::template create<T>();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    /// Returns a null pointer if there are no free items.
+    //*************************************************************************
+    template <typename T1>
+    T* create(const T1& value1)
+    {
+      return base_t::template create<T>(value1);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 2 parameters.
+    /// Returns a null pointer if there are no free items.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      return base_t::template create<T>(value1, value2);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 3 parameters.
+    /// Returns a null pointer if there are no free items.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      return base_t::template create<T>(value1, value2, value3);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 4 parameters.
+    /// Returns a null pointer if there are no free items.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      return base_t::template create<T>(value1, value2, value3, value4);
+    }
+#else
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with variadic parameters.
+    /// Returns a null pointer if there are no free items.
+    //*************************************************************************
+    template <typename... Args>
+    T* create(Args&&... args)
+    {
+      return base_t::template create<T>(etl::forward<Args>(args)...);
+    }
+#endif
+
+    //*************************************************************************
+    /// Releases the object.
+    /// Undefined behaviour if the pool does not contain a 'U' object derived from 'U'.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    template <typename U>
+    void release(const U* const p_object)
+    {
+      ETL_STATIC_ASSERT((etl::is_same<U, T>::value || etl::is_base_of<U, T>::value), "Pool does not contain this type");
+      base_t::release(p_object);
+    }
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'U' object derived from 'U'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename U>
+    void destroy(const U* const p_object)
+    {
+      ETL_STATIC_ASSERT((etl::is_base_of<U, T>::value), "Pool does not contain this type");
+      base_t::destroy(p_object);
+    }
+
+  private:
+
+    // Should not be copied.
+    pool_atomic(const pool_atomic&) ETL_DELETE;
+    pool_atomic& operator =(const pool_atomic&) ETL_DELETE;
+  };
+}
+
+#endif
+#endif
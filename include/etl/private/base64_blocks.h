@@ -0,0 +1,563 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BASE64_BLOCKS_INCLUDED
+#define ETL_BASE64_BLOCKS_INCLUDED
+
+///\ingroup private
+
+#include "../platform.h"
+#include "../type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+// Select the block implementation.
+// Define ETL_BASE64_NO_SIMD to force the portable implementation.
+// The vector kernels are only used where constant evaluation can be detected,
+// as the encoders and decoders may be used in constexpr contexts.
+//*****************************************************************************
+#if !defined(ETL_BASE64_NO_SIMD) && (ETL_USING_CPP23 || (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1))
+  #if defined(__AVX2__)
+    #define ETL_BASE64_USING_AVX2
+    #define ETL_BASE64_USING_SSSE3
+    #define ETL_BASE64_USING_SIMD
+    #include <immintrin.h>
+  #elif defined(__SSSE3__)
+    #define ETL_BASE64_USING_SSSE3
+    #define ETL_BASE64_USING_SIMD
+    #include <tmmintrin.h>
+  #elif (defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64)
+    #define ETL_BASE64_USING_NEON
+    #define ETL_BASE64_USING_SIMD
+    #include <arm_neon.h>
+  #endif
+#endif
+
+//*****************************************************************************
+// The sextet values of 'A'-'Z', 'a'-'z' and '0'-'9', which are common to all
+// of the character sets. Every other character maps to 0xFF.
+//*****************************************************************************
+#define ETL_BASE64_SEXTETS \
+  { \
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, \
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, \
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, \
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, \
+    0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, \
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, \
+    0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, \
+    0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF  \
+  }
+
+namespace etl
+{
+  namespace private_base64
+  {
+    //*************************************************************************
+    /// The sextet lookup for the 7 bit characters.
+    //*************************************************************************
+    template <typename T = void>
+    struct tables
+    {
+#if ETL_USING_CPP11
+      static ETL_CONSTANT uint8_t sextets[128] = ETL_BASE64_SEXTETS;
+#else
+      static const uint8_t sextets[128];
+#endif
+    };
+
+#if ETL_USING_CPP11
+    template <typename T>
+    ETL_CONSTANT uint8_t tables<T>::sextets[128];
+#else
+    template <typename T>
+    const uint8_t tables<T>::sextets[128] = ETL_BASE64_SEXTETS;
+#endif
+
+    //*************************************************************************
+    /// Gets the sextet value of a character, or 0xFF if it is not part of the
+    /// character set.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 uint8_t sextet(T c, const char* encoder_table)
+    {
+      const uint8_t u = static_cast<uint8_t>(c);
+
+      uint8_t value = (u < 128U) ? tables<>::sextets[u] : 0xFFU;
+
+      if (value == 0xFFU)
+      {
+        if (u == static_cast<uint8_t>(encoder_table[62]))
+        {
+          value = 62U;
+        }
+        else if (u == static_cast<uint8_t>(encoder_table[63]))
+        {
+          value = 63U;
+        }
+      }
+
+      return value;
+    }
+
+#if defined(ETL_BASE64_USING_SSSE3)
+    //*************************************************************************
+    /// Splits the first 12 bytes of each 16 byte lane into 16 sextets.
+    //*************************************************************************
+    inline __m128i encode_sextets(__m128i input)
+    {
+      input = _mm_shuffle_epi8(input, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+      const __m128i t0 = _mm_mulhi_epu16(_mm_and_si128(input, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+      const __m128i t1 = _mm_mullo_epi16(_mm_and_si128(input, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+
+      return _mm_or_si128(t0, t1);
+    }
+
+    //*************************************************************************
+    /// Converts sextets to characters.
+    /// The sextet ranges 0-25, 26-51, 52-61, 62 and 63 are reduced to an index
+    /// into a table of offsets from the sextet to its character.
+    //*************************************************************************
+    inline __m128i encode_characters(__m128i sextets, __m128i offsets)
+    {
+      __m128i index = _mm_subs_epu8(sextets, _mm_set1_epi8(51));
+      index = _mm_or_si128(index, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), sextets), _mm_set1_epi8(13)));
+
+      return _mm_add_epi8(sextets, _mm_shuffle_epi8(offsets, index));
+    }
+
+    //*************************************************************************
+    /// The offsets from each sextet range to its characters.
+    //*************************************************************************
+    inline __m128i encode_offsets(const char* encoder_table)
+    {
+      const char digits = static_cast<char>('0' - 52);
+
+      return _mm_setr_epi8(static_cast<char>('a' - 26), digits, digits, digits, digits, digits, digits, digits, digits, digits, digits,
+                           static_cast<char>(encoder_table[62] - 62), static_cast<char>(encoder_table[63] - 63), 'A', 0, 0);
+    }
+
+    //*************************************************************************
+    /// Converts 16 characters to sextets.
+    /// Returns false if any of them are not part of the character set.
+    //*************************************************************************
+    inline bool decode_sextets(__m128i input, const char* encoder_table, __m128i& sextets)
+    {
+      const __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(input, _mm_set1_epi8('A' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('Z' + 1), input));
+      const __m128i lower = _mm_and_si128(_mm_cmpgt_epi8(input, _mm_set1_epi8('a' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), input));
+      const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(input, _mm_set1_epi8('0' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), input));
+      const __m128i is_62 = _mm_cmpeq_epi8(input, _mm_set1_epi8(encoder_table[62]));
+      const __m128i is_63 = _mm_cmpeq_epi8(input, _mm_set1_epi8(encoder_table[63]));
+
+      const __m128i valid = _mm_or_si128(_mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, is_62)), is_63);
+
+      if (_mm_movemask_epi8(valid) != 0xFFFF)
+      {
+        return false;
+      }
+
+      __m128i offset = _mm_and_si128(upper, _mm_set1_epi8(static_cast<char>(0 - 'A')));
+      offset = _mm_or_si128(offset, _mm_and_si128(lower, _mm_set1_epi8(static_cast<char>(26 - 'a'))));
+      offset = _mm_or_si128(offset, _mm_and_si128(digit, _mm_set1_epi8(static_cast<char>(52 - '0'))));
+      offset = _mm_or_si128(offset, _mm_and_si128(is_62, _mm_set1_epi8(static_cast<char>(62 - encoder_table[62]))));
+      offset = _mm_or_si128(offset, _mm_and_si128(is_63, _mm_set1_epi8(static_cast<char>(63 - encoder_table[63]))));
+
+      sextets = _mm_add_epi8(input, offset);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Packs the 16 sextets into the first 12 bytes of the lane.
+    //*************************************************************************
+    inline __m128i decode_octets(__m128i sextets)
+    {
+      const __m128i pairs = _mm_maddubs_epi16(sextets, _mm_set1_epi32(0x01400140));
+      const __m128i quads = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+
+      return _mm_shuffle_epi8(quads, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    }
+#endif
+
+#if defined(ETL_BASE64_USING_AVX2)
+    //*************************************************************************
+    /// The AVX2 versions of the above, with a 12 byte group in each lane.
+    //*************************************************************************
+    inline __m256i encode_sextets(__m256i input)
+    {
+      input = _mm256_shuffle_epi8(input, _mm256_broadcastsi128_si256(_mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1)));
+
+      const __m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(input, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+      const __m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(input, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+
+      return _mm256_or_si256(t0, t1);
+    }
+
+    //*************************************************************************
+    inline __m256i encode_characters(__m256i sextets, __m256i offsets)
+    {
+      __m256i index = _mm256_subs_epu8(sextets, _mm256_set1_epi8(51));
+      index = _mm256_or_si256(index, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), sextets), _mm256_set1_epi8(13)));
+
+      return _mm256_add_epi8(sextets, _mm256_shuffle_epi8(offsets, index));
+    }
+
+    //*************************************************************************
+    inline bool decode_sextets(__m256i input, const char* encoder_table, __m256i& sextets)
+    {
+      const __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(input, _mm256_set1_epi8('A' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), input));
+      const __m256i lower = _mm256_and_si256(_mm256_cmpgt_epi8(input, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), input));
+      const __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(input, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), input));
+      const __m256i is_62 = _mm256_cmpeq_epi8(input, _mm256_set1_epi8(encoder_table[62]));
+      const __m256i is_63 = _mm256_cmpeq_epi8(input, _mm256_set1_epi8(encoder_table[63]));
+
+      const __m256i valid = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(upper, lower), _mm256_or_si256(digit, is_62)), is_63);
+
+      if (_mm256_movemask_epi8(valid) != -1)
+      {
+        return false;
+      }
+
+      __m256i offset = _mm256_and_si256(upper, _mm256_set1_epi8(static_cast<char>(0 - 'A')));
+      offset = _mm256_or_si256(offset, _mm256_and_si256(lower, _mm256_set1_epi8(static_cast<char>(26 - 'a'))));
+      offset = _mm256_or_si256(offset, _mm256_and_si256(digit, _mm256_set1_epi8(static_cast<char>(52 - '0'))));
+      offset = _mm256_or_si256(offset, _mm256_and_si256(is_62, _mm256_set1_epi8(static_cast<char>(62 - encoder_table[62]))));
+      offset = _mm256_or_si256(offset, _mm256_and_si256(is_63, _mm256_set1_epi8(static_cast<char>(63 - encoder_table[63]))));
+
+      sextets = _mm256_add_epi8(input, offset);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Packs the 32 sextets into the first 24 bytes.
+    //*************************************************************************
+    inline __m256i decode_octets(__m256i sextets)
+    {
+      const __m256i pairs = _mm256_maddubs_epi16(sextets, _mm256_set1_epi32(0x01400140));
+      const __m256i quads = _mm256_madd_epi16(pairs, _mm256_set1_epi32(0x00011000));
+      const __m256i lanes = _mm256_shuffle_epi8(quads, _mm256_broadcastsi128_si256(_mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1)));
+
+      return _mm256_permutevar8x32_epi32(lanes, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+    }
+#endif
+
+#if defined(ETL_BASE64_USING_NEON)
+    //*************************************************************************
+    /// Converts 16 characters to sextets.
+    /// Returns false if any of them are not part of the character set.
+    //*************************************************************************
+    inline bool decode_sextets(uint8x16_t input, uint8x16_t c62, uint8x16_t c63, uint8x16_t& sextets)
+    {
+      const uint8x16_t upper = vandq_u8(vcgeq_u8(input, vdupq_n_u8('A')), vcleq_u8(input, vdupq_n_u8('Z')));
+      const uint8x16_t lower = vandq_u8(vcgeq_u8(input, vdupq_n_u8('a')), vcleq_u8(input, vdupq_n_u8('z')));
+      const uint8x16_t digit = vandq_u8(vcgeq_u8(input, vdupq_n_u8('0')), vcleq_u8(input, vdupq_n_u8('9')));
+      const uint8x16_t is_62 = vceqq_u8(input, c62);
+      const uint8x16_t is_63 = vceqq_u8(input, c63);
+
+      const uint8x16_t valid = vorrq_u8(vorrq_u8(vorrq_u8(upper, lower), vorrq_u8(digit, is_62)), is_63);
+
+      if (vminvq_u8(valid) == 0U)
+      {
+        return false;
+      }
+
+      uint8x16_t offset = vandq_u8(upper, vdupq_n_u8(static_cast<uint8_t>(0 - 'A')));
+      offset = vorrq_u8(offset, vandq_u8(lower, vdupq_n_u8(static_cast<uint8_t>(26 - 'a'))));
+      offset = vorrq_u8(offset, vandq_u8(digit, vdupq_n_u8(static_cast<uint8_t>(52 - '0'))));
+      offset = vorrq_u8(offset, vandq_u8(is_62, vsubq_u8(vdupq_n_u8(62U), c62)));
+      offset = vorrq_u8(offset, vandq_u8(is_63, vsubq_u8(vdupq_n_u8(63U), c63)));
+
+      sextets = vaddq_u8(input, offset);
+
+      return true;
+    }
+#endif
+
+#if defined(ETL_BASE64_USING_SIMD)
+    //*************************************************************************
+    /// Encodes as many 3 byte groups as the vector kernels can handle.
+    /// Returns the number of groups encoded.
+    //*************************************************************************
+    inline size_t encode_groups_simd(const void* input, size_t groups, char* output, const char* encoder_table)
+    {
+      const uint8_t* p_input = static_cast<const uint8_t*>(input);
+      size_t done = 0U;
+
+  #if defined(ETL_BASE64_USING_AVX2)
+      const __m256i offsets_256 = _mm256_broadcastsi128_si256(encode_offsets(encoder_table));
+
+      // 24 bytes to 32 characters. The second lane load reads up to 28 bytes.
+      while ((groups - done) >= 10U)
+      {
+        const __m128i low  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_input));
+        const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_input + 12));
+        const __m256i block = _mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), encode_characters(encode_sextets(block), offsets_256));
+
+        p_input += 24;
+        output  += 32;
+        done    += 8U;
+      }
+  #endif
+
+  #if defined(ETL_BASE64_USING_SSSE3)
+      const __m128i offsets = encode_offsets(encoder_table);
+
+      // 12 bytes to 16 characters. The load reads 16 bytes.
+      while ((groups - done) >= 6U)
+      {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_input));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output), encode_characters(encode_sextets(block), offsets));
+
+        p_input += 12;
+        output  += 16;
+        done    += 4U;
+      }
+  #elif defined(ETL_BASE64_USING_NEON)
+      uint8x16x4_t characters;
+      characters.val[0] = vld1q_u8(reinterpret_cast<const uint8_t*>(encoder_table));
+      characters.val[1] = vld1q_u8(reinterpret_cast<const uint8_t*>(encoder_table) + 16);
+      characters.val[2] = vld1q_u8(reinterpret_cast<const uint8_t*>(encoder_table) + 32);
+      characters.val[3] = vld1q_u8(reinterpret_cast<const uint8_t*>(encoder_table) + 48);
+
+      const uint8x16_t mask = vdupq_n_u8(0x3FU);
+
+      // 48 bytes to 64 characters.
+      while ((groups - done) >= 16U)
+      {
+        const uint8x16x3_t block = vld3q_u8(p_input);
+
+        uint8x16x4_t sextets;
+        sextets.val[0] = vshrq_n_u8(block.val[0], 2);
+        sextets.val[1] = vandq_u8(vorrq_u8(vshrq_n_u8(block.val[1], 4), vshlq_n_u8(block.val[0], 4)), mask);
+        sextets.val[2] = vandq_u8(vorrq_u8(vshrq_n_u8(block.val[2], 6), vshlq_n_u8(block.val[1], 2)), mask);
+        sextets.val[3] = vandq_u8(block.val[2], mask);
+
+        uint8x16x4_t text;
+        text.val[0] = vqtbl4q_u8(characters, sextets.val[0]);
+        text.val[1] = vqtbl4q_u8(characters, sextets.val[1]);
+        text.val[2] = vqtbl4q_u8(characters, sextets.val[2]);
+        text.val[3] = vqtbl4q_u8(characters, sextets.val[3]);
+
+        vst4q_u8(reinterpret_cast<uint8_t*>(output), text);
+
+        p_input += 48;
+        output  += 64;
+        done    += 16U;
+      }
+  #endif
+
+      return done;
+    }
+
+    //*************************************************************************
+    /// Decodes as many 4 character groups as the vector kernels can handle.
+    /// Stops at the first block containing a character that is not part of
+    /// the character set.
+    /// Returns the number of groups decoded.
+    //*************************************************************************
+    inline size_t decode_groups_simd(const void* input, size_t groups, unsigned char* output, const char* encoder_table)
+    {
+      const uint8_t* p_input = static_cast<const uint8_t*>(input);
+      size_t done = 0U;
+
+  #if defined(ETL_BASE64_USING_AVX2)
+      // 32 characters to 24 bytes.
+      while ((groups - done) >= 8U)
+      {
+        __m256i sextets;
+
+        if (!decode_sextets(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p_input)), encoder_table, sextets))
+        {
+          return done;
+        }
+
+        const __m256i octets = decode_octets(sextets);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm256_castsi256_si128(octets));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(output + 16), _mm256_extracti128_si256(octets, 1));
+
+        p_input += 32;
+        output  += 24;
+        done    += 8U;
+      }
+  #endif
+
+  #if defined(ETL_BASE64_USING_SSSE3)
+      // 16 characters to 12 bytes, stored as two overlapping 8 byte writes.
+      while ((groups - done) >= 4U)
+      {
+        __m128i sextets;
+
+        if (!decode_sextets(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p_input)), encoder_table, sextets))
+        {
+          return done;
+        }
+
+        const __m128i octets = decode_octets(sextets);
+
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(output), octets);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(output + 4), _mm_srli_si128(octets, 4));
+
+        p_input += 16;
+        output  += 12;
+        done    += 4U;
+      }
+  #elif defined(ETL_BASE64_USING_NEON)
+      const uint8x16_t c62 = vdupq_n_u8(static_cast<uint8_t>(encoder_table[62]));
+      const uint8x16_t c63 = vdupq_n_u8(static_cast<uint8_t>(encoder_table[63]));
+
+      // 64 characters to 48 bytes.
+      while ((groups - done) >= 16U)
+      {
+        const uint8x16x4_t block = vld4q_u8(p_input);
+
+        uint8x16x4_t sextets;
+
+        if (!decode_sextets(block.val[0], c62, c63, sextets.val[0]) ||
+            !decode_sextets(block.val[1], c62, c63, sextets.val[1]) ||
+            !decode_sextets(block.val[2], c62, c63, sextets.val[2]) ||
+            !decode_sextets(block.val[3], c62, c63, sextets.val[3]))
+        {
+          return done;
+        }
+
+        uint8x16x3_t octets;
+        octets.val[0] = vorrq_u8(vshlq_n_u8(sextets.val[0], 2), vshrq_n_u8(sextets.val[1], 4));
+        octets.val[1] = vorrq_u8(vshlq_n_u8(sextets.val[1], 4), vshrq_n_u8(sextets.val[2], 2));
+        octets.val[2] = vorrq_u8(vshlq_n_u8(sextets.val[2], 6), sextets.val[3]);
+
+        vst3q_u8(output, octets);
+
+        p_input += 64;
+        output  += 48;
+        done    += 16U;
+      }
+  #endif
+
+      return done;
+    }
+#endif
+
+    //*************************************************************************
+    /// Encodes 'groups' groups of 3 bytes to 4 characters.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 void encode_groups(const T* input, size_t groups, char* output, const char* encoder_table)
+    {
+#if defined(ETL_BASE64_USING_SIMD)
+      if (!etl::is_constant_evaluated())
+      {
+        const size_t done = encode_groups_simd(input, groups, output, encoder_table);
+
+        input  += done * 3U;
+        output += done * 4U;
+        groups -= done;
+      }
+#endif
+
+      while (groups-- != 0U)
+      {
+        const uint32_t octets = (static_cast<uint32_t>(static_cast<uint8_t>(input[0])) << 16) |
+                                (static_cast<uint32_t>(static_cast<uint8_t>(input[1])) << 8)  |
+                                 static_cast<uint32_t>(static_cast<uint8_t>(input[2]));
+
+        output[0] = encoder_table[(octets >> 18) & 0x3F];
+        output[1] = encoder_table[(octets >> 12) & 0x3F];
+        output[2] = encoder_table[(octets >>  6) & 0x3F];
+        output[3] = encoder_table[(octets >>  0) & 0x3F];
+
+        input  += 3;
+        output += 4;
+      }
+    }
+
+    //*************************************************************************
+    /// Decodes up to 'groups' groups of 4 characters to 3 bytes.
+    /// Stops at the first group containing a character that is not part of
+    /// the character set, including padding.
+    /// Returns the number of groups decoded.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 size_t decode_groups(const T* input, size_t groups, unsigned char* output, const char* encoder_table)
+    {
+      size_t done = 0U;
+
+#if defined(ETL_BASE64_USING_SIMD)
+      if (!etl::is_constant_evaluated())
+      {
+        done = decode_groups_simd(input, groups, output, encoder_table);
+
+        input  += done * 4U;
+        output += done * 3U;
+      }
+#endif
+
+      while (done != groups)
+      {
+        const uint8_t s0 = sextet(input[0], encoder_table);
+        const uint8_t s1 = sextet(input[1], encoder_table);
+        const uint8_t s2 = sextet(input[2], encoder_table);
+        const uint8_t s3 = sextet(input[3], encoder_table);
+
+        if (((s0 | s1 | s2 | s3) & 0xC0U) != 0U)
+        {
+          break;
+        }
+
+        const uint32_t sextets = (static_cast<uint32_t>(s0) << 18) | (static_cast<uint32_t>(s1) << 12) | (static_cast<uint32_t>(s2) << 6) | s3;
+
+        output[0] = static_cast<unsigned char>(sextets >> 16);
+        output[1] = static_cast<unsigned char>(sextets >> 8);
+        output[2] = static_cast<unsigned char>(sextets);
+
+        input  += 4;
+        output += 3;
+        ++done;
+      }
+
+      return done;
+    }
+  }
+}
+
+#undef ETL_BASE64_SEXTETS
+#undef ETL_BASE64_USING_AVX2
+#undef ETL_BASE64_USING_SSSE3
+#undef ETL_BASE64_USING_NEON
+#undef ETL_BASE64_USING_SIMD
+
+#endif
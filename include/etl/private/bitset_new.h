@@ -40,6 +40,7 @@ SOFTWARE.
 #include "../exception.h"
 #include "../integral_limits.h"
 #include "../binary.h"
+#include "../bit.h"
 #include "../char_traits.h"
 #include "../static_assert.h"
 #include "../error_handler.h"
@@ -57,6 +58,21 @@ SOFTWARE.
 #include <algorithm>
 #endif
 
+//*****************************************************************************
+// Select the implementation used to skip over runs of uniform elements.
+// Define ETL_BITSET_NO_SIMD to force the portable implementation.
+// The vector scan is only used where constant evaluation can be detected.
+//*****************************************************************************
+#if !defined(ETL_BITSET_NO_SIMD) && (ETL_USING_CPP23 || (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1))
+  #if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define ETL_BITSET_USING_SSE2
+    #include <emmintrin.h>
+  #elif (defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64)
+    #define ETL_BITSET_USING_NEON
+    #include <arm_neon.h>
+  #endif
+#endif
+
 #include "minmax_push.h"
 
 #if defined(ETL_COMPILER_KEIL)
@@ -190,6 +206,114 @@ namespace etl
 
     template <typename TElement>
     ETL_CONSTANT TElement bitset_impl_common<TElement>::All_Clear_Element;
+
+    //*************************************************************************
+    /// The word used to scan a multi element bitset.
+    /// Elements narrower than the widest unsigned type are combined so that
+    /// several can be tested or counted at once.
+    //*************************************************************************
+    template <typename TElement>
+    struct bitset_scan
+    {
+#if ETL_USING_64BIT_TYPES
+      typedef uint64_t widest_type;
+#else
+      typedef uint32_t widest_type;
+#endif
+
+      typedef typename etl::conditional<(etl::integral_limits<TElement>::bits < etl::integral_limits<widest_type>::bits), widest_type, TElement>::type scan_type;
+
+      static ETL_CONSTANT size_t Elements_Per_Scan = etl::integral_limits<scan_type>::bits / etl::integral_limits<TElement>::bits;
+
+      //***********************************
+      /// Loads Elements_Per_Scan elements.
+      /// The callers only count or compare the bits, so the order of the
+      /// elements within the word does not matter.
+      static ETL_CONSTEXPR14 scan_type load(const TElement* pbuffer) ETL_NOEXCEPT
+      {
+        scan_type word = 0U;
+
+#if ETL_USING_CPP23 || (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1)
+        if (!etl::is_constant_evaluated())
+        {
+          memcpy(&word, pbuffer, sizeof(scan_type));
+
+          return word;
+        }
+#endif
+
+        for (size_t i = 0U; i < Elements_Per_Scan; ++i)
+        {
+          word |= static_cast<scan_type>(static_cast<scan_type>(pbuffer[i]) << (i * etl::integral_limits<TElement>::bits));
+        }
+
+        return word;
+      }
+    };
+
+    template <typename TElement>
+    ETL_CONSTANT size_t bitset_scan<TElement>::Elements_Per_Scan;
+
+#if defined(ETL_BITSET_USING_SSE2) || defined(ETL_BITSET_USING_NEON)
+    //*************************************************************************
+    /// Returns the number of leading bytes, in whole 16 byte blocks, that are
+    /// all clear or all set.
+    //*************************************************************************
+    inline size_t uniform_bytes(const void* pbuffer, size_t length, bool all_set)
+    {
+      const uint8_t* p = static_cast<const uint8_t*>(pbuffer);
+      size_t offset = 0U;
+
+  #if defined(ETL_BITSET_USING_SSE2)
+      const __m128i uniform = all_set ? _mm_set1_epi8(-1) : _mm_setzero_si128();
+
+      // Four blocks at a time.
+      while ((length - offset) >= 64U)
+      {
+        const __m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + offset));
+        const __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + offset + 16U));
+        const __m128i b2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + offset + 32U));
+        const __m128i b3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + offset + 48U));
+
+        const __m128i combined = all_set ? _mm_and_si128(_mm_and_si128(b0, b1), _mm_and_si128(b2, b3))
+                                         : _mm_or_si128(_mm_or_si128(b0, b1), _mm_or_si128(b2, b3));
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(combined, uniform)) != 0xFFFF)
+        {
+          break;
+        }
+
+        offset += 64U;
+      }
+
+      while ((length - offset) >= 16U)
+      {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + offset));
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(block, uniform)) != 0xFFFF)
+        {
+          break;
+        }
+
+        offset += 16U;
+      }
+  #else
+      while ((length - offset) >= 16U)
+      {
+        const uint8x16_t block = vld1q_u8(p + offset);
+
+        if (all_set ? (vminvq_u8(block) != 0xFFU) : (vmaxvq_u8(block) != 0U))
+        {
+          break;
+        }
+
+        offset += 16U;
+      }
+  #endif
+
+      return offset;
+    }
+#endif
   }
 
   //*************************************************************************
@@ -683,26 +807,16 @@ namespace etl
     {
       if (position < active_bits)
       {
-        // Where to start.
-        size_t bit = position;
-
-        element_type mask = 1U << position;
+        // The bits in the required state, from the position onwards.
+        const element_type value = element_type((state ? *pbuffer : element_type(~*pbuffer)) & element_type(All_Set_Element << position));
 
-        // Needs checking?
-        if ((state && (*pbuffer != All_Clear_Element)) || (!state && (*pbuffer != All_Set_Element)))
+        if (value != All_Clear_Element)
         {
-          // For each bit in the element...
-          while (bit < active_bits)
+          const size_t bit = static_cast<size_t>(etl::countr_zero(value));
+
+          if (bit < active_bits)
           {
-            // Equal to the required state?
-            if (((*pbuffer & mask) != 0) == state)
-            {
-              return bit;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++bit;
+            return bit;
           }
         }
       }
@@ -877,6 +991,8 @@ namespace etl
 
     using etl::private_bitset::bitset_impl_common<TElement>::npos;
 
+    typedef etl::private_bitset::bitset_scan<TElement> scan;
+
     //*************************************************************************
     /// Check to see if the requested extract is contained within one element.
     //*************************************************************************
@@ -886,6 +1002,45 @@ namespace etl
       static ETL_CONSTANT bool value = ((Position + Length - 1) >> etl::log2<Bits_Per_Element>::value) == (Position >> etl::log2<Bits_Per_Element>::value);
     };
 
+    //*************************************************************************
+    /// Finds the first element, from 'index', that is not equal to 'uniform'.
+    /// Skips whole vector blocks where available, then scan words, then
+    /// single elements.
+    ///\returns The index of the element or 'number_of_elements' if none were found.
+    //*************************************************************************
+    static
+    ETL_CONSTEXPR14
+    size_t find_element_not_equal(const_pointer pbuffer,
+                                  size_t        index,
+                                  size_t        number_of_elements,
+                                  element_type  uniform) ETL_NOEXCEPT
+    {
+#if defined(ETL_BITSET_USING_SSE2) || defined(ETL_BITSET_USING_NEON)
+      if (!etl::is_constant_evaluated() && (index < number_of_elements))
+      {
+        const size_t length = (number_of_elements - index) * sizeof(element_type);
+
+        index += etl::private_bitset::uniform_bytes(pbuffer + index, length, uniform == All_Set_Element) / sizeof(element_type);
+      }
+#endif
+
+      typedef typename scan::scan_type scan_type;
+
+      const scan_type uniform_scan = (uniform == All_Set_Element) ? scan_type(~scan_type(0U)) : scan_type(0U);
+
+      while (((number_of_elements - index) >= scan::Elements_Per_Scan) && (scan::load(pbuffer + index) == uniform_scan))
+      {
+        index += scan::Elements_Per_Scan;
+      }
+
+      while ((index < number_of_elements) && (pbuffer[index] == uniform))
+      {
+        ++index;
+      }
+
+      return index;
+    }
+
     //*************************************************************************
     /// Tests a bit at a position.
     /// Positions greater than the number of configured bits will return <b>false</b>.
@@ -910,10 +1065,16 @@ namespace etl
                  size_t        number_of_elements) ETL_NOEXCEPT
     {
       size_t count = 0;
+      size_t index = 0;
 
-      while (number_of_elements-- != 0)
+      for (; (number_of_elements - index) >= scan::Elements_Per_Scan; index += scan::Elements_Per_Scan)
       {
-        count += etl::count_bits(*pbuffer++);
+        count += static_cast<size_t>(etl::popcount(scan::load(pbuffer + index)));
+      }
+
+      for (; index < number_of_elements; ++index)
+      {
+        count += etl::count_bits(pbuffer[index]);
       }
 
       return count;
@@ -929,16 +1090,13 @@ namespace etl
              element_type  top_mask) ETL_NOEXCEPT
     {
       // All but the last.
-      while (number_of_elements-- != 1U)
+      if (find_element_not_equal(pbuffer, 0U, number_of_elements - 1U, All_Set_Element) != (number_of_elements - 1U))
       {
-        if (*pbuffer++ != All_Set_Element)
-        {
-          return false;
-        }
+        return false;
       }
 
       // The last.
-      if ((*pbuffer & top_mask) != top_mask)
+      if ((pbuffer[number_of_elements - 1U] & top_mask) != top_mask)
       {
         return false;
       }
@@ -954,15 +1112,7 @@ namespace etl
     bool none(const_pointer pbuffer,
               size_t        number_of_elements) ETL_NOEXCEPT
     {
-      while (number_of_elements-- != 0)
-      {
-        if (*pbuffer++ != 0)
-        {
-          return false;
-        }
-      }
-
-      return true;
+      return find_element_not_equal(pbuffer, 0U, number_of_elements, All_Clear_Element) == number_of_elements;
     }
 
     //*************************************************************************
@@ -973,18 +1123,7 @@ namespace etl
     bool any(const_pointer pbuffer,
              size_t        number_of_elements) ETL_NOEXCEPT
     {
-      bool any_set = false;
-
-      while (number_of_elements-- != 0)
-      {
-        if (*pbuffer++ != All_Clear_Element)
-        {
-          any_set = true;
-          break;
-        }
-      }
-
-      return any_set;
+      return find_element_not_equal(pbuffer, 0U, number_of_elements, All_Clear_Element) != number_of_elements;
     }
 
     //*************************************************************************
@@ -1474,49 +1613,37 @@ namespace etl
                      bool          state, 
                      size_t        position) ETL_NOEXCEPT
     {
+      if (position >= total_bits)
+      {
+        return npos;
+      }
+
+      // Elements that contain no bits in the required state.
+      const element_type skip = state ? All_Clear_Element : All_Set_Element;
+
       // Where to start.
       size_t index = position >> log2<Bits_Per_Element>::value;
       size_t bit   = position & (Bits_Per_Element - 1);
 
-      element_type mask = 1 << bit;
+      // The bits in the required state, from the position onwards.
+      element_type value = element_type((pbuffer[index] ^ skip) & element_type(All_Set_Element << bit));
 
-      // For each element in the bitset...
-      while (index < number_of_elements)
+      if (value == All_Clear_Element)
       {
-        element_type value = pbuffer[index];
+        index = find_element_not_equal(pbuffer, index + 1U, number_of_elements, skip);
 
-        // Needs checking?
-        if ((state && (value != All_Clear_Element)) ||
-            (!state && (value != All_Set_Element)))
+        if (index == number_of_elements)
         {
-          // For each bit in the element...
-          while ((bit < Bits_Per_Element) && (position < total_bits))
-          {
-            // Equal to the required state?
-            if (((value & mask) != 0) == state)
-            {
-              return position;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++position;
-            ++bit;
-          }
-        }
-        else
-        {
-          position += (Bits_Per_Element - bit);
+          return npos;
         }
 
-        // Start at the beginning for all other elements.
-        bit = 0;
-        mask = 1;
-
-        ++index;
+        value = element_type(pbuffer[index] ^ skip);
       }
 
-      return npos;
+      position = (index << log2<Bits_Per_Element>::value) + static_cast<size_t>(etl::countr_zero(value));
+
+      // Unused bits in the last element are clear, so may be found when searching for clear bits.
+      return (position < total_bits) ? position : npos;
     }
 
     //*************************************************************************
@@ -3960,6 +4087,9 @@ typename etl::enable_if<!etl::is_same<TLhsElement, TRhsElement>::value, bool>::t
   return !(lhs == rhs);
 }
 
+#undef ETL_BITSET_USING_SSE2
+#undef ETL_BITSET_USING_NEON
+
 #include "minmax_pop.h"
 
 #endif
@@ -41,6 +41,14 @@ SOFTWARE.
 
 #include "crc_parameters.h"
 
+#if ETL_USING_CRC_INTRINSICS
+  #if defined(__SSE4_2__)
+    #include <nmmintrin.h>
+  #elif defined(__ARM_FEATURE_CRC32)
+    #include <arm_acle.h>
+  #endif
+#endif
+
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
 #endif
@@ -703,6 +711,306 @@ namespace etl
         return crc ^ TCrcParameters::Xor_Out;
       }
     };
+
+#if ETL_USING_CPP14
+    //*****************************************************************************
+    /// CRC Slice Tables.
+    /// Generated at compile time for the slice-by-N policies.
+    /// table[0] is the standard byte-wise table.
+    /// table[n] is the CRC of a byte followed by 'n' zero bytes.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    struct crc_slice_tables
+    {
+      //*************************************************************************
+      ETL_CONSTEXPR14 crc_slice_tables()
+        : table()
+      {
+        const TAccumulator poly = Reflect ? etl::reverse_bits_const<TAccumulator, Polynomial>::value : Polynomial;
+        const TAccumulator top  = TAccumulator(TAccumulator(1U) << (Accumulator_Bits - 1U));
+
+        for (size_t i = 0U; i < 256U; ++i)
+        {
+          TAccumulator entry = Reflect ? TAccumulator(i) : TAccumulator(TAccumulator(i) << (Accumulator_Bits - 8U));
+
+          for (size_t bit = 0U; bit < 8U; ++bit)
+          {
+            if (Reflect)
+            {
+              entry = ((entry & TAccumulator(1U)) != 0U) ? TAccumulator((entry >> 1U) ^ poly) : TAccumulator(entry >> 1U);
+            }
+            else
+            {
+              entry = ((entry & top) != 0U) ? TAccumulator((entry << 1U) ^ poly) : TAccumulator(entry << 1U);
+            }
+          }
+
+          table[0][i] = entry;
+        }
+
+        for (size_t slice = 1U; slice < Slices; ++slice)
+        {
+          for (size_t i = 0U; i < 256U; ++i)
+          {
+            table[slice][i] = crc_update_chunk<TAccumulator, Accumulator_Bits, 8U, 0xFFU, Reflect>(table[slice - 1U][i], 0U, table[0]);
+          }
+        }
+      }
+
+      TAccumulator table[Slices][256U];
+    };
+
+#if ETL_USING_CRC_INTRINSICS
+    //*****************************************************************************
+    /// CRC Intrinsics.
+    /// Maps the CRCs that have a dedicated hardware instruction onto it.
+    /// The instructions update the raw reflected accumulator, so the initial
+    /// value and final xor are still applied by the policy.
+    //*****************************************************************************
+    template <typename TCrcParameters>
+    struct crc_intrinsics
+    {
+      static ETL_CONSTANT bool Supported = false;
+
+      static uint32_t update(uint32_t crc, uint64_t) { return crc; }
+    };
+
+#if defined(__SSE4_2__) && ETL_PLATFORM_64BIT
+    //*********************************
+    // CRC32-C with SSE4.2
+    template <>
+    struct crc_intrinsics<crc32_c_parameters>
+    {
+      static ETL_CONSTANT bool Supported = true;
+
+      static uint32_t update(uint32_t crc, uint64_t value)
+      {
+        return static_cast<uint32_t>(_mm_crc32_u64(crc, value));
+      }
+    };
+#elif defined(__ARM_FEATURE_CRC32)
+    //*********************************
+    // CRC32 with ARMv8 CRC
+    template <>
+    struct crc_intrinsics<crc32_parameters>
+    {
+      static ETL_CONSTANT bool Supported = true;
+
+      static uint32_t update(uint32_t crc, uint64_t value)
+      {
+        return __crc32d(crc, value);
+      }
+    };
+
+    //*********************************
+    // CRC32-C with ARMv8 CRC
+    template <>
+    struct crc_intrinsics<crc32_c_parameters>
+    {
+      static ETL_CONSTANT bool Supported = true;
+
+      static uint32_t update(uint32_t crc, uint64_t value)
+      {
+        return __crc32cd(crc, value);
+      }
+    };
+#endif
+#endif
+
+    //*****************************************************************************
+    /// Policy for slice-by-N tables.
+    /// Processes Slices bytes per step when the input is a random access range.
+    //*****************************************************************************
+    template <typename TCrcParameters, size_t Slices>
+    struct crc_slice_policy
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+      typedef accumulator_type value_type;
+
+      typedef crc_slice_tables<accumulator_type,
+                               TCrcParameters::Accumulator_Bits,
+                               TCrcParameters::Polynomial,
+                               TCrcParameters::Reflect,
+                               Slices> tables_type;
+
+      static ETL_CONSTANT size_t Block_Size        = Slices;
+      static ETL_CONSTANT size_t Accumulator_Bytes = TCrcParameters::Accumulator_Bits / 8U;
+
+      ETL_STATIC_ASSERT(Accumulator_Bytes <= Block_Size, "Slice count must not be less than the accumulator size");
+
+      static ETL_CONSTANT tables_type tables = tables_type();
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type initial() const
+      {
+        return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
+                                       : TCrcParameters::Initial;
+      }
+
+      //*************************************************************************
+      ETL_CONSTEXPR14 accumulator_type add(accumulator_type crc, uint8_t value) const
+      {
+        return crc_update_chunk<accumulator_type, TCrcParameters::Accumulator_Bits, 8U, 0xFFU, TCrcParameters::Reflect>(crc, value, tables.table[0]);
+      }
+
+      //*************************************************************************
+      /// Adds Block_Size bytes starting at 'itr'.
+      //*************************************************************************
+      template <typename TIterator>
+      ETL_CONSTEXPR14 accumulator_type add_block(accumulator_type crc, TIterator itr) const
+      {
+#if ETL_USING_CRC_INTRINSICS
+        if (crc_intrinsics<TCrcParameters>::Supported && !etl::is_constant_evaluated())
+        {
+          for (size_t word = 0U; word < (Block_Size / 8U); ++word)
+          {
+            uint64_t value = 0U;
+
+            for (size_t i = 0U; i < 8U; ++i)
+            {
+              value |= uint64_t(static_cast<uint8_t>(*itr++)) << (8U * i);
+            }
+
+            crc = accumulator_type(crc_intrinsics<TCrcParameters>::update(uint32_t(crc), value));
+          }
+
+          return crc;
+        }
+#endif
+
+        accumulator_type result = 0U;
+
+        for (size_t i = 0U; i < Block_Size; ++i)
+        {
+          uint8_t value = static_cast<uint8_t>(*itr++);
+
+          if (i < Accumulator_Bytes)
+          {
+            value ^= TCrcParameters::Reflect ? uint8_t(crc >> (8U * i))
+                                             : uint8_t(crc >> (TCrcParameters::Accumulator_Bits - 8U - (8U * i)));
+          }
+
+          result ^= tables.table[Block_Size - 1U - i][value];
+        }
+
+        return result;
+      }
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type final(accumulator_type crc) const
+      {
+        return crc ^ TCrcParameters::Xor_Out;
+      }
+    };
+
+    template <typename TCrcParameters, size_t Slices>
+    ETL_CONSTANT size_t crc_slice_policy<TCrcParameters, Slices>::Block_Size;
+
+    template <typename TCrcParameters, size_t Slices>
+    ETL_CONSTANT size_t crc_slice_policy<TCrcParameters, Slices>::Accumulator_Bytes;
+
+    template <typename TCrcParameters, size_t Slices>
+    ETL_CONSTANT typename crc_slice_policy<TCrcParameters, Slices>::tables_type crc_slice_policy<TCrcParameters, Slices>::tables;
+
+    //*********************************
+    // Policy for slice-by-8 tables (8 x 256 entries).
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, 2048U> : public crc_slice_policy<TCrcParameters, 8U>
+    {
+    };
+
+    //*********************************
+    // Policy for slice-by-16 tables (16 x 256 entries).
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, 4096U> : public crc_slice_policy<TCrcParameters, 16U>
+    {
+    };
+#endif
+
+    //*****************************************************************************
+    /// CRC Combine.
+    /// Arithmetic on the CRC register as a polynomial in GF(2) modulo the CRC
+    /// polynomial, used to combine the CRCs of two consecutive blocks.
+    //*****************************************************************************
+    template <typename TCrcParameters>
+    struct crc_combiner
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+
+      static ETL_CONSTANT size_t Accumulator_Bits = TCrcParameters::Accumulator_Bits;
+
+      //*************************************************************************
+      /// Multiplies 'a' by 'b' modulo the polynomial, unreflected bit order.
+      //*************************************************************************
+      static ETL_CONSTEXPR14 accumulator_type multiply(accumulator_type a, accumulator_type b)
+      {
+        const accumulator_type top = accumulator_type(accumulator_type(1U) << (Accumulator_Bits - 1U));
+
+        accumulator_type product = 0U;
+
+        for (size_t i = 0U; i < Accumulator_Bits; ++i)
+        {
+          product = ((product & top) != 0U) ? accumulator_type((product << 1U) ^ TCrcParameters::Polynomial)
+                                            : accumulator_type(product << 1U);
+
+          if ((a & top) != 0U)
+          {
+            product ^= b;
+          }
+
+          a = accumulator_type(a << 1U);
+        }
+
+        return product;
+      }
+
+      //*************************************************************************
+      /// Returns the register after 'length' zero bytes have been added to it.
+      //*************************************************************************
+      static ETL_CONSTEXPR14 accumulator_type shift(accumulator_type reg, size_t length)
+      {
+        if (TCrcParameters::Reflect)
+        {
+          reg = etl::reverse_bits(reg);
+        }
+
+        // x^8 modulo the polynomial.
+        accumulator_type power = (Accumulator_Bits > 8U) ? accumulator_type(accumulator_type(1U) << 8U)
+                                                         : multiply(accumulator_type(1U) << 4U, accumulator_type(1U) << 4U);
+
+        while (length != 0U)
+        {
+          if ((length & 1U) != 0U)
+          {
+            reg = multiply(reg, power);
+          }
+
+          power = multiply(power, power);
+          length >>= 1U;
+        }
+
+        if (TCrcParameters::Reflect)
+        {
+          reg = etl::reverse_bits(reg);
+        }
+
+        return reg;
+      }
+
+      //*************************************************************************
+      /// Combines the final CRCs of blocks 'a' and 'b'.
+      //*************************************************************************
+      static ETL_CONSTEXPR14 accumulator_type combine(accumulator_type crc_a, accumulator_type crc_b, size_t length_b)
+      {
+        const accumulator_type initial = TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
+                                                                 : TCrcParameters::Initial;
+
+        return shift(accumulator_type(crc_a ^ TCrcParameters::Xor_Out ^ initial), length_b) ^ crc_b;
+      }
+    };
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT size_t crc_combiner<TCrcParameters>::Accumulator_Bits;
   }
 
   //*****************************************************************************
@@ -713,7 +1021,11 @@ namespace etl
   {
   public:
 
+#if ETL_USING_CPP14
+    ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U) || (Table_Size == 2048U) || (Table_Size == 4096U), "Table size must be 4, 16, 256, 2048 or 4096");
+#else
     ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U), "Table size must be 4, 16 or 256");
+#endif
 
     //*************************************************************************
     /// Default constructor.
@@ -734,7 +1046,35 @@ namespace etl
       this->reset();
       this->add(begin, end);
     }
+
+    //*************************************************************************
+    /// Combines the CRCs of two consecutive blocks of data.
+    /// Returns the CRC of 'a' followed by 'b'.
+    /// \param crc_a    The CRC of block 'a'.
+    /// \param crc_b    The CRC of block 'b'.
+    /// \param length_b The length of block 'b' in bytes.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 typename TCrcParameters::accumulator_type combine(typename TCrcParameters::accumulator_type crc_a,
+                                                                             typename TCrcParameters::accumulator_type crc_b,
+                                                                             size_t length_b)
+    {
+      return private_crc::crc_combiner<TCrcParameters>::combine(crc_a, crc_b, length_b);
+    }
   };
+
+  //*****************************************************************************
+  /// Combines the CRCs of two consecutive blocks of data.
+  /// Returns the CRC of 'a' followed by 'b'.
+  ///\tparam TCrc    The CRC type. i.e. etl::crc32
+  /// \param crc_a    The CRC of block 'a'.
+  /// \param crc_b    The CRC of block 'b'.
+  /// \param length_b The length of block 'b' in bytes.
+  //*****************************************************************************
+  template <typename TCrc>
+  ETL_CONSTEXPR14 typename TCrc::value_type crc_combine(typename TCrc::value_type crc_a, typename TCrc::value_type crc_b, size_t length_b)
+  {
+    return TCrc::combine(crc_a, crc_b, length_b);
+  }
 }
 
 #endif
@@ -0,0 +1,230 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DECIMAL_DIGITS_INCLUDED
+#define ETL_DECIMAL_DIGITS_INCLUDED
+
+///\ingroup private
+
+#include "../platform.h"
+#include "../bit.h"
+#include "../type_traits.h"
+
+#include <stdint.h>
+
+//*****************************************************************************
+// Fast decimal output of unsigned integers.
+// Digits are counted up front, then written backwards from the end of the
+// destination, two at a time, so that no reversal is needed.
+//*****************************************************************************
+
+#define ETL_DECIMAL_DIGIT_PAIRS "00010203040506070809" \
+                                "10111213141516171819" \
+                                "20212223242526272829" \
+                                "30313233343536373839" \
+                                "40414243444546474849" \
+                                "50515253545556575859" \
+                                "60616263646566676869" \
+                                "70717273747576777879" \
+                                "80818283848586878889" \
+                                "90919293949596979899"
+
+namespace etl
+{
+  namespace private_decimal
+  {
+    //*************************************************************************
+    /// The two digit decimal strings "00" to "99" and the powers of ten.
+    //*************************************************************************
+    template <typename T = void>
+    struct tables
+    {
+#if ETL_USING_CPP11
+      static ETL_CONSTANT char digit_pairs[201] = ETL_DECIMAL_DIGIT_PAIRS;
+
+      static ETL_CONSTANT uint32_t powers_of_10_32[10] =
+      {
+        1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL
+      };
+
+  #if ETL_USING_64BIT_TYPES
+      static ETL_CONSTANT uint64_t powers_of_10_64[20] =
+      {
+        1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+        10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+        1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+      };
+  #endif
+#else
+      static const char     digit_pairs[201];
+      static const uint32_t powers_of_10_32[10];
+  #if ETL_USING_64BIT_TYPES
+      static const uint64_t powers_of_10_64[20];
+  #endif
+#endif
+    };
+
+#if ETL_USING_CPP11
+    template <typename T>
+    ETL_CONSTANT char tables<T>::digit_pairs[201];
+
+    template <typename T>
+    ETL_CONSTANT uint32_t tables<T>::powers_of_10_32[10];
+
+  #if ETL_USING_64BIT_TYPES
+    template <typename T>
+    ETL_CONSTANT uint64_t tables<T>::powers_of_10_64[20];
+  #endif
+#else
+    template <typename T>
+    const char tables<T>::digit_pairs[201] = ETL_DECIMAL_DIGIT_PAIRS;
+
+    template <typename T>
+    const uint32_t tables<T>::powers_of_10_32[10] =
+    {
+      1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL
+    };
+
+  #if ETL_USING_64BIT_TYPES
+    template <typename T>
+    const uint64_t tables<T>::powers_of_10_64[20] =
+    {
+      1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+      10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+      1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+    };
+  #endif
+#endif
+
+    //*************************************************************************
+    /// The unsigned type used to format T.
+    //*************************************************************************
+    template <typename T>
+    struct work_type
+    {
+#if ETL_USING_64BIT_TYPES
+      typedef typename etl::conditional<(sizeof(T) > sizeof(uint32_t)), uint64_t, uint32_t>::type type;
+#else
+      typedef uint32_t type;
+#endif
+    };
+
+    //*************************************************************************
+    /// The number of decimal digits in value. Zero has one digit.
+    //*************************************************************************
+    inline uint32_t count_digits(uint32_t value)
+    {
+      // 1233 / 4096 ~= log10(2)
+      const uint32_t x    = value | 1U;
+      const uint32_t bits = 32U - static_cast<uint32_t>(etl::countl_zero(x));
+      const uint32_t t    = (bits * 1233U) >> 12;
+
+      return t + 1U - ((x < tables<>::powers_of_10_32[t]) ? 1U : 0U);
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// The number of decimal digits in value. Zero has one digit.
+    //*************************************************************************
+    inline uint32_t count_digits(uint64_t value)
+    {
+      const uint64_t x    = value | 1U;
+      const uint32_t bits = 64U - static_cast<uint32_t>(etl::countl_zero(x));
+      const uint32_t t    = (bits * 1233U) >> 12;
+
+      return t + 1U - ((x < tables<>::powers_of_10_64[t]) ? 1U : 0U);
+    }
+#endif
+
+    //*************************************************************************
+    /// Writes the digits of value so that the last one is just before 'end'.
+    /// Returns a pointer to the first digit.
+    //*************************************************************************
+    template <typename TChar>
+    TChar* write_digits_backward(TChar* end, uint32_t value)
+    {
+      while (value >= 100U)
+      {
+        const char* pair = tables<>::digit_pairs + (2U * (value % 100U));
+        value /= 100U;
+
+        *--end = static_cast<TChar>(pair[1]);
+        *--end = static_cast<TChar>(pair[0]);
+      }
+
+      if (value >= 10U)
+      {
+        const char* pair = tables<>::digit_pairs + (2U * value);
+
+        *--end = static_cast<TChar>(pair[1]);
+        *--end = static_cast<TChar>(pair[0]);
+      }
+      else
+      {
+        *--end = static_cast<TChar>('0' + value);
+      }
+
+      return end;
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Writes the digits of value so that the last one is just before 'end'.
+    /// Eight digits at a time are split off so that the rest uses 32 bit
+    /// arithmetic.
+    /// Returns a pointer to the first digit.
+    //*************************************************************************
+    template <typename TChar>
+    TChar* write_digits_backward(TChar* end, uint64_t value)
+    {
+      while (value > 0xFFFFFFFFU)
+      {
+        uint32_t low = static_cast<uint32_t>(value % 100000000U);
+        value /= 100000000U;
+
+        for (int i = 0; i < 4; ++i)
+        {
+          const char* pair = tables<>::digit_pairs + (2U * (low % 100U));
+          low /= 100U;
+
+          *--end = static_cast<TChar>(pair[1]);
+          *--end = static_cast<TChar>(pair[0]);
+        }
+      }
+
+      return write_digits_backward(end, static_cast<uint32_t>(value));
+    }
+#endif
+  }
+}
+
+#undef ETL_DECIMAL_DIGIT_PAIRS
+
+#endif
@@ -0,0 +1,1224 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_HASH_TABLE_INCLUDED
+#define ETL_FLAT_HASH_TABLE_INCLUDED
+
+#include "../platform.h"
+#include "../algorithm.h"
+#include "../iterator.h"
+#include "../utility.h"
+#include "../bit.h"
+#include "../type_traits.h"
+#include "../placement_new.h"
+#include "../debug_count.h"
+#include "../memory.h"
+#include "../nullptr.h"
+
+#include "comparator_is_transparent.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+// Select the group matching implementation.
+// Define ETL_FLAT_HASH_NO_SIMD to force the portable implementation.
+//*****************************************************************************
+#if !defined(ETL_FLAT_HASH_NO_SIMD)
+  #if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define ETL_FLAT_HASH_USING_SSE2
+    #include <emmintrin.h>
+  #elif (defined(__ARM_NEON) && defined(__aarch64__)) || defined(_M_ARM64)
+    #define ETL_FLAT_HASH_USING_NEON
+    #include <arm_neon.h>
+  #endif
+#endif
+
+namespace etl
+{
+  namespace private_flat_hash
+  {
+    //*************************************************************************
+    /// Control byte values.
+    /// A full slot holds the low 7 bits of the hash of its key, so all full
+    /// slots are non-negative and all free slots are negative.
+    //*************************************************************************
+    struct control
+    {
+      static ETL_CONSTANT int8_t Empty   = -128;
+      static ETL_CONSTANT int8_t Deleted = -2;
+    };
+
+    //*************************************************************************
+    /// The number of control bytes matched at once.
+    //*************************************************************************
+    struct group_width
+    {
+      static ETL_CONSTANT size_t value = 16U;
+    };
+
+    //*************************************************************************
+    /// The number of groups needed to hold Max_Size elements at a load
+    /// factor of no more than 3/4.
+    /// A rehash is triggered when full and deleted slots reach 7/8 of the
+    /// slots, so a full table still has room for at least Max_Size / 6
+    /// deleted slots between rehashes.
+    //*************************************************************************
+    template <size_t Max_Size>
+    struct number_of_groups
+    {
+      static ETL_CONSTANT size_t value = (Max_Size + (Max_Size / 3U) + group_width::value) / group_width::value;
+    };
+
+    //*************************************************************************
+    /// A mask of the slots in a group. Bit n is set for slot n.
+    //*************************************************************************
+    class group_mask
+    {
+    public:
+
+      explicit group_mask(uint16_t mask_)
+        : mask(mask_)
+      {
+      }
+
+      bool any() const
+      {
+        return mask != 0U;
+      }
+
+      size_t lowest() const
+      {
+        return static_cast<size_t>(etl::countr_zero(mask));
+      }
+
+      void clear_lowest()
+      {
+        mask = static_cast<uint16_t>(mask & (mask - 1U));
+      }
+
+    private:
+
+      uint16_t mask;
+    };
+
+    //*************************************************************************
+    /// A group of control bytes.
+    /// Uses SSE2 or NEON to match all of the bytes at once, if available.
+    //*************************************************************************
+    class group
+    {
+    public:
+
+#if defined(ETL_FLAT_HASH_USING_SSE2)
+      explicit group(const int8_t* pctrl)
+        : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pctrl)))
+      {
+      }
+
+      //***********************************
+      group_mask match(int8_t h2) const
+      {
+        return group_mask(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl))));
+      }
+
+      //***********************************
+      group_mask match_empty() const
+      {
+        return match(control::Empty);
+      }
+
+      //***********************************
+      group_mask match_free() const
+      {
+        return group_mask(static_cast<uint16_t>(_mm_movemask_epi8(ctrl)));
+      }
+
+    private:
+
+      __m128i ctrl;
+
+#elif defined(ETL_FLAT_HASH_USING_NEON)
+      explicit group(const int8_t* pctrl)
+        : ctrl(vld1q_s8(pctrl))
+      {
+      }
+
+      //***********************************
+      group_mask match(int8_t h2) const
+      {
+        return to_mask(vceqq_s8(ctrl, vdupq_n_s8(h2)));
+      }
+
+      //***********************************
+      group_mask match_empty() const
+      {
+        return match(control::Empty);
+      }
+
+      //***********************************
+      group_mask match_free() const
+      {
+        return to_mask(vcltzq_s8(ctrl));
+      }
+
+    private:
+
+      //***********************************
+      /// Gathers the top bit of each byte into a 16 bit mask.
+      //***********************************
+      static group_mask to_mask(uint8x16_t bytes)
+      {
+        static const uint8_t bits[16] = { 1U, 2U, 4U, 8U, 16U, 32U, 64U, 128U, 1U, 2U, 4U, 8U, 16U, 32U, 64U, 128U };
+
+        const uint8x16_t masked = vandq_u8(bytes, vld1q_u8(bits));
+
+        return group_mask(static_cast<uint16_t>(vaddv_u8(vget_low_u8(masked)) | (vaddv_u8(vget_high_u8(masked)) << 8U)));
+      }
+
+      int8x16_t ctrl;
+
+#else
+      explicit group(const int8_t* pctrl_)
+        : pctrl(pctrl_)
+      {
+      }
+
+      //***********************************
+      group_mask match(int8_t h2) const
+      {
+        uint16_t mask = 0U;
+
+        for (size_t i = 0U; i < group_width::value; ++i)
+        {
+          mask = static_cast<uint16_t>(mask | ((pctrl[i] == h2) ? (1U << i) : 0U));
+        }
+
+        return group_mask(mask);
+      }
+
+      //***********************************
+      group_mask match_empty() const
+      {
+        return match(control::Empty);
+      }
+
+      //***********************************
+      group_mask match_free() const
+      {
+        uint16_t mask = 0U;
+
+        for (size_t i = 0U; i < group_width::value; ++i)
+        {
+          mask = static_cast<uint16_t>(mask | ((pctrl[i] < 0) ? (1U << i) : 0U));
+        }
+
+        return group_mask(mask);
+      }
+
+    private:
+
+      const int8_t* pctrl;
+#endif
+    };
+
+    //*************************************************************************
+    /// Mixes the bits of a hash so that both the group index and the control
+    /// byte are well distributed, even for an identity hash.
+    //*************************************************************************
+    inline size_t mix(size_t hash)
+    {
+#if ETL_USING_64BIT_TYPES
+      const uint64_t h = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ULL;
+
+      return static_cast<size_t>(h ^ (h >> 32U));
+#else
+      const uint32_t h = static_cast<uint32_t>(hash) * 0x9E3779B9UL;
+
+      return static_cast<size_t>(h ^ (h >> 16U));
+#endif
+    }
+
+    //*************************************************************************
+    /// The common implementation of flat_hash_map and flat_hash_set.
+    /// An open addressing hash table, in the style of SwissTable.
+    /// Each slot has a control byte, and the control bytes are arranged in
+    /// groups of 16 that are searched in parallel. The group to start at is
+    /// chosen by the high bits of the hash, and the low 7 bits are stored in
+    /// the control byte to filter the key comparisons.
+    /// \tparam TValue    The stored type.
+    /// \tparam TKey      The key type.
+    /// \tparam TKeyOf    Gets the key from a stored value with TKeyOf::get(value).
+    /// \tparam THash     The key hash function.
+    /// \tparam TKeyEqual The key equality function.
+    //*************************************************************************
+    template <typename TValue, typename TKey, typename TKeyOf, typename THash, typename TKeyEqual>
+    class flat_hash_table
+    {
+    public:
+
+      typedef TValue            value_type;
+      typedef TKey              key_type;
+      typedef THash             hasher;
+      typedef TKeyEqual         key_equal;
+      typedef value_type&       reference;
+      typedef const value_type& const_reference;
+#if ETL_USING_CPP11
+      typedef value_type&&      rvalue_reference;
+#endif
+      typedef value_type*       pointer;
+      typedef const value_type* const_pointer;
+      typedef size_t            size_type;
+
+      typedef const key_type&   const_key_reference;
+#if ETL_USING_CPP11
+      typedef key_type&&        rvalue_key_reference;
+#endif
+
+      class const_iterator;
+
+      //*********************************************************************
+      class iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, TValue>
+      {
+      public:
+
+        friend class flat_hash_table;
+        friend class const_iterator;
+
+        //*********************************
+        iterator()
+          : pctrl(ETL_NULLPTR)
+          , pctrl_end(ETL_NULLPTR)
+          , pslot(ETL_NULLPTR)
+        {
+        }
+
+        //*********************************
+        iterator& operator ++()
+        {
+          do
+          {
+            ++pctrl;
+            ++pslot;
+          } while ((pctrl != pctrl_end) && (*pctrl < 0));
+
+          return *this;
+        }
+
+        //*********************************
+        iterator operator ++(int)
+        {
+          iterator temp(*this);
+          operator++();
+          return temp;
+        }
+
+        //*********************************
+        reference operator *() const
+        {
+          return *pslot;
+        }
+
+        //*********************************
+        pointer operator &() const
+        {
+          return pslot;
+        }
+
+        //*********************************
+        pointer operator ->() const
+        {
+          return pslot;
+        }
+
+        //*********************************
+        friend bool operator == (const iterator& lhs, const iterator& rhs)
+        {
+          return lhs.pctrl == rhs.pctrl;
+        }
+
+        //*********************************
+        friend bool operator != (const iterator& lhs, const iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        //*********************************
+        iterator(const int8_t* pctrl_, const int8_t* pctrl_end_, pointer pslot_)
+          : pctrl(pctrl_)
+          , pctrl_end(pctrl_end_)
+          , pslot(pslot_)
+        {
+        }
+
+        const int8_t* pctrl;
+        const int8_t* pctrl_end;
+        pointer       pslot;
+      };
+
+      //*********************************************************************
+      class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const TValue>
+      {
+      public:
+
+        friend class flat_hash_table;
+        friend class iterator;
+
+        //*********************************
+        const_iterator()
+          : pctrl(ETL_NULLPTR)
+          , pctrl_end(ETL_NULLPTR)
+          , pslot(ETL_NULLPTR)
+        {
+        }
+
+        //*********************************
+        const_iterator(const typename flat_hash_table::iterator& other)
+          : pctrl(other.pctrl)
+          , pctrl_end(other.pctrl_end)
+          , pslot(other.pslot)
+        {
+        }
+
+        //*********************************
+        const_iterator& operator ++()
+        {
+          do
+          {
+            ++pctrl;
+            ++pslot;
+          } while ((pctrl != pctrl_end) && (*pctrl < 0));
+
+          return *this;
+        }
+
+        //*********************************
+        const_iterator operator ++(int)
+        {
+          const_iterator temp(*this);
+          operator++();
+          return temp;
+        }
+
+        //*********************************
+        const_reference operator *() const
+        {
+          return *pslot;
+        }
+
+        //*********************************
+        const_pointer operator &() const
+        {
+          return pslot;
+        }
+
+        //*********************************
+        const_pointer operator ->() const
+        {
+          return pslot;
+        }
+
+        //*********************************
+        friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return lhs.pctrl == rhs.pctrl;
+        }
+
+        //*********************************
+        friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        //*********************************
+        const_iterator(const int8_t* pctrl_, const int8_t* pctrl_end_, const_pointer pslot_)
+          : pctrl(pctrl_)
+          , pctrl_end(pctrl_end_)
+          , pslot(pslot_)
+        {
+        }
+
+        const int8_t* pctrl;
+        const int8_t* pctrl_end;
+        const_pointer pslot;
+      };
+
+      typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+      //*********************************************************************
+      /// Returns an iterator to the beginning of the table.
+      //*********************************************************************
+      iterator begin()
+      {
+        return make_iterator(first_full(0U));
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the beginning of the table.
+      //*********************************************************************
+      const_iterator begin() const
+      {
+        return make_const_iterator(first_full(0U));
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the beginning of the table.
+      //*********************************************************************
+      const_iterator cbegin() const
+      {
+        return make_const_iterator(first_full(0U));
+      }
+
+      //*********************************************************************
+      /// Returns an iterator to the end of the table.
+      //*********************************************************************
+      iterator end()
+      {
+        return make_iterator(number_of_slots);
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the end of the table.
+      //*********************************************************************
+      const_iterator end() const
+      {
+        return make_const_iterator(number_of_slots);
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the end of the table.
+      //*********************************************************************
+      const_iterator cend() const
+      {
+        return make_const_iterator(number_of_slots);
+      }
+
+      //*********************************************************************
+      /// Finds an element.
+      ///\param key The key to search for.
+      ///\return An iterator to the element if the key exists, otherwise end().
+      //*********************************************************************
+      iterator find(const_key_reference key)
+      {
+        return make_iterator(find_index(key, hash_key(key)));
+      }
+
+      //*********************************************************************
+      /// Finds an element.
+      ///\param key The key to search for.
+      ///\return An iterator to the element if the key exists, otherwise end().
+      //*********************************************************************
+      const_iterator find(const_key_reference key) const
+      {
+        return make_const_iterator(find_index(key, hash_key(key)));
+      }
+
+#if ETL_USING_CPP11
+      //*********************************************************************
+      /// Finds an element.
+      ///\param key The key to search for.
+      ///\return An iterator to the element if the key exists, otherwise end().
+      //*********************************************************************
+      template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+      iterator find(const K& key)
+      {
+        return make_iterator(find_index(key, hash_key(key)));
+      }
+
+      //*********************************************************************
+      /// Finds an element.
+      ///\param key The key to search for.
+      ///\return An iterator to the element if the key exists, otherwise end().
+      //*********************************************************************
+      template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+      const_iterator find(const K& key) const
+      {
+        return make_const_iterator(find_index(key, hash_key(key)));
+      }
+#endif
+
+      //*********************************************************************
+      /// Counts an element.
+      ///\param key The key to search for.
+      ///\return 1 if the key exists, otherwise 0.
+      //*********************************************************************
+      size_t count(const_key_reference key) const
+      {
+        return (find_index(key, hash_key(key)) == number_of_slots) ? 0U : 1U;
+      }
+
+#if ETL_USING_CPP11
+      //*********************************************************************
+      /// Counts an element.
+      ///\param key The key to search for.
+      ///\return 1 if the key exists, otherwise 0.
+      //*********************************************************************
+      template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+      size_t count(const K& key) const
+      {
+        return (find_index(key, hash_key(key)) == number_of_slots) ? 0U : 1U;
+      }
+#endif
+
+      //*********************************************************************
+      /// Check if the table contains the key.
+      //*********************************************************************
+      bool contains(const_key_reference key) const
+      {
+        return find_index(key, hash_key(key)) != number_of_slots;
+      }
+
+#if ETL_USING_CPP11
+      //*********************************************************************
+      /// Check if the table contains the key.
+      //*********************************************************************
+      template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+      bool contains(const K& key) const
+      {
+        return find_index(key, hash_key(key)) != number_of_slots;
+      }
+#endif
+
+      //*********************************************************************
+      /// Returns a range containing all elements with the key.
+      /// As keys are unique, the range will contain no more than one element.
+      ///\param key The key to search for.
+      //*********************************************************************
+      ETL_OR_STD::pair<iterator, iterator> equal_range(const_key_reference key)
+      {
+        iterator first = find(key);
+        iterator last  = first;
+
+        if (last != end())
+        {
+          ++last;
+        }
+
+        return ETL_OR_STD::pair<iterator, iterator>(first, last);
+      }
+
+      //*********************************************************************
+      /// Returns a range containing all elements with the key.
+      /// As keys are unique, the range will contain no more than one element.
+      ///\param key The key to search for.
+      //*********************************************************************
+      ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+      {
+        const_iterator first = find(key);
+        const_iterator last  = first;
+
+        if (last != end())
+        {
+          ++last;
+        }
+
+        return ETL_OR_STD::pair<const_iterator, const_iterator>(first, last);
+      }
+
+#if ETL_USING_CPP11
+      //*********************************************************************
+      /// Returns a range containing all elements with the key.
+      /// As keys are unique, the range will contain no more than one element.
+      ///\param key The key to search for.
+      //*********************************************************************
+      template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+      ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+      {
+        iterator first = find(key);
+        iterator last  = first;
+
+        if (last != end())
+        {
+          ++last;
+        }
+
+        return ETL_OR_STD::pair<iterator, iterator>(first, last);
+      }
+
+      //*********************************************************************
+      /// Returns a range containing all elements with the key.
+      /// As keys are unique, the range will contain no more than one element.
+      ///\param key The key to search for.
+      //*********************************************************************
+      template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+      ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+      {
+        const_iterator first = find(key);
+        const_iterator last  = first;
+
+        if (last != end())
+        {
+          ++last;
+        }
+
+        return ETL_OR_STD::pair<const_iterator, const_iterator>(first, last);
+      }
+#endif
+
+      //*********************************************************************
+      /// Erases an element.
+      ///\param key The key to erase.
+      ///\return The number of elements erased. 0 or 1.
+      //*********************************************************************
+      size_t erase(const_key_reference key)
+      {
+        size_t index = find_index(key, hash_key(key));
+
+        if (index == number_of_slots)
+        {
+          return 0U;
+        }
+
+        erase_index(index);
+
+        return 1U;
+      }
+
+#if ETL_USING_CPP11
+      //*********************************************************************
+      /// Erases an element.
+      ///\param key The key to erase.
+      ///\return The number of elements erased. 0 or 1.
+      //*********************************************************************
+      template <typename K, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KE>::value, int> = 0>
+      size_t erase(const K& key)
+      {
+        size_t index = find_index(key, hash_key(key));
+
+        if (index == number_of_slots)
+        {
+          return 0U;
+        }
+
+        erase_index(index);
+
+        return 1U;
+      }
+#endif
+
+      //*********************************************************************
+      /// Erases an element.
+      /// Erasing does not move any other elements, so other iterators remain valid.
+      ///\param ielement Iterator to the element.
+      ///\return An iterator to the next element.
+      //*********************************************************************
+      iterator erase(const_iterator ielement)
+      {
+        const size_t index = static_cast<size_t>(ielement.pctrl - pctrl);
+
+        erase_index(index);
+
+        return make_iterator(first_full(index + 1U));
+      }
+
+      //*********************************************************************
+      /// Erases a range of elements.
+      /// The range includes all the elements between first and last, including the
+      /// element pointed by first, but not the one pointed to by last.
+      ///\param first Iterator to the first element.
+      ///\param last  Iterator to the last element.
+      //*********************************************************************
+      iterator erase(const_iterator first_, const_iterator last_)
+      {
+        while (first_ != last_)
+        {
+          const size_t index = static_cast<size_t>(first_.pctrl - pctrl);
+          ++first_;
+
+          erase_index(index);
+        }
+
+        return make_iterator(static_cast<size_t>(last_.pctrl - pctrl));
+      }
+
+      //*************************************************************************
+      /// Clears the table.
+      //*************************************************************************
+      void clear()
+      {
+        initialise();
+      }
+
+      //*************************************************************************
+      /// Gets the size of the table.
+      //*************************************************************************
+      size_type size() const
+      {
+        return current_size;
+      }
+
+      //*************************************************************************
+      /// Gets the maximum possible size of the table.
+      //*************************************************************************
+      size_type max_size() const
+      {
+        return maximum_size;
+      }
+
+      //*************************************************************************
+      /// Gets the maximum possible size of the table.
+      //*************************************************************************
+      size_type capacity() const
+      {
+        return maximum_size;
+      }
+
+      //*************************************************************************
+      /// Checks to see if the table is empty.
+      //*************************************************************************
+      bool empty() const
+      {
+        return current_size == 0U;
+      }
+
+      //*************************************************************************
+      /// Checks to see if the table is full.
+      //*************************************************************************
+      bool full() const
+      {
+        return current_size == maximum_size;
+      }
+
+      //*************************************************************************
+      /// Returns the remaining capacity.
+      ///\return The remaining capacity.
+      //*************************************************************************
+      size_t available() const
+      {
+        return maximum_size - current_size;
+      }
+
+      //*************************************************************************
+      /// Gets the number of slots in the table.
+      //*************************************************************************
+      size_type bucket_count() const
+      {
+        return number_of_slots;
+      }
+
+      //*************************************************************************
+      /// Gets the maximum number of slots in the table.
+      //*************************************************************************
+      size_type max_bucket_count() const
+      {
+        return number_of_slots;
+      }
+
+      //*************************************************************************
+      /// Returns the load factor = size / bucket_count.
+      ///\return The load factor = size / bucket_count.
+      //*************************************************************************
+      float load_factor() const
+      {
+        return static_cast<float>(size()) / static_cast<float>(bucket_count());
+      }
+
+      //*************************************************************************
+      /// Returns the function that hashes the keys.
+      ///\return The function that hashes the keys..
+      //*************************************************************************
+      hasher hash_function() const
+      {
+        return key_hash_function;
+      }
+
+      //*************************************************************************
+      /// Returns the function that compares the keys.
+      ///\return The function that compares the keys..
+      //*************************************************************************
+      key_equal key_eq() const
+      {
+        return key_equal_function;
+      }
+
+    protected:
+
+      //*********************************************************************
+      /// Constructor.
+      //*********************************************************************
+      flat_hash_table(int8_t* pctrl_, pointer pslots_, size_t number_of_groups_, size_t maximum_size_, hasher key_hash_function_, key_equal key_equal_function_)
+        : pctrl(pctrl_)
+        , pslots(pslots_)
+        , number_of_groups(number_of_groups_)
+        , number_of_slots(number_of_groups_ * group_width::value)
+        , maximum_size(maximum_size_)
+        , growth_limit(number_of_slots - (number_of_slots / 8U))
+        , current_size(0U)
+        , deleted_count(0U)
+        , key_hash_function(key_hash_function_)
+        , key_equal_function(key_equal_function_)
+      {
+        etl::fill_n(pctrl, number_of_slots, static_cast<int8_t>(control::Empty));
+      }
+
+      //*********************************************************************
+      /// Destroys all of the elements and marks all slots as empty.
+      //*********************************************************************
+      void initialise()
+      {
+        if ETL_IF_CONSTEXPR(!etl::is_trivially_destructible<value_type>::value)
+        {
+          for (size_t i = 0U; (i < number_of_slots) && (current_size != 0U); ++i)
+          {
+            if (pctrl[i] >= 0)
+            {
+              pslots[i].~value_type();
+              --current_size;
+            }
+          }
+        }
+
+        ETL_RESET_DEBUG_COUNT;
+
+        etl::fill_n(pctrl, number_of_slots, static_cast<int8_t>(control::Empty));
+        current_size  = 0U;
+        deleted_count = 0U;
+      }
+
+      //*********************************************************************
+      /// Gets the mixed hash of a key.
+      //*********************************************************************
+      template <typename K>
+      size_t hash_key(const K& key) const
+      {
+        return private_flat_hash::mix(key_hash_function(key));
+      }
+
+      //*********************************************************************
+      /// Finds the index of the slot holding the key.
+      ///\return The index, or number_of_slots if not found.
+      //*********************************************************************
+      template <typename K>
+      size_t find_index(const K& key, size_t hash) const
+      {
+        const int8_t h2 = get_h2(hash);
+        size_t       g  = get_first_group(hash);
+
+        for (size_t probe = 0U; probe < number_of_groups; ++probe)
+        {
+          const size_t group_start = g * group_width::value;
+          const group  grp(pctrl + group_start);
+
+          for (group_mask match = grp.match(h2); match.any(); match.clear_lowest())
+          {
+            const size_t index = group_start + match.lowest();
+
+            if (key_equal_function(TKeyOf::get(pslots[index]), key))
+            {
+              return index;
+            }
+          }
+
+          // A group with an empty slot ends the search.
+          if (grp.match_empty().any())
+          {
+            break;
+          }
+
+          g = get_next_group(g);
+        }
+
+        return number_of_slots;
+      }
+
+      //*********************************************************************
+      /// Finds a free slot for a new key, which must not already be in the table.
+      /// The table must not be full.
+      /// The caller must construct the value in the slot and then call set_full.
+      ///\return The index of the free slot.
+      //*********************************************************************
+      size_t find_insert_index(size_t hash)
+      {
+        if ((current_size + deleted_count) >= growth_limit)
+        {
+          rehash_in_place();
+        }
+
+        return find_first_free(hash);
+      }
+
+      //*********************************************************************
+      /// Marks a slot found by find_insert_index as holding a value.
+      //*********************************************************************
+      void set_full(size_t index, size_t hash)
+      {
+        if (pctrl[index] == control::Deleted)
+        {
+          --deleted_count;
+        }
+
+        pctrl[index] = get_h2(hash);
+        ++current_size;
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+
+      //*********************************************************************
+      /// Gets a reference to the value in a slot.
+      //*********************************************************************
+      reference slot(size_t index)
+      {
+        return pslots[index];
+      }
+
+      //*********************************************************************
+      /// Gets a pointer to the storage for a slot.
+      //*********************************************************************
+      void* slot_address(size_t index)
+      {
+        return static_cast<void*>(pslots + index);
+      }
+
+      //*********************************************************************
+      /// Makes an iterator to a slot.
+      //*********************************************************************
+      iterator make_iterator(size_t index)
+      {
+        return iterator(pctrl + index, pctrl + number_of_slots, pslots + index);
+      }
+
+      //*********************************************************************
+      /// Makes a const_iterator to a slot.
+      //*********************************************************************
+      const_iterator make_const_iterator(size_t index) const
+      {
+        return const_iterator(pctrl + index, pctrl + number_of_slots, pslots + index);
+      }
+
+      //*********************************************************************
+      /// Sets the hash and key equality functions.
+      //*********************************************************************
+      void set_functions(const hasher& key_hash_function_, const key_equal& key_equal_function_)
+      {
+        key_hash_function  = key_hash_function_;
+        key_equal_function = key_equal_function_;
+      }
+
+      //*************************************************************************
+      /// Destructor.
+      //*************************************************************************
+      ~flat_hash_table()
+      {
+      }
+
+    private:
+
+      //*********************************************************************
+      /// The control byte for a hash.
+      //*********************************************************************
+      static int8_t get_h2(size_t hash)
+      {
+        return static_cast<int8_t>(hash & 0x7FU);
+      }
+
+      //*********************************************************************
+      /// The group to start the probe sequence at.
+      //*********************************************************************
+      size_t get_first_group(size_t hash) const
+      {
+#if ETL_USING_64BIT_TYPES
+        return static_cast<size_t>((static_cast<uint64_t>(static_cast<uint32_t>(hash >> 7U)) * number_of_groups) >> 32U);
+#else
+        return (hash >> 7U) % number_of_groups;
+#endif
+      }
+
+      //*********************************************************************
+      /// The next group in the probe sequence.
+      //*********************************************************************
+      size_t get_next_group(size_t g) const
+      {
+        ++g;
+
+        return (g == number_of_groups) ? 0U : g;
+      }
+
+      //*********************************************************************
+      /// Finds the first full slot at or after index.
+      //*********************************************************************
+      size_t first_full(size_t index) const
+      {
+        while ((index < number_of_slots) && (pctrl[index] < 0))
+        {
+          ++index;
+        }
+
+        return index;
+      }
+
+      //*********************************************************************
+      /// Finds the first empty or deleted slot in the probe sequence.
+      //*********************************************************************
+      size_t find_first_free(size_t hash) const
+      {
+        size_t g = get_first_group(hash);
+
+        while (true)
+        {
+          const size_t     group_start = g * group_width::value;
+          const group_mask free_slots  = group(pctrl + group_start).match_free();
+
+          if (free_slots.any())
+          {
+            return group_start + free_slots.lowest();
+          }
+
+          g = get_next_group(g);
+        }
+      }
+
+      //*********************************************************************
+      /// Erases the element in a slot.
+      /// A group that still has an empty slot has never been probed past, so
+      /// the slot can be marked empty. Otherwise it must be marked deleted so
+      /// that searches continue past it.
+      //*********************************************************************
+      void erase_index(size_t index)
+      {
+        pslots[index].~value_type();
+        --current_size;
+        ETL_DECREMENT_DEBUG_COUNT;
+
+        const size_t group_start = index - (index % group_width::value);
+
+        if (group(pctrl + group_start).match_empty().any())
+        {
+          pctrl[index] = control::Empty;
+        }
+        else
+        {
+          pctrl[index] = control::Deleted;
+          ++deleted_count;
+        }
+      }
+
+      //*********************************************************************
+      /// Gets a value as an rvalue, where supported.
+      //*********************************************************************
+#if ETL_USING_CPP11
+      static value_type&& move_value(value_type& value)
+      {
+        return etl::move(value);
+      }
+#else
+      static value_type& move_value(value_type& value)
+      {
+        return value;
+      }
+#endif
+
+      //*********************************************************************
+      /// Moves the value from one slot to another, empty, slot.
+      //*********************************************************************
+      void move_slot(size_t from, size_t to)
+      {
+        ::new (slot_address(to)) value_type(move_value(pslots[from]));
+        pslots[from].~value_type();
+      }
+
+      //*********************************************************************
+      /// Removes all of the deleted markers by re-placing every element.
+      /// Every full slot is first marked as deleted, and every deleted slot as
+      /// empty. Each marked element is then moved to the first free slot of
+      /// its probe sequence, swapping with any marked element found there.
+      //*********************************************************************
+      void rehash_in_place()
+      {
+        for (size_t i = 0U; i < number_of_slots; ++i)
+        {
+          pctrl[i] = static_cast<int8_t>((pctrl[i] < 0) ? int8_t(control::Empty) : int8_t(control::Deleted));
+        }
+
+        for (size_t i = 0U; i < number_of_slots; ++i)
+        {
+          if (pctrl[i] != control::Deleted)
+          {
+            continue;
+          }
+
+          const size_t hash   = hash_key(TKeyOf::get(pslots[i]));
+          const size_t target = find_first_free(hash);
+
+          if ((target / group_width::value) == (i / group_width::value))
+          {
+            // Already in the first free group of its probe sequence.
+            pctrl[i] = get_h2(hash);
+          }
+          else if (pctrl[target] == control::Empty)
+          {
+            move_slot(i, target);
+            pctrl[target] = get_h2(hash);
+            pctrl[i]      = control::Empty;
+          }
+          else
+          {
+            // Swap with the marked element in the target slot, then look at this slot again.
+            typename etl::aligned_storage<sizeof(value_type), etl::alignment_of<value_type>::value>::type temp;
+
+            ::new (static_cast<void*>(&temp)) value_type(move_value(pslots[target]));
+            pslots[target].~value_type();
+            move_slot(i, target);
+
+            value_type& temp_value = *reinterpret_cast<value_type*>(&temp);
+            ::new (slot_address(i)) value_type(move_value(temp_value));
+            temp_value.~value_type();
+
+            pctrl[target] = get_h2(hash);
+            --i;
+          }
+        }
+
+        deleted_count = 0U;
+      }
+
+      // Disable copy construction.
+      flat_hash_table(const flat_hash_table&);
+
+      int8_t*      pctrl;              ///< The control bytes.
+      pointer      pslots;             ///< The slots.
+      const size_t number_of_groups;   ///< The number of groups of slots.
+      const size_t number_of_slots;    ///< The number of slots.
+      const size_t maximum_size;       ///< The maximum number of elements.
+      const size_t growth_limit;       ///< The number of full or deleted slots that triggers a rehash.
+      size_t       current_size;       ///< The number of elements.
+      size_t       deleted_count;      ///< The number of deleted slots.
+
+      hasher    key_hash_function;     ///< The function that creates the hashes.
+      key_equal key_equal_function;    ///< The function that compares the keys for equality.
+
+      ETL_DECLARE_DEBUG_COUNT;
+    };
+  }
+}
+
+#endif
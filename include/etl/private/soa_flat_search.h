@@ -0,0 +1,202 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SOA_FLAT_SEARCH_INCLUDED
+#define ETL_SOA_FLAT_SEARCH_INCLUDED
+
+#include "../platform.h"
+#include "../bit.h"
+#include "../memory.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Search policies for etl::soa_flat_map and etl::soa_flat_set.
+  //***************************************************************************
+  namespace soa_flat_search
+  {
+    //*************************************************************************
+    /// Branchless binary search of the sorted keys.
+    //*************************************************************************
+    struct binary
+    {
+    };
+
+    //*************************************************************************
+    /// Search of a copy of the keys held in Eytzinger (breadth first) order.
+    /// The first levels of the search share a few cache lines, and each
+    /// later step reads the next level down. Costs a second copy of the keys
+    /// and an index per element, and a rebuild on every modification.
+    //*************************************************************************
+    struct eytzinger
+    {
+    };
+  }
+
+  namespace private_soa_flat
+  {
+    typedef uint32_t eytzinger_index_type;
+
+    //*************************************************************************
+    /// Returns the index of the first key not less than 'key'.
+    /// The loop has a fixed number of steps for a given size, and the
+    /// comparison selects the next position rather than a branch.
+    //*************************************************************************
+    template <typename TKey, typename TCompare>
+    size_t lower_bound(const TKey* keys, size_t size, const TKey& key, const TCompare& compare)
+    {
+      if (size == 0U)
+      {
+        return 0U;
+      }
+
+      const TKey* first = keys;
+
+      while (size > 1U)
+      {
+        const size_t half = size / 2U;
+
+        first = compare(first[half], key) ? first + half : first;
+        size -= half;
+      }
+
+      return size_t(first - keys) + (compare(*first, key) ? 1U : 0U);
+    }
+
+    //*************************************************************************
+    /// Returns the Eytzinger node of the first key not less than 'key', or 0.
+    /// The nodes are numbered from 1 and the children of node k are 2k and 2k + 1.
+    //*************************************************************************
+    template <typename TKey, typename TCompare>
+    size_t eytzinger_lower_bound(const TKey* eytzinger_keys, size_t size, const TKey& key, const TCompare& compare)
+    {
+      size_t k = 1U;
+
+      while (k <= size)
+      {
+        k = (2U * k) + (compare(eytzinger_keys[k], key) ? 1U : 0U);
+      }
+
+      // Go back up past the nodes where we went right.
+      return k >> (etl::countr_zero(~k) + 1);
+    }
+
+    //*************************************************************************
+    /// The Eytzinger node of the first in order element, or 0 if empty.
+    //*************************************************************************
+    inline size_t eytzinger_first(size_t size)
+    {
+      if (size == 0U)
+      {
+        return 0U;
+      }
+
+      size_t k = 1U;
+
+      while ((2U * k) <= size)
+      {
+        k *= 2U;
+      }
+
+      return k;
+    }
+
+    //*************************************************************************
+    /// The Eytzinger node following 'k' in order, or 0 if there is none.
+    //*************************************************************************
+    inline size_t eytzinger_next(size_t k, size_t size)
+    {
+      if (((2U * k) + 1U) <= size)
+      {
+        // The leftmost node of the right subtree.
+        k = (2U * k) + 1U;
+
+        while ((2U * k) <= size)
+        {
+          k *= 2U;
+        }
+      }
+      else
+      {
+        // Up to the first ancestor of which we are in the left subtree.
+        while ((k & 1U) != 0U)
+        {
+          k >>= 1U;
+        }
+
+        k >>= 1U;
+      }
+
+      return k;
+    }
+
+    //*************************************************************************
+    /// Storage for the Eytzinger copy of the keys.
+    /// Empty for binary search.
+    //*************************************************************************
+    template <typename TKey, size_t VSize, typename TSearch>
+    struct eytzinger_storage
+    {
+      TKey* keys()
+      {
+        return ETL_NULLPTR;
+      }
+
+      eytzinger_index_type* index()
+      {
+        return ETL_NULLPTR;
+      }
+    };
+
+    //*************************************************************************
+    template <typename TKey, size_t VSize>
+    struct eytzinger_storage<TKey, VSize, etl::soa_flat_search::eytzinger>
+    {
+      TKey* keys()
+      {
+        return key_buffer.begin();
+      }
+
+      eytzinger_index_type* index()
+      {
+        return index_buffer;
+      }
+
+      // Numbered from 1.
+      etl::uninitialized_buffer_of<TKey, VSize + 1U> key_buffer;
+      eytzinger_index_type index_buffer[VSize + 1U];
+    };
+  }
+}
+
+#endif
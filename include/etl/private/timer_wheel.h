@@ -0,0 +1,900 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TIMER_WHEEL_INCLUDED
+#define ETL_TIMER_WHEEL_INCLUDED
+
+#include "../platform.h"
+#include "../algorithm.h"
+#include "../timer.h"
+#include "../delegate.h"
+#include "../placement_new.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_timer_wheel
+  {
+    //*************************************************************************
+    /// A hashed timing wheel for timer data.
+    /// Each active timer holds its absolute expiry time and is linked, in
+    /// constant time, into the slot selected by the low bits of that time.
+    /// The wheel advances one slot per unit of time, so the cost of a tick is
+    /// proportional to the elapsed time, not to the number of active timers.
+    /// Long idle periods are skipped by jumping straight to the next expiry.
+    /// Timers with equal expiry times are fired in reverse order of insertion,
+    /// as they are for the list based timers.
+    /// Periods must be less than 2^31.
+    ///\tparam TTimer The timer data type. Must have the members
+    /// 'expiry', 'previous', 'next' and 'active'.
+    //*************************************************************************
+    template <typename TTimer>
+    class timer_wheel
+    {
+    public:
+
+      //*******************************
+      timer_wheel(TTimer* ptimers_, etl::timer::id::type* pslots_, uint32_t number_of_slots_)
+        : ptimers(ptimers_)
+        , pslots(pslots_)
+        , mask(number_of_slots_ - 1U)
+        , current_time(0U)
+        , active_count(0U)
+      {
+        clear();
+      }
+
+      //*******************************
+      bool empty() const
+      {
+        return active_count == 0U;
+      }
+
+      //*******************************
+      /// The current time of the wheel.
+      //*******************************
+      uint32_t time() const
+      {
+        return current_time;
+      }
+
+      //*******************************
+      /// Inserts the timer to expire after 'delay'.
+      //*******************************
+      void insert(etl::timer::id::type id_, uint32_t delay)
+      {
+        TTimer& timer = ptimers[id_];
+
+        timer.expiry = current_time + delay;
+        timer.active = true;
+
+        etl::timer::id::type& head = pslots[timer.expiry & mask];
+
+        timer.previous = etl::timer::id::NO_TIMER;
+        timer.next     = head;
+
+        if (head != etl::timer::id::NO_TIMER)
+        {
+          ptimers[head].previous = id_;
+        }
+
+        head = id_;
+        ++active_count;
+      }
+
+      //*******************************
+      /// Removes the timer from its slot.
+      //*******************************
+      void remove(etl::timer::id::type id_)
+      {
+        TTimer& timer = ptimers[id_];
+
+        if (timer.previous == etl::timer::id::NO_TIMER)
+        {
+          pslots[timer.expiry & mask] = timer.next;
+        }
+        else
+        {
+          ptimers[timer.previous].next = timer.next;
+        }
+
+        if (timer.next != etl::timer::id::NO_TIMER)
+        {
+          ptimers[timer.next].previous = timer.previous;
+        }
+
+        timer.previous = etl::timer::id::NO_TIMER;
+        timer.next     = etl::timer::id::NO_TIMER;
+        timer.active   = false;
+        --active_count;
+      }
+
+      //*******************************
+      void clear()
+      {
+        etl::fill_n(pslots, mask + 1U, static_cast<etl::timer::id::type>(etl::timer::id::NO_TIMER));
+        active_count = 0U;
+      }
+
+      //*******************************
+      /// The time until the next timer expires.
+      /// Returns etl::timer::interval::No_Active_Interval if there are no active timers.
+      /// Walks the slots forward from the current time, stopping at the first
+      /// timer that expires in this revolution of the wheel.
+      //*******************************
+      uint32_t time_to_next() const
+      {
+        uint32_t result = static_cast<uint32_t>(etl::timer::interval::No_Active_Interval);
+
+        if (!empty())
+        {
+          for (uint32_t distance = 0U; distance <= mask; ++distance)
+          {
+            etl::timer::id::type id = pslots[(current_time + distance) & mask];
+
+            while (id != etl::timer::id::NO_TIMER)
+            {
+              const TTimer& timer = ptimers[id];
+              const uint32_t remaining = timer.expiry - current_time;
+
+              if (remaining == distance)
+              {
+                return remaining;
+              }
+
+              result = etl::min(result, remaining);
+              id = timer.next;
+            }
+          }
+        }
+
+        return result;
+      }
+
+      //*******************************
+      /// Removes and returns the next timer that expires at or before 'target'.
+      /// Advances the wheel's time as it goes.
+      /// Returns etl::timer::id::NO_TIMER when the wheel has reached 'target'
+      /// and there are no more expired timers.
+      //*******************************
+      etl::timer::id::type expire_next(uint32_t target)
+      {
+        while (true)
+        {
+          // The first due timer in the current slot is the most recently inserted.
+          etl::timer::id::type id = pslots[current_time & mask];
+
+          while (id != etl::timer::id::NO_TIMER)
+          {
+            if (has_expired(ptimers[id]))
+            {
+              remove(id);
+              return id;
+            }
+
+            id = ptimers[id].next;
+          }
+
+          if (current_time == target)
+          {
+            return etl::timer::id::NO_TIMER;
+          }
+
+          const uint32_t remaining = target - current_time;
+
+          if (empty())
+          {
+            current_time = target;
+          }
+          else if (remaining > mask)
+          {
+            // More than one revolution to go, so jump straight to the next expiry.
+            current_time += etl::min(time_to_next(), remaining);
+          }
+          else
+          {
+            ++current_time;
+          }
+        }
+      }
+
+    private:
+
+      //*******************************
+      bool has_expired(const TTimer& timer) const
+      {
+        return static_cast<int32_t>(current_time - timer.expiry) >= 0;
+      }
+
+      TTimer* const               ptimers;
+      etl::timer::id::type* const pslots;
+      const uint32_t              mask;
+      uint32_t                    current_time;
+      uint_least8_t               active_count;
+    };
+
+    //*************************************************************************
+    /// The state of a timer in a timer wheel.
+    //*************************************************************************
+    struct timer_data
+    {
+      //*******************************
+      timer_data()
+        : period(0U)
+        , expiry(0U)
+        , id(etl::timer::id::NO_TIMER)
+        , previous(etl::timer::id::NO_TIMER)
+        , next(etl::timer::id::NO_TIMER)
+        , repeating(true)
+        , active(false)
+      {
+      }
+
+      //*******************************
+      timer_data(etl::timer::id::type id_, uint32_t period_, bool repeating_)
+        : period(period_)
+        , expiry(0U)
+        , id(id_)
+        , previous(etl::timer::id::NO_TIMER)
+        , next(etl::timer::id::NO_TIMER)
+        , repeating(repeating_)
+        , active(false)
+      {
+      }
+
+      //*******************************
+      /// Returns true if the timer is active.
+      //*******************************
+      bool is_active() const
+      {
+        return active;
+      }
+
+      uint32_t             period;
+      uint32_t             expiry;
+      etl::timer::id::type id;
+      uint_least8_t        previous;
+      uint_least8_t        next;
+      bool                 repeating;
+      bool                 active;
+    };
+
+    //*************************************************************************
+    /// A timer that calls a delegate.
+    //*************************************************************************
+    struct callback_timer_data : public timer_data
+    {
+      typedef etl::delegate<void(void)> callback_type;
+
+      //*******************************
+      callback_timer_data()
+        : timer_data()
+        , callback()
+      {
+      }
+
+      //*******************************
+      callback_timer_data(etl::timer::id::type id_,
+                          const callback_type& callback_,
+                          uint32_t             period_,
+                          bool                 repeating_)
+        : timer_data(id_, period_, repeating_)
+        , callback(callback_)
+      {
+      }
+
+      //*******************************
+      void fire()
+      {
+        if (callback.is_valid())
+        {
+          callback();
+        }
+      }
+
+      callback_type callback;
+
+    private:
+
+      // Disabled.
+      callback_timer_data(const callback_timer_data& other) ETL_DELETE;
+      callback_timer_data& operator =(const callback_timer_data& other) ETL_DELETE;
+    };
+
+    //*************************************************************************
+    /// A timer that sends a message to a router.
+    /// Templated on the message types, so that this header does not depend on
+    /// the messaging headers.
+    //*************************************************************************
+    template <typename TMessage, typename TRouter, typename TRouterId>
+    struct message_timer_data : public timer_data
+    {
+      //*******************************
+      message_timer_data()
+        : timer_data()
+        , p_message(ETL_NULLPTR)
+        , p_router(ETL_NULLPTR)
+        , destination_router_id()
+      {
+      }
+
+      //*******************************
+      message_timer_data(etl::timer::id::type id_,
+                         const TMessage&      message_,
+                         TRouter&             router_,
+                         uint32_t             period_,
+                         bool                 repeating_,
+                         TRouterId            destination_router_id_)
+        : timer_data(id_, period_, repeating_)
+        , p_message(&message_)
+        , p_router(&router_)
+        , destination_router_id(destination_router_id_)
+      {
+      }
+
+      //*******************************
+      void fire()
+      {
+        if (p_router != ETL_NULLPTR)
+        {
+          p_router->receive(destination_router_id, *p_message);
+        }
+      }
+
+      const TMessage* p_message;
+      TRouter*        p_router;
+      TRouterId       destination_router_id;
+
+    private:
+
+      // Disabled.
+      message_timer_data(const message_timer_data& other) ETL_DELETE;
+      message_timer_data& operator =(const message_timer_data& other) ETL_DELETE;
+    };
+
+    //*************************************************************************
+    /// Access to the wheel guarded by a counting semaphore.
+    /// A tick is skipped while the semaphore is held.
+    //*************************************************************************
+    template <typename TSemaphore>
+    class semaphore_access
+    {
+    protected:
+
+      //*******************************
+      class scoped_lock
+      {
+      public:
+
+        explicit scoped_lock(const semaphore_access& access_)
+          : semaphore(access_.semaphore)
+        {
+          ++semaphore;
+        }
+
+        ~scoped_lock()
+        {
+          --semaphore;
+        }
+
+      private:
+
+        TSemaphore& semaphore;
+      };
+
+      //*******************************
+      semaphore_access()
+        : semaphore(0U)
+      {
+      }
+
+      //*******************************
+      bool try_lock_tick() const
+      {
+        return semaphore == 0U;
+      }
+
+      //*******************************
+      void unlock_tick() const
+      {
+      }
+
+    private:
+
+      mutable TSemaphore semaphore;
+    };
+
+    //*************************************************************************
+    /// Access to the wheel guarded by an interrupt guard.
+    /// The tick is assumed to be called from the interrupt.
+    //*************************************************************************
+    template <typename TInterruptGuard>
+    class interrupt_access
+    {
+    protected:
+
+      //*******************************
+      class scoped_lock
+      {
+      public:
+
+        explicit scoped_lock(const interrupt_access&)
+        {
+        }
+
+      private:
+
+        TInterruptGuard interrupt_guard;
+      };
+
+      //*******************************
+      bool try_lock_tick() const
+      {
+        return true;
+      }
+
+      //*******************************
+      void unlock_tick() const
+      {
+      }
+    };
+
+    //*************************************************************************
+    /// Access to the wheel guarded by user supplied lock delegates.
+    /// A tick is skipped if the lock cannot be taken.
+    //*************************************************************************
+    class delegate_access
+    {
+    public:
+
+      typedef etl::delegate<bool(void)> try_lock_type;
+      typedef etl::delegate<void(void)> lock_type;
+      typedef etl::delegate<void(void)> unlock_type;
+
+      //*******************************
+      /// Sets the lock and unlock delegates.
+      //*******************************
+      void set_locks(try_lock_type try_lock_, lock_type lock_, unlock_type unlock_)
+      {
+        try_lock = try_lock_;
+        lock     = lock_;
+        unlock   = unlock_;
+      }
+
+    protected:
+
+      //*******************************
+      class scoped_lock
+      {
+      public:
+
+        explicit scoped_lock(const delegate_access& access_)
+          : access(access_)
+        {
+          access.lock();
+        }
+
+        ~scoped_lock()
+        {
+          access.unlock();
+        }
+
+      private:
+
+        const delegate_access& access;
+      };
+
+      //*******************************
+      bool try_lock_tick() const
+      {
+        return try_lock();
+      }
+
+      //*******************************
+      void unlock_tick() const
+      {
+        unlock();
+      }
+
+    private:
+
+      try_lock_type try_lock; ///< The callback that tries to lock.
+      lock_type     lock;     ///< The callback that locks.
+      unlock_type   unlock;   ///< The callback that unlocks.
+    };
+
+    //*************************************************************************
+    /// The timer bookkeeping shared by the callback and message timer wheels.
+    /// Registered timers are held in an array indexed by id, and the active
+    /// ones are linked into a timer_wheel.
+    ///\tparam TTimer  The timer data. Derived from timer_data, with a 'fire' member.
+    ///\tparam TAccess The access policy that guards changes to the wheel.
+    //*************************************************************************
+    template <typename TTimer, typename TAccess>
+    class timer_wheel_base : public TAccess
+    {
+    public:
+
+      typedef etl::delegate<void(etl::timer::id::type)> event_callback_type;
+
+      //*******************************************
+      /// Unregister a timer.
+      //*******************************************
+      bool unregister_timer(etl::timer::id::type id_)
+      {
+        bool result = false;
+
+        if (is_valid_timer_id(id_))
+        {
+          TTimer& timer = timer_array[id_];
+
+          if (timer.id != etl::timer::id::NO_TIMER)
+          {
+            if (timer.is_active())
+            {
+              access_guard guard(*this);
+
+              active_wheel.remove(timer.id);
+              remove_callback.call_if(timer.id);
+            }
+
+            // Reset in-place.
+            ::new (&timer) TTimer();
+            --number_of_registered_timers;
+
+            result = true;
+          }
+        }
+
+        return result;
+      }
+
+      //*******************************************
+      /// Enable/disable the timer.
+      //*******************************************
+      void enable(bool state_)
+      {
+        enabled = state_;
+      }
+
+      //*******************************************
+      /// Get the enable/disable state.
+      //*******************************************
+      bool is_running() const
+      {
+        return enabled;
+      }
+
+      //*******************************************
+      /// Clears the timer of data.
+      //*******************************************
+      void clear()
+      {
+        access_guard guard(*this);
+
+        active_wheel.clear();
+
+        for (uint_least8_t i = 0U; i < Max_Timers; ++i)
+        {
+          ::new (&timer_array[i]) TTimer();
+        }
+
+        number_of_registered_timers = 0U;
+      }
+
+      //*******************************************
+      // Called by the timer service to indicate the
+      // amount of time that has elapsed since the last successful call to 'tick'.
+      // Returns true if the tick was processed,
+      // false if not.
+      //*******************************************
+      bool tick(uint32_t count)
+      {
+        if (enabled)
+        {
+          if (this->try_lock_tick())
+          {
+            const uint32_t target = active_wheel.time() + count;
+
+            etl::timer::id::type id = active_wheel.expire_next(target);
+
+            while (id != etl::timer::id::NO_TIMER)
+            {
+              TTimer& timer = timer_array[id];
+
+              remove_callback.call_if(timer.id);
+
+              timer.fire();
+
+              if (timer.repeating)
+              {
+                // Reinsert the timer.
+                active_wheel.insert(timer.id, timer.period);
+                insert_callback.call_if(timer.id);
+              }
+
+              id = active_wheel.expire_next(target);
+            }
+
+            this->unlock_tick();
+
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+      //*******************************************
+      /// Starts a timer.
+      //*******************************************
+      bool start(etl::timer::id::type id_, bool immediate_ = false)
+      {
+        bool result = false;
+
+        // Valid timer id?
+        if (is_valid_timer_id(id_))
+        {
+          TTimer& timer = timer_array[id_];
+
+          // Registered timer?
+          if (timer.id != etl::timer::id::NO_TIMER)
+          {
+            // Has a valid period.
+            if (timer.period != etl::timer::state::Inactive)
+            {
+              access_guard guard(*this);
+
+              if (timer.is_active())
+              {
+                active_wheel.remove(timer.id);
+                remove_callback.call_if(timer.id);
+              }
+
+              active_wheel.insert(timer.id, immediate_ ? 0U : timer.period);
+              insert_callback.call_if(timer.id);
+
+              result = true;
+            }
+          }
+        }
+
+        return result;
+      }
+
+      //*******************************************
+      /// Stops a timer.
+      //*******************************************
+      bool stop(etl::timer::id::type id_)
+      {
+        bool result = false;
+
+        // Valid timer id?
+        if (is_valid_timer_id(id_))
+        {
+          TTimer& timer = timer_array[id_];
+
+          // Registered timer?
+          if (timer.id != etl::timer::id::NO_TIMER)
+          {
+            if (timer.is_active())
+            {
+              access_guard guard(*this);
+
+              active_wheel.remove(timer.id);
+              remove_callback.call_if(timer.id);
+            }
+
+            result = true;
+          }
+        }
+
+        return result;
+      }
+
+      //*******************************************
+      /// Sets a timer's period.
+      //*******************************************
+      bool set_period(etl::timer::id::type id_, uint32_t period_)
+      {
+        if (stop(id_))
+        {
+          timer_array[id_].period = period_;
+          return true;
+        }
+
+        return false;
+      }
+
+      //*******************************************
+      /// Sets a timer's mode.
+      //*******************************************
+      bool set_mode(etl::timer::id::type id_, bool repeating_)
+      {
+        if (stop(id_))
+        {
+          timer_array[id_].repeating = repeating_;
+          return true;
+        }
+
+        return false;
+      }
+
+      //*******************************************
+      /// Check if there is an active timer.
+      //*******************************************
+      bool has_active_timer() const
+      {
+        access_guard guard(*this);
+
+        return !active_wheel.empty();
+      }
+
+      //*******************************************
+      /// Get the time to the next timer event.
+      /// Returns etl::timer::interval::No_Active_Interval if there is no active timer.
+      //*******************************************
+      uint32_t time_to_next() const
+      {
+        access_guard guard(*this);
+
+        return active_wheel.time_to_next();
+      }
+
+      //*******************************************
+      /// Checks if a timer is currently active.
+      /// Returns <b>true</b> if the timer is active, otherwise <b>false</b>.
+      //*******************************************
+      bool is_active(etl::timer::id::type id_) const
+      {
+        bool result = false;
+
+        // Valid timer id?
+        if (is_valid_timer_id(id_))
+        {
+          access_guard guard(*this);
+
+          const TTimer& timer = timer_array[id_];
+
+          // Registered timer?
+          if (timer.id != etl::timer::id::NO_TIMER)
+          {
+            result = timer.is_active();
+          }
+        }
+
+        return result;
+      }
+
+      //*******************************************
+      /// Set a callback when a timer is inserted on the wheel.
+      //*******************************************
+      void set_insert_callback(event_callback_type insert_)
+      {
+        insert_callback = insert_;
+      }
+
+      //*******************************************
+      /// Set a callback when a timer is removed from the wheel.
+      //*******************************************
+      void set_remove_callback(event_callback_type remove_)
+      {
+        remove_callback = remove_;
+      }
+
+      //*******************************************
+      void clear_insert_callback()
+      {
+        insert_callback.clear();
+      }
+
+      //*******************************************
+      void clear_remove_callback()
+      {
+        remove_callback.clear();
+      }
+
+    protected:
+
+      //*******************************************
+      /// Constructor.
+      //*******************************************
+      timer_wheel_base(TTimer* const timer_array_, const uint_least8_t Max_Timers_,
+                       etl::timer::id::type* const wheel_slots_, const uint32_t Wheel_Size_)
+        : timer_array(timer_array_)
+        , active_wheel(timer_array_, wheel_slots_, Wheel_Size_)
+        , enabled(false)
+        , number_of_registered_timers(0U)
+        , Max_Timers(Max_Timers_)
+      {
+      }
+
+      //*******************************************
+      /// Reserves the first free timer.
+      /// The caller constructs the timer in place at timer_at(id).
+      /// Returns etl::timer::id::NO_TIMER if there are no free timers.
+      //*******************************************
+      etl::timer::id::type allocate_timer()
+      {
+        if (number_of_registered_timers < Max_Timers)
+        {
+          // Search for the free space.
+          for (uint_least8_t i = 0U; i < Max_Timers; ++i)
+          {
+            if (timer_array[i].id == etl::timer::id::NO_TIMER)
+            {
+              ++number_of_registered_timers;
+              return i;
+            }
+          }
+        }
+
+        return etl::timer::id::NO_TIMER;
+      }
+
+      //*******************************************
+      TTimer& timer_at(etl::timer::id::type id_)
+      {
+        return timer_array[id_];
+      }
+
+    private:
+
+      typedef typename TAccess::scoped_lock access_guard;
+
+      //*******************************************
+      /// Check that the timer id is valid.
+      //*******************************************
+      bool is_valid_timer_id(etl::timer::id::type id_) const
+      {
+        return (id_ < Max_Timers);
+      }
+
+      // The array of timer data structures.
+      TTimer* const timer_array;
+
+      // The wheel of active timers.
+      timer_wheel<TTimer> active_wheel;
+
+      bool          enabled;
+      uint_least8_t number_of_registered_timers;
+
+      event_callback_type insert_callback;
+      event_callback_type remove_callback;
+
+    public:
+
+      const uint_least8_t Max_Timers;
+    };
+  }
+}
+
+#endif
@@ -44,6 +44,8 @@ SOFTWARE.
 #include "../iterator.h"
 #include "../math.h"
 #include "../limits.h"
+#include "floating_point_shortest.h"
+#include "decimal_digits.h"
 
 #include <math.h>
 
@@ -136,6 +138,41 @@ namespace etl
       etl::private_to_string::add_alignment(str, start, format);
     }
 
+    //***************************************************************************
+    /// Helper function for base 10 integrals.
+    /// Counts the digits, then writes them directly into the string's buffer,
+    /// last digit first. Returns false, without changing the string, if the
+    /// number will not fit.
+    //***************************************************************************
+    template <typename T, typename TIString>
+    bool add_decimal_digits(T value, TIString& str, const bool negative)
+    {
+      typedef typename TIString::value_type                     type;
+      typedef typename etl::private_decimal::work_type<T>::type work_t;
+
+      const work_t   magnitude = static_cast<work_t>(etl::absolute_unsigned(value));
+      const uint32_t n_digits  = etl::private_decimal::count_digits(magnitude);
+      const size_t   length    = n_digits + (negative ? 1U : 0U);
+
+      if (length > str.available())
+      {
+        return false;
+      }
+
+      const size_t old_size = str.size();
+      str.uninitialized_resize(old_size + length);
+
+      type* end = str.data() + old_size + length;
+      etl::private_decimal::write_digits_backward(end, magnitude);
+
+      if (negative)
+      {
+        str.data()[old_size] = type('-');
+      }
+
+      return true;
+    }
+
     //***************************************************************************
     /// Helper function for integrals.
     //***************************************************************************
@@ -156,7 +193,11 @@ namespace etl
 
       iterator start = str.end();
 
-      if (value == 0)
+      if ((format.get_base() == 10U) && add_decimal_digits(value, str, negative))
+      {
+        // Written directly into the buffer.
+      }
+      else if (value == 0)
       {
         // If number is negative, append '-' (a negative zero might occur for fractional numbers > -1.0)
         if ((format.get_base() == 10U) && negative)
@@ -312,6 +353,33 @@ namespace etl
       {
         etl::private_to_string::add_nan_inf(isnan(value), isinf(value), str);
       }
+#if ETL_USING_64BIT_TYPES
+      else if (format.get_notation() != etl::float_notation::fixed_precision)
+      {
+        // Shortest representation that round trips.
+        const etl::private_floating_point::decimal_value      decimal = etl::private_floating_point::to_shortest_decimal(value);
+        const etl::private_floating_point::binary_float_value binary  = etl::private_floating_point::to_binary_float_value(value);
+
+        if (decimal.negative)
+        {
+          str.push_back(type('-'));
+        }
+
+        if (format.get_notation() == etl::float_notation::shortest_fixed)
+        {
+          // Unbounded length.
+          etl::back_insert_iterator<TIString> itr(str);
+          etl::private_floating_point::write_shortest(itr, decimal, binary, format.get_notation(), format.is_upper_case());
+        }
+        else
+        {
+          type buffer[etl::private_floating_point::Max_Shortest_Length];
+          type* p = buffer;
+          etl::private_floating_point::write_shortest(p, decimal, binary, format.get_notation(), format.is_upper_case());
+          str.insert(str.end(), buffer, p);
+        }
+      }
+#endif
       else
       {
         // Make sure we format the two halves correctly.
@@ -129,6 +129,18 @@ SOFTWARE.
   #if !defined(ETL_USING_BUILTIN_MEMCHR)
     #define ETL_USING_BUILTIN_MEMCHR __has_builtin(__builtin_memchr)
   #endif
+
+  #if !defined(ETL_USING_BUILTIN_POPCOUNT)
+    #define ETL_USING_BUILTIN_POPCOUNT __has_builtin(__builtin_popcount)
+  #endif
+
+  #if !defined(ETL_USING_BUILTIN_CTZ)
+    #define ETL_USING_BUILTIN_CTZ __has_builtin(__builtin_ctz)
+  #endif
+
+  #if !defined(ETL_USING_BUILTIN_CLZ)
+    #define ETL_USING_BUILTIN_CLZ __has_builtin(__builtin_clz)
+  #endif
 #endif
 
 // The default. Set to 0, if not already set.
@@ -180,6 +192,18 @@ SOFTWARE.
   #define ETL_USING_BUILTIN_MEMCHR 0
 #endif
 
+#if !defined(ETL_USING_BUILTIN_POPCOUNT)
+  #define ETL_USING_BUILTIN_POPCOUNT 0
+#endif
+
+#if !defined(ETL_USING_BUILTIN_CTZ)
+  #define ETL_USING_BUILTIN_CTZ 0
+#endif
+
+#if !defined(ETL_USING_BUILTIN_CLZ)
+  #define ETL_USING_BUILTIN_CLZ 0
+#endif
+
 namespace etl
 {
   namespace traits
@@ -198,6 +222,9 @@ namespace etl
     static ETL_CONSTANT bool using_builtin_memset                     = (ETL_USING_BUILTIN_MEMSET == 1);
     static ETL_CONSTANT bool using_builtin_memcmp                     = (ETL_USING_BUILTIN_MEMCMP == 1);
     static ETL_CONSTANT bool using_builtin_memchr                     = (ETL_USING_BUILTIN_MEMCHR == 1);
+    static ETL_CONSTANT bool using_builtin_popcount                   = (ETL_USING_BUILTIN_POPCOUNT == 1);
+    static ETL_CONSTANT bool using_builtin_ctz                        = (ETL_USING_BUILTIN_CTZ == 1);
+    static ETL_CONSTANT bool using_builtin_clz                        = (ETL_USING_BUILTIN_CLZ == 1);
   }
 }
 
@@ -0,0 +1,678 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+#define ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "alignment.h"
+#include "parameter_type.h"
+#include "atomic.h"
+#include "memory_model.h"
+#include "integral_limits.h"
+#include "utility.h"
+#include "placement_new.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  template <size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic_base
+  {
+  public:
+
+    /// The type used for determining the size of queue.
+    typedef typename etl::size_type_lookup<MEMORY_MODEL>::type size_type;
+
+    //*************************************************************************
+    /// Is the queue empty?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    //*************************************************************************
+    /// Is the queue full?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items in the queue?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type size() const
+    {
+      size_type read_index  = read_position.load(etl::memory_order_acquire);
+      size_type write_index = write_position.load(etl::memory_order_acquire);
+
+      size_type n = distance(write_index, read_index);
+
+      // The positions are read at different times, so correct any transient overshoot.
+      if (is_negative(n))
+      {
+        n = 0;
+      }
+      else if (n > MAX_SIZE)
+      {
+        n = MAX_SIZE;
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// How much free space available in the queue.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type available() const
+    {
+      return MAX_SIZE - size();
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+  protected:
+
+    queue_mpmc_atomic_base(size_type max_size_)
+      : MAX_SIZE(max_size_),
+        WRAP((etl::integral_limits<size_type>::max / max_size_) * max_size_),
+        write_position(0),
+        read_position(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Positions run from 0 to WRAP - 1, where WRAP is the largest multiple
+    /// of the capacity that the size type can hold.
+    /// Calculate the position 'n' places after 'position'.
+    //*************************************************************************
+    size_type advance(size_type position, size_type n) const
+    {
+      return (position >= (WRAP - n)) ? size_type(position - (WRAP - n)) : size_type(position + n);
+    }
+
+    //*************************************************************************
+    /// Calculate the distance from 'from' to 'to', modulo WRAP.
+    //*************************************************************************
+    size_type distance(size_type to, size_type from) const
+    {
+      return (to >= from) ? size_type(to - from) : size_type(WRAP - (from - to));
+    }
+
+    //*************************************************************************
+    /// Is the distance a negative one?
+    //*************************************************************************
+    bool is_negative(size_type distance_) const
+    {
+      return distance_ > (WRAP / 2);
+    }
+
+    const size_type MAX_SIZE; ///< The maximum number of items in the queue.
+    const size_type WRAP;     ///< The modulus of the positions.
+
+    char padding_write[ETL_CACHE_LINE_SIZE];
+    etl::atomic<size_type> write_position; ///< The next position to write to.
+    char padding_read[ETL_CACHE_LINE_SIZE];
+    etl::atomic<size_type> read_position;  ///< The next position to read from.
+    char padding_end[ETL_CACHE_LINE_SIZE];
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_MPMC_QUEUE_ATOMIC) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~queue_mpmc_atomic_base()
+    {
+    }
+#else
+  protected:
+    ~queue_mpmc_atomic_base()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  ///\brief This is the base for all queue_mpmc_atomic's that contain a particular type.
+  ///\details Normally a reference to this type will be taken from a derived queue_mpmc_atomic.
+  ///\code
+  /// etl::queue_mpmc_atomic<int, 10> myQueue;
+  /// etl::iqueue_mpmc_atomic<int>& iQueue = myQueue;
+  ///\endcode
+  /// This queue supports concurrent access by multiple producers and multiple consumers.
+  /// It is a bounded lock free queue, where each cell carries a sequence number
+  /// that tells producers and consumers whether it is ready for them.
+  /// \tparam T The type of value that the queue_mpmc_atomic holds.
+  //***************************************************************************
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class iqueue_mpmc_atomic : public queue_mpmc_atomic_base<MEMORY_MODEL>
+  {
+  private:
+
+    typedef etl::queue_mpmc_atomic_base<MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef T                          value_type;      ///< The type stored in the queue.
+    typedef T&                         reference;       ///< A reference to the type used in the queue.
+    typedef const T&                   const_reference; ///< A const reference to the type used in the queue.
+#if ETL_USING_CPP11
+    typedef T&&                        rvalue_reference;///< An rvalue reference to the type used in the queue.
+#endif
+    typedef typename base_t::size_type size_type;       ///< The type used for determining the size of the queue.
+
+    using base_t::write_position;
+    using base_t::read_position;
+    using base_t::MAX_SIZE;
+    using base_t::advance;
+    using base_t::distance;
+    using base_t::is_negative;
+
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(const_reference value)
+    {
+      size_type position;
+      cell_type* p_cell = claim_write(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->value.template get_address<T>()) T(value);
+        commit_write(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(rvalue_reference value)
+    {
+      size_type position;
+      cell_type* p_cell = claim_write(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->value.template get_address<T>()) T(etl::move(value));
+        commit_write(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#endif
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_MPMC_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+      size_type position;
+      cell_type* p_cell = claim_write(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->value.template get_address<T>()) T(etl::forward<Args>(args)...);
+        commit_write(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#else
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    bool emplace()
+    {
+      size_type position;
+      cell_type* p_cell = claim_write(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->value.template get_address<T>()) T();
+        commit_write(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1>
+    bool emplace(const T1& value1)
+    {
+      size_type position;
+      cell_type* p_cell = claim_write(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->value.template get_address<T>()) T(value1);
+        commit_write(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool emplace(const T1& value1, const T2& value2)
+    {
+      size_type position;
+      cell_type* p_cell = claim_write(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->value.template get_address<T>()) T(value1, value2);
+        commit_write(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      size_type position;
+      cell_type* p_cell = claim_write(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->value.template get_address<T>()) T(value1, value2, value3);
+        commit_write(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      size_type position;
+      cell_type* p_cell = claim_write(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->value.template get_address<T>()) T(value1, value2, value3, value4);
+        commit_write(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#endif
+
+    //*************************************************************************
+    /// Pop a value from the queue.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      size_type position;
+      cell_type* p_cell = claim_read(position);
+
+      if (p_cell == ETL_NULLPTR)
+      {
+        // Queue is empty
+        return false;
+      }
+
+      T& item = p_cell->value.template get_reference<T>();
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_MPMC_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+      value = etl::move(item);
+#else
+      value = item;
+#endif
+
+      item.~T();
+      commit_read(p_cell, position);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue and discard.
+    //*************************************************************************
+    bool pop()
+    {
+      size_type position;
+      cell_type* p_cell = claim_read(position);
+
+      if (p_cell == ETL_NULLPTR)
+      {
+        // Queue is empty
+        return false;
+      }
+
+      p_cell->value.template get_reference<T>().~T();
+      commit_read(p_cell, position);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Peek a value at the front of the queue.
+    /// The queue must not be empty.
+    /// Only valid when there are no other consumers popping concurrently.
+    //*************************************************************************
+    reference front()
+    {
+      return p_buffer[index_of(read_position.load(etl::memory_order_acquire))].value.template get_reference<T>();
+    }
+
+    //*************************************************************************
+    /// Peek a value at the front of the queue.
+    /// The queue must not be empty.
+    /// Only valid when there are no other consumers popping concurrently.
+    //*************************************************************************
+    const_reference front() const
+    {
+      return p_buffer[index_of(read_position.load(etl::memory_order_acquire))].value.template get_reference<T>();
+    }
+
+    //*************************************************************************
+    /// Clear the queue.
+    /// Pops every item that has been pushed.
+    //*************************************************************************
+    void clear()
+    {
+      while (pop())
+      {
+        // Do nothing.
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// A cell holds an item and the sequence number that indicates its state.
+    /// sequence == position     : Empty, ready for the producer at 'position'.
+    /// sequence == position + 1 : Full, ready for the consumer at 'position'.
+    //*************************************************************************
+    struct cell_type
+    {
+      etl::atomic<size_type> sequence;
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type value;
+    };
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iqueue_mpmc_atomic(cell_type* p_buffer_, size_type max_size_)
+      : base_t(max_size_),
+        p_buffer(p_buffer_)
+    {
+    }
+
+    //*************************************************************************
+    /// Sets the sequence number of every cell to its position.
+    /// Called by the derived class once its buffer has been constructed.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_type i = 0; i < MAX_SIZE; ++i)
+      {
+        p_buffer[i].sequence.store(i, etl::memory_order_relaxed);
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Get the buffer index for a position.
+    //*************************************************************************
+    size_type index_of(size_type position) const
+    {
+      return position % MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Claims the next cell for writing.
+    /// Returns ETL_NULLPTR if the queue is full.
+    //*************************************************************************
+    cell_type* claim_write(size_type& position)
+    {
+      size_type write_index = write_position.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        cell_type& cell     = p_buffer[index_of(write_index)];
+        size_type  sequence = cell.sequence.load(etl::memory_order_acquire);
+        size_type  delta    = distance(sequence, write_index);
+
+        if (delta == 0)
+        {
+          // The cell is empty; try to claim it.
+          if (write_position.compare_exchange_weak(write_index, advance(write_index, 1), etl::memory_order_relaxed))
+          {
+            position = write_index;
+            return &cell;
+          }
+        }
+        else if (is_negative(delta))
+        {
+          // The cell has not been consumed since the last lap.
+          return ETL_NULLPTR;
+        }
+        else
+        {
+          // Another producer got here first.
+          write_index = write_position.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Publishes a written cell to the consumers.
+    //*************************************************************************
+    void commit_write(cell_type* p_cell, size_type position)
+    {
+      p_cell->sequence.store(advance(position, 1), etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Claims the next cell for reading.
+    /// Returns ETL_NULLPTR if the queue is empty.
+    //*************************************************************************
+    cell_type* claim_read(size_type& position)
+    {
+      size_type read_index = read_position.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        cell_type& cell     = p_buffer[index_of(read_index)];
+        size_type  sequence = cell.sequence.load(etl::memory_order_acquire);
+        size_type  delta    = distance(sequence, advance(read_index, 1));
+
+        if (delta == 0)
+        {
+          // The cell is full; try to claim it.
+          if (read_position.compare_exchange_weak(read_index, advance(read_index, 1), etl::memory_order_relaxed))
+          {
+            position = read_index;
+            return &cell;
+          }
+        }
+        else if (is_negative(delta))
+        {
+          // The cell has not been written yet.
+          return ETL_NULLPTR;
+        }
+        else
+        {
+          // Another consumer got here first.
+          read_index = read_position.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Releases a read cell to the producers of the next lap.
+    //*************************************************************************
+    void commit_read(cell_type* p_cell, size_type position)
+    {
+      p_cell->sequence.store(advance(position, MAX_SIZE), etl::memory_order_release);
+    }
+
+    // Disable copy construction and assignment.
+    iqueue_mpmc_atomic(const iqueue_mpmc_atomic&) ETL_DELETE;
+    iqueue_mpmc_atomic& operator =(const iqueue_mpmc_atomic&) ETL_DELETE;
+
+#if ETL_USING_CPP11
+    iqueue_mpmc_atomic(iqueue_mpmc_atomic&&) = delete;
+    iqueue_mpmc_atomic& operator =(iqueue_mpmc_atomic&&) = delete;
+#endif
+
+    cell_type* p_buffer; ///< The internal buffer.
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  /// A fixed capacity lock free mpmc queue.
+  /// This queue supports concurrent access by multiple producers and multiple consumers.
+  /// \tparam T            The type this queue should support.
+  /// \tparam SIZE         The maximum capacity of the queue. Must be at least 2.
+  /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  //***************************************************************************
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic : public etl::iqueue_mpmc_atomic<T, MEMORY_MODEL>
+  {
+  private:
+
+    typedef etl::iqueue_mpmc_atomic<T, MEMORY_MODEL> base_t;
+    typedef typename base_t::cell_type cell_type;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+    ETL_STATIC_ASSERT((SIZE >= 2U), "Size must be at least 2");
+    ETL_STATIC_ASSERT((SIZE <= (etl::integral_limits<size_type>::max / 2U)), "Size too large for memory model");
+
+    static ETL_CONSTANT size_type MAX_SIZE = size_type(SIZE);
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    queue_mpmc_atomic()
+      : base_t(buffer, MAX_SIZE)
+    {
+      base_t::initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_mpmc_atomic()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    queue_mpmc_atomic(const queue_mpmc_atomic&) ETL_DELETE;
+    queue_mpmc_atomic& operator = (const queue_mpmc_atomic&) ETL_DELETE;
+
+#if ETL_USING_CPP11
+    queue_mpmc_atomic(queue_mpmc_atomic&&) = delete;
+    queue_mpmc_atomic& operator =(queue_mpmc_atomic&&) = delete;
+#endif
+
+    /// The cells used in the queue.
+    cell_type buffer[MAX_SIZE];
+  };
+
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL>
+  ETL_CONSTANT typename queue_mpmc_atomic<T, SIZE, MEMORY_MODEL>::size_type queue_mpmc_atomic<T, SIZE, MEMORY_MODEL>::MAX_SIZE;
+}
+
+#endif
+
+#endif
@@ -39,6 +39,11 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "spsc_policy.h"
+#include "span.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -47,9 +52,49 @@ SOFTWARE.
 
 namespace etl
 {
-  template <size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
-  class queue_spsc_atomic_base
+  //***************************************************************************
+  /// Base exception for a queue_spsc_atomic.
+  //***************************************************************************
+  class queue_spsc_atomic_exception : public exception
+  {
+  public:
+
+    queue_spsc_atomic_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Exception for committing more than was reserved.
+  //***************************************************************************
+  class queue_spsc_atomic_reserve_invalid : public queue_spsc_atomic_exception
+  {
+  public:
+
+    queue_spsc_atomic_reserve_invalid(string_type file_name_, numeric_type line_number_)
+      : queue_spsc_atomic_exception(ETL_ERROR_TEXT("queue_spsc_atomic:reserve", ETL_QUEUE_SPSC_ATOMIC_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_spsc_atomic
+  /// The common base for queue_spsc_atomic.
+  /// \tparam Memory_Model The memory model for the queue.
+  /// \tparam TPolicy      The index layout policy. etl::spsc_policy_compact or etl::spsc_policy_cached.
+  //***************************************************************************
+  template <size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE, typename TPolicy = etl::spsc_policy_compact>
+  class queue_spsc_atomic_base : protected etl::private_spsc::spsc_indexes<etl::atomic<typename etl::size_type_lookup<Memory_Model>::type>,
+                                                                           typename etl::size_type_lookup<Memory_Model>::type,
+                                                                           TPolicy::Padded>
   {
+  private:
+
+    typedef etl::private_spsc::spsc_indexes<etl::atomic<typename etl::size_type_lookup<Memory_Model>::type>,
+                                            typename etl::size_type_lookup<Memory_Model>::type,
+                                            TPolicy::Padded> indexes_t;
+
   public:
 
     /// The type used for determining the size of queue.
@@ -127,11 +172,36 @@ namespace etl
 
   protected:
 
+    using indexes_t::write;
+    using indexes_t::read;
+    using indexes_t::Cached;
+    using indexes_t::producer_read_index;
+    using indexes_t::producer_reload_read_index;
+    using indexes_t::consumer_write_index;
+    using indexes_t::consumer_reload_write_index;
+    using indexes_t::reset_cached_indexes;
+
     queue_spsc_atomic_base(size_type reserved_)
-      : write(0),
-        read(0),
-        Reserved(reserved_)
+      : Reserved(reserved_)
+    {
+    }
+
+    //*************************************************************************
+    /// Is there a free slot for the producer?
+    /// The cached read index is only reloaded if it says that the queue is full.
+    //*************************************************************************
+    bool is_writable(size_type next_index)
+    {
+      return (next_index != producer_read_index()) || (Cached && (next_index != producer_reload_read_index()));
+    }
+
+    //*************************************************************************
+    /// Is there a value for the consumer?
+    /// The cached write index is only reloaded if it says that the queue is empty.
+    //*************************************************************************
+    bool is_readable(size_type read_index)
     {
+      return (read_index != consumer_write_index()) || (Cached && (read_index != consumer_reload_write_index()));
     }
 
     //*************************************************************************
@@ -149,8 +219,26 @@ namespace etl
       return index;
     }
 
-    etl::atomic<size_type> write; ///< Where to input new data.
-    etl::atomic<size_type> read;  ///< Where to get the oldest data.
+    //*************************************************************************
+    /// Calculate the number of free slots that follow the write index without
+    /// wrapping around the end of the buffer.
+    //*************************************************************************
+    static size_type get_contiguous_free_size(size_type write_index, size_type read_index, size_type maximum)
+    {
+      if (read_index > write_index)
+      {
+        return size_type(read_index - write_index - 1U);
+      }
+      else if (read_index == 0U)
+      {
+        return size_type(maximum - write_index - 1U);
+      }
+      else
+      {
+        return size_type(maximum - write_index);
+      }
+    }
+
     const size_type Reserved;     ///< The maximum number of items in the queue.
 
   private:
@@ -182,12 +270,12 @@ namespace etl
   /// This queue supports concurrent access by one producer and one consumer.
   /// \tparam T The type of value that the queue_spsc_atomic holds.
   //***************************************************************************
-  template <typename T, const size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
-  class iqueue_spsc_atomic : public queue_spsc_atomic_base<Memory_Model>
+  template <typename T, const size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE, typename TPolicy = etl::spsc_policy_compact>
+  class iqueue_spsc_atomic : public queue_spsc_atomic_base<Memory_Model, TPolicy>
   {
   private:
 
-    typedef typename etl::queue_spsc_atomic_base<Memory_Model> base_t;
+    typedef typename etl::queue_spsc_atomic_base<Memory_Model, TPolicy> base_t;
 
   public:
 
@@ -203,6 +291,15 @@ namespace etl
     using base_t::read;
     using base_t::Reserved;
     using base_t::get_next_index;
+    using base_t::get_contiguous_free_size;
+    using base_t::Cached;
+    using base_t::is_writable;
+    using base_t::is_readable;
+    using base_t::producer_read_index;
+    using base_t::producer_reload_read_index;
+    using base_t::consumer_write_index;
+    using base_t::consumer_reload_write_index;
+    using base_t::reset_cached_indexes;
 
     //*************************************************************************
     /// Push a value to the queue.
@@ -212,7 +309,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (is_writable(next_index))
       {
         ::new (&p_buffer[write_index]) T(value);
 
@@ -234,7 +331,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (is_writable(next_index))
       {
         ::new (&p_buffer[write_index]) T(etl::move(value));
 
@@ -259,7 +356,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (is_writable(next_index))
       {
         ::new (&p_buffer[write_index]) T(etl::forward<Args>(args)...);
 
@@ -281,7 +378,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (is_writable(next_index))
       {
         ::new (&p_buffer[write_index]) T();
 
@@ -304,7 +401,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (is_writable(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1);
 
@@ -327,7 +424,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (is_writable(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2);
 
@@ -350,7 +447,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (is_writable(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3);
 
@@ -373,7 +470,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, Reserved);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (is_writable(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3, value4);
 
@@ -387,6 +484,135 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    /// Pushes as many values as will fit and publishes them all at once.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push(TIterator first, TIterator last)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type read_index  = producer_read_index();
+      size_type count       = 0U;
+
+      while (first != last)
+      {
+        size_type next_index = get_next_index(write_index, Reserved);
+
+        if ((next_index == read_index) && Cached)
+        {
+          read_index = producer_reload_read_index();
+        }
+
+        if (next_index == read_index)
+        {
+          // Queue is full.
+          break;
+        }
+
+        ::new (&p_buffer[write_index]) T(*first);
+
+        write_index = next_index;
+        ++first;
+        ++count;
+      }
+
+      if (count != 0U)
+      {
+        write.store(write_index, etl::memory_order_release);
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Pop up to max_count values from the queue to an output iterator.
+    /// Releases all of the popped slots at once.
+    ///\return The number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop(TOutputIterator out, size_type max_count)
+    {
+      size_type read_index  = read.load(etl::memory_order_relaxed);
+      size_type write_index = consumer_write_index();
+      size_type count       = 0U;
+
+      while (count < max_count)
+      {
+        if ((read_index == write_index) && Cached)
+        {
+          write_index = consumer_reload_write_index();
+        }
+
+        if (read_index == write_index)
+        {
+          // Queue is empty.
+          break;
+        }
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+        *out = etl::move(p_buffer[read_index]);
+#else
+        *out = p_buffer[read_index];
+#endif
+        p_buffer[read_index].~T();
+
+        read_index = get_next_index(read_index, Reserved);
+        ++out;
+        ++count;
+      }
+
+      if (count != 0U)
+      {
+        read.store(read_index, etl::memory_order_release);
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Reserves up to n contiguous slots at the back of the queue.
+    /// The slots are uninitialised storage; the producer constructs values
+    /// in them in place (with placement new) and then calls commit().
+    /// The span will be shorter than n if the queue is nearly full, or if the
+    /// free space wraps around the end of the buffer.
+    //*************************************************************************
+    etl::span<T> reserve_write(size_type n)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type free_size   = get_contiguous_free_size(write_index, producer_read_index(), Reserved);
+
+      if ((free_size < n) && Cached)
+      {
+        free_size = get_contiguous_free_size(write_index, producer_reload_read_index(), Reserved);
+      }
+
+      return etl::span<T>(p_buffer + write_index, (n < free_size) ? n : free_size);
+    }
+
+    //*************************************************************************
+    /// Publishes the first n slots of the last reserve_write().
+    /// All n values must have been constructed.
+    /// If asserts or exceptions are enabled, emits an etl::queue_spsc_atomic_reserve_invalid
+    /// if n is larger than the free contiguous space.
+    //*************************************************************************
+    void commit(size_type n)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+
+      ETL_ASSERT_OR_RETURN(n <= get_contiguous_free_size(write_index, producer_read_index(), Reserved), ETL_ERROR(queue_spsc_atomic_reserve_invalid));
+
+      write_index = size_type(write_index + n);
+
+      if (write_index == Reserved)
+      {
+        write_index = 0U;
+      }
+
+      write.store(write_index, etl::memory_order_release);
+    }
+
     //*************************************************************************
     /// Peek the next value in the queue without removing it.
     //*************************************************************************
@@ -394,7 +620,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!is_readable(read_index))
       {
         // Queue is empty
         return false;
@@ -412,7 +638,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!is_readable(read_index))
       {
         // Queue is empty
         return false;
@@ -440,7 +666,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!is_readable(read_index))
       {
         // Queue is empty
         return false;
@@ -486,6 +712,7 @@ namespace etl
       {
         write = 0;
         read  = 0;
+        reset_cached_indexes();
       }
       else
       {
@@ -528,13 +755,14 @@ namespace etl
   /// \tparam T            The type this queue should support.
   /// \tparam Size         The maximum capacity of the queue.
   /// \tparam Memory_Model The memory model for the queue. Determines the type of the internal counter variables.
+  /// \tparam TPolicy      The index layout policy. etl::spsc_policy_compact (default) or etl::spsc_policy_cached.
   //***************************************************************************
-  template <typename T, size_t Size, const size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE>
-  class queue_spsc_atomic : public iqueue_spsc_atomic<T, Memory_Model>
+  template <typename T, size_t Size, const size_t Memory_Model = etl::memory_model::MEMORY_MODEL_LARGE, typename TPolicy = etl::spsc_policy_compact>
+  class queue_spsc_atomic : public iqueue_spsc_atomic<T, Memory_Model, TPolicy>
   {
   private:
 
-    typedef typename etl::iqueue_spsc_atomic<T, Memory_Model> base_t;
+    typedef typename etl::iqueue_spsc_atomic<T, Memory_Model, TPolicy> base_t;
 
   public:
 
@@ -572,8 +800,8 @@ namespace etl
     typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type buffer[Reserved_Size];
   };
 
-  template <typename T, size_t Size, const size_t Memory_Model>
-  ETL_CONSTANT typename queue_spsc_atomic<T, Size, Memory_Model>::size_type queue_spsc_atomic<T, Size, Memory_Model>::MAX_SIZE;
+  template <typename T, size_t Size, const size_t Memory_Model, typename TPolicy>
+  ETL_CONSTANT typename queue_spsc_atomic<T, Size, Memory_Model, TPolicy>::size_type queue_spsc_atomic<T, Size, Memory_Model, TPolicy>::MAX_SIZE;
 }
 
 #endif
@@ -38,15 +38,24 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "spsc_policy.h"
 
 #include <stddef.h>
 #include <stdint.h>
 
 namespace etl
 {
-  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
-  class queue_spsc_isr_base
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, typename TPolicy = etl::spsc_policy_compact>
+  class queue_spsc_isr_base : protected etl::private_spsc::spsc_indexes<typename etl::size_type_lookup<MEMORY_MODEL>::type,
+                                                                        typename etl::size_type_lookup<MEMORY_MODEL>::type,
+                                                                        TPolicy::Padded>
   {
+  private:
+
+    typedef etl::private_spsc::spsc_indexes<typename etl::size_type_lookup<MEMORY_MODEL>::type,
+                                            typename etl::size_type_lookup<MEMORY_MODEL>::type,
+                                            TPolicy::Padded> indexes_t;
+
   public:
 
     /// The type used for determining the size of queue.
@@ -189,8 +198,6 @@ namespace etl
 
     queue_spsc_isr_base(T* p_buffer_, size_type max_size_)
       : p_buffer(p_buffer_),
-        write_index(0),
-        read_index(0),
         current_size(0),
         MAX_SIZE(max_size_)
     {
@@ -203,9 +210,9 @@ namespace etl
     {
       if (current_size != MAX_SIZE)
       {
-        ::new (&p_buffer[write_index]) T(value);
+        ::new (&p_buffer[write]) T(value);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
+        write = get_next_index(write, MAX_SIZE);
 
         ++current_size;
 
@@ -224,9 +231,9 @@ namespace etl
     {
       if (current_size != MAX_SIZE)
       {
-        ::new (&p_buffer[write_index]) T(etl::move(value));
+        ::new (&p_buffer[write]) T(etl::move(value));
 
-        write_index = get_next_index(write_index, MAX_SIZE);
+        write = get_next_index(write, MAX_SIZE);
 
         ++current_size;
 
@@ -249,9 +256,9 @@ namespace etl
     {
       if (current_size != MAX_SIZE)
       {
-        ::new (&p_buffer[write_index]) T(etl::forward<Args>(args)...);
+        ::new (&p_buffer[write]) T(etl::forward<Args>(args)...);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
+        write = get_next_index(write, MAX_SIZE);
 
         ++current_size;
 
@@ -270,9 +277,9 @@ namespace etl
     {
       if (current_size != MAX_SIZE)
       {
-        ::new (&p_buffer[write_index]) T();
+        ::new (&p_buffer[write]) T();
 
-        write_index = get_next_index(write_index, MAX_SIZE);
+        write = get_next_index(write, MAX_SIZE);
 
         ++current_size;
 
@@ -292,9 +299,9 @@ namespace etl
     {
       if (current_size != MAX_SIZE)
       {
-        ::new (&p_buffer[write_index]) T(value1);
+        ::new (&p_buffer[write]) T(value1);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
+        write = get_next_index(write, MAX_SIZE);
 
         ++current_size;
 
@@ -314,9 +321,9 @@ namespace etl
     {
       if (current_size != MAX_SIZE)
       {
-        ::new (&p_buffer[write_index]) T(value1, value2);
+        ::new (&p_buffer[write]) T(value1, value2);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
+        write = get_next_index(write, MAX_SIZE);
 
         ++current_size;
 
@@ -336,9 +343,9 @@ namespace etl
     {
       if (current_size != MAX_SIZE)
       {
-        ::new (&p_buffer[write_index]) T(value1, value2, value3);
+        ::new (&p_buffer[write]) T(value1, value2, value3);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
+        write = get_next_index(write, MAX_SIZE);
 
         ++current_size;
 
@@ -358,9 +365,9 @@ namespace etl
     {
       if (current_size != MAX_SIZE)
       {
-        ::new (&p_buffer[write_index]) T(value1, value2, value3, value4);
+        ::new (&p_buffer[write]) T(value1, value2, value3, value4);
 
-        write_index = get_next_index(write_index, MAX_SIZE);
+        write = get_next_index(write, MAX_SIZE);
 
         ++current_size;
 
@@ -385,14 +392,14 @@ namespace etl
       }
 
 #if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_LOCKABLE_FORCE_CPP03_IMPLEMENTATION)
-      value = etl::move(p_buffer[read_index]);
+      value = etl::move(p_buffer[read]);
 #else
-      value = p_buffer[read_index];
+      value = p_buffer[read];
 #endif
 
-      p_buffer[read_index].~T();
+      p_buffer[read].~T();
 
-      read_index = get_next_index(read_index, MAX_SIZE);
+      read = get_next_index(read, MAX_SIZE);
 
       --current_size;
 
@@ -404,7 +411,7 @@ namespace etl
     //*************************************************************************
     reference front_implementation()
     {
-      return p_buffer[read_index];
+      return p_buffer[read];
     }
 
     //*************************************************************************
@@ -412,7 +419,7 @@ namespace etl
     //*************************************************************************
     const_reference front_implementation() const
     {
-      return p_buffer[read_index];
+      return p_buffer[read];
     }
 
     //*************************************************************************
@@ -426,9 +433,9 @@ namespace etl
         return false;
       }
 
-      p_buffer[read_index].~T();
+      p_buffer[read].~T();
 
-      read_index = get_next_index(read_index, MAX_SIZE);
+      read = get_next_index(read, MAX_SIZE);
 
       --current_size;
 
@@ -450,9 +457,10 @@ namespace etl
       return index;
     }
 
+    using indexes_t::write;   ///< Where to input new data.
+    using indexes_t::read;    ///< Where to get the oldest data.
+
     T* p_buffer;              ///< The internal buffer.
-    size_type write_index;    ///< Where to input new data.
-    size_type read_index;     ///< Where to get the oldest data.
     size_type current_size;   ///< The current size of the queue.
     const size_type MAX_SIZE; ///< The maximum number of items in the queue.
 
@@ -485,12 +493,12 @@ namespace etl
   /// This queue supports concurrent access by one producer and one consumer.
   /// \tparam T The type of value that the queue_spsc_isr holds.
   //***************************************************************************
-  template <typename T, typename TAccess, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
-  class iqueue_spsc_isr : public queue_spsc_isr_base<T, MEMORY_MODEL>
+  template <typename T, typename TAccess, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, typename TPolicy = etl::spsc_policy_compact>
+  class iqueue_spsc_isr : public queue_spsc_isr_base<T, MEMORY_MODEL, TPolicy>
   {
   private:
 
-    typedef queue_spsc_isr_base<T, MEMORY_MODEL> base_t;
+    typedef queue_spsc_isr_base<T, MEMORY_MODEL, TPolicy> base_t;
 
   public:
 
@@ -694,8 +702,8 @@ namespace etl
 
       if ETL_IF_CONSTEXPR(etl::is_trivially_destructible<T>::value)
       {
-        this->write_index  = 0;
-        this->read_index   = 0;
+        this->write  = 0;
+        this->read   = 0;
         this->current_size = 0;
       }
       else
@@ -797,13 +805,14 @@ namespace etl
   /// \tparam SIZE         The maximum capacity of the queue.
   /// \tparam TAccess      The type that will lock and unlock interrupts.
   /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  /// \tparam TPolicy      The index layout policy. etl::spsc_policy_compact (default) or etl::spsc_policy_cached.
   //***************************************************************************
-  template <typename T, size_t SIZE, typename TAccess, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
-  class queue_spsc_isr : public etl::iqueue_spsc_isr<T, TAccess, MEMORY_MODEL>
+  template <typename T, size_t SIZE, typename TAccess, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, typename TPolicy = etl::spsc_policy_compact>
+  class queue_spsc_isr : public etl::iqueue_spsc_isr<T, TAccess, MEMORY_MODEL, TPolicy>
   {
   private:
 
-    typedef etl::iqueue_spsc_isr<T, TAccess, MEMORY_MODEL> base_t;
+    typedef etl::iqueue_spsc_isr<T, TAccess, MEMORY_MODEL, TPolicy> base_t;
 
   public:
 
@@ -843,8 +852,8 @@ namespace etl
     typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type buffer[MAX_SIZE];
   };
 
-  template <typename T, size_t SIZE, typename TAccess, const size_t MEMORY_MODEL>
-  ETL_CONSTANT typename queue_spsc_isr<T, SIZE, TAccess, MEMORY_MODEL>::size_type queue_spsc_isr<T, SIZE, TAccess, MEMORY_MODEL>::MAX_SIZE;
+  template <typename T, size_t SIZE, typename TAccess, const size_t MEMORY_MODEL, typename TPolicy>
+  ETL_CONSTANT typename queue_spsc_isr<T, SIZE, TAccess, MEMORY_MODEL, TPolicy>::size_type queue_spsc_isr<T, SIZE, TAccess, MEMORY_MODEL, TPolicy>::MAX_SIZE;
 }
 
 #endif
@@ -0,0 +1,300 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_RADIX_SORT_INCLUDED
+#define ETL_RADIX_SORT_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "span.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+
+#include <stdint.h>
+#include <string.h>
+
+///\defgroup radix_sort radix_sort
+/// Least significant digit radix sort, using a caller supplied scratch buffer.
+///\ingroup algorithm
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup radix_sort
+  /// Exception base for radix_sort
+  //***************************************************************************
+  class radix_sort_exception : public etl::exception
+  {
+  public:
+
+    radix_sort_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup radix_sort
+  /// The scratch buffer is smaller than the range to sort.
+  //***************************************************************************
+  class radix_sort_buffer_too_small : public etl::radix_sort_exception
+  {
+  public:
+
+    radix_sort_buffer_too_small(string_type file_name_, numeric_type line_number_)
+      : radix_sort_exception(ETL_ERROR_TEXT("radix_sort:buffer too small", ETL_RADIX_SORT_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_radix_sort
+  {
+    //*************************************************************************
+    /// Converts a key to an unsigned integral with the same ordering.
+    //*************************************************************************
+    template <typename TKey, typename = void>
+    struct key_traits;
+
+    //*************************************************************************
+    /// Unsigned integral keys are used as they are.
+    //*************************************************************************
+    template <typename TKey>
+    struct key_traits<TKey, typename etl::enable_if<etl::is_integral<TKey>::value && etl::is_unsigned<TKey>::value>::type>
+    {
+      typedef TKey type;
+
+      static type to_unsigned(TKey key)
+      {
+        return key;
+      }
+    };
+
+    //*************************************************************************
+    /// Signed integral keys have the sign bit flipped, so that negative
+    /// values come first.
+    //*************************************************************************
+    template <typename TKey>
+    struct key_traits<TKey, typename etl::enable_if<etl::is_integral<TKey>::value && etl::is_signed<TKey>::value>::type>
+    {
+      typedef typename etl::make_unsigned<TKey>::type type;
+
+      static type to_unsigned(TKey key)
+      {
+        return static_cast<type>(static_cast<type>(key) ^ (type(1) << (etl::integral_limits<type>::bits - 1U)));
+      }
+    };
+
+    //*************************************************************************
+    /// Floating point keys are ordered by their bit pattern.
+    /// Negative values have all bits flipped, positive values have the sign
+    /// bit set. -0.0 is ordered before +0.0.
+    //*************************************************************************
+    template <typename TKey, typename TUnsigned>
+    struct floating_point_key_traits
+    {
+      ETL_STATIC_ASSERT(sizeof(TKey) == sizeof(TUnsigned), "Unsupported floating point type");
+
+      typedef TUnsigned type;
+
+      static type to_unsigned(TKey key)
+      {
+        type bits;
+        memcpy(&bits, &key, sizeof(bits));
+
+        const type sign = type(1) << (etl::integral_limits<type>::bits - 1U);
+
+        return ((bits & sign) != 0U) ? static_cast<type>(~bits) : static_cast<type>(bits | sign);
+      }
+    };
+
+    template <>
+    struct key_traits<float> : public floating_point_key_traits<float, uint32_t>
+    {
+    };
+
+#if ETL_USING_64BIT_TYPES
+    template <>
+    struct key_traits<double> : public floating_point_key_traits<double, uint64_t>
+    {
+    };
+#endif
+
+    //*************************************************************************
+    /// Returns the value as the key.
+    //*************************************************************************
+    template <typename T>
+    struct identity_key
+    {
+      const T& operator()(const T& value) const
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// Performs one counting sort pass on the digit at 'shift'.
+    /// Returns false, without moving anything, if the digit is the same for
+    /// every element.
+    //*************************************************************************
+    template <typename TKeyType, typename TSource, typename TDestination, typename TKey>
+    bool sort_pass(TSource source, TDestination destination, size_t n, size_t shift, TKey key)
+    {
+      typedef key_traits<TKeyType> traits;
+
+      static ETL_CONSTANT size_t Buckets = 256U;
+
+      size_t counts[Buckets];
+      etl::fill_n(counts, Buckets, size_t(0U));
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        ++counts[(traits::to_unsigned(key(source[i])) >> shift) & 0xFFU];
+      }
+
+      // All in one bucket?
+      if (counts[(traits::to_unsigned(key(source[0])) >> shift) & 0xFFU] == n)
+      {
+        return false;
+      }
+
+      // Convert the counts to offsets.
+      size_t offset = 0U;
+
+      for (size_t i = 0U; i < Buckets; ++i)
+      {
+        const size_t count = counts[i];
+        counts[i] = offset;
+        offset += count;
+      }
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        const size_t digit = (traits::to_unsigned(key(source[i])) >> shift) & 0xFFU;
+        destination[counts[digit]++] = ETL_MOVE(source[i]);
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Sorts [first, first + n) using the scratch buffer.
+    //*************************************************************************
+    template <typename TKeyType, typename TIterator, typename T, typename TKey>
+    void sort(TIterator first, size_t n, T* scratch, TKey key)
+    {
+      typedef typename key_traits<TKeyType>::type unsigned_type;
+
+      bool in_scratch = false;
+
+      for (size_t shift = 0U; shift < etl::integral_limits<unsigned_type>::bits; shift += 8U)
+      {
+        bool moved = in_scratch ? sort_pass<TKeyType>(scratch, first, n, shift, key)
+                                : sort_pass<TKeyType>(first, scratch, n, shift, key);
+
+        if (moved)
+        {
+          in_scratch = !in_scratch;
+        }
+      }
+
+      if (in_scratch)
+      {
+        etl::move(scratch, scratch + n, first);
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using a least significant digit radix sort.
+  /// Sorts unsigned, signed and floating point values in O(n) time.
+  /// Passes where every element has the same digit are skipped.
+  /// Stable.
+  ///\param first   The start of the range.
+  ///\param last    The end of the range.
+  ///\param scratch A buffer with space for at least last - first elements.
+  ///\ingroup radix_sort
+  //***************************************************************************
+  template <typename TIterator>
+  void radix_sort(TIterator first, TIterator last, etl::span<typename etl::iterator_traits<TIterator>::value_type> scratch)
+  {
+    typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+    ETL_STATIC_ASSERT(etl::is_random_access_iterator<TIterator>::value, "radix_sort requires random access iterators");
+
+    const size_t n = static_cast<size_t>(etl::distance(first, last));
+
+    ETL_ASSERT_OR_RETURN(scratch.size() >= n, ETL_ERROR(radix_sort_buffer_too_small));
+
+    if (n < 2U)
+    {
+      return;
+    }
+
+    private_radix_sort::sort<value_type>(first, n, scratch.data(), private_radix_sort::identity_key<value_type>());
+  }
+
+#if ETL_USING_CPP11
+  //***************************************************************************
+  /// Sorts the elements using a least significant digit radix sort.
+  /// The sort key is a projection of each element, such as a member.
+  /// Stable.
+  ///\param first   The start of the range.
+  ///\param last    The end of the range.
+  ///\param scratch A buffer with space for at least last - first elements.
+  ///\param key     Returns the unsigned, signed or floating point key for an element.
+  ///\ingroup radix_sort
+  //***************************************************************************
+  template <typename TIterator, typename TKey>
+  void radix_sort(TIterator first, TIterator last, etl::span<typename etl::iterator_traits<TIterator>::value_type> scratch, TKey key)
+  {
+    typedef typename etl::decay<decltype(key(*first))>::type key_type;
+
+    ETL_STATIC_ASSERT(etl::is_random_access_iterator<TIterator>::value, "radix_sort requires random access iterators");
+
+    const size_t n = static_cast<size_t>(etl::distance(first, last));
+
+    ETL_ASSERT_OR_RETURN(scratch.size() >= n, ETL_ERROR(radix_sort_buffer_too_small));
+
+    if (n < 2U)
+    {
+      return;
+    }
+
+    private_radix_sort::sort<key_type>(first, n, scratch.data(), key);
+  }
+#endif
+}
+
+#endif
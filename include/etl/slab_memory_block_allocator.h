@@ -0,0 +1,311 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SLAB_MEMORY_BLOCK_ALLOCATOR_INCLUDED
+#define ETL_SLAB_MEMORY_BLOCK_ALLOCATOR_INCLUDED
+
+#include "platform.h"
+#include "imemory_block_allocator.h"
+#include "memory.h"
+#include "bit.h"
+#include "log.h"
+#include "power.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  //*************************************************************************
+  /// A memory block allocator with several size classes.
+  /// The block sizes are powers of two, starting at VMin_Block_Size and
+  /// doubling for each of the VClasses classes. i.e. 32, 64, 128, 256, 512.
+  /// Each class has VBlocks_Per_Class blocks.
+  ///
+  /// A request is mapped to the smallest class that fits it with a bit
+  /// width calculation, rather than by searching a chain of successors.
+  /// If that class is exhausted, the next larger class is used.
+  /// The class of a released block is calculated from its address.
+  ///
+  /// The number of blocks allocated from each class, and the highest number
+  /// ever allocated, are recorded, to help size the classes.
+  //*************************************************************************
+  template <size_t VMin_Block_Size, size_t VClasses, size_t VBlocks_Per_Class, size_t VAlignment>
+  class slab_memory_block_allocator : public imemory_block_allocator
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VClasses > 0U, "There must be at least one size class");
+    ETL_STATIC_ASSERT(VBlocks_Per_Class > 0U, "There must be at least one block per class");
+    ETL_STATIC_ASSERT(etl::is_power_of_2<VMin_Block_Size>::value, "The minimum block size must be a power of 2");
+    ETL_STATIC_ASSERT(VMin_Block_Size >= sizeof(void*), "The minimum block size must be able to hold a pointer");
+    ETL_STATIC_ASSERT((VMin_Block_Size % VAlignment) == 0U, "The minimum block size must be a multiple of the alignment");
+
+    static ETL_CONSTANT size_t Min_Block_Size   = VMin_Block_Size;
+    static ETL_CONSTANT size_t Max_Block_Size   = VMin_Block_Size << (VClasses - 1U);
+    static ETL_CONSTANT size_t Classes          = VClasses;
+    static ETL_CONSTANT size_t Blocks_Per_Class = VBlocks_Per_Class;
+    static ETL_CONSTANT size_t Alignment        = VAlignment;
+
+    //*************************************************************************
+    /// Default constructor
+    //*************************************************************************
+    slab_memory_block_allocator()
+    {
+      for (size_t i = 0U; i < VClasses; ++i)
+      {
+        slabs[i].p_free          = ETL_NULLPTR;
+        slabs[i].initialised     = 0U;
+        slabs[i].allocated       = 0U;
+        slabs[i].high_water_mark = 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// The size of the blocks in a class.
+    //*************************************************************************
+    static size_t block_size(size_t size_class)
+    {
+      return Min_Block_Size << size_class;
+    }
+
+    //*************************************************************************
+    /// The smallest class with blocks of at least 'size' bytes.
+    /// Returns Classes if the size is larger than Max_Block_Size.
+    //*************************************************************************
+    static size_t size_class(size_t size)
+    {
+      if (size <= Min_Block_Size)
+      {
+        return 0U;
+      }
+      else if (size > Max_Block_Size)
+      {
+        return Classes;
+      }
+      else
+      {
+        return static_cast<size_t>(etl::bit_width((size - 1U) >> Log2_Min_Block_Size));
+      }
+    }
+
+    //*************************************************************************
+    /// The number of blocks currently allocated from a class.
+    //*************************************************************************
+    size_t allocated(size_t size_class) const
+    {
+      return slabs[size_class].allocated;
+    }
+
+    //*************************************************************************
+    /// The number of blocks still free in a class.
+    //*************************************************************************
+    size_t available(size_t size_class) const
+    {
+      return Blocks_Per_Class - slabs[size_class].allocated;
+    }
+
+    //*************************************************************************
+    /// The highest number of blocks allocated from a class at any one time.
+    //*************************************************************************
+    size_t high_water_mark(size_t size_class) const
+    {
+      return slabs[size_class].high_water_mark;
+    }
+
+    //*************************************************************************
+    /// Sets the high water marks to the number of blocks currently allocated.
+    //*************************************************************************
+    void reset_high_water_marks()
+    {
+      for (size_t i = 0U; i < VClasses; ++i)
+      {
+        slabs[i].high_water_mark = slabs[i].allocated;
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The overridden virtual function to allocate a block.
+    //*************************************************************************
+    virtual void* allocate_block(size_t required_size, size_t required_alignment) ETL_OVERRIDE
+    {
+      if (required_alignment > Alignment)
+      {
+        return ETL_NULLPTR;
+      }
+
+      // Use the first class, from the best fit upwards, that has a free block.
+      for (size_t i = size_class(required_size); i < VClasses; ++i)
+      {
+        if (slabs[i].allocated < Blocks_Per_Class)
+        {
+          return allocate_from(i);
+        }
+      }
+
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to release a block.
+    //*************************************************************************
+    virtual bool release_block(const void* const pblock) ETL_OVERRIDE
+    {
+      if (!is_owner_of_block(pblock))
+      {
+        return false;
+      }
+
+      const size_t offset = static_cast<size_t>(static_cast<const char*>(pblock) - begin());
+
+      // Class 'n' starts at (2^n - 1) units from the start of the buffer and is 2^n units long.
+      const size_t unit = offset / Unit_Size;
+      const size_t i    = static_cast<size_t>(etl::bit_width(unit + 1U)) - 1U;
+
+      slab& s = slabs[i];
+
+      char* p = const_cast<char*>(static_cast<const char*>(pblock));
+
+      *reinterpret_cast<char**>(p) = s.p_free;
+      s.p_free = p;
+      --s.allocated;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Returns true if the allocator is the owner of the block.
+    //*************************************************************************
+    virtual bool is_owner_of_block(const void* const pblock) const ETL_OVERRIDE
+    {
+      const char* p = static_cast<const char*>(pblock);
+
+      return (p >= begin()) && (p < (begin() + Buffer_Size));
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Log2_Min_Block_Size = etl::log2<VMin_Block_Size>::value;
+
+    /// Class 'n' occupies 2^n units of the buffer.
+    static ETL_CONSTANT size_t Unit_Size   = VMin_Block_Size * VBlocks_Per_Class;
+    static ETL_CONSTANT size_t Buffer_Size = Unit_Size * ((size_t(1U) << VClasses) - 1U);
+
+    //*************************************************************************
+    /// The state of one size class.
+    //*************************************************************************
+    struct slab
+    {
+      char*  p_free;          ///< The first free block, or null.
+      size_t initialised;     ///< The number of blocks that have ever been allocated.
+      size_t allocated;       ///< The number of blocks currently allocated.
+      size_t high_water_mark; ///< The highest value of 'allocated'.
+    };
+
+    //*************************************************************************
+    /// Allocates a block from a class that is known to have a free one.
+    /// Blocks that have never been used are taken in address order, so the
+    /// free list does not have to be built up front.
+    //*************************************************************************
+    void* allocate_from(size_t i)
+    {
+      slab& s = slabs[i];
+
+      char* p;
+
+      if (s.p_free != ETL_NULLPTR)
+      {
+        p = s.p_free;
+        s.p_free = *reinterpret_cast<char**>(p);
+      }
+      else
+      {
+        p = begin() + (Unit_Size * ((size_t(1U) << i) - 1U)) + (s.initialised * block_size(i));
+        ++s.initialised;
+      }
+
+      ++s.allocated;
+
+      if (s.allocated > s.high_water_mark)
+      {
+        s.high_water_mark = s.allocated;
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    char* begin()
+    {
+      return buffer.raw;
+    }
+
+    //*************************************************************************
+    const char* begin() const
+    {
+      return buffer.raw;
+    }
+
+    /// The state of each size class.
+    slab slabs[VClasses];
+
+    /// The blocks of every class, smallest first.
+    etl::uninitialized_buffer<Buffer_Size, 1U, VAlignment> buffer;
+  };
+
+  template <size_t VMin_Block_Size, size_t VClasses, size_t VBlocks_Per_Class, size_t VAlignment>
+  ETL_CONSTANT size_t slab_memory_block_allocator<VMin_Block_Size, VClasses, VBlocks_Per_Class, VAlignment>::Min_Block_Size;
+
+  template <size_t VMin_Block_Size, size_t VClasses, size_t VBlocks_Per_Class, size_t VAlignment>
+  ETL_CONSTANT size_t slab_memory_block_allocator<VMin_Block_Size, VClasses, VBlocks_Per_Class, VAlignment>::Max_Block_Size;
+
+  template <size_t VMin_Block_Size, size_t VClasses, size_t VBlocks_Per_Class, size_t VAlignment>
+  ETL_CONSTANT size_t slab_memory_block_allocator<VMin_Block_Size, VClasses, VBlocks_Per_Class, VAlignment>::Classes;
+
+  template <size_t VMin_Block_Size, size_t VClasses, size_t VBlocks_Per_Class, size_t VAlignment>
+  ETL_CONSTANT size_t slab_memory_block_allocator<VMin_Block_Size, VClasses, VBlocks_Per_Class, VAlignment>::Blocks_Per_Class;
+
+  template <size_t VMin_Block_Size, size_t VClasses, size_t VBlocks_Per_Class, size_t VAlignment>
+  ETL_CONSTANT size_t slab_memory_block_allocator<VMin_Block_Size, VClasses, VBlocks_Per_Class, VAlignment>::Alignment;
+
+  template <size_t VMin_Block_Size, size_t VClasses, size_t VBlocks_Per_Class, size_t VAlignment>
+  ETL_CONSTANT size_t slab_memory_block_allocator<VMin_Block_Size, VClasses, VBlocks_Per_Class, VAlignment>::Log2_Min_Block_Size;
+
+  template <size_t VMin_Block_Size, size_t VClasses, size_t VBlocks_Per_Class, size_t VAlignment>
+  ETL_CONSTANT size_t slab_memory_block_allocator<VMin_Block_Size, VClasses, VBlocks_Per_Class, VAlignment>::Unit_Size;
+
+  template <size_t VMin_Block_Size, size_t VClasses, size_t VBlocks_Per_Class, size_t VAlignment>
+  ETL_CONSTANT size_t slab_memory_block_allocator<VMin_Block_Size, VClasses, VBlocks_Per_Class, VAlignment>::Buffer_Size;
+}
+
+#endif
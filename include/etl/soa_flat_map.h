@@ -0,0 +1,1420 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SOA_FLAT_MAP_INCLUDED
+#define ETL_SOA_FLAT_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "memory.h"
+#include "type_traits.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "placement_new.h"
+#include "initializer_list.h"
+
+#include "private/soa_flat_search.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup soa_flat_map soa_flat_map
+/// A sorted map with the capacity defined at compile time, that holds the
+/// keys in one contiguous array and the mapped values in a parallel array.
+/// Lookups only touch the key array, using a branchless binary search or,
+/// optionally, an Eytzinger ordered copy of the keys.
+/// As with std::flat_map, the iterators dereference to a pair of references.
+/// Has insertion of O(N) and find of O(logN).
+/// Duplicate entries are not allowed.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the soa_flat_map.
+  ///\ingroup soa_flat_map
+  //***************************************************************************
+  class soa_flat_map_exception : public etl::exception
+  {
+  public:
+
+    soa_flat_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the soa_flat_map.
+  ///\ingroup soa_flat_map
+  //***************************************************************************
+  class soa_flat_map_full : public etl::soa_flat_map_exception
+  {
+  public:
+
+    soa_flat_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::soa_flat_map_exception(ETL_ERROR_TEXT("soa_flat_map:full", ETL_SOA_FLAT_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the soa_flat_map.
+  ///\ingroup soa_flat_map
+  //***************************************************************************
+  class soa_flat_map_out_of_range : public etl::soa_flat_map_exception
+  {
+  public:
+
+    soa_flat_map_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::soa_flat_map_exception(ETL_ERROR_TEXT("soa_flat_map:range", ETL_SOA_FLAT_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+#if ETL_USING_CPP11 == 0
+  namespace private_soa_flat
+  {
+    //*************************************************************************
+    /// A pair of references.
+    /// Stands in for pair<const TKey&, TMapped&>, which cannot be formed before C++11.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    struct reference_pair
+    {
+      reference_pair(T1& first_, T2& second_)
+        : first(first_)
+        , second(second_)
+      {
+      }
+
+      T1& first;
+      T2& second;
+    };
+  }
+#endif
+
+  //***************************************************************************
+  /// The base class for specifically sized soa_flat_maps.
+  /// Can be used as a reference type for all soa_flat_maps containing a specific type.
+  ///\ingroup soa_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey>, typename TSearch = etl::soa_flat_search::binary>
+  class isoa_flat_map
+  {
+  public:
+
+    typedef ETL_OR_STD::pair<TKey, TMapped>                     value_type;
+    typedef TKey                                                key_type;
+    typedef TMapped                                             mapped_type;
+    typedef TKeyCompare                                         key_compare;
+    typedef TSearch                                             search_type;
+#if ETL_USING_CPP11
+    typedef ETL_OR_STD::pair<const TKey&, TMapped&>             reference;
+    typedef ETL_OR_STD::pair<const TKey&, const TMapped&>       const_reference;
+#else
+    typedef private_soa_flat::reference_pair<const TKey, TMapped>       reference;
+    typedef private_soa_flat::reference_pair<const TKey, const TMapped> const_reference;
+#endif
+    typedef size_t                                              size_type;
+    typedef ptrdiff_t                                           difference_type;
+
+    typedef const key_type&    const_key_reference;
+    typedef mapped_type&       mapped_reference;
+    typedef const mapped_type& const_mapped_reference;
+
+    //*************************************************************************
+    /// Allows operator -> on an iterator that dereferences to a pair of references.
+    //*************************************************************************
+    template <typename TReference>
+    class arrow_proxy
+    {
+    public:
+
+      explicit arrow_proxy(const TReference& reference_)
+        : value(reference_)
+      {
+      }
+
+      const TReference* operator ->() const
+      {
+        return &value;
+      }
+
+    private:
+
+      TReference value;
+    };
+
+    typedef arrow_proxy<reference>       pointer;
+    typedef arrow_proxy<const_reference> const_pointer;
+
+    class const_iterator;
+
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, value_type, difference_type, pointer, reference>
+    {
+    public:
+
+      friend class isoa_flat_map;
+      friend class const_iterator;
+
+      iterator()
+        : p_key(ETL_NULLPTR)
+        , p_mapped(ETL_NULLPTR)
+      {
+      }
+
+      reference operator *() const
+      {
+        return reference(*p_key, *p_mapped);
+      }
+
+      pointer operator ->() const
+      {
+        return pointer(**this);
+      }
+
+      reference operator [](difference_type n) const
+      {
+        return reference(p_key[n], p_mapped[n]);
+      }
+
+      const key_type& key() const
+      {
+        return *p_key;
+      }
+
+      mapped_type& mapped() const
+      {
+        return *p_mapped;
+      }
+
+      iterator& operator ++()
+      {
+        ++p_key;
+        ++p_mapped;
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        --p_key;
+        --p_mapped;
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      iterator& operator +=(difference_type n)
+      {
+        p_key    += n;
+        p_mapped += n;
+        return *this;
+      }
+
+      iterator& operator -=(difference_type n)
+      {
+        p_key    -= n;
+        p_mapped -= n;
+        return *this;
+      }
+
+      friend iterator operator +(iterator lhs, difference_type n)
+      {
+        return lhs += n;
+      }
+
+      friend iterator operator +(difference_type n, iterator rhs)
+      {
+        return rhs += n;
+      }
+
+      friend iterator operator -(iterator lhs, difference_type n)
+      {
+        return lhs -= n;
+      }
+
+      friend difference_type operator -(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.p_key - rhs.p_key;
+      }
+
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.p_key == rhs.p_key;
+      }
+
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      friend bool operator <(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.p_key < rhs.p_key;
+      }
+
+      friend bool operator >(const iterator& lhs, const iterator& rhs)
+      {
+        return rhs < lhs;
+      }
+
+      friend bool operator <=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(rhs < lhs);
+      }
+
+      friend bool operator >=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs < rhs);
+      }
+
+    private:
+
+      iterator(key_type* p_key_, mapped_type* p_mapped_)
+        : p_key(p_key_)
+        , p_mapped(p_mapped_)
+      {
+      }
+
+      key_type*    p_key;
+      mapped_type* p_mapped;
+    };
+
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, const value_type, difference_type, const_pointer, const_reference>
+    {
+    public:
+
+      friend class isoa_flat_map;
+
+      const_iterator()
+        : p_key(ETL_NULLPTR)
+        , p_mapped(ETL_NULLPTR)
+      {
+      }
+
+      const_iterator(const typename isoa_flat_map::iterator& other)
+        : p_key(other.p_key)
+        , p_mapped(other.p_mapped)
+      {
+      }
+
+      const_reference operator *() const
+      {
+        return const_reference(*p_key, *p_mapped);
+      }
+
+      const_pointer operator ->() const
+      {
+        return const_pointer(**this);
+      }
+
+      const_reference operator [](difference_type n) const
+      {
+        return const_reference(p_key[n], p_mapped[n]);
+      }
+
+      const key_type& key() const
+      {
+        return *p_key;
+      }
+
+      const mapped_type& mapped() const
+      {
+        return *p_mapped;
+      }
+
+      const_iterator& operator ++()
+      {
+        ++p_key;
+        ++p_mapped;
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        --p_key;
+        --p_mapped;
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      const_iterator& operator +=(difference_type n)
+      {
+        p_key    += n;
+        p_mapped += n;
+        return *this;
+      }
+
+      const_iterator& operator -=(difference_type n)
+      {
+        p_key    -= n;
+        p_mapped -= n;
+        return *this;
+      }
+
+      friend const_iterator operator +(const_iterator lhs, difference_type n)
+      {
+        return lhs += n;
+      }
+
+      friend const_iterator operator +(difference_type n, const_iterator rhs)
+      {
+        return rhs += n;
+      }
+
+      friend const_iterator operator -(const_iterator lhs, difference_type n)
+      {
+        return lhs -= n;
+      }
+
+      friend difference_type operator -(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.p_key - rhs.p_key;
+      }
+
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.p_key == rhs.p_key;
+      }
+
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      friend bool operator <(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.p_key < rhs.p_key;
+      }
+
+      friend bool operator >(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return rhs < lhs;
+      }
+
+      friend bool operator <=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(rhs < lhs);
+      }
+
+      friend bool operator >=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs < rhs);
+      }
+
+    private:
+
+      const_iterator(const key_type* p_key_, const mapped_type* p_mapped_)
+        : p_key(p_key_)
+        , p_mapped(p_mapped_)
+      {
+      }
+
+      const key_type*    p_key;
+      const mapped_type* p_mapped;
+    };
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the soa_flat_map.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(p_keys, p_mapped);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the beginning of the soa_flat_map.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(p_keys, p_mapped);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the soa_flat_map.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(p_keys + current_size, p_mapped + current_size);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the soa_flat_map.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(p_keys + current_size, p_mapped + current_size);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the beginning of the soa_flat_map.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the soa_flat_map.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*************************************************************************
+    /// Returns a reverse_iterator to the reverse beginning of the soa_flat_map.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the reverse beginning of the soa_flat_map.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse_iterator to the end + 1 of the soa_flat_map.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the end + 1 of the soa_flat_map.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the reverse beginning of the soa_flat_map.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the end + 1 of the soa_flat_map.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a pointer to the contiguous, sorted, array of keys.
+    //*************************************************************************
+    const key_type* keys() const
+    {
+      return p_keys;
+    }
+
+    //*************************************************************************
+    /// Returns a pointer to the array of mapped values, in key order.
+    //*************************************************************************
+    mapped_type* values()
+    {
+      return p_mapped;
+    }
+
+    //*************************************************************************
+    /// Returns a const pointer to the array of mapped values, in key order.
+    //*************************************************************************
+    const mapped_type* values() const
+    {
+      return p_mapped;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'.
+    /// Inserts a default constructed value if the key does not exist.
+    /// If asserts or exceptions are enabled, emits soa_flat_map_full if a new key is added to a full map.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator [](const_key_reference key)
+    {
+      size_t index = lower_bound_index(key);
+
+      if (!is_match(index, key))
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(soa_flat_map_full));
+
+        make_space(index);
+        ::new (p_keys + index) key_type(key);
+        ::new (p_mapped + index) mapped_type();
+        update_search();
+      }
+
+      return p_mapped[index];
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'.
+    /// If asserts or exceptions are enabled, emits soa_flat_map_out_of_range if the key is not in the map.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference at(const_key_reference key)
+    {
+      const size_t index = find_index(key);
+
+      ETL_ASSERT(index != current_size, ETL_ERROR(soa_flat_map_out_of_range));
+
+      return p_mapped[index];
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'.
+    /// If asserts or exceptions are enabled, emits soa_flat_map_out_of_range if the key is not in the map.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const_mapped_reference at(const_key_reference key) const
+    {
+      const size_t index = find_index(key);
+
+      ETL_ASSERT(index != current_size, ETL_ERROR(soa_flat_map_out_of_range));
+
+      return p_mapped[index];
+    }
+
+    //*********************************************************************
+    /// Assigns values to the soa_flat_map.
+    /// If asserts or exceptions are enabled, emits soa_flat_map_full if the soa_flat_map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+      insert(first, last);
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the soa_flat_map.
+    /// If asserts or exceptions are enabled, emits soa_flat_map_full if the soa_flat_map is already full.
+    ///\param value The value to insert.
+    ///\return A pair of an iterator to the element with the key and 'true' if it was inserted.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const value_type& value)
+    {
+      const size_t index    = lower_bound_index(value.first);
+      const bool   inserted = !is_match(index, value.first);
+
+      if (inserted)
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(soa_flat_map_full));
+
+        make_space(index);
+        ::new (p_keys + index) key_type(value.first);
+        ::new (p_mapped + index) mapped_type(value.second);
+        update_search();
+      }
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator_at(index), inserted);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the soa_flat_map.
+    /// If asserts or exceptions are enabled, emits soa_flat_map_full if the soa_flat_map is already full.
+    ///\param value The value to insert.
+    ///\return A pair of an iterator to the element with the key and 'true' if it was inserted.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(value_type&& value)
+    {
+      const size_t index    = lower_bound_index(value.first);
+      const bool   inserted = !is_match(index, value.first);
+
+      if (inserted)
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(soa_flat_map_full));
+
+        make_space(index);
+        ::new (p_keys + index) key_type(etl::move(value.first));
+        ::new (p_mapped + index) mapped_type(etl::move(value.second));
+        update_search();
+      }
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator_at(index), inserted);
+    }
+
+    //*********************************************************************
+    /// Inserts a value constructed from the arguments, if the key does not exist.
+    /// If asserts or exceptions are enabled, emits soa_flat_map_full if the soa_flat_map is already full.
+    ///\param key  The key.
+    ///\param args The constructor arguments for the mapped value.
+    ///\return A pair of an iterator to the element with the key and 'true' if it was inserted.
+    //*********************************************************************
+    template <typename... TArgs>
+    ETL_OR_STD::pair<iterator, bool> try_emplace(const_key_reference key, TArgs&&... args)
+    {
+      const size_t index    = lower_bound_index(key);
+      const bool   inserted = !is_match(index, key);
+
+      if (inserted)
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(soa_flat_map_full));
+
+        make_space(index);
+        ::new (p_keys + index) key_type(key);
+        ::new (p_mapped + index) mapped_type(etl::forward<TArgs>(args)...);
+        update_search();
+      }
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator_at(index), inserted);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the soa_flat_map.
+    /// If asserts or exceptions are enabled, emits soa_flat_map_full if the soa_flat_map does not have enough free space.
+    /// The search structure is rebuilt once, at the end.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        const size_t index = private_soa_flat::lower_bound(p_keys, current_size, first->first, compare);
+
+        if (!((index < current_size) && !compare(first->first, p_keys[index])))
+        {
+          if (full())
+          {
+            update_search();
+            ETL_ASSERT_FAIL(ETL_ERROR(soa_flat_map_full));
+            return;
+          }
+
+          make_space(index);
+          ::new (p_keys + index) key_type(first->first);
+          ::new (p_mapped + index) mapped_type(first->second);
+        }
+
+        ++first;
+      }
+
+      update_search();
+    }
+
+    //*********************************************************************
+    /// Inserts a value, or assigns to it if the key already exists.
+    /// If asserts or exceptions are enabled, emits soa_flat_map_full if a new key is added to a full map.
+    ///\param key   The key.
+    ///\param value The mapped value.
+    ///\return A pair of an iterator to the element with the key and 'true' if it was inserted.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert_or_assign(const_key_reference key, const_mapped_reference value)
+    {
+      const size_t index = lower_bound_index(key);
+
+      if (is_match(index, key))
+      {
+        p_mapped[index] = value;
+
+        return ETL_OR_STD::pair<iterator, bool>(iterator_at(index), false);
+      }
+
+      return insert(value_type(key, value));
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(const_key_reference key)
+    {
+      const size_t index = find_index(key);
+
+      if (index == current_size)
+      {
+        return 0U;
+      }
+
+      erase_range(index, index + 1U);
+
+      return 1U;
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    ///\return An iterator to the element after the one erased.
+    //*********************************************************************
+    iterator erase(const_iterator i_element)
+    {
+      const size_t index = index_of(i_element);
+
+      erase_range(index, index + 1U);
+
+      return iterator_at(index);
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element + 1.
+    ///\return An iterator to the element after the last one erased.
+    //*********************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      const size_t index = index_of(first);
+
+      erase_range(index, index_of(last));
+
+      return iterator_at(index);
+    }
+
+    //*************************************************************************
+    /// Clears the soa_flat_map.
+    //*************************************************************************
+    void clear()
+    {
+      erase_range(0U, current_size);
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    iterator find(const_key_reference key)
+    {
+      return iterator_at(find_index(key));
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return A const_iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(const_key_reference key) const
+    {
+      return const_iterator_at(find_index(key));
+    }
+
+    //*********************************************************************
+    /// Checks if the soa_flat_map contains an element with key.
+    //*********************************************************************
+    bool contains(const_key_reference key) const
+    {
+      return find_index(key) != current_size;
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(const_key_reference key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator lower_bound(const_key_reference key)
+    {
+      return iterator_at(lower_bound_index(key));
+    }
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return A const_iterator.
+    //*********************************************************************
+    const_iterator lower_bound(const_key_reference key) const
+    {
+      return const_iterator_at(lower_bound_index(key));
+    }
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator upper_bound(const_key_reference key)
+    {
+      return iterator_at(upper_bound_index(key));
+    }
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return A const_iterator.
+    //*********************************************************************
+    const_iterator upper_bound(const_key_reference key) const
+    {
+      return const_iterator_at(upper_bound_index(key));
+    }
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const_key_reference key)
+    {
+      const size_t index = lower_bound_index(key);
+      const size_t last  = is_match(index, key) ? index + 1U : index;
+
+      return ETL_OR_STD::pair<iterator, iterator>(iterator_at(index), iterator_at(last));
+    }
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return A const_iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+    {
+      const size_t index = lower_bound_index(key);
+      const size_t last  = is_match(index, key) ? index + 1U : index;
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(const_iterator_at(index), const_iterator_at(last));
+    }
+
+    //*************************************************************************
+    /// Gets the size of the soa_flat_map.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the soa_flat_map.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the soa_flat_map.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == capacity_;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the soa_flat_map.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return capacity_;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the soa_flat_map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return capacity_;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return capacity_ - current_size;
+    }
+
+    //*************************************************************************
+    /// How to compare two keys.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return compare;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    isoa_flat_map& operator = (const isoa_flat_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    isoa_flat_map(key_type* p_keys_,
+                  mapped_type* p_mapped_,
+                  key_type* p_eytzinger_keys_,
+                  private_soa_flat::eytzinger_index_type* p_eytzinger_index_,
+                  size_type capacity__)
+      : p_keys(p_keys_)
+      , p_mapped(p_mapped_)
+      , p_eytzinger_keys(p_eytzinger_keys_)
+      , p_eytzinger_index(p_eytzinger_index_)
+      , current_size(0U)
+      , eytzinger_size(0U)
+      , capacity_(capacity__)
+      , compare()
+    {
+    }
+
+    //*********************************************************************
+    /// Moves the elements from another soa_flat_map.
+    //*********************************************************************
+    void move_container(isoa_flat_map& other)
+    {
+      clear();
+
+      for (size_t i = 0U; i < other.current_size; ++i)
+      {
+        ::new (p_keys + i) key_type(ETL_MOVE(other.p_keys[i]));
+        ::new (p_mapped + i) mapped_type(ETL_MOVE(other.p_mapped[i]));
+      }
+
+      current_size = other.current_size;
+      update_search();
+
+      other.clear();
+    }
+
+  private:
+
+    //*********************************************************************
+    /// Is the key at the index equal to 'key'?
+    //*********************************************************************
+    bool is_match(size_t index, const_key_reference key) const
+    {
+      return (index < current_size) && !compare(key, p_keys[index]);
+    }
+
+    //*********************************************************************
+    iterator iterator_at(size_t index)
+    {
+      return iterator(p_keys + index, p_mapped + index);
+    }
+
+    //*********************************************************************
+    const_iterator const_iterator_at(size_t index) const
+    {
+      return const_iterator(p_keys + index, p_mapped + index);
+    }
+
+    //*********************************************************************
+    size_t index_of(const_iterator itr) const
+    {
+      return size_t(itr.p_key - p_keys);
+    }
+
+#include "private/diagnostic_uninitialized_push.h"
+    //*********************************************************************
+    /// The index of the first key not less than 'key'.
+    //*********************************************************************
+    size_t lower_bound_index(const_key_reference key) const
+    {
+      return lower_bound_index(key, search_type());
+    }
+
+    //*********************************************************************
+    size_t lower_bound_index(const_key_reference key, etl::soa_flat_search::binary) const
+    {
+      return private_soa_flat::lower_bound(p_keys, current_size, key, compare);
+    }
+
+    //*********************************************************************
+    size_t lower_bound_index(const_key_reference key, etl::soa_flat_search::eytzinger) const
+    {
+      const size_t k = private_soa_flat::eytzinger_lower_bound(p_eytzinger_keys, current_size, key, compare);
+
+      return (k == 0U) ? current_size : size_t(p_eytzinger_index[k]);
+    }
+
+    //*********************************************************************
+    /// The index of the first key greater than 'key'.
+    //*********************************************************************
+    size_t upper_bound_index(const_key_reference key) const
+    {
+      const size_t index = lower_bound_index(key);
+
+      return is_match(index, key) ? index + 1U : index;
+    }
+
+    //*********************************************************************
+    /// The index of the key, or size() if it is not in the map.
+    //*********************************************************************
+    size_t find_index(const_key_reference key) const
+    {
+      return find_index(key, search_type());
+    }
+
+    //*********************************************************************
+    size_t find_index(const_key_reference key, etl::soa_flat_search::binary) const
+    {
+      const size_t index = lower_bound_index(key);
+
+      return is_match(index, key) ? index : current_size;
+    }
+
+    //*********************************************************************
+    size_t find_index(const_key_reference key, etl::soa_flat_search::eytzinger) const
+    {
+      // Compare against the Eytzinger copy, which has just been read.
+      const size_t k = private_soa_flat::eytzinger_lower_bound(p_eytzinger_keys, current_size, key, compare);
+
+      return ((k != 0U) && !compare(key, p_eytzinger_keys[k])) ? size_t(p_eytzinger_index[k]) : current_size;
+    }
+
+#include "private/diagnostic_pop.h"
+
+    //*********************************************************************
+    /// Opens a gap at 'index' by moving the following elements up by one.
+    /// The gap is left unconstructed.
+    //*********************************************************************
+    void make_space(size_t index)
+    {
+      if (index < current_size)
+      {
+        const size_t last = current_size - 1U;
+
+        ::new (p_keys + current_size) key_type(ETL_MOVE(p_keys[last]));
+        ::new (p_mapped + current_size) mapped_type(ETL_MOVE(p_mapped[last]));
+
+        etl::move_backward(p_keys + index, p_keys + last, p_keys + current_size);
+        etl::move_backward(p_mapped + index, p_mapped + last, p_mapped + current_size);
+
+        p_keys[index].~key_type();
+        p_mapped[index].~mapped_type();
+      }
+
+      ++current_size;
+    }
+
+    //*********************************************************************
+    /// Erases the elements in [first, last).
+    //*********************************************************************
+    void erase_range(size_t first, size_t last)
+    {
+      if (first == last)
+      {
+        return;
+      }
+
+      etl::move(p_keys + last, p_keys + current_size, p_keys + first);
+      etl::move(p_mapped + last, p_mapped + current_size, p_mapped + first);
+
+      const size_t new_size = current_size - (last - first);
+
+      for (size_t i = new_size; i < current_size; ++i)
+      {
+        p_keys[i].~key_type();
+        p_mapped[i].~mapped_type();
+      }
+
+      current_size = new_size;
+      update_search();
+    }
+
+    //*********************************************************************
+    /// Rebuilds the search structure after a modification.
+    //*********************************************************************
+    void update_search()
+    {
+      update_search(search_type());
+    }
+
+    //*********************************************************************
+    void update_search(etl::soa_flat_search::binary)
+    {
+    }
+
+    //*********************************************************************
+    void update_search(etl::soa_flat_search::eytzinger)
+    {
+      for (size_t k = 1U; k <= eytzinger_size; ++k)
+      {
+        p_eytzinger_keys[k].~key_type();
+      }
+
+      size_t k = private_soa_flat::eytzinger_first(current_size);
+
+      for (size_t i = 0U; i < current_size; ++i)
+      {
+        ::new (p_eytzinger_keys + k) key_type(p_keys[i]);
+        p_eytzinger_index[k] = private_soa_flat::eytzinger_index_type(i);
+
+        k = private_soa_flat::eytzinger_next(k, current_size);
+      }
+
+      eytzinger_size = current_size;
+    }
+
+    // Disable copy construction.
+    isoa_flat_map(const isoa_flat_map&);
+
+    key_type*                               p_keys;
+    mapped_type*                            p_mapped;
+    key_type*                               p_eytzinger_keys;  ///< Numbered from 1. Unused for binary search.
+    private_soa_flat::eytzinger_index_type* p_eytzinger_index; ///< Numbered from 1. Unused for binary search.
+    size_type                               current_size;
+    size_type                               eytzinger_size;
+    const size_type                         capacity_;
+    key_compare                             compare;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_SOA_FLAT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~isoa_flat_map()
+    {
+    }
+#else
+  protected:
+    ~isoa_flat_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first soa_flat_map.
+  ///\param rhs Reference to the second soa_flat_map.
+  ///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+  ///\ingroup soa_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare, typename TSearch>
+  bool operator ==(const etl::isoa_flat_map<TKey, TMapped, TKeyCompare, TSearch>& lhs,
+                   const etl::isoa_flat_map<TKey, TMapped, TKeyCompare, TSearch>& rhs)
+  {
+    return (lhs.size() == rhs.size()) &&
+           etl::equal(lhs.keys(), lhs.keys() + lhs.size(), rhs.keys()) &&
+           etl::equal(lhs.values(), lhs.values() + lhs.size(), rhs.values());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first soa_flat_map.
+  ///\param rhs Reference to the second soa_flat_map.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup soa_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare, typename TSearch>
+  bool operator !=(const etl::isoa_flat_map<TKey, TMapped, TKeyCompare, TSearch>& lhs,
+                   const etl::isoa_flat_map<TKey, TMapped, TKeyCompare, TSearch>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// A soa_flat_map implementation that uses a fixed size buffer.
+  ///\tparam TKey     The key type.
+  ///\tparam TValue   The value type.
+  ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
+  ///\tparam TCompare The type to compare keys. Default = etl::less<TKey>
+  ///\tparam TSearch  etl::soa_flat_search::binary (default) or etl::soa_flat_search::eytzinger
+  ///\ingroup soa_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare = etl::less<TKey>, typename TSearch = etl::soa_flat_search::binary>
+  class soa_flat_map : public etl::isoa_flat_map<TKey, TValue, TCompare, TSearch>
+  {
+  private:
+
+    typedef etl::isoa_flat_map<TKey, TValue, TCompare, TSearch> base;
+
+  public:
+
+    ETL_STATIC_ASSERT(MAX_SIZE_ < 0xFFFFFFFFUL, "Capacity too large for the Eytzinger index");
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    soa_flat_map()
+      : base(key_buffer.begin(), mapped_buffer.begin(), eytzinger.keys(), eytzinger.index(), MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    soa_flat_map(const soa_flat_map& other)
+      : base(key_buffer.begin(), mapped_buffer.begin(), eytzinger.keys(), eytzinger.index(), MAX_SIZE)
+    {
+      this->assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    soa_flat_map(soa_flat_map&& other)
+      : base(key_buffer.begin(), mapped_buffer.begin(), eytzinger.keys(), eytzinger.index(), MAX_SIZE)
+    {
+      this->move_container(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    soa_flat_map(TIterator first, TIterator last)
+      : base(key_buffer.begin(), mapped_buffer.begin(), eytzinger.keys(), eytzinger.index(), MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    soa_flat_map(std::initializer_list<typename base::value_type> init)
+      : base(key_buffer.begin(), mapped_buffer.begin(), eytzinger.keys(), eytzinger.index(), MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~soa_flat_map()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    soa_flat_map& operator = (const soa_flat_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    soa_flat_map& operator = (soa_flat_map&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->move_container(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The sorted keys.
+    etl::uninitialized_buffer_of<TKey, MAX_SIZE_> key_buffer;
+
+    /// The mapped values, in key order.
+    etl::uninitialized_buffer_of<TValue, MAX_SIZE_> mapped_buffer;
+
+    /// The Eytzinger copy of the keys, if used.
+    private_soa_flat::eytzinger_storage<TKey, MAX_SIZE_, TSearch> eytzinger;
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare, typename TSearch>
+  ETL_CONSTANT size_t soa_flat_map<TKey, TValue, MAX_SIZE_, TCompare, TSearch>::MAX_SIZE;
+}
+
+#endif
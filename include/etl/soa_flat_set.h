@@ -0,0 +1,833 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SOA_FLAT_SET_INCLUDED
+#define ETL_SOA_FLAT_SET_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "memory.h"
+#include "type_traits.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "placement_new.h"
+#include "initializer_list.h"
+
+#include "private/soa_flat_search.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup soa_flat_set soa_flat_set
+/// A sorted set with the capacity defined at compile time, that holds the
+/// keys in one contiguous array.
+/// Lookups use a branchless binary search or, optionally, an Eytzinger
+/// ordered copy of the keys.
+/// Has insertion of O(N) and find of O(logN).
+/// Duplicate entries are not allowed.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the soa_flat_set.
+  ///\ingroup soa_flat_set
+  //***************************************************************************
+  class soa_flat_set_exception : public etl::exception
+  {
+  public:
+
+    soa_flat_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the soa_flat_set.
+  ///\ingroup soa_flat_set
+  //***************************************************************************
+  class soa_flat_set_full : public etl::soa_flat_set_exception
+  {
+  public:
+
+    soa_flat_set_full(string_type file_name_, numeric_type line_number_)
+      : etl::soa_flat_set_exception(ETL_ERROR_TEXT("soa_flat_set:full", ETL_SOA_FLAT_SET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for specifically sized soa_flat_sets.
+  /// Can be used as a reference type for all soa_flat_sets containing a specific type.
+  ///\ingroup soa_flat_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare = etl::less<TKey>, typename TSearch = etl::soa_flat_search::binary>
+  class isoa_flat_set
+  {
+  public:
+
+    typedef TKey              key_type;
+    typedef TKey              value_type;
+    typedef TKeyCompare       key_compare;
+    typedef TKeyCompare       value_compare;
+    typedef TSearch           search_type;
+    typedef const value_type& reference;
+    typedef const value_type& const_reference;
+    typedef const value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+    typedef ptrdiff_t         difference_type;
+
+    typedef const key_type& const_key_reference;
+
+    /// The keys may not be modified through an iterator.
+    typedef const value_type* iterator;
+    typedef const value_type* const_iterator;
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the soa_flat_set.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return p_keys;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the soa_flat_set.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return p_keys + current_size;
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the beginning of the soa_flat_set.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return begin();
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the soa_flat_set.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return end();
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the reverse beginning of the soa_flat_set.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the end + 1 of the soa_flat_set.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the reverse beginning of the soa_flat_set.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a const_reverse_iterator to the end + 1 of the soa_flat_set.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a pointer to the contiguous, sorted, array of keys.
+    //*************************************************************************
+    const key_type* data() const
+    {
+      return p_keys;
+    }
+
+    //*********************************************************************
+    /// Assigns values to the soa_flat_set.
+    /// If asserts or exceptions are enabled, emits soa_flat_set_full if the soa_flat_set does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+      insert(first, last);
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the soa_flat_set.
+    /// If asserts or exceptions are enabled, emits soa_flat_set_full if the soa_flat_set is already full.
+    ///\param value The value to insert.
+    ///\return A pair of an iterator to the element and 'true' if it was inserted.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      const size_t index    = lower_bound_index(value);
+      const bool   inserted = !is_match(index, value);
+
+      if (inserted)
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(soa_flat_set_full));
+
+        make_space(index);
+        ::new (p_keys + index) key_type(value);
+        update_search();
+      }
+
+      return ETL_OR_STD::pair<iterator, bool>(p_keys + index, inserted);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the soa_flat_set.
+    /// If asserts or exceptions are enabled, emits soa_flat_set_full if the soa_flat_set is already full.
+    ///\param value The value to insert.
+    ///\return A pair of an iterator to the element and 'true' if it was inserted.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(value_type&& value)
+    {
+      const size_t index    = lower_bound_index(value);
+      const bool   inserted = !is_match(index, value);
+
+      if (inserted)
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(soa_flat_set_full));
+
+        make_space(index);
+        ::new (p_keys + index) key_type(etl::move(value));
+        update_search();
+      }
+
+      return ETL_OR_STD::pair<iterator, bool>(p_keys + index, inserted);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the soa_flat_set.
+    /// If asserts or exceptions are enabled, emits soa_flat_set_full if the soa_flat_set does not have enough free space.
+    /// The search structure is rebuilt once, at the end.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        const size_t index = private_soa_flat::lower_bound(p_keys, current_size, *first, compare);
+
+        if (!((index < current_size) && !compare(*first, p_keys[index])))
+        {
+          if (full())
+          {
+            update_search();
+            ETL_ASSERT_FAIL(ETL_ERROR(soa_flat_set_full));
+            return;
+          }
+
+          make_space(index);
+          ::new (p_keys + index) key_type(*first);
+        }
+
+        ++first;
+      }
+
+      update_search();
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(const_key_reference key)
+    {
+      const size_t index = find_index(key);
+
+      if (index == current_size)
+      {
+        return 0U;
+      }
+
+      erase_range(index, index + 1U);
+
+      return 1U;
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param i_element Iterator to the element.
+    ///\return An iterator to the element after the one erased.
+    //*********************************************************************
+    iterator erase(const_iterator i_element)
+    {
+      const size_t index = size_t(i_element - p_keys);
+
+      erase_range(index, index + 1U);
+
+      return p_keys + index;
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element + 1.
+    ///\return An iterator to the element after the last one erased.
+    //*********************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      const size_t index = size_t(first - p_keys);
+
+      erase_range(index, size_t(last - p_keys));
+
+      return p_keys + index;
+    }
+
+    //*************************************************************************
+    /// Clears the soa_flat_set.
+    //*************************************************************************
+    void clear()
+    {
+      erase_range(0U, current_size);
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(const_key_reference key) const
+    {
+      return p_keys + find_index(key);
+    }
+
+    //*********************************************************************
+    /// Checks if the soa_flat_set contains the key.
+    //*********************************************************************
+    bool contains(const_key_reference key) const
+    {
+      return find_index(key) != current_size;
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(const_key_reference key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator lower_bound(const_key_reference key) const
+    {
+      return p_keys + lower_bound_index(key);
+    }
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator upper_bound(const_key_reference key) const
+    {
+      const size_t index = lower_bound_index(key);
+
+      return p_keys + (is_match(index, key) ? index + 1U : index);
+    }
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+    {
+      const size_t index = lower_bound_index(key);
+      const size_t last  = is_match(index, key) ? index + 1U : index;
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(p_keys + index, p_keys + last);
+    }
+
+    //*************************************************************************
+    /// Gets the size of the soa_flat_set.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the soa_flat_set.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the soa_flat_set.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == capacity_;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the soa_flat_set.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return capacity_;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the soa_flat_set.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return capacity_;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return capacity_ - current_size;
+    }
+
+    //*************************************************************************
+    /// How to compare two keys.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return compare;
+    }
+
+    //*************************************************************************
+    /// How to compare two values.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return compare;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    isoa_flat_set& operator = (const isoa_flat_set& rhs)
+    {
+      if (&rhs != this)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    isoa_flat_set(key_type* p_keys_,
+                  key_type* p_eytzinger_keys_,
+                  private_soa_flat::eytzinger_index_type* p_eytzinger_index_,
+                  size_type capacity__)
+      : p_keys(p_keys_)
+      , p_eytzinger_keys(p_eytzinger_keys_)
+      , p_eytzinger_index(p_eytzinger_index_)
+      , current_size(0U)
+      , eytzinger_size(0U)
+      , capacity_(capacity__)
+      , compare()
+    {
+    }
+
+    //*********************************************************************
+    /// Moves the elements from another soa_flat_set.
+    //*********************************************************************
+    void move_container(isoa_flat_set& other)
+    {
+      clear();
+
+      for (size_t i = 0U; i < other.current_size; ++i)
+      {
+        ::new (p_keys + i) key_type(ETL_MOVE(other.p_keys[i]));
+      }
+
+      current_size = other.current_size;
+      update_search();
+
+      other.clear();
+    }
+
+  private:
+
+    //*********************************************************************
+    /// Is the key at the index equal to 'key'?
+    //*********************************************************************
+    bool is_match(size_t index, const_key_reference key) const
+    {
+      return (index < current_size) && !compare(key, p_keys[index]);
+    }
+
+#include "private/diagnostic_uninitialized_push.h"
+    //*********************************************************************
+    /// The index of the first key not less than 'key'.
+    //*********************************************************************
+    size_t lower_bound_index(const_key_reference key) const
+    {
+      return lower_bound_index(key, search_type());
+    }
+
+    //*********************************************************************
+    size_t lower_bound_index(const_key_reference key, etl::soa_flat_search::binary) const
+    {
+      return private_soa_flat::lower_bound(p_keys, current_size, key, compare);
+    }
+
+    //*********************************************************************
+    size_t lower_bound_index(const_key_reference key, etl::soa_flat_search::eytzinger) const
+    {
+      const size_t k = private_soa_flat::eytzinger_lower_bound(p_eytzinger_keys, current_size, key, compare);
+
+      return (k == 0U) ? current_size : size_t(p_eytzinger_index[k]);
+    }
+
+    //*********************************************************************
+    /// The index of the key, or size() if it is not in the set.
+    //*********************************************************************
+    size_t find_index(const_key_reference key) const
+    {
+      return find_index(key, search_type());
+    }
+
+    //*********************************************************************
+    size_t find_index(const_key_reference key, etl::soa_flat_search::binary) const
+    {
+      const size_t index = lower_bound_index(key);
+
+      return is_match(index, key) ? index : current_size;
+    }
+
+    //*********************************************************************
+    size_t find_index(const_key_reference key, etl::soa_flat_search::eytzinger) const
+    {
+      // Compare against the Eytzinger copy, which has just been read.
+      const size_t k = private_soa_flat::eytzinger_lower_bound(p_eytzinger_keys, current_size, key, compare);
+
+      return ((k != 0U) && !compare(key, p_eytzinger_keys[k])) ? size_t(p_eytzinger_index[k]) : current_size;
+    }
+
+#include "private/diagnostic_pop.h"
+
+    //*********************************************************************
+    /// Opens a gap at 'index' by moving the following elements up by one.
+    /// The gap is left unconstructed.
+    //*********************************************************************
+    void make_space(size_t index)
+    {
+      if (index < current_size)
+      {
+        const size_t last = current_size - 1U;
+
+        ::new (p_keys + current_size) key_type(ETL_MOVE(p_keys[last]));
+        etl::move_backward(p_keys + index, p_keys + last, p_keys + current_size);
+        p_keys[index].~key_type();
+      }
+
+      ++current_size;
+    }
+
+    //*********************************************************************
+    /// Erases the elements in [first, last).
+    //*********************************************************************
+    void erase_range(size_t first, size_t last)
+    {
+      if (first == last)
+      {
+        return;
+      }
+
+      etl::move(p_keys + last, p_keys + current_size, p_keys + first);
+
+      const size_t new_size = current_size - (last - first);
+
+      for (size_t i = new_size; i < current_size; ++i)
+      {
+        p_keys[i].~key_type();
+      }
+
+      current_size = new_size;
+      update_search();
+    }
+
+    //*********************************************************************
+    /// Rebuilds the search structure after a modification.
+    //*********************************************************************
+    void update_search()
+    {
+      update_search(search_type());
+    }
+
+    //*********************************************************************
+    void update_search(etl::soa_flat_search::binary)
+    {
+    }
+
+    //*********************************************************************
+    void update_search(etl::soa_flat_search::eytzinger)
+    {
+      for (size_t k = 1U; k <= eytzinger_size; ++k)
+      {
+        p_eytzinger_keys[k].~key_type();
+      }
+
+      size_t k = private_soa_flat::eytzinger_first(current_size);
+
+      for (size_t i = 0U; i < current_size; ++i)
+      {
+        ::new (p_eytzinger_keys + k) key_type(p_keys[i]);
+        p_eytzinger_index[k] = private_soa_flat::eytzinger_index_type(i);
+
+        k = private_soa_flat::eytzinger_next(k, current_size);
+      }
+
+      eytzinger_size = current_size;
+    }
+
+    // Disable copy construction.
+    isoa_flat_set(const isoa_flat_set&);
+
+    key_type*                               p_keys;
+    key_type*                               p_eytzinger_keys;  ///< Numbered from 1. Unused for binary search.
+    private_soa_flat::eytzinger_index_type* p_eytzinger_index; ///< Numbered from 1. Unused for binary search.
+    size_type                               current_size;
+    size_type                               eytzinger_size;
+    const size_type                         capacity_;
+    key_compare                             compare;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_SOA_FLAT_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~isoa_flat_set()
+    {
+    }
+#else
+  protected:
+    ~isoa_flat_set()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first soa_flat_set.
+  ///\param rhs Reference to the second soa_flat_set.
+  ///\return <b>true</b> if the sets are equal, otherwise <b>false</b>
+  ///\ingroup soa_flat_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare, typename TSearch>
+  bool operator ==(const etl::isoa_flat_set<TKey, TKeyCompare, TSearch>& lhs,
+                   const etl::isoa_flat_set<TKey, TKeyCompare, TSearch>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first soa_flat_set.
+  ///\param rhs Reference to the second soa_flat_set.
+  ///\return <b>true</b> if the sets are not equal, otherwise <b>false</b>
+  ///\ingroup soa_flat_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare, typename TSearch>
+  bool operator !=(const etl::isoa_flat_set<TKey, TKeyCompare, TSearch>& lhs,
+                   const etl::isoa_flat_set<TKey, TKeyCompare, TSearch>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// A soa_flat_set implementation that uses a fixed size buffer.
+  ///\tparam TKey     The key type.
+  ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
+  ///\tparam TCompare The type to compare keys. Default = etl::less<TKey>
+  ///\tparam TSearch  etl::soa_flat_search::binary (default) or etl::soa_flat_search::eytzinger
+  ///\ingroup soa_flat_set
+  //***************************************************************************
+  template <typename TKey, const size_t MAX_SIZE_, typename TCompare = etl::less<TKey>, typename TSearch = etl::soa_flat_search::binary>
+  class soa_flat_set : public etl::isoa_flat_set<TKey, TCompare, TSearch>
+  {
+  private:
+
+    typedef etl::isoa_flat_set<TKey, TCompare, TSearch> base;
+
+  public:
+
+    ETL_STATIC_ASSERT(MAX_SIZE_ < 0xFFFFFFFFUL, "Capacity too large for the Eytzinger index");
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    soa_flat_set()
+      : base(key_buffer.begin(), eytzinger.keys(), eytzinger.index(), MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    soa_flat_set(const soa_flat_set& other)
+      : base(key_buffer.begin(), eytzinger.keys(), eytzinger.index(), MAX_SIZE)
+    {
+      this->assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    soa_flat_set(soa_flat_set&& other)
+      : base(key_buffer.begin(), eytzinger.keys(), eytzinger.index(), MAX_SIZE)
+    {
+      this->move_container(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    soa_flat_set(TIterator first, TIterator last)
+      : base(key_buffer.begin(), eytzinger.keys(), eytzinger.index(), MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    soa_flat_set(std::initializer_list<TKey> init)
+      : base(key_buffer.begin(), eytzinger.keys(), eytzinger.index(), MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~soa_flat_set()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    soa_flat_set& operator = (const soa_flat_set& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    soa_flat_set& operator = (soa_flat_set&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->move_container(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The sorted keys.
+    etl::uninitialized_buffer_of<TKey, MAX_SIZE_> key_buffer;
+
+    /// The Eytzinger copy of the keys, if used.
+    private_soa_flat::eytzinger_storage<TKey, MAX_SIZE_, TSearch> eytzinger;
+  };
+
+  template <typename TKey, const size_t MAX_SIZE_, typename TCompare, typename TSearch>
+  ETL_CONSTANT size_t soa_flat_set<TKey, MAX_SIZE_, TCompare, TSearch>::MAX_SIZE;
+}
+
+#endif
@@ -0,0 +1,224 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SPSC_POLICY_INCLUDED
+#define ETL_SPSC_POLICY_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+
+///\defgroup spsc_policy SPSC layout policies
+/// Selects the layout of the indexes of the single producer, single consumer
+/// queues and buffers.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup spsc_policy
+  /// The default layout.
+  /// The read and write indexes are stored together and each side reads the
+  /// other side's index on every operation.
+  //***************************************************************************
+  struct spsc_policy_compact
+  {
+    static ETL_CONSTANT bool Padded = false;
+  };
+
+  //***************************************************************************
+  ///\ingroup spsc_policy
+  /// The read and write indexes are each placed on their own cache line of
+  /// ETL_CACHE_LINE_SIZE bytes, so that the producer and consumer do not
+  /// invalidate each other's line on every operation.
+  /// Each side also keeps a local copy of the other side's index and only
+  /// reloads it when the copy says that the queue is full (producer) or
+  /// empty (consumer).
+  /// Where access is serialised by a lock, as in queue_spsc_isr, only the
+  /// padding applies.
+  //***************************************************************************
+  struct spsc_policy_cached
+  {
+    static ETL_CONSTANT bool Padded = true;
+  };
+
+  namespace private_spsc
+  {
+    //*************************************************************************
+    /// The read and write indexes.
+    /// \tparam TIndex The stored index type. May be atomic.
+    /// \tparam TValue The value type of the index.
+    //*************************************************************************
+    template <typename TIndex, typename TValue, bool Padded>
+    class spsc_indexes;
+
+    //*************************************************************************
+    /// Compact layout.
+    //*************************************************************************
+    template <typename TIndex, typename TValue>
+    class spsc_indexes<TIndex, TValue, false>
+    {
+    public:
+
+      static ETL_CONSTANT bool Cached = false;
+
+      spsc_indexes()
+        : write(0),
+          read(0)
+      {
+      }
+
+#if ETL_HAS_ATOMIC
+      //***********************************
+      /// The read index, as seen by the producer.
+      //***********************************
+      TValue producer_read_index() const
+      {
+        return read.load(etl::memory_order_acquire);
+      }
+
+      //***********************************
+      /// Reloads the read index for the producer.
+      //***********************************
+      TValue producer_reload_read_index()
+      {
+        return read.load(etl::memory_order_acquire);
+      }
+
+      //***********************************
+      /// The write index, as seen by the consumer.
+      //***********************************
+      TValue consumer_write_index() const
+      {
+        return write.load(etl::memory_order_acquire);
+      }
+
+      //***********************************
+      /// Reloads the write index for the consumer.
+      //***********************************
+      TValue consumer_reload_write_index()
+      {
+        return write.load(etl::memory_order_acquire);
+      }
+#endif
+
+      //***********************************
+      /// Resets the local copies.
+      //***********************************
+      void reset_cached_indexes()
+      {
+      }
+
+      TIndex write; ///< Where to input new data.
+      TIndex read;  ///< Where to get the oldest data.
+    };
+
+    template <typename TIndex, typename TValue>
+    ETL_CONSTANT bool spsc_indexes<TIndex, TValue, false>::Cached;
+
+    //*************************************************************************
+    /// Padded layout, with local copies of the remote indexes.
+    //*************************************************************************
+    template <typename TIndex, typename TValue>
+    class spsc_indexes<TIndex, TValue, true>
+    {
+    public:
+
+      static ETL_CONSTANT bool Cached = true;
+
+      spsc_indexes()
+        : write(0),
+          cached_read(0),
+          read(0),
+          cached_write(0)
+      {
+      }
+
+#if ETL_HAS_ATOMIC
+      //***********************************
+      /// The read index, as last seen by the producer.
+      //***********************************
+      TValue producer_read_index() const
+      {
+        return cached_read;
+      }
+
+      //***********************************
+      /// Reloads the read index for the producer.
+      //***********************************
+      TValue producer_reload_read_index()
+      {
+        cached_read = read.load(etl::memory_order_acquire);
+
+        return cached_read;
+      }
+
+      //***********************************
+      /// The write index, as last seen by the consumer.
+      //***********************************
+      TValue consumer_write_index() const
+      {
+        return cached_write;
+      }
+
+      //***********************************
+      /// Reloads the write index for the consumer.
+      //***********************************
+      TValue consumer_reload_write_index()
+      {
+        cached_write = write.load(etl::memory_order_acquire);
+
+        return cached_write;
+      }
+#endif
+
+      //***********************************
+      /// Resets the local copies.
+      //***********************************
+      void reset_cached_indexes()
+      {
+        cached_read  = 0;
+        cached_write = 0;
+      }
+
+      char   padding_write[ETL_CACHE_LINE_SIZE];
+      TIndex write;        ///< Where to input new data.
+      TValue cached_read;  ///< The producer's copy of the read index.
+      char   padding_read[ETL_CACHE_LINE_SIZE];
+      TIndex read;         ///< Where to get the oldest data.
+      TValue cached_write; ///< The consumer's copy of the write index.
+      char   padding_end[ETL_CACHE_LINE_SIZE];
+    };
+
+    template <typename TIndex, typename TValue>
+    ETL_CONSTANT bool spsc_indexes<TIndex, TValue, true>::Cached;
+  }
+}
+
+#endif
@@ -45,6 +45,7 @@ SOFTWARE.
 #include "absolute.h"
 #include "expected.h"
 #include "math.h"
+#include "private/floating_point_parse.h"
 
 #include <math.h>
 
@@ -358,6 +359,98 @@ namespace etl
              (radix == etl::radix::hexadecimal);
     }
 
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// Loads eight single byte characters into a word, the first in the low byte.
+    //***************************************************************************
+    template <typename TChar>
+    ETL_NODISCARD
+    ETL_CONSTEXPR14
+    uint64_t load_block(const TChar* p)
+    {
+      return  static_cast<uint64_t>(static_cast<uint8_t>(p[0]))         |
+             (static_cast<uint64_t>(static_cast<uint8_t>(p[1])) << 8U)  |
+             (static_cast<uint64_t>(static_cast<uint8_t>(p[2])) << 16U) |
+             (static_cast<uint64_t>(static_cast<uint8_t>(p[3])) << 24U) |
+             (static_cast<uint64_t>(static_cast<uint8_t>(p[4])) << 32U) |
+             (static_cast<uint64_t>(static_cast<uint8_t>(p[5])) << 40U) |
+             (static_cast<uint64_t>(static_cast<uint8_t>(p[6])) << 48U) |
+             (static_cast<uint64_t>(static_cast<uint8_t>(p[7])) << 56U);
+    }
+
+    //***************************************************************************
+    /// Sets the top bit of each byte that is in the range [low, high].
+    /// The bytes must all be less than 0x80.
+    //***************************************************************************
+    ETL_NODISCARD
+    inline
+    ETL_CONSTEXPR14
+    uint64_t bytes_in_range(uint64_t block, uint8_t low, uint8_t high)
+    {
+      const uint64_t ones = 0x0101010101010101ULL;
+
+      return (block + (ones * (0x80U - low))) & ~(block + (ones * (0x7FU - high))) & (ones * 0x80U);
+    }
+
+    //***************************************************************************
+    /// Gets the value of a block of eight decimal digits.
+    /// Returns false if they are not all decimal digits.
+    //***************************************************************************
+    ETL_NODISCARD
+    inline
+    ETL_CONSTEXPR14
+    bool decimal_block(uint64_t block, uint32_t& value)
+    {
+      // Each byte must be 0x3n, and adding 6 must leave it 0x3n.
+      if (((block & 0xF0F0F0F0F0F0F0F0ULL) | (((block + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4U)) != 0x3333333333333333ULL)
+      {
+        return false;
+      }
+
+      // Combine pairs of digits, then pairs of pairs, then pairs of quads.
+      block = ((block & 0x0F0F0F0F0F0F0F0FULL) * 2561U) >> 8U;
+      block = ((block & 0x00FF00FF00FF00FFULL) * 6553601U) >> 16U;
+      value = static_cast<uint32_t>(((block & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32U);
+
+      return true;
+    }
+
+    //***************************************************************************
+    /// Gets the value of a block of eight hexadecimal digits, in either case.
+    /// Returns false if they are not all hexadecimal digits.
+    //***************************************************************************
+    ETL_NODISCARD
+    inline
+    ETL_CONSTEXPR14
+    bool hex_block(uint64_t block, uint32_t& value)
+    {
+      const uint64_t top_bits = 0x8080808080808080ULL;
+
+      if ((block & top_bits) != 0U)
+      {
+        return false;
+      }
+
+      const uint64_t digits  = bytes_in_range(block, '0', '9');
+      const uint64_t letters = bytes_in_range(block | 0x2020202020202020ULL, 'a', 'f');
+
+      if ((digits | letters) != top_bits)
+      {
+        return false;
+      }
+
+      // Letters are worth nine more than their low nibble.
+      uint64_t nibbles = (block & 0x0F0F0F0F0F0F0F0FULL) + ((letters >> 7U) * 9U);
+
+      // Combine pairs of nibbles, then pairs of bytes, then pairs of words.
+      nibbles = ((nibbles << 4U) | (nibbles >> 8U))  & 0x00FF00FF00FF00FFULL;
+      nibbles = ((nibbles << 8U) | (nibbles >> 16U)) & 0x0000FFFF0000FFFFULL;
+      value   = static_cast<uint32_t>((nibbles << 16U) | (nibbles >> 32U));
+
+      return true;
+    }
+#endif
+
     //***************************************************************************
     /// Accumulate integrals
     //***************************************************************************
@@ -420,6 +513,48 @@ namespace etl
         return is_success;
       }
 
+#if ETL_USING_64BIT_TYPES
+      //*********************************
+      /// Adds eight characters at once, as packed by load_block.
+      /// Returns false, without changing the value, if they are not all
+      /// digits of a decimal or hexadecimal radix.
+      /// Returns false and sets the status on overflow.
+      //*********************************
+      ETL_NODISCARD
+      ETL_CONSTEXPR14
+      bool add_block(uint64_t block)
+      {
+        uint32_t block_value = 0U;
+        uint64_t scale       = 0U;
+
+        if ((radix == etl::radix::decimal) && decimal_block(block, block_value))
+        {
+          scale = 100000000ULL;
+        }
+        else if ((radix == etl::radix::hexadecimal) && hex_block(block, block_value))
+        {
+          scale = 0x100000000ULL;
+        }
+        else
+        {
+          return false;
+        }
+
+        const uint64_t max_value = static_cast<uint64_t>(maximum);
+        const uint64_t old_value = static_cast<uint64_t>(integral_value);
+
+        if ((block_value > max_value) || (old_value > ((max_value - block_value) / scale)))
+        {
+          conversion_status = to_arithmetic_status::Overflow;
+          return false;
+        }
+
+        integral_value = static_cast<TValue>((old_value * scale) + block_value);
+
+        return true;
+      }
+#endif
+
       //*********************************
       ETL_NODISCARD
       ETL_CONSTEXPR14
@@ -637,6 +772,150 @@ namespace etl
       to_arithmetic_status conversion_status;
     };
 
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// Scans decimal digits into the mantissa, keeping up to 19 significant
+    /// digits. Digits beyond that are dropped, adjusting the exponent for
+    /// integral digits, and marking the mantissa as truncated if non-zero.
+    //***************************************************************************
+    template <typename TChar>
+    ETL_CONSTEXPR14
+    void scan_digits(const TChar*& itr,
+                     const TChar*  itr_end,
+                     etl::private_floating_point::decimal_value& decimal,
+                     int&  n_digits,
+                     bool& truncated,
+                     bool& has_digits,
+                     const bool is_fractional)
+    {
+      const int Max_Digits = 19;
+
+      if (sizeof(TChar) == 1U)
+      {
+        uint32_t block_value = 0U;
+
+        // Eight characters at a time, while they are all digits.
+        while (((itr_end - itr) >= 8) && (n_digits <= (Max_Digits - 8)) && decimal_block(load_block(itr), block_value))
+        {
+          decimal.mantissa = (decimal.mantissa * 100000000U) + block_value;
+          decimal.exponent -= is_fractional ? 8 : 0;
+          n_digits  += 8;
+          has_digits = true;
+          itr       += 8;
+        }
+      }
+
+      while ((itr != itr_end) && is_valid(convert(*itr), etl::radix::decimal))
+      {
+        const char digit = digit_value(convert(*itr), etl::radix::decimal);
+
+        if (n_digits < Max_Digits)
+        {
+          decimal.mantissa = (decimal.mantissa * 10U) + static_cast<uint64_t>(digit);
+          decimal.exponent -= is_fractional ? 1 : 0;
+          ++n_digits;
+        }
+        else
+        {
+          truncated = truncated || (digit != 0);
+          decimal.exponent += is_fractional ? 0 : 1;
+        }
+
+        has_digits = true;
+        ++itr;
+      }
+    }
+
+    //***************************************************************************
+    /// Scans text of the form [sign] digits [radix point digits] [e [sign] digits]
+    /// into a decimal mantissa and exponent.
+    /// Returns false for any other form, leaving it to floating_point_accumulator.
+    //***************************************************************************
+    template <typename TChar>
+    ETL_NODISCARD
+    ETL_CONSTEXPR14
+    bool scan_decimal(const etl::basic_string_view<TChar>& view,
+                      etl::private_floating_point::decimal_value& decimal,
+                      bool& truncated)
+    {
+      const TChar*       itr     = view.begin();
+      const TChar* const itr_end = view.end();
+
+      decimal.mantissa = 0U;
+      decimal.exponent = 0;
+      decimal.negative = false;
+      truncated        = false;
+
+      bool has_digits = false;
+      int  n_digits   = 0;
+
+      if ((itr != itr_end) && ((convert(*itr) == char_constant::Positive_Char) || (convert(*itr) == char_constant::Negative_Char)))
+      {
+        decimal.negative = (convert(*itr) == char_constant::Negative_Char);
+        ++itr;
+      }
+
+      // Leading zeros are not significant.
+      while ((itr != itr_end) && (convert(*itr) == '0'))
+      {
+        has_digits = true;
+        ++itr;
+      }
+
+      scan_digits(itr, itr_end, decimal, n_digits, truncated, has_digits, false);
+
+      if ((itr != itr_end) && ((convert(*itr) == char_constant::Radix_Point1_Char) || (convert(*itr) == char_constant::Radix_Point2_Char)))
+      {
+        ++itr;
+
+        // Nor are zeros straight after the radix point, if there were no integral digits.
+        while ((n_digits == 0) && (itr != itr_end) && (convert(*itr) == '0'))
+        {
+          has_digits = true;
+          --decimal.exponent;
+          ++itr;
+        }
+
+        scan_digits(itr, itr_end, decimal, n_digits, truncated, has_digits, true);
+      }
+
+      if (!has_digits)
+      {
+        return false;
+      }
+
+      if ((itr != itr_end) && (convert(*itr) == char_constant::Exponential_Char))
+      {
+        ++itr;
+
+        bool is_negative_exponent = false;
+
+        if ((itr != itr_end) && ((convert(*itr) == char_constant::Positive_Char) || (convert(*itr) == char_constant::Negative_Char)))
+        {
+          is_negative_exponent = (convert(*itr) == char_constant::Negative_Char);
+          ++itr;
+        }
+
+        int32_t exponent = 0;
+
+        while ((itr != itr_end) && is_valid(convert(*itr), etl::radix::decimal))
+        {
+          // Anything this large is out of range anyway.
+          if (exponent < 100000)
+          {
+            exponent = (exponent * 10) + digit_value(convert(*itr), etl::radix::decimal);
+          }
+
+          ++itr;
+        }
+
+        decimal.exponent += is_negative_exponent ? -exponent : exponent;
+      }
+
+      return (itr == itr_end);
+    }
+#endif
+
     //***************************************************************************
     // Define an unsigned accumulator type that is at least as large as TValue.
     //***************************************************************************
@@ -687,7 +966,18 @@ namespace etl
 
       integral_accumulator<TAccumulatorType> accumulator(radix, maximum);
 
-      while ((itr != itr_end) && accumulator.add(convert(*itr)))
+#if ETL_USING_64BIT_TYPES
+      if (sizeof(TChar) == 1U)
+      {
+        // Eight characters at a time, while they are all digits.
+        while (((itr_end - itr) >= 8) && accumulator.add_block(load_block(itr)))
+        {
+          itr += 8;
+        }
+      }
+#endif
+
+      while ((itr != itr_end) && accumulator.has_value() && accumulator.add(convert(*itr)))
       {
         // Keep looping until done or an error occurs.
         ++itr;
@@ -893,38 +1183,64 @@ namespace etl
     }
     else
     {
-      floating_point_accumulator accumulator;
+      bool is_converted = false;
 
-      typename etl::basic_string_view<TChar>::const_iterator itr           = view.begin();
-      const typename etl::basic_string_view<TChar>::const_iterator itr_end = view.end();
+#if ETL_USING_64BIT_TYPES
+      // Plain decimal text is converted exactly.
+      etl::private_floating_point::decimal_value decimal = { 0U, 0, false };
+      bool   truncated = false;
+      TValue converted = 0;
+
+      is_converted = scan_decimal(view, decimal, truncated) && etl::private_floating_point::from_decimal(decimal, truncated, converted);
 
-      while ((itr != itr_end) && accumulator.add(convert(*itr)))
+      if (is_converted)
       {
-        // Keep looping until done or an error occurs.
-        ++itr;
+        if (etl::is_infinity(converted))
+        {
+          result = unexpected_type(to_arithmetic_status::Overflow);
+        }
+        else
+        {
+          result = converted;
+        }
       }
+#endif
 
-      result = unexpected_type(accumulator.status());
-
-      if (result.has_value())
+      if (!is_converted)
       {
-        TValue value = static_cast<TValue>(accumulator.value());
-        int exponent = accumulator.exponent();
+        floating_point_accumulator accumulator;
 
-        value *= pow(static_cast<TValue>(10.0), static_cast<TValue>(exponent));
+        typename etl::basic_string_view<TChar>::const_iterator itr           = view.begin();
+        const typename etl::basic_string_view<TChar>::const_iterator itr_end = view.end();
 
-        // Check that the result is a valid floating point number.
-        if (etl::is_infinity(value))
+        while ((itr != itr_end) && accumulator.add(convert(*itr)))
         {
-          result = unexpected_type(to_arithmetic_status::Overflow);
+          // Keep looping until done or an error occurs.
+          ++itr;
         }
-        else if (etl::is_nan(value))
-        {
-          result = unexpected_type(to_arithmetic_status::Invalid_Float);
-        }
-        else
+
+        result = unexpected_type(accumulator.status());
+
+        if (result.has_value())
         {
-          result = value;
+          TValue value = static_cast<TValue>(accumulator.value());
+          int exponent = accumulator.exponent();
+
+          value *= pow(static_cast<TValue>(10.0), static_cast<TValue>(exponent));
+
+          // Check that the result is a valid floating point number.
+          if (etl::is_infinity(value))
+          {
+            result = unexpected_type(to_arithmetic_status::Overflow);
+          }
+          else if (etl::is_nan(value))
+          {
+            result = unexpected_type(to_arithmetic_status::Invalid_Float);
+          }
+          else
+          {
+            result = value;
+          }
         }
       }
     }
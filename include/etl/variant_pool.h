@@ -62,21 +62,82 @@ SOFTWARE.
 namespace etl
 {
 #if ETL_USING_CPP11 && !defined(ETL_VARIANT_POOL_FORCE_CPP03_IMPLEMENTATION)
+  namespace private_variant_pool
+  {
+    //***************************************************************************
+    /// The implementation of variant_pool and variant_pool_with_occupancy.
+    //***************************************************************************
+    template <size_t MAX_SIZE_, bool VOccupancy, typename ... Ts>
+    class variant_pool_base
+      : public etl::generic_pool<etl::largest<Ts...>::size,
+                                 etl::largest<Ts...>::alignment,
+                                 MAX_SIZE_,
+                                 VOccupancy>
+    {
+    public:
+
+      typedef etl::generic_pool<etl::largest<Ts...>::size,
+                                etl::largest<Ts...>::alignment,
+                                MAX_SIZE_,
+                                VOccupancy> base_t;
+
+      static const size_t MAX_SIZE = MAX_SIZE_;
+
+      //*************************************************************************
+      /// Creates the object from a type. Variadic parameter constructor.
+      //*************************************************************************
+      template <typename T, typename... Args>
+      T* create(Args&&... args)
+      {
+        ETL_STATIC_ASSERT((etl::is_one_of<T, Ts...>::value), "Unsupported type");
+
+        return base_t::template create<T>(etl::forward<Args>(args)...);
+      }
+
+      //*************************************************************************
+      /// Destroys the object.
+      //*************************************************************************
+      template <typename T>
+      void destroy(const T* const p)
+      {
+        ETL_STATIC_ASSERT((etl::is_one_of<T, Ts...>::value || etl::is_base_of_any<T, Ts...>::value), "Invalid type");
+
+        base_t::destroy(p);
+      }
+
+      //*************************************************************************
+      /// Returns the maximum number of items in the variant_pool.
+      //*************************************************************************
+      size_t max_size() const
+      {
+        return MAX_SIZE;
+      }
+
+    protected:
+
+      //*************************************************************************
+      /// Default constructor.
+      //*************************************************************************
+      variant_pool_base()
+      {
+      }
+
+    private:
+
+      variant_pool_base(const variant_pool_base&) ETL_DELETE;
+      variant_pool_base& operator =(const variant_pool_base&) ETL_DELETE;
+    };
+  }
+
+  //***************************************************************************
+  /// A pool of objects of any of the types Ts.
   //***************************************************************************
   template <size_t MAX_SIZE_, typename ... Ts>
   class variant_pool
-    : public etl::generic_pool<etl::largest<Ts...>::size,
-                               etl::largest<Ts...>::alignment,
-                               MAX_SIZE_>
+    : public private_variant_pool::variant_pool_base<MAX_SIZE_, false, Ts...>
   {
   public:
 
-    typedef etl::generic_pool<etl::largest<Ts...>::size,
-                              etl::largest<Ts...>::alignment,
-                              MAX_SIZE_> base_t;
-
-    static const size_t MAX_SIZE = MAX_SIZE_;
-
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
@@ -84,40 +145,32 @@ namespace etl
     {
     }
 
-    //*************************************************************************
-    /// Creates the object from a type. Variadic parameter constructor.
-    //*************************************************************************
-    template <typename T, typename... Args>
-    T* create(Args&&... args)
-    {
-      ETL_STATIC_ASSERT((etl::is_one_of<T, Ts...>::value), "Unsupported type");
-
-      return base_t::template create<T>(etl::forward<Args>(args)...);
-    }
+  private:
 
-    //*************************************************************************
-    /// Destroys the object.
-    //*************************************************************************
-    template <typename T>
-    void destroy(const T* const p)
-    {
-      ETL_STATIC_ASSERT((etl::is_one_of<T, Ts...>::value || etl::is_base_of_any<T, Ts...>::value), "Invalid type");
+    variant_pool(const variant_pool&) ETL_DELETE;
+    variant_pool& operator =(const variant_pool&) ETL_DELETE;
+  };
 
-      base_t::destroy(p);
-    }
+  //***************************************************************************
+  /// A pool of objects of any of the types Ts, with an occupancy bitmap.
+  //***************************************************************************
+  template <size_t MAX_SIZE_, typename ... Ts>
+  class variant_pool_with_occupancy
+    : public private_variant_pool::variant_pool_base<MAX_SIZE_, true, Ts...>
+  {
+  public:
 
     //*************************************************************************
-    /// Returns the maximum number of items in the variant_pool.
+    /// Default constructor.
     //*************************************************************************
-    size_t max_size() const
+    variant_pool_with_occupancy()
     {
-      return MAX_SIZE;
     }
 
   private:
 
-    variant_pool(const variant_pool&) ETL_DELETE;
-    variant_pool& operator =(const variant_pool&) ETL_DELETE;
+    variant_pool_with_occupancy(const variant_pool_with_occupancy&) ETL_DELETE;
+    variant_pool_with_occupancy& operator =(const variant_pool_with_occupancy&) ETL_DELETE;
   };
 
   //***************************************************************************
@@ -175,6 +228,165 @@ namespace etl
     variant_pool_ext& operator =(const variant_pool_ext&) ETL_DELETE;
   };
 #else
+  namespace private_variant_pool
+  {
+    //***************************************************************************
+    /// The implementation of variant_pool and variant_pool_with_occupancy.
+    //***************************************************************************
+    template <size_t MAX_SIZE_,
+              bool VOccupancy,
+              typename T1,
+              typename T2,
+              typename T3,
+              typename T4,
+              typename T5,
+              typename T6,
+              typename T7,
+              typename T8,
+              typename T9,
+              typename T10,
+              typename T11,
+              typename T12,
+              typename T13,
+              typename T14,
+              typename T15,
+              typename T16>
+    class variant_pool_base
+      : public etl::generic_pool<etl::largest<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::size,
+                                 etl::largest<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::alignment,
+                                 MAX_SIZE_,
+                                 VOccupancy>
+    {
+    public:
+
+      typedef etl::generic_pool<etl::largest<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::size,
+                                etl::largest<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::alignment,
+                                MAX_SIZE_,
+                                VOccupancy> base_t;
+
+      static const size_t MAX_SIZE = MAX_SIZE_;
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_USING_STLPORT
+      //*************************************************************************
+      /// Creates the object. Default constructor.
+      //*************************************************************************
+      template <typename T>
+      T* create()
+      {
+        ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type");
+
+        return base_t::template create<T>();
+      }
+
+      //*************************************************************************
+      /// Creates the object. One parameter constructor.
+      //*************************************************************************
+      template <typename T, typename TP1>
+      T* create(const TP1& p1)
+      {
+        ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type");
+
+        return base_t::template create<T>(p1);
+      }
+
+      //*************************************************************************
+      /// Creates the object. Two parameter constructor.
+      //*************************************************************************
+      template <typename T, typename TP1, typename TP2>
+      T* create(const TP1& p1, const TP2& p2)
+      {
+        ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type");
+
+        return base_t::template create<T>(p1, p2);
+      }
+
+      //*************************************************************************
+      /// Creates the object. Three parameter constructor.
+      //*************************************************************************
+      template <typename T, typename TP1, typename TP2, typename TP3>
+      T* create(const TP1& p1, const TP2& p2, const TP3& p3)
+      {
+        ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type");
+
+        return base_t::template create<T>(p1, p2, p3);
+      }
+
+      //*************************************************************************
+      /// Creates the object. Four parameter constructor.
+      //*************************************************************************
+      template <typename T, typename TP1, typename TP2, typename TP3, typename TP4>
+      T* create(const TP1& p1, const TP2& p2, const TP3& p3, const TP4& p4)
+      {
+        ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type");
+
+        return base_t::template create<T>(p1, p2, p3, p4);
+      }
+#else
+      //*************************************************************************
+      /// Creates the object from a type. Variadic parameter constructor.
+      //*************************************************************************
+      template <typename T, typename... Args>
+      T* create(Args&&... args)
+      {
+        ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type");
+
+        return base_t::template create<T>(etl::forward<Args>(args)...);
+      }
+#endif
+
+      //*************************************************************************
+      /// Destroys the object.
+      //*************************************************************************
+      template <typename T>
+      void destroy(const T* const p)
+      {
+        ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value ||
+                           etl::is_base_of<T, T1>::value ||
+                           etl::is_base_of<T, T2>::value ||
+                           etl::is_base_of<T, T3>::value ||
+                           etl::is_base_of<T, T4>::value ||
+                           etl::is_base_of<T, T5>::value ||
+                           etl::is_base_of<T, T6>::value ||
+                           etl::is_base_of<T, T7>::value ||
+                           etl::is_base_of<T, T8>::value ||
+                           etl::is_base_of<T, T9>::value ||
+                           etl::is_base_of<T, T10>::value ||
+                           etl::is_base_of<T, T11>::value ||
+                           etl::is_base_of<T, T12>::value ||
+                           etl::is_base_of<T, T13>::value ||
+                           etl::is_base_of<T, T14>::value ||
+                           etl::is_base_of<T, T15>::value ||
+                           etl::is_base_of<T, T16>::value), "Invalid type");
+
+        base_t::destroy(p);
+      }
+
+      //*************************************************************************
+      /// Returns the maximum number of items in the variant_pool.
+      //*************************************************************************
+      size_t max_size() const
+      {
+        return MAX_SIZE;
+      }
+
+    protected:
+
+      //*************************************************************************
+      /// Default constructor.
+      //*************************************************************************
+      variant_pool_base()
+      {
+      }
+
+    private:
+
+      variant_pool_base(const variant_pool_base&) ETL_DELETE;
+      variant_pool_base& operator =(const variant_pool_base&) ETL_DELETE;
+    };
+  }
+
+  //***************************************************************************
+  /// A pool of objects of any of the listed types.
   //***************************************************************************
   template <size_t MAX_SIZE_,
             typename T1,
@@ -194,18 +406,10 @@ namespace etl
             typename T15 = void,
             typename T16 = void>
   class variant_pool
-    : public etl::generic_pool<etl::largest<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::size,
-                               etl::largest<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::alignment,
-                               MAX_SIZE_>
+    : public private_variant_pool::variant_pool_base<MAX_SIZE_, false, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>
   {
   public:
 
-    typedef etl::generic_pool<etl::largest<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::size,
-                              etl::largest<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::alignment,
-                              MAX_SIZE_> base_t;
-
-    static const size_t MAX_SIZE = MAX_SIZE_;
-
     //*************************************************************************
     /// Default constructor.
     //*************************************************************************
@@ -213,113 +417,48 @@ namespace etl
     {
     }
 
-#if ETL_CPP11_NOT_SUPPORTED || ETL_USING_STLPORT
-    //*************************************************************************
-    /// Creates the object. Default constructor.
-    //*************************************************************************
-    template <typename T>
-    T* create()
-    {
-      ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type");
-
-      return base_t::template create<T>();
-    }
-
-    //*************************************************************************
-    /// Creates the object. One parameter constructor.
-    //*************************************************************************
-    template <typename T, typename TP1>
-    T* create(const TP1& p1)
-    {
-      ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type");
-
-      return base_t::template create<T>(p1);
-    }
-
-    //*************************************************************************
-    /// Creates the object. Two parameter constructor.
-    //*************************************************************************
-    template <typename T, typename TP1, typename TP2>
-    T* create(const TP1& p1, const TP2& p2)
-    {
-      ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type");
-
-      return base_t::template create<T>(p1, p2);
-    }
-
-    //*************************************************************************
-    /// Creates the object. Three parameter constructor.
-    //*************************************************************************
-    template <typename T, typename TP1, typename TP2, typename TP3>
-    T* create(const TP1& p1, const TP2& p2, const TP3& p3)
-    {
-      ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type");
-
-      return base_t::template create<T>(p1, p2, p3);
-    }
-
-    //*************************************************************************
-    /// Creates the object. Four parameter constructor.
-    //*************************************************************************
-    template <typename T, typename TP1, typename TP2, typename TP3, typename TP4>
-    T* create(const TP1& p1, const TP2& p2, const TP3& p3, const TP4& p4)
-    {
-      ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type");
-
-      return base_t::template create<T>(p1, p2, p3, p4);
-    }
-#else
-    //*************************************************************************
-    /// Creates the object from a type. Variadic parameter constructor.
-    //*************************************************************************
-    template <typename T, typename... Args>
-    T* create(Args&&... args)
-    {
-      ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type");
-
-      return base_t::template create<T>(etl::forward<Args>(args)...);
-    }
-#endif
+  private:
 
-    //*************************************************************************
-    /// Destroys the object.
-    //*************************************************************************
-    template <typename T>
-    void destroy(const T* const p)
-    {
-      ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value ||
-                         etl::is_base_of<T, T1>::value ||
-                         etl::is_base_of<T, T2>::value ||
-                         etl::is_base_of<T, T3>::value ||
-                         etl::is_base_of<T, T4>::value ||
-                         etl::is_base_of<T, T5>::value ||
-                         etl::is_base_of<T, T6>::value ||
-                         etl::is_base_of<T, T7>::value ||
-                         etl::is_base_of<T, T8>::value ||
-                         etl::is_base_of<T, T9>::value ||
-                         etl::is_base_of<T, T10>::value ||
-                         etl::is_base_of<T, T11>::value ||
-                         etl::is_base_of<T, T12>::value ||
-                         etl::is_base_of<T, T13>::value ||
-                         etl::is_base_of<T, T14>::value ||
-                         etl::is_base_of<T, T15>::value ||
-                         etl::is_base_of<T, T16>::value), "Invalid type");
+    variant_pool(const variant_pool&) ETL_DELETE;
+    variant_pool& operator =(const variant_pool&) ETL_DELETE;
+  };
 
-      base_t::destroy(p);
-    }
+  //***************************************************************************
+  /// A pool of objects of any of the listed types, with an occupancy bitmap.
+  //***************************************************************************
+  template <size_t MAX_SIZE_,
+            typename T1,
+            typename T2 = void,
+            typename T3 = void,
+            typename T4 = void,
+            typename T5 = void,
+            typename T6 = void,
+            typename T7 = void,
+            typename T8 = void,
+            typename T9 = void,
+            typename T10 = void,
+            typename T11 = void,
+            typename T12 = void,
+            typename T13 = void,
+            typename T14 = void,
+            typename T15 = void,
+            typename T16 = void>
+  class variant_pool_with_occupancy
+    : public private_variant_pool::variant_pool_base<MAX_SIZE_, true, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>
+  {
+  public:
 
     //*************************************************************************
-    /// Returns the maximum number of items in the variant_pool.
+    /// Default constructor.
     //*************************************************************************
-    size_t max_size() const
+    variant_pool_with_occupancy()
     {
-      return MAX_SIZE;
     }
 
   private:
 
-    variant_pool(const variant_pool&) ETL_DELETE;
-    variant_pool& operator =(const variant_pool&) ETL_DELETE;
+    variant_pool_with_occupancy(const variant_pool_with_occupancy&) ETL_DELETE;
+    variant_pool_with_occupancy& operator =(const variant_pool_with_occupancy&) ETL_DELETE;
   };
 
   //***************************************************************************
@@ -0,0 +1,479 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WYHASH_INCLUDED
+#define ETL_WYHASH_INCLUDED
+
+#include "platform.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "iterator.h"
+
+#include <stdint.h>
+
+ETL_STATIC_ASSERT(ETL_USING_8BIT_TYPES, "This file does not currently support targets with no 8bit type");
+
+#if defined(ETL_COMPILER_KEIL)
+#pragma diag_suppress 1300
+#endif
+
+///\defgroup wyhash wyhash hash calculation
+///\ingroup maths
+
+#if ETL_USING_64BIT_TYPES
+
+namespace etl
+{
+  namespace private_wyhash
+  {
+    //*************************************************************************
+    /// The default secret.
+    //*************************************************************************
+    static ETL_CONSTANT uint64_t Secret0 = 0x2D358DCCAA6C78A5ULL;
+    static ETL_CONSTANT uint64_t Secret1 = 0x8BB84B93962EACC9ULL;
+    static ETL_CONSTANT uint64_t Secret2 = 0x4B33A62ED433D4A3ULL;
+    static ETL_CONSTANT uint64_t Secret3 = 0x4D5A2DA51DE1AA47ULL;
+
+    //*************************************************************************
+    /// 64 x 64 -> 128 bit multiply.
+    /// 'a' receives the low 64 bits, 'b' the high 64 bits.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline void multiply(uint64_t& a, uint64_t& b)
+    {
+#if defined(__SIZEOF_INT128__)
+      __extension__ typedef unsigned __int128 uint128_t;
+
+      const uint128_t r = static_cast<uint128_t>(a) * b;
+
+      a = static_cast<uint64_t>(r);
+      b = static_cast<uint64_t>(r >> 64U);
+#else
+      const uint64_t ha = a >> 32U;
+      const uint64_t hb = b >> 32U;
+      const uint64_t la = static_cast<uint32_t>(a);
+      const uint64_t lb = static_cast<uint32_t>(b);
+
+      const uint64_t rh  = ha * hb;
+      const uint64_t rm0 = ha * lb;
+      const uint64_t rm1 = hb * la;
+      const uint64_t rl  = la * lb;
+
+      const uint64_t t  = rl + (rm0 << 32U);
+      uint64_t       c  = (t < rl) ? 1U : 0U;
+      const uint64_t lo = t + (rm1 << 32U);
+      c += (lo < t) ? 1U : 0U;
+
+      a = lo;
+      b = rh + (rm0 >> 32U) + (rm1 >> 32U) + c;
+#endif
+    }
+
+    //*************************************************************************
+    /// Multiply and fold the 128 bit result to 64 bits.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint64_t mix(uint64_t a, uint64_t b)
+    {
+      multiply(a, b);
+
+      return a ^ b;
+    }
+
+    //*************************************************************************
+    /// Reads 8 little endian bytes.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 uint64_t read64(TIterator p)
+    {
+      uint64_t value = 0U;
+
+      for (int i = 7; i >= 0; --i)
+      {
+        value = (value << 8U) | static_cast<uint8_t>(p[i]);
+      }
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Reads 4 little endian bytes.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 uint64_t read32(TIterator p)
+    {
+      uint64_t value = 0U;
+
+      for (int i = 3; i >= 0; --i)
+      {
+        value = (value << 8U) | static_cast<uint8_t>(p[i]);
+      }
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Reads 1 to 3 bytes.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 uint64_t read_small(TIterator p, size_t length)
+    {
+      return (static_cast<uint64_t>(static_cast<uint8_t>(p[0])) << 16U) |
+             (static_cast<uint64_t>(static_cast<uint8_t>(p[length >> 1U])) << 8U) |
+              static_cast<uint64_t>(static_cast<uint8_t>(p[length - 1U]));
+    }
+
+    //*************************************************************************
+    /// Initial state for a seed.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint64_t initial(uint64_t seed)
+    {
+      return seed ^ mix(seed ^ Secret0, Secret1);
+    }
+
+    //*************************************************************************
+    /// Adds a 48 byte block to the state.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 void add_block(uint64_t& seed, uint64_t& see1, uint64_t& see2, TIterator p)
+    {
+      seed = mix(read64(p)      ^ Secret1, read64(p + 8)  ^ seed);
+      see1 = mix(read64(p + 16) ^ Secret2, read64(p + 24) ^ see1);
+      see2 = mix(read64(p + 32) ^ Secret3, read64(p + 40) ^ see2);
+    }
+
+    //*************************************************************************
+    /// Adds a 16 byte chunk to the state.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 uint64_t add_chunk(uint64_t seed, TIterator p)
+    {
+      return mix(read64(p) ^ Secret1, read64(p + 8) ^ seed);
+    }
+
+    //*************************************************************************
+    /// Final mix of the last two words.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint64_t finalise(uint64_t a, uint64_t b, uint64_t seed, uint64_t length)
+    {
+      a ^= Secret1;
+      b ^= seed;
+      multiply(a, b);
+
+      return mix(a ^ Secret0 ^ length, b ^ Secret1);
+    }
+
+    //*************************************************************************
+    /// Hashes 'length' bytes from a random access iterator.
+    //*************************************************************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14 uint64_t hash(TIterator p, size_t length, uint64_t seed)
+    {
+      seed = initial(seed);
+
+      uint64_t a = 0U;
+      uint64_t b = 0U;
+
+      if (length <= 16U)
+      {
+        if (length >= 4U)
+        {
+          const size_t offset = (length >> 3U) << 2U;
+
+          a = (read32(p) << 32U) | read32(p + offset);
+          b = (read32(p + (length - 4U)) << 32U) | read32(p + (length - 4U - offset));
+        }
+        else if (length > 0U)
+        {
+          a = read_small(p, length);
+        }
+      }
+      else
+      {
+        size_t i = length;
+
+        if (i >= 48U)
+        {
+          uint64_t see1 = seed;
+          uint64_t see2 = seed;
+
+          do
+          {
+            add_block(seed, see1, see2, p);
+            p += 48;
+            i -= 48U;
+          } while (i >= 48U);
+
+          seed ^= see1 ^ see2;
+        }
+
+        while (i > 16U)
+        {
+          seed = add_chunk(seed, p);
+          p += 16;
+          i -= 16U;
+        }
+
+        a = read64(p + (static_cast<ptrdiff_t>(i) - 16));
+        b = read64(p + (static_cast<ptrdiff_t>(i) - 8));
+      }
+
+      return finalise(a, b, seed, length);
+    }
+  }
+
+  //***************************************************************************
+  /// Calculates a 64 bit hash using the wyhash algorithm.
+  /// Reads a 64 bit word at a time, so is considerably faster than the
+  /// byte-at-a-time FNV-1a for all but the shortest keys.
+  /// Requires no heap and may be used in constexpr expressions from C++14.
+  /// Implements wyhash final version 4 with the default secret, and gives the
+  /// same values as the reference implementation for the same seed.
+  /// See https://github.com/wangyi-fudan/wyhash for more details.
+  ///\ingroup wyhash
+  //***************************************************************************
+  class wyhash
+  {
+  public:
+
+    typedef uint64_t value_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    ETL_CONSTEXPR14 wyhash(value_type seed_ = 0U)
+      : seed(seed_)
+      , state(0U)
+      , see1(0U)
+      , see2(0U)
+      , length(0U)
+      , buffer()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    ETL_CONSTEXPR14 wyhash(TIterator begin, const TIterator end, value_type seed_ = 0U)
+      : seed(seed_)
+      , state(0U)
+      , see1(0U)
+      , see2(0U)
+      , length(0U)
+      , buffer()
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+
+      reset();
+      add(begin, end);
+    }
+
+    //*************************************************************************
+    /// Resets the hash to the initial state.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void reset()
+    {
+      state  = private_wyhash::initial(seed);
+      see1   = state;
+      see2   = state;
+      length = 0U;
+    }
+
+    //*************************************************************************
+    /// Adds a range.
+    /// \param begin
+    /// \param end
+    //*************************************************************************
+    template<typename TIterator>
+    ETL_CONSTEXPR14 void add(TIterator begin, const TIterator end)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+
+      add_range(begin, end, etl::integral_constant<bool, etl::is_random_access_iterator<TIterator>::value>());
+    }
+
+    //*************************************************************************
+    /// Adds a uint8_t value.
+    /// \param value The char to add to the hash.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void add(uint8_t value_)
+    {
+      buffer[buffered()] = value_;
+      ++length;
+
+      if (buffered() == 0U)
+      {
+        private_wyhash::add_block(state, see1, see2, buffer);
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the hash value.
+    /// More data may still be added afterwards.
+    //*************************************************************************
+    ETL_CONSTEXPR14 value_type value() const
+    {
+      if (length <= Block_Size)
+      {
+        // All of the data is still in the buffer.
+        return private_wyhash::hash(buffer, static_cast<size_t>(length), seed);
+      }
+
+      // At least one block has been processed.
+      uint64_t s = state ^ see1 ^ see2;
+      size_t   i = buffered();
+      size_t   p = 0U;
+
+      while (i > 16U)
+      {
+        s = private_wyhash::add_chunk(s, buffer + p);
+        p += 16U;
+        i -= 16U;
+      }
+
+      // The last 16 bytes may straddle the previous block,
+      // the tail of which is still in the buffer.
+      uint8_t last[16] = {};
+
+      for (size_t j = 0U; j < 16U; ++j)
+      {
+        last[j] = buffer[(p + i + Block_Size - 16U + j) % Block_Size];
+      }
+
+      return private_wyhash::finalise(private_wyhash::read64(last), private_wyhash::read64(last + 8), s, length);
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    ETL_CONSTEXPR14 operator value_type () const
+    {
+      return value();
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Block_Size = 48U;
+
+    //*************************************************************************
+    /// The number of bytes waiting in the buffer.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t buffered() const
+    {
+      return static_cast<size_t>(length % Block_Size);
+    }
+
+    //*************************************************************************
+    /// Adds a range, one byte at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    ETL_CONSTEXPR14 void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        add(static_cast<uint8_t>(*begin));
+        ++begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range, processing whole blocks directly from the source.
+    //*************************************************************************
+    template<typename TIterator>
+    ETL_CONSTEXPR14 void add_range(TIterator begin, const TIterator end, etl::true_type)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+      const difference_type block_size = static_cast<difference_type>(Block_Size);
+
+      // Fill any partial block.
+      while ((buffered() != 0U) && (begin != end))
+      {
+        add(static_cast<uint8_t>(*begin));
+        ++begin;
+      }
+
+      if (begin == end)
+      {
+        return;
+      }
+
+      bool blocks_added = false;
+
+      // Always leave at least one byte, so that a full final block goes through the buffer.
+      while ((end - begin) > block_size)
+      {
+        private_wyhash::add_block(state, see1, see2, begin);
+        begin  += block_size;
+        length += Block_Size;
+        blocks_added = true;
+      }
+
+      // Copy the remainder, at most one block, to the buffer.
+      const size_t remaining = static_cast<size_t>(end - begin);
+
+      for (size_t i = 0U; i < remaining; ++i)
+      {
+        buffer[i] = static_cast<uint8_t>(begin[static_cast<difference_type>(i)]);
+      }
+
+      // The final calculation may read the tail of the last block.
+      if (blocks_added)
+      {
+        for (size_t i = remaining; i < Block_Size; ++i)
+        {
+          buffer[i] = static_cast<uint8_t>(begin[static_cast<difference_type>(i) - block_size]);
+        }
+      }
+
+      length += remaining;
+
+      if (remaining == Block_Size)
+      {
+        private_wyhash::add_block(state, see1, see2, buffer);
+      }
+    }
+
+    value_type seed;
+    value_type state;
+    value_type see1;
+    value_type see2;
+    uint64_t   length;
+    uint8_t    buffer[Block_Size];
+  };
+}
+
+#endif
+
+#endif
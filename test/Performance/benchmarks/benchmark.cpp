@@ -0,0 +1,254 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "benchmark.h"
+
+#include "etl/version.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+namespace
+{
+  volatile uint64_t    sink;
+  const void* volatile object_sink;
+
+  //***************************************************************************
+  /// Runs the benchmark once and returns the elapsed time in nanoseconds.
+  //***************************************************************************
+  double time_ns(etl_benchmark::function_t function, size_t repeat)
+  {
+    typedef std::chrono::steady_clock clock;
+
+    const clock::time_point start = clock::now();
+    etl_benchmark::do_not_optimise(function(repeat));
+    const clock::time_point finish = clock::now();
+
+    return double(std::chrono::duration_cast<std::chrono::nanoseconds>(finish - start).count());
+  }
+
+  //***************************************************************************
+  /// Finds the repeat count that takes at least the minimum sample time.
+  //***************************************************************************
+  size_t calibrate(etl_benchmark::function_t function, double min_ns)
+  {
+    const size_t Max_Repeat = 1000000000U;
+
+    size_t repeat = 1U;
+
+    while (true)
+    {
+      const double elapsed = time_ns(function, repeat);
+
+      if ((elapsed >= min_ns) || (repeat >= Max_Repeat))
+      {
+        return repeat;
+      }
+
+      // Aim a little beyond the minimum, growing by at least a factor of 2 and at most 100.
+      double factor = (elapsed > 0.0) ? (1.2 * min_ns / elapsed) : 100.0;
+      factor = std::min(std::max(factor, 2.0), 100.0);
+
+      repeat = std::min(size_t(double(repeat) * factor), Max_Repeat);
+    }
+  }
+
+  //***************************************************************************
+  /// Escapes a string for JSON.
+  //***************************************************************************
+  std::string escape(const std::string& text)
+  {
+    std::string result;
+
+    for (size_t i = 0U; i < text.size(); ++i)
+    {
+      const char c = text[i];
+
+      if ((c == '"') || (c == '\\'))
+      {
+        result += '\\';
+      }
+
+      result += c;
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  std::string format_double(double value)
+  {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.3f", value);
+
+    return buffer;
+  }
+
+  //***************************************************************************
+  std::string format_size(size_t value)
+  {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%lu", static_cast<unsigned long>(value));
+
+    return buffer;
+  }
+
+  //***************************************************************************
+  std::string compiler_name()
+  {
+#if defined(__clang__)
+    return std::string("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+    return std::string("gcc ") + __VERSION__;
+#elif defined(_MSC_VER)
+    return std::string("msvc ") + format_size(_MSC_VER);
+#else
+    return "unknown";
+#endif
+  }
+}
+
+namespace etl_benchmark
+{
+  //***************************************************************************
+  std::vector<benchmark>& registry()
+  {
+    static std::vector<benchmark> benchmarks;
+
+    return benchmarks;
+  }
+
+  //***************************************************************************
+  void do_not_optimise(uint64_t value)
+  {
+    sink = value;
+  }
+
+  //***************************************************************************
+  void do_not_optimise(const void* object)
+  {
+    object_sink = object;
+  }
+
+  //***************************************************************************
+  std::vector<result> run_all(const settings& s)
+  {
+    std::vector<result> results;
+
+    const std::vector<benchmark>& benchmarks = registry();
+
+    for (size_t i = 0U; i < benchmarks.size(); ++i)
+    {
+      const benchmark& b = benchmarks[i];
+      const std::string full_name = std::string(b.group) + "/" + b.name;
+
+      if (full_name.find(s.filter) == std::string::npos)
+      {
+        continue;
+      }
+
+      const size_t repeat     = calibrate(b.function, s.min_sample_time_ms * 1000000.0);
+      const size_t operations = repeat * b.operations;
+
+      std::vector<double> ns_per_op;
+
+      for (size_t sample = 0U; sample < s.samples; ++sample)
+      {
+        ns_per_op.push_back(time_ns(b.function, repeat) / double(operations));
+      }
+
+      std::sort(ns_per_op.begin(), ns_per_op.end());
+
+      result r;
+      r.group         = b.group;
+      r.name          = b.name;
+      r.operations    = operations;
+      r.samples       = s.samples;
+      r.ns_per_op     = ns_per_op[ns_per_op.size() / 2U];
+      r.min_ns_per_op = ns_per_op.front();
+      r.max_ns_per_op = ns_per_op.back();
+      r.mb_per_second = (b.bytes == 0U) ? 0.0 : (double(b.bytes) * 1000.0) / r.ns_per_op;
+
+      results.push_back(r);
+
+      fprintf(stderr, "%-48s %12.3f ns/op\n", full_name.c_str(), r.ns_per_op);
+    }
+
+    return results;
+  }
+
+  //***************************************************************************
+  std::string to_csv(const std::vector<result>& results)
+  {
+    std::string text = "group,name,operations,samples,ns_per_op,min_ns_per_op,max_ns_per_op,mb_per_second\n";
+
+    for (size_t i = 0U; i < results.size(); ++i)
+    {
+      const result& r = results[i];
+
+      text += r.group + "," + r.name + "," + format_size(r.operations) + "," + format_size(r.samples) + "," +
+              format_double(r.ns_per_op) + "," + format_double(r.min_ns_per_op) + "," + format_double(r.max_ns_per_op) + "," +
+              format_double(r.mb_per_second) + "\n";
+    }
+
+    return text;
+  }
+
+  //***************************************************************************
+  std::string to_json(const std::vector<result>& results)
+  {
+    std::string text = "{\n";
+
+    text += "  \"etl_version\": \"" ETL_VERSION "\",\n";
+    text += "  \"compiler\": \"" + escape(compiler_name()) + "\",\n";
+    text += "  \"cplusplus\": " + format_size(size_t(__cplusplus)) + ",\n";
+    text += "  \"benchmarks\": [\n";
+
+    for (size_t i = 0U; i < results.size(); ++i)
+    {
+      const result& r = results[i];
+
+      text += "    { \"group\": \"" + escape(r.group) + "\", \"name\": \"" + escape(r.name) + "\"" +
+              ", \"operations\": " + format_size(r.operations) +
+              ", \"samples\": " + format_size(r.samples) +
+              ", \"ns_per_op\": " + format_double(r.ns_per_op) +
+              ", \"min_ns_per_op\": " + format_double(r.min_ns_per_op) +
+              ", \"max_ns_per_op\": " + format_double(r.max_ns_per_op) +
+              ", \"mb_per_second\": " + format_double(r.mb_per_second) + " }";
+
+      text += (i + 1U < results.size()) ? ",\n" : "\n";
+    }
+
+    text += "  ]\n}\n";
+
+    return text;
+  }
+}
@@ -0,0 +1,191 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BENCHMARK_INCLUDED
+#define ETL_BENCHMARK_INCLUDED
+
+//*****************************************************************************
+// A minimal benchmark harness.
+//
+// A benchmark is a function that performs a unit of work 'repeat' times and
+// returns a value derived from the work, which stops the optimiser from
+// removing it. Benchmarks are registered with ETL_BENCHMARK and run by
+// etl_benchmark::run_all.
+//
+//   ETL_BENCHMARK(vector, push_back, 1000)
+//   {
+//     uint64_t sum = 0;
+//     for (size_t r = 0; r < repeat; ++r) { ... sum += ...; }
+//     return sum;
+//   }
+//
+// The third parameter is the number of operations performed per repeat. The
+// reported times are per operation.
+//*****************************************************************************
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+namespace etl_benchmark
+{
+  typedef uint64_t (*function_t)(size_t repeat);
+
+  //***************************************************************************
+  /// A registered benchmark.
+  //***************************************************************************
+  struct benchmark
+  {
+    const char* group;
+    const char* name;
+    function_t  function;
+    size_t      operations;
+    size_t      bytes;
+  };
+
+  //***************************************************************************
+  /// The measured result of a benchmark.
+  //***************************************************************************
+  struct result
+  {
+    std::string group;
+    std::string name;
+    size_t      operations;   ///< The total number of operations in each sample.
+    size_t      samples;
+    double      ns_per_op;    ///< The median of the samples.
+    double      min_ns_per_op;
+    double      max_ns_per_op;
+    double      mb_per_second; ///< Zero if the benchmark does not process bytes.
+  };
+
+  //***************************************************************************
+  /// The run settings.
+  //***************************************************************************
+  struct settings
+  {
+    settings()
+      : min_sample_time_ms(20.0)
+      , samples(5U)
+    {
+    }
+
+    std::string filter;
+    double      min_sample_time_ms;
+    size_t      samples;
+  };
+
+  //***************************************************************************
+  /// The list of registered benchmarks.
+  //***************************************************************************
+  std::vector<benchmark>& registry();
+
+  //***************************************************************************
+  /// Registers a benchmark at static initialisation.
+  //***************************************************************************
+  struct registrar
+  {
+    registrar(const char* group, const char* name, function_t function, size_t operations, size_t bytes = 0U)
+    {
+      benchmark b = { group, name, function, operations, bytes };
+      registry().push_back(b);
+    }
+  };
+
+  //***************************************************************************
+  /// Runs all of the benchmarks whose 'group/name' contains the filter.
+  //***************************************************************************
+  std::vector<result> run_all(const settings& s);
+
+  //***************************************************************************
+  /// Writes the results.
+  //***************************************************************************
+  std::string to_csv(const std::vector<result>& results);
+  std::string to_json(const std::vector<result>& results);
+
+  //***************************************************************************
+  /// Stops the optimiser from removing a value.
+  //***************************************************************************
+  void do_not_optimise(uint64_t value);
+
+  //***************************************************************************
+  /// Stops the optimiser from removing writes to an object.
+  /// Defined in a separate translation unit, so the object must be complete
+  /// at the point of the call.
+  //***************************************************************************
+  void do_not_optimise(const void* object);
+
+  //***************************************************************************
+  /// A deterministic pseudo random sequence, for generating test data.
+  //***************************************************************************
+  class random
+  {
+  public:
+
+    explicit random(uint32_t seed_ = 0x12345678UL)
+      : seed(seed_)
+    {
+    }
+
+    uint32_t operator()()
+    {
+      // xorshift32
+      seed ^= seed << 13U;
+      seed ^= seed >> 17U;
+      seed ^= seed << 5U;
+
+      return seed;
+    }
+
+  private:
+
+    uint32_t seed;
+  };
+}
+
+//*****************************************************************************
+/// Defines and registers a benchmark.
+/// The body receives 'size_t repeat' and returns a uint64_t.
+//*****************************************************************************
+#define ETL_BENCHMARK(GROUP, NAME, OPERATIONS) \
+  static uint64_t etl_benchmark_##GROUP##_##NAME(size_t repeat); \
+  static const etl_benchmark::registrar etl_benchmark_registrar_##GROUP##_##NAME(#GROUP, #NAME, &etl_benchmark_##GROUP##_##NAME, OPERATIONS); \
+  static uint64_t etl_benchmark_##GROUP##_##NAME(size_t repeat)
+
+//*****************************************************************************
+/// Defines and registers a benchmark that processes BYTES bytes per operation.
+//*****************************************************************************
+#define ETL_BENCHMARK_BYTES(GROUP, NAME, OPERATIONS, BYTES) \
+  static uint64_t etl_benchmark_##GROUP##_##NAME(size_t repeat); \
+  static const etl_benchmark::registrar etl_benchmark_registrar_##GROUP##_##NAME(#GROUP, #NAME, &etl_benchmark_##GROUP##_##NAME, OPERATIONS, BYTES); \
+  static uint64_t etl_benchmark_##GROUP##_##NAME(size_t repeat)
+
+#endif
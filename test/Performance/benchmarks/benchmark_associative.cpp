@@ -0,0 +1,292 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Associative container benchmarks, with std equivalents for comparison.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/map.h"
+#include "etl/set.h"
+#include "etl/flat_map.h"
+#include "etl/flat_set.h"
+#include "etl/unordered_map.h"
+#include "etl/unordered_set.h"
+#include "etl/flat_hash_map.h"
+#include "etl/flat_hash_set.h"
+#include "etl/soa_flat_map.h"
+
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <algorithm>
+
+namespace
+{
+  const size_t Size       = 1000U;
+  const size_t Large_Size = 10000U;
+
+  typedef etl::map<uint32_t, uint32_t, Size>           Etl_Map;
+  typedef etl::set<uint32_t, Size>                     Etl_Set;
+  typedef etl::flat_map<uint32_t, uint32_t, Size>      Etl_Flat_Map;
+  typedef etl::flat_set<uint32_t, Size>                Etl_Flat_Set;
+  typedef etl::unordered_map<uint32_t, uint32_t, Size> Etl_Unordered_Map;
+  typedef etl::unordered_set<uint32_t, Size>           Etl_Unordered_Set;
+  typedef etl::flat_hash_map<uint32_t, uint32_t, Size> Etl_Flat_Hash_Map;
+  typedef etl::flat_hash_set<uint32_t, Size>           Etl_Flat_Hash_Set;
+  typedef etl::soa_flat_map<uint32_t, uint32_t, Size>  Etl_Soa_Flat_Map;
+  typedef etl::soa_flat_map<uint32_t, uint32_t, Size, etl::less<uint32_t>, etl::soa_flat_search::eytzinger> Etl_Soa_Flat_Map_Eytzinger;
+
+  typedef etl::flat_map<uint32_t, uint32_t, Large_Size>      Etl_Flat_Map_Large;
+  typedef etl::flat_hash_map<uint32_t, uint32_t, Large_Size> Etl_Flat_Hash_Map_Large;
+  typedef etl::soa_flat_map<uint32_t, uint32_t, Large_Size>  Etl_Soa_Flat_Map_Large;
+  typedef etl::soa_flat_map<uint32_t, uint32_t, Large_Size, etl::less<uint32_t>, etl::soa_flat_search::eytzinger> Etl_Soa_Flat_Map_Eytzinger_Large;
+
+  //***************************************************************************
+  /// Makes 'count' keys, in a random order.
+  //***************************************************************************
+  std::vector<uint32_t> make_keys(size_t count)
+  {
+    std::vector<uint32_t> k;
+    etl_benchmark::random rng;
+
+    for (uint32_t i = 0U; i < count; ++i)
+    {
+      k.push_back(i * 7919U);
+    }
+
+    for (size_t i = count - 1U; i > 0U; --i)
+    {
+      std::swap(k[i], k[rng() % (i + 1U)]);
+    }
+
+    return k;
+  }
+
+  //***************************************************************************
+  /// The keys, in a random order.
+  //***************************************************************************
+  const std::vector<uint32_t>& keys()
+  {
+    static const std::vector<uint32_t> k = make_keys(Size);
+
+    return k;
+  }
+
+  //***************************************************************************
+  /// The keys for the large containers, in a random order.
+  //***************************************************************************
+  const std::vector<uint32_t>& large_keys()
+  {
+    static const std::vector<uint32_t> k = make_keys(Large_Size);
+
+    return k;
+  }
+
+  //***************************************************************************
+  /// Makes a value for a map.
+  //***************************************************************************
+  template <typename TContainer>
+  typename TContainer::value_type make_value(uint32_t key, typename TContainer::mapped_type*)
+  {
+    return typename TContainer::value_type(key, key);
+  }
+
+  //***************************************************************************
+  /// Makes a value for a set.
+  //***************************************************************************
+  template <typename TContainer>
+  typename TContainer::value_type make_value(uint32_t key, ...)
+  {
+    return key;
+  }
+
+  //***************************************************************************
+  template <typename TContainer>
+  void fill(TContainer& container, const std::vector<uint32_t>& k = keys())
+  {
+    for (size_t i = 0U; i < k.size(); ++i)
+    {
+      container.insert(make_value<TContainer>(k[i], 0));
+    }
+  }
+
+  //***************************************************************************
+  template <typename TContainer>
+  uint64_t insert(size_t repeat)
+  {
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      TContainer container;
+      fill(container);
+      sum += container.size();
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  template <typename TContainer>
+  uint64_t find(size_t repeat, const std::vector<uint32_t>& k = keys())
+  {
+    // Filled once, and kept off the stack.
+    static TContainer container;
+
+    if (container.empty())
+    {
+      fill(container, k);
+    }
+
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (size_t i = 0U; i < k.size(); ++i)
+      {
+        // Alternate hits and misses.
+        sum += container.count(k[i] + (i & 1U));
+      }
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  template <typename TContainer>
+  uint64_t insert_erase(size_t repeat)
+  {
+    TContainer container;
+
+    const std::vector<uint32_t>& k = keys();
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      fill(container);
+
+      for (size_t i = 0U; i < k.size(); ++i)
+      {
+        sum += container.erase(k[i]);
+      }
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  /// Keeps the container full, erasing the oldest key before each insert.
+  //***************************************************************************
+  template <typename TContainer>
+  uint64_t churn(size_t repeat)
+  {
+    // Filled once, and kept off the stack.
+    static TContainer container;
+    static uint32_t   next = 0U;
+
+    if (container.empty())
+    {
+      for (next = 0U; next < Large_Size; ++next)
+      {
+        container.insert(make_value<TContainer>(next * 7919U, 0));
+      }
+    }
+
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (size_t i = 0U; i < Large_Size; ++i)
+      {
+        sum += container.erase((next - Large_Size) * 7919U);
+        container.insert(make_value<TContainer>(next * 7919U, 0));
+        ++next;
+      }
+    }
+
+    return sum;
+  }
+}
+
+ETL_BENCHMARK(map, etl_insert, Size)       { return insert<Etl_Map>(repeat); }
+ETL_BENCHMARK(map, std_insert, Size)       { return insert<std::map<uint32_t, uint32_t> >(repeat); }
+ETL_BENCHMARK(map, etl_find, Size)         { return find<Etl_Map>(repeat); }
+ETL_BENCHMARK(map, std_find, Size)         { return find<std::map<uint32_t, uint32_t> >(repeat); }
+ETL_BENCHMARK(map, etl_insert_erase, Size) { return insert_erase<Etl_Map>(repeat); }
+ETL_BENCHMARK(map, std_insert_erase, Size) { return insert_erase<std::map<uint32_t, uint32_t> >(repeat); }
+
+ETL_BENCHMARK(set, etl_insert, Size)       { return insert<Etl_Set>(repeat); }
+ETL_BENCHMARK(set, std_insert, Size)       { return insert<std::set<uint32_t> >(repeat); }
+ETL_BENCHMARK(set, etl_find, Size)         { return find<Etl_Set>(repeat); }
+ETL_BENCHMARK(set, std_find, Size)         { return find<std::set<uint32_t> >(repeat); }
+
+ETL_BENCHMARK(flat_map, etl_insert, Size)       { return insert<Etl_Flat_Map>(repeat); }
+ETL_BENCHMARK(flat_map, etl_find, Size)         { return find<Etl_Flat_Map>(repeat); }
+ETL_BENCHMARK(flat_map, etl_insert_erase, Size) { return insert_erase<Etl_Flat_Map>(repeat); }
+
+ETL_BENCHMARK(flat_set, etl_insert, Size) { return insert<Etl_Flat_Set>(repeat); }
+ETL_BENCHMARK(flat_set, etl_find, Size)   { return find<Etl_Flat_Set>(repeat); }
+
+ETL_BENCHMARK(unordered_map, etl_insert, Size)       { return insert<Etl_Unordered_Map>(repeat); }
+ETL_BENCHMARK(unordered_map, std_insert, Size)       { return insert<std::unordered_map<uint32_t, uint32_t> >(repeat); }
+ETL_BENCHMARK(unordered_map, etl_find, Size)         { return find<Etl_Unordered_Map>(repeat); }
+ETL_BENCHMARK(unordered_map, std_find, Size)         { return find<std::unordered_map<uint32_t, uint32_t> >(repeat); }
+ETL_BENCHMARK(unordered_map, etl_insert_erase, Size) { return insert_erase<Etl_Unordered_Map>(repeat); }
+ETL_BENCHMARK(unordered_map, std_insert_erase, Size) { return insert_erase<std::unordered_map<uint32_t, uint32_t> >(repeat); }
+
+ETL_BENCHMARK(unordered_set, etl_insert, Size) { return insert<Etl_Unordered_Set>(repeat); }
+ETL_BENCHMARK(unordered_set, std_insert, Size) { return insert<std::unordered_set<uint32_t> >(repeat); }
+ETL_BENCHMARK(unordered_set, etl_find, Size)   { return find<Etl_Unordered_Set>(repeat); }
+ETL_BENCHMARK(unordered_set, std_find, Size)   { return find<std::unordered_set<uint32_t> >(repeat); }
+
+ETL_BENCHMARK(flat_hash_map, etl_insert, Size)       { return insert<Etl_Flat_Hash_Map>(repeat); }
+ETL_BENCHMARK(flat_hash_map, etl_find, Size)         { return find<Etl_Flat_Hash_Map>(repeat); }
+ETL_BENCHMARK(flat_hash_map, etl_insert_erase, Size) { return insert_erase<Etl_Flat_Hash_Map>(repeat); }
+
+ETL_BENCHMARK(flat_hash_set, etl_insert, Size) { return insert<Etl_Flat_Hash_Set>(repeat); }
+ETL_BENCHMARK(flat_hash_set, etl_find, Size)   { return find<Etl_Flat_Hash_Set>(repeat); }
+
+ETL_BENCHMARK(soa_flat_map, etl_insert, Size)                 { return insert<Etl_Soa_Flat_Map>(repeat); }
+ETL_BENCHMARK(soa_flat_map, etl_find, Size)                   { return find<Etl_Soa_Flat_Map>(repeat); }
+ETL_BENCHMARK(soa_flat_map, etl_insert_erase, Size)           { return insert_erase<Etl_Soa_Flat_Map>(repeat); }
+ETL_BENCHMARK(soa_flat_map, etl_eytzinger_insert, Size)       { return insert<Etl_Soa_Flat_Map_Eytzinger>(repeat); }
+ETL_BENCHMARK(soa_flat_map, etl_eytzinger_find, Size)         { return find<Etl_Soa_Flat_Map_Eytzinger>(repeat); }
+ETL_BENCHMARK(soa_flat_map, etl_eytzinger_insert_erase, Size) { return insert_erase<Etl_Soa_Flat_Map_Eytzinger>(repeat); }
+
+ETL_BENCHMARK(find_10k, etl_flat_map, Large_Size)               { return find<Etl_Flat_Map_Large>(repeat, large_keys()); }
+ETL_BENCHMARK(find_10k, etl_soa_flat_map, Large_Size)           { return find<Etl_Soa_Flat_Map_Large>(repeat, large_keys()); }
+ETL_BENCHMARK(find_10k, etl_soa_flat_map_eytzinger, Large_Size) { return find<Etl_Soa_Flat_Map_Eytzinger_Large>(repeat, large_keys()); }
+ETL_BENCHMARK(find_10k, std_map, Large_Size)                    { return find<std::map<uint32_t, uint32_t> >(repeat, large_keys()); }
+
+ETL_BENCHMARK(churn_full_10k, etl_flat_hash_map, Large_Size) { return churn<Etl_Flat_Hash_Map_Large>(repeat); }
+ETL_BENCHMARK(churn_full_10k, std_unordered_map, Large_Size) { return churn<std::unordered_map<uint32_t, uint32_t> >(repeat); }
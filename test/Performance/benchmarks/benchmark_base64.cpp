@@ -0,0 +1,172 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Base64 benchmarks.
+// Each operation encodes Block_Size bytes, or decodes them back again.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/base64_encoder.h"
+#include "etl/base64_decoder.h"
+
+namespace
+{
+  const size_t Block_Size = 1024U;
+
+  typedef etl::base64_rfc4648_padding_encoder<etl::base64_rfc4648_padding_encoder<>::safe_output_buffer_size(Block_Size)> encoder_type;
+  typedef etl::base64_rfc4648_padding_decoder<Block_Size> decoder_type;
+
+  //***************************************************************************
+  const uint8_t* block()
+  {
+    static uint8_t data[Block_Size];
+    static bool    initialised = false;
+
+    if (!initialised)
+    {
+      etl_benchmark::random rng;
+
+      for (size_t i = 0U; i < Block_Size; ++i)
+      {
+        data[i] = uint8_t(rng());
+      }
+
+      initialised = true;
+    }
+
+    return data;
+  }
+
+  //***************************************************************************
+  const encoder_type& encoded_block()
+  {
+    static encoder_type encoder;
+    static bool         initialised = false;
+
+    if (!initialised)
+    {
+      encoder.encode_final(block(), Block_Size);
+      initialised = true;
+    }
+
+    return encoder;
+  }
+
+  //***************************************************************************
+  uint64_t encode(size_t repeat)
+  {
+    const uint8_t* data = block();
+    encoder_type encoder;
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      encoder.restart();
+      encoder.encode_final(data, Block_Size);
+      sum += uint64_t(encoder.begin()[r % encoder.size()]);
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  uint64_t decode(size_t repeat)
+  {
+    const encoder_type& text = encoded_block();
+    decoder_type decoder;
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      decoder.restart();
+      decoder.decode_final(text.begin(), text.end());
+      sum += uint64_t(decoder.begin()[r % decoder.size()]);
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  /// Decodes one character at a time, as for input that is not contiguous.
+  //***************************************************************************
+  uint64_t decode_by_value(size_t repeat)
+  {
+    const encoder_type& text = encoded_block();
+    decoder_type decoder;
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      decoder.restart();
+
+      for (const char* p = text.begin(); p != text.end(); ++p)
+      {
+        decoder.decode(*p);
+      }
+
+      decoder.flush();
+      sum += uint64_t(decoder.begin()[r % decoder.size()]);
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  /// Encodes one byte at a time, as for input that is not contiguous.
+  //***************************************************************************
+  uint64_t encode_by_value(size_t repeat)
+  {
+    const uint8_t* data = block();
+    encoder_type encoder;
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      encoder.restart();
+
+      for (size_t i = 0U; i < Block_Size; ++i)
+      {
+        encoder.encode(data[i]);
+      }
+
+      encoder.flush();
+      sum += uint64_t(encoder.begin()[r % encoder.size()]);
+    }
+
+    return sum;
+  }
+}
+
+ETL_BENCHMARK_BYTES(base64, encode, 1U, Block_Size)          { return encode(repeat); }
+ETL_BENCHMARK_BYTES(base64, encode_by_value, 1U, Block_Size) { return encode_by_value(repeat); }
+ETL_BENCHMARK_BYTES(base64, decode, 1U, Block_Size)          { return decode(repeat); }
+ETL_BENCHMARK_BYTES(base64, decode_by_value, 1U, Block_Size) { return decode_by_value(repeat); }
@@ -0,0 +1,115 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Bitset scanning benchmarks.
+// A 4096 bit bitset used as a slot allocator, where finding the first free
+// slot is on the allocation path.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/bitset.h"
+
+namespace
+{
+  const size_t Slots = 4096U;
+
+  //***************************************************************************
+  /// Allocates and frees slots in a mostly full allocator.
+  /// The first free slot moves around the bitset, so each search covers a
+  /// varying number of full words.
+  //***************************************************************************
+  template <typename TElement>
+  uint64_t allocate(size_t repeat)
+  {
+    etl::bitset<Slots, TElement> slots;
+    etl_benchmark::random rng;
+    uint64_t sum = 0U;
+
+    slots.set();
+    slots.reset(Slots - 1U);
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      const size_t slot = slots.find_first(false);
+      slots.set(slot);
+      slots.reset(size_t(rng()) % Slots);
+      sum += slot;
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  template <typename TElement>
+  uint64_t count(size_t repeat)
+  {
+    etl::bitset<Slots, TElement> slots;
+    etl_benchmark::random rng;
+    uint64_t sum = 0U;
+
+    for (size_t i = 0U; i < Slots; ++i)
+    {
+      slots.set(i, (rng() & 1U) != 0U);
+    }
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      slots.flip(r % Slots);
+      sum += slots.count();
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  template <typename TElement>
+  uint64_t none(size_t repeat)
+  {
+    etl::bitset<Slots, TElement> slots;
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      slots.flip(Slots - 1U);
+      sum += slots.none() ? 1U : 0U;
+    }
+
+    return sum;
+  }
+}
+
+ETL_BENCHMARK(bitset, allocate_uint8, 1U)  { return allocate<uint8_t>(repeat); }
+ETL_BENCHMARK(bitset, allocate_uint64, 1U) { return allocate<uint64_t>(repeat); }
+ETL_BENCHMARK(bitset, count_uint8, 1U)     { return count<uint8_t>(repeat); }
+ETL_BENCHMARK(bitset, count_uint64, 1U)    { return count<uint64_t>(repeat); }
+ETL_BENCHMARK(bitset, none_uint8, 1U)      { return none<uint8_t>(repeat); }
+ETL_BENCHMARK(bitset, none_uint64, 1U)     { return none<uint64_t>(repeat); }
@@ -0,0 +1,169 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Checksum, CRC and hash benchmarks.
+// Each operation processes one block of Block_Size bytes.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/crc8_ccitt.h"
+#include "etl/crc16_ccitt.h"
+#include "etl/crc32.h"
+#include "etl/crc32_c.h"
+#include "etl/crc64_ecma.h"
+#include "etl/fnv_1.h"
+#include "etl/jenkins.h"
+#include "etl/murmur3.h"
+#include "etl/wyhash.h"
+#include "etl/hash.h"
+#include "etl/string.h"
+
+namespace
+{
+  const size_t Block_Size = 1024U;
+
+  //***************************************************************************
+  const uint8_t* block()
+  {
+    static uint32_t storage[Block_Size / sizeof(uint32_t)];
+    uint8_t* data = reinterpret_cast<uint8_t*>(storage);
+    static bool    initialised = false;
+
+    if (!initialised)
+    {
+      etl_benchmark::random rng;
+
+      for (size_t i = 0U; i < Block_Size; ++i)
+      {
+        data[i] = uint8_t(rng());
+      }
+
+      initialised = true;
+    }
+
+    return data;
+  }
+
+  //***************************************************************************
+  template <typename TChecksum>
+  uint64_t checksum(size_t repeat)
+  {
+    const uint8_t* data = block();
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      sum += TChecksum(data, data + Block_Size).value();
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  uint64_t hash_integers(size_t repeat)
+  {
+    const uint32_t* data = reinterpret_cast<const uint32_t*>(block());
+    const size_t    n    = Block_Size / sizeof(uint32_t);
+
+    etl::hash<uint32_t> hasher;
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        sum += hasher(data[i] + uint32_t(sum));
+      }
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  uint64_t hash_strings(size_t repeat)
+  {
+    etl::string<32> text("etl::hash<etl::string<32>>");
+    etl::hash<etl::istring> hasher;
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      text[0] = char(r);
+      sum += hasher(text);
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  /// Hashes short, string sized keys.
+  //***************************************************************************
+  template <typename THash>
+  uint64_t hash_keys(size_t repeat)
+  {
+    char key[] = "etl::hash<etl::string<32>>";
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      key[0] = char(r);
+      sum += THash(key, key + sizeof(key) - 1U).value();
+    }
+
+    return sum;
+  }
+}
+
+ETL_BENCHMARK_BYTES(crc, crc8_ccitt_t256, 1U, Block_Size)  { return checksum<etl::crc8_ccitt_t256>(repeat); }
+ETL_BENCHMARK_BYTES(crc, crc16_ccitt_t256, 1U, Block_Size) { return checksum<etl::crc16_ccitt_t256>(repeat); }
+ETL_BENCHMARK_BYTES(crc, crc32_t4, 1U, Block_Size)         { return checksum<etl::crc32_t4>(repeat); }
+ETL_BENCHMARK_BYTES(crc, crc32_t16, 1U, Block_Size)        { return checksum<etl::crc32_t16>(repeat); }
+ETL_BENCHMARK_BYTES(crc, crc32_t256, 1U, Block_Size)       { return checksum<etl::crc32_t256>(repeat); }
+#if ETL_USING_CPP14
+ETL_BENCHMARK_BYTES(crc, crc32_t2048, 1U, Block_Size)      { return checksum<etl::crc32_t2048>(repeat); }
+ETL_BENCHMARK_BYTES(crc, crc32_t4096, 1U, Block_Size)      { return checksum<etl::crc32_t4096>(repeat); }
+ETL_BENCHMARK_BYTES(crc, crc32_c_t2048, 1U, Block_Size)    { return checksum<etl::crc32_c_t2048>(repeat); }
+#endif
+ETL_BENCHMARK_BYTES(crc, crc32_c_t256, 1U, Block_Size)     { return checksum<etl::crc32_c_t256>(repeat); }
+ETL_BENCHMARK_BYTES(crc, crc64_ecma_t256, 1U, Block_Size)  { return checksum<etl::crc64_ecma_t256>(repeat); }
+
+ETL_BENCHMARK_BYTES(hash, fnv_1a_32, 1U, Block_Size)       { return checksum<etl::fnv_1a_32>(repeat); }
+ETL_BENCHMARK_BYTES(hash, fnv_1a_64, 1U, Block_Size)       { return checksum<etl::fnv_1a_64>(repeat); }
+ETL_BENCHMARK_BYTES(hash, jenkins, 1U, Block_Size)         { return checksum<etl::jenkins>(repeat); }
+ETL_BENCHMARK_BYTES(hash, murmur3_32, 1U, Block_Size)      { return checksum<etl::murmur3<uint32_t> >(repeat); }
+ETL_BENCHMARK_BYTES(hash, murmur3_x64_64, 1U, Block_Size)  { return checksum<etl::murmur3_x64_64>(repeat); }
+ETL_BENCHMARK_BYTES(hash, wyhash, 1U, Block_Size)          { return checksum<etl::wyhash>(repeat); }
+ETL_BENCHMARK(hash, fnv_1a_64_key, 1U)                     { return hash_keys<etl::fnv_1a_64>(repeat); }
+ETL_BENCHMARK(hash, wyhash_key, 1U)                        { return hash_keys<etl::wyhash>(repeat); }
+ETL_BENCHMARK(hash, murmur3_x64_64_key, 1U)                { return hash_keys<etl::murmur3_x64_64>(repeat); }
+ETL_BENCHMARK(hash, etl_hash_uint32, Block_Size / sizeof(uint32_t))           { return hash_integers(repeat); }
+ETL_BENCHMARK(hash, etl_hash_string, 1U)                   { return hash_strings(repeat); }
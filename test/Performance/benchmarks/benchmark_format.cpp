@@ -0,0 +1,283 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Text formatting and parsing benchmarks.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/string.h"
+#include "etl/to_string.h"
+#include "etl/string_stream.h"
+#include "etl/format.h"
+#include "etl/to_arithmetic.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace
+{
+  const size_t Count = 100U;
+
+  //***************************************************************************
+  template <typename T>
+  T value(size_t i)
+  {
+    return T(i * 7919U);
+  }
+
+  //***************************************************************************
+  // Sensor style readings with a fractional part.
+  template <>
+  double value<double>(size_t i)
+  {
+    return double(i * 7919U) / 1024.0 + 0.1;
+  }
+
+  //***************************************************************************
+  template <>
+  float value<float>(size_t i)
+  {
+    return float(i * 7919U) / 1024.0f + 0.1f;
+  }
+
+  //***************************************************************************
+  template <typename T>
+  uint64_t to_string(size_t repeat, const etl::format_spec& format)
+  {
+    etl::string<64> text;
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (size_t i = 0U; i < Count; ++i)
+      {
+        etl::to_string(value<T>(i + r), text, format);
+        sum += text.size();
+      }
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  uint64_t string_stream(size_t repeat)
+  {
+    etl::string<128> text;
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (size_t i = 0U; i < Count; ++i)
+      {
+        text.clear();
+        etl::string_stream stream(text);
+        stream << "value=" << int(i + r) << " hex=" << etl::hex << uint32_t(i * 7919U);
+        sum += text.size();
+      }
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  uint64_t snprintf_baseline(size_t repeat)
+  {
+    char text[128];
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (size_t i = 0U; i < Count; ++i)
+      {
+        sum += size_t(snprintf(text, sizeof(text), "value=%d hex=%x", int(i + r), unsigned(i * 7919U)));
+      }
+    }
+
+    return sum;
+  }
+
+#if ETL_USING_CPP11
+  //***************************************************************************
+  uint64_t format(size_t repeat)
+  {
+    etl::string<128> text;
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (size_t i = 0U; i < Count; ++i)
+      {
+        text.clear();
+        etl::format_to(text, "value={} hex={:x}", int(i + r), uint32_t(i * 7919U));
+        sum += text.size();
+      }
+    }
+
+    return sum;
+  }
+#endif
+
+  //***************************************************************************
+  // Numeric fields, as found in CSV log files.
+  struct fields
+  {
+    fields()
+    {
+      for (size_t i = 0U; i < Count; ++i)
+      {
+        snprintf(integer[i], sizeof(integer[i]), "%llu",  static_cast<unsigned long long>(i * 2654435761ULL * 7919U));
+        snprintf(hex[i],     sizeof(hex[i]),     "%08x",  static_cast<unsigned>(i * 2654435761U));
+        snprintf(real[i],    sizeof(real[i]),    "%.6f",  double(i * 7919U) / 1024.0 + 0.1);
+      }
+    }
+
+    char integer[Count][24];
+    char hex[Count][24];
+    char real[Count][24];
+  };
+
+  const fields& get_fields()
+  {
+    static const fields f;
+    return f;
+  }
+
+  //***************************************************************************
+  template <typename T>
+  uint64_t parse(size_t repeat, const char (&text)[Count][24], etl::radix::value_type radix)
+  {
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (size_t i = 0U; i < Count; ++i)
+      {
+        sum += uint64_t(etl::to_arithmetic<T>(etl::string_view(text[i]), radix).value());
+      }
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  uint64_t parse_double(size_t repeat)
+  {
+    double sum = 0.0;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (size_t i = 0U; i < Count; ++i)
+      {
+        sum += etl::to_arithmetic<double>(etl::string_view(get_fields().real[i])).value();
+      }
+    }
+
+    return uint64_t(sum);
+  }
+
+  //***************************************************************************
+  uint64_t strtoull_baseline(size_t repeat)
+  {
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (size_t i = 0U; i < Count; ++i)
+      {
+        sum += strtoull(get_fields().integer[i], ETL_NULLPTR, 10);
+      }
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  uint64_t strtod_baseline(size_t repeat)
+  {
+    double sum = 0.0;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (size_t i = 0U; i < Count; ++i)
+      {
+        sum += strtod(get_fields().real[i], ETL_NULLPTR);
+      }
+    }
+
+    return uint64_t(sum);
+  }
+
+#if ETL_USING_CPP14
+  //***************************************************************************
+  uint64_t format_constexpr(size_t repeat)
+  {
+    static constexpr etl::format_string<int, uint32_t> fmt("value={} hex={:x}");
+
+    etl::string<128> text;
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (size_t i = 0U; i < Count; ++i)
+      {
+        text.clear();
+        etl::format_to(text, fmt, int(i + r), uint32_t(i * 7919U));
+        sum += text.size();
+      }
+    }
+
+    return sum;
+  }
+#endif
+}
+
+ETL_BENCHMARK(to_string, int32_decimal, Count)  { return to_string<int32_t>(repeat, etl::format_spec()); }
+ETL_BENCHMARK(to_string, uint64_decimal, Count) { return to_string<uint64_t>(repeat, etl::format_spec()); }
+ETL_BENCHMARK(to_string, uint32_hex, Count)     { return to_string<uint32_t>(repeat, etl::format_spec().hex()); }
+ETL_BENCHMARK(to_string, double_fixed, Count)   { return to_string<double>(repeat, etl::format_spec().precision(6)); }
+ETL_BENCHMARK(to_string, double_shortest, Count) { return to_string<double>(repeat, etl::format_spec().shortest()); }
+ETL_BENCHMARK(to_string, float_shortest, Count)  { return to_string<float>(repeat, etl::format_spec().shortest()); }
+
+ETL_BENCHMARK(format, string_stream, Count)     { return string_stream(repeat); }
+ETL_BENCHMARK(format, snprintf, Count)          { return snprintf_baseline(repeat); }
+#if ETL_USING_CPP11
+ETL_BENCHMARK(format, format_to, Count)         { return format(repeat); }
+#endif
+#if ETL_USING_CPP14
+ETL_BENCHMARK(format, format_to_constexpr, Count) { return format_constexpr(repeat); }
+#endif
+
+ETL_BENCHMARK(parse, uint64_decimal, Count) { return parse<uint64_t>(repeat, get_fields().integer, etl::radix::decimal); }
+ETL_BENCHMARK(parse, uint32_hex, Count)     { return parse<uint32_t>(repeat, get_fields().hex, etl::radix::hexadecimal); }
+ETL_BENCHMARK(parse, double, Count)         { return parse_double(repeat); }
+ETL_BENCHMARK(parse, strtoull, Count)       { return strtoull_baseline(repeat); }
+ETL_BENCHMARK(parse, strtod, Count)         { return strtod_baseline(repeat); }
@@ -0,0 +1,250 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Message router benchmarks.
+// Measures the cost of dispatching a message through etl::imessage_router.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/message.h"
+#include "etl/message_router.h"
+
+namespace
+{
+  const size_t Count = 1000U;
+
+  template <etl::message_id_t Id>
+  struct Message : public etl::message<Id>
+  {
+  };
+
+  typedef Message<1> Message1;
+  typedef Message<2> Message2;
+  typedef Message<3> Message3;
+  typedef Message<4> Message4;
+  typedef Message<5> Message5;
+  typedef Message<6> Message6;
+  typedef Message<7> Message7;
+  typedef Message<8> Message8;
+
+  //***************************************************************************
+  class Router : public etl::message_router<Router, Message1, Message2, Message3, Message4, Message5, Message6, Message7, Message8>
+  {
+  public:
+
+    Router()
+      : message_router(1)
+      , sum(0U)
+    {
+    }
+
+    void on_receive(const Message1&) { sum += 1U; }
+    void on_receive(const Message2&) { sum += 2U; }
+    void on_receive(const Message3&) { sum += 3U; }
+    void on_receive(const Message4&) { sum += 4U; }
+    void on_receive(const Message5&) { sum += 5U; }
+    void on_receive(const Message6&) { sum += 6U; }
+    void on_receive(const Message7&) { sum += 7U; }
+    void on_receive(const Message8&) { sum += 8U; }
+
+    void on_receive_unknown(const etl::imessage&) { sum += 100U; }
+
+    uint64_t sum;
+  };
+
+  //***************************************************************************
+  uint64_t receive(size_t repeat, const etl::imessage* const* messages, size_t n)
+  {
+    Router router;
+    etl::imessage_router& irouter = router;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (size_t i = 0U; i < Count; ++i)
+      {
+        irouter.receive(*messages[i % n]);
+      }
+    }
+
+    return router.sum;
+  }
+
+  //***************************************************************************
+  // Routers for 40 message types.
+  //***************************************************************************
+  template <etl::message_id_t Id>
+  struct IdMessage : public etl::message<Id>
+  {
+  };
+
+  template <typename TIds>
+  class IdRouter;
+
+  template <etl::message_id_t... Ids>
+  class IdRouter<etl::integer_sequence<etl::message_id_t, Ids...>>
+    : public etl::message_router<IdRouter<etl::integer_sequence<etl::message_id_t, Ids...>>, IdMessage<Ids>...>
+  {
+  public:
+
+    using id_sequence = etl::integer_sequence<etl::message_id_t, Ids...>;
+    using lookup      = etl::private_message_router::message_id_lookup<typename IdRouter::sorted_message_types>;
+
+    IdRouter()
+      : sum(0U)
+    {
+    }
+
+    template <etl::message_id_t Id>
+    void on_receive(const IdMessage<Id>&) { sum += Id; }
+
+    void on_receive_unknown(const etl::imessage&) { sum += 1000U; }
+
+    uint64_t sum;
+  };
+
+  typedef IdRouter<etl::integer_sequence<etl::message_id_t,
+    1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U, 10U, 11U, 12U, 13U, 14U, 15U, 16U, 17U, 18U, 19U, 20U, 21U, 22U, 23U,
+    24U, 25U, 26U, 27U, 28U, 29U, 30U, 31U, 32U, 33U, 34U, 35U, 36U, 37U, 38U, 39U, 40U>> ContiguousRouter;
+
+  typedef IdRouter<etl::integer_sequence<etl::message_id_t,
+    1U, 3U, 5U, 7U, 9U, 11U, 13U, 15U, 17U, 19U, 21U, 23U, 25U, 27U, 29U, 31U, 33U, 35U, 37U, 39U, 41U, 43U,
+    45U, 47U, 49U, 51U, 53U, 55U, 57U, 59U, 61U, 63U, 65U, 67U, 69U, 71U, 73U, 75U, 77U, 79U>> DenseRouter;
+
+  typedef IdRouter<etl::integer_sequence<etl::message_id_t,
+    1U, 6U, 11U, 16U, 21U, 26U, 31U, 36U, 41U, 46U, 51U, 56U, 61U, 66U, 71U, 76U, 81U, 86U, 91U, 96U, 101U,
+    106U, 111U, 116U, 121U, 126U, 131U, 136U, 141U, 146U, 151U, 156U, 161U, 166U, 171U, 176U, 181U, 186U,
+    191U, 196U>> HashedRouter;
+
+  typedef IdRouter<etl::integer_sequence<etl::message_id_t,
+    1U, 3U, 20U, 21U, 35U, 37U, 38U, 42U, 45U, 46U, 59U, 67U, 71U, 72U, 91U, 94U, 97U, 102U, 106U, 107U,
+    110U, 114U, 124U, 136U, 140U, 150U, 168U, 174U, 180U, 209U, 212U, 221U, 226U, 230U, 234U, 235U, 248U,
+    249U, 250U, 254U>> SearchRouter;
+
+  static_assert(DenseRouter::lookup::Use_Dense_Table,   "Expected a dense table");
+  static_assert(HashedRouter::lookup::Use_Hash_Table,   "Expected a hash table");
+  static_assert(!SearchRouter::lookup::Use_Dense_Table && !SearchRouter::lookup::Use_Hash_Table, "Expected a binary search");
+
+  //***************************************************************************
+  template <etl::message_id_t Id>
+  const etl::imessage* get_message()
+  {
+    static const IdMessage<Id> message;
+    return &message;
+  }
+
+  //***************************************************************************
+  /// Sends the router's messages in a pseudo random order.
+  //***************************************************************************
+  template <etl::message_id_t... Ids>
+  uint64_t receive_all(size_t repeat, etl::integer_sequence<etl::message_id_t, Ids...>)
+  {
+    typedef IdRouter<etl::integer_sequence<etl::message_id_t, Ids...>> router_type;
+
+    const etl::imessage* const messages[] = { get_message<Ids>()... };
+    const size_t               n          = sizeof...(Ids);
+
+    static size_t order[Count];
+    static bool   initialised = false;
+
+    if (!initialised)
+    {
+      etl_benchmark::random random;
+
+      for (size_t i = 0U; i < Count; ++i)
+      {
+        order[i] = random() % n;
+      }
+
+      initialised = true;
+    }
+
+    router_type router;
+    etl::imessage_router& irouter = router;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (size_t i = 0U; i < Count; ++i)
+      {
+        irouter.receive(*messages[order[i]]);
+      }
+    }
+
+    return router.sum;
+  }
+
+  const Message1 message1;
+  const Message2 message2;
+  const Message3 message3;
+  const Message4 message4;
+  const Message5 message5;
+  const Message6 message6;
+  const Message7 message7;
+  const Message8 message8;
+}
+
+ETL_BENCHMARK(message_router, receive_first, Count)
+{
+  const etl::imessage* messages[] = { &message1 };
+  return receive(repeat, messages, 1U);
+}
+
+ETL_BENCHMARK(message_router, receive_last, Count)
+{
+  const etl::imessage* messages[] = { &message8 };
+  return receive(repeat, messages, 1U);
+}
+
+ETL_BENCHMARK(message_router, receive_mixed, Count)
+{
+  const etl::imessage* messages[] = { &message1, &message5, &message3, &message8, &message2, &message7, &message4, &message6 };
+  return receive(repeat, messages, 8U);
+}
+
+ETL_BENCHMARK(message_router, receive_40_contiguous_ids, Count)
+{
+  return receive_all(repeat, ContiguousRouter::id_sequence());
+}
+
+ETL_BENCHMARK(message_router, receive_40_dense_ids, Count)
+{
+  return receive_all(repeat, DenseRouter::id_sequence());
+}
+
+ETL_BENCHMARK(message_router, receive_40_hashed_ids, Count)
+{
+  return receive_all(repeat, HashedRouter::id_sequence());
+}
+
+ETL_BENCHMARK(message_router, receive_40_searched_ids, Count)
+{
+  return receive_all(repeat, SearchRouter::id_sequence());
+}
@@ -0,0 +1,367 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Pool benchmarks.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/pool.h"
+#include "etl/pool_atomic.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/magazine_memory_block_allocator.h"
+#include "etl/slab_memory_block_allocator.h"
+
+#include <mutex>
+
+namespace
+{
+  const size_t Items = 1024U;
+
+  struct Item
+  {
+    uint32_t id;
+    uint32_t data[3];
+  };
+
+  typedef etl::pool<Item, Items>       Pool;
+  typedef etl::pool<Item, Items, true> Occupancy_Pool;
+
+  typedef etl::fixed_sized_memory_block_allocator<sizeof(Item), alignof(Item), Items> Block_Allocator;
+
+  const size_t Burst = 8U;
+
+  //***************************************************************************
+  /// The shared allocator, locked for every call.
+  //***************************************************************************
+  class Locked_Allocator
+  {
+  public:
+
+    void* allocate()
+    {
+      std::lock_guard<std::mutex> guard(mutex);
+      return blocks.allocate(sizeof(Item), alignof(Item));
+    }
+
+    void release(void* p)
+    {
+      std::lock_guard<std::mutex> guard(mutex);
+      blocks.release(p);
+    }
+
+  private:
+
+    std::mutex      mutex;
+    Block_Allocator blocks;
+  };
+
+  //***************************************************************************
+  /// The shared allocator behind a magazine, locked to refill or flush.
+  //***************************************************************************
+  class Magazine_Allocator : public etl::magazine_memory_block_allocator<sizeof(Item), alignof(Item), 1U, 32U>
+  {
+  public:
+
+    Magazine_Allocator()
+      : magazine_memory_block_allocator(blocks)
+    {
+    }
+
+    void* allocate()
+    {
+      return magazine_memory_block_allocator::allocate(sizeof(Item), alignof(Item));
+    }
+
+  protected:
+
+    size_t thread_index() const override
+    {
+      return 0U;
+    }
+
+    void lock() override
+    {
+      mutex.lock();
+    }
+
+    void unlock() override
+    {
+      mutex.unlock();
+    }
+
+  private:
+
+    std::mutex      mutex;
+    Block_Allocator blocks;
+  };
+
+  //***************************************************************************
+  /// A pool with every other item allocated.
+  //***************************************************************************
+  template <typename TPool>
+  TPool& half_full_pool()
+  {
+    static TPool pool;
+
+    if (pool.empty())
+    {
+      Item* first = pool.allocate();
+
+      while (!pool.full())
+      {
+        pool.allocate()->id = 1U;
+      }
+
+      for (size_t i = 0U; i < Items; i += 2U)
+      {
+        pool.release(first + i);
+      }
+    }
+
+    return pool;
+  }
+
+  //***************************************************************************
+  /// Visits every allocated item.
+  //***************************************************************************
+  template <typename TPool>
+  uint64_t iterate(size_t repeat)
+  {
+    const TPool& pool = half_full_pool<TPool>();
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (typename TPool::const_iterator itr = pool.begin(); itr != pool.end(); ++itr)
+      {
+        sum += itr.template get<const Item>().id;
+      }
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  template <typename TPool>
+  uint64_t allocate_release(size_t repeat)
+  {
+    TPool& pool = half_full_pool<TPool>();
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      Item* p = pool.allocate();
+      p->id = uint32_t(r);
+      sum += p->id;
+      pool.release(p);
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  /// etl::pool, locked for every call.
+  //***************************************************************************
+  class Locked_Pool
+  {
+  public:
+
+    void* allocate()
+    {
+      std::lock_guard<std::mutex> guard(mutex);
+      return pool.allocate();
+    }
+
+    void release(void* p)
+    {
+      std::lock_guard<std::mutex> guard(mutex);
+      pool.release(static_cast<Item*>(p));
+    }
+
+  private:
+
+    std::mutex mutex;
+    Pool       pool;
+  };
+
+  //***************************************************************************
+  /// The lock free pool.
+  //***************************************************************************
+  class Atomic_Pool
+  {
+  public:
+
+    void* allocate()
+    {
+      return pool.allocate();
+    }
+
+    void release(void* p)
+    {
+      pool.release(static_cast<Item*>(p));
+    }
+
+  private:
+
+    etl::pool_atomic<Item, Items> pool;
+  };
+
+  //***************************************************************************
+  /// Allocates, then releases, a burst of blocks.
+  //***************************************************************************
+  template <typename TAllocator>
+  uint64_t allocate_release_burst(size_t repeat)
+  {
+    static TAllocator allocator;
+    void* blocks[Burst];
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (size_t i = 0U; i < Burst; ++i)
+      {
+        blocks[i] = allocator.allocate();
+        sum += (blocks[i] != ETL_NULLPTR) ? 1U : 0U;
+      }
+
+      for (size_t i = 0U; i < Burst; ++i)
+      {
+        allocator.release(blocks[i]);
+      }
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  /// Message sizes of a mixture of classes.
+  //***************************************************************************
+  const size_t Mixed_Sizes[Burst] = { 24U, 500U, 100U, 60U, 300U, 16U, 200U, 40U };
+
+  const size_t Blocks_Per_Size = 64U;
+
+  //***************************************************************************
+  /// One fixed sized allocator per size, linked as successors, smallest first.
+  //***************************************************************************
+  class Chained_Allocators
+  {
+  public:
+
+    Chained_Allocators()
+    {
+      b32.set_successor(b64);
+      b64.set_successor(b128);
+      b128.set_successor(b256);
+      b256.set_successor(b512);
+    }
+
+    void* allocate(size_t size)
+    {
+      return b32.allocate(size, alignof(uint64_t));
+    }
+
+    void release(void* p)
+    {
+      b32.release(p);
+    }
+
+  private:
+
+    etl::fixed_sized_memory_block_allocator<32U,  alignof(uint64_t), Blocks_Per_Size> b32;
+    etl::fixed_sized_memory_block_allocator<64U,  alignof(uint64_t), Blocks_Per_Size> b64;
+    etl::fixed_sized_memory_block_allocator<128U, alignof(uint64_t), Blocks_Per_Size> b128;
+    etl::fixed_sized_memory_block_allocator<256U, alignof(uint64_t), Blocks_Per_Size> b256;
+    etl::fixed_sized_memory_block_allocator<512U, alignof(uint64_t), Blocks_Per_Size> b512;
+  };
+
+  //***************************************************************************
+  /// One slab allocator with the same classes.
+  //***************************************************************************
+  class Slab_Allocator
+  {
+  public:
+
+    void* allocate(size_t size)
+    {
+      return slab.allocate(size, alignof(uint64_t));
+    }
+
+    void release(void* p)
+    {
+      slab.release(p);
+    }
+
+  private:
+
+    etl::slab_memory_block_allocator<32U, 5U, Blocks_Per_Size, alignof(uint64_t)> slab;
+  };
+
+  //***************************************************************************
+  /// Allocates, then releases, a burst of blocks of mixed sizes.
+  //***************************************************************************
+  template <typename TAllocator>
+  uint64_t allocate_release_mixed(size_t repeat)
+  {
+    static TAllocator allocator;
+    void* blocks[Burst];
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (size_t i = 0U; i < Burst; ++i)
+      {
+        blocks[i] = allocator.allocate(Mixed_Sizes[i]);
+        sum += (blocks[i] != ETL_NULLPTR) ? 1U : 0U;
+      }
+
+      for (size_t i = 0U; i < Burst; ++i)
+      {
+        allocator.release(blocks[i]);
+      }
+    }
+
+    return sum;
+  }
+}
+
+ETL_BENCHMARK(pool, iterate, Items / 2U)            { return iterate<Pool>(repeat); }
+ETL_BENCHMARK(pool, allocate_release, 1U)           { return allocate_release<Pool>(repeat); }
+ETL_BENCHMARK(pool, iterate_occupancy, Items / 2U)  { return iterate<Occupancy_Pool>(repeat); }
+ETL_BENCHMARK(pool, allocate_release_occupancy, 1U) { return allocate_release<Occupancy_Pool>(repeat); }
+
+ETL_BENCHMARK(memory_block_allocator, locked, 2U * Burst)        { return allocate_release_burst<Locked_Allocator>(repeat); }
+ETL_BENCHMARK(memory_block_allocator, magazine, 2U * Burst)      { return allocate_release_burst<Magazine_Allocator>(repeat); }
+ETL_BENCHMARK(memory_block_allocator, chained_mixed, 2U * Burst) { return allocate_release_mixed<Chained_Allocators>(repeat); }
+ETL_BENCHMARK(memory_block_allocator, slab_mixed, 2U * Burst)    { return allocate_release_mixed<Slab_Allocator>(repeat); }
+
+ETL_BENCHMARK(pool_shared, locked, 2U * Burst) { return allocate_release_burst<Locked_Pool>(repeat); }
+ETL_BENCHMARK(pool_shared, atomic, 2U * Burst) { return allocate_release_burst<Atomic_Pool>(repeat); }
@@ -0,0 +1,152 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Queue benchmarks.
+// Each repeat pushes a batch of items and then pops them, on one thread, so
+// the results show the cost of the operations without contention.
+// See ../queue_spsc and ../queue_mpmc for the multi-threaded benchmarks.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/queue.h"
+#include "etl/circular_buffer.h"
+#include "etl/queue_spsc_isr.h"
+#include "etl/queue_spsc_atomic.h"
+#include "etl/queue_mpmc_atomic.h"
+#include "etl/queue_mpmc_mutex.h"
+
+#include <queue>
+
+namespace
+{
+  const size_t Size  = 256U;
+  const size_t Batch = 200U;
+
+  //***************************************************************************
+  /// No locking is needed for a single thread.
+  //***************************************************************************
+  struct Access
+  {
+    static void lock()   {}
+    static void unlock() {}
+  };
+
+  //***************************************************************************
+  template <typename TQueue>
+  uint64_t push_pop(size_t repeat)
+  {
+    static TQueue queue;
+
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (uint32_t i = 0U; i < Batch; ++i)
+      {
+        queue.push(i);
+      }
+
+      for (uint32_t i = 0U; i < Batch; ++i)
+      {
+        uint32_t value = 0U;
+
+        if (queue.pop(value))
+        {
+          sum += value;
+        }
+      }
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  template <typename TQueue>
+  uint64_t push_pop_front(size_t repeat)
+  {
+    static TQueue queue;
+
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (uint32_t i = 0U; i < Batch; ++i)
+      {
+        queue.push(i);
+      }
+
+      for (uint32_t i = 0U; i < Batch; ++i)
+      {
+        sum += queue.front();
+        queue.pop();
+      }
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  uint64_t circular_buffer_push_pop(size_t repeat)
+  {
+    static etl::circular_buffer<uint32_t, Size> buffer;
+
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (uint32_t i = 0U; i < Batch; ++i)
+      {
+        buffer.push(i);
+      }
+
+      for (uint32_t i = 0U; i < Batch; ++i)
+      {
+        sum += buffer.front();
+        buffer.pop();
+      }
+    }
+
+    return sum;
+  }
+}
+
+ETL_BENCHMARK(queue, etl_queue, 2U * Batch)              { return push_pop_front<etl::queue<uint32_t, Size> >(repeat); }
+ETL_BENCHMARK(queue, std_queue, 2U * Batch)              { return push_pop_front<std::queue<uint32_t> >(repeat); }
+ETL_BENCHMARK(queue, etl_circular_buffer, 2U * Batch)    { return circular_buffer_push_pop(repeat); }
+ETL_BENCHMARK(queue, etl_queue_spsc_isr, 2U * Batch)     { return push_pop<etl::queue_spsc_isr<uint32_t, Size, Access> >(repeat); }
+ETL_BENCHMARK(queue, etl_queue_spsc_atomic, 2U * Batch)  { return push_pop<etl::queue_spsc_atomic<uint32_t, Size> >(repeat); }
+ETL_BENCHMARK(queue, etl_queue_spsc_atomic_cached, 2U * Batch)
+{
+  return push_pop<etl::queue_spsc_atomic<uint32_t, Size, etl::memory_model::MEMORY_MODEL_LARGE, etl::spsc_policy_cached> >(repeat);
+}
+ETL_BENCHMARK(queue, etl_queue_mpmc_atomic, 2U * Batch)  { return push_pop<etl::queue_mpmc_atomic<uint32_t, Size> >(repeat); }
+ETL_BENCHMARK(queue, etl_queue_mpmc_mutex, 2U * Batch)   { return push_pop<etl::queue_mpmc_mutex<uint32_t, Size> >(repeat); }
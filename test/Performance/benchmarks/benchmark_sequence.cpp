@@ -0,0 +1,162 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Sequence container benchmarks, with std equivalents for comparison.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/vector.h"
+#include "etl/deque.h"
+
+#include <vector>
+#include <deque>
+
+namespace
+{
+  const size_t Size = 1000U;
+
+  typedef etl::vector<uint32_t, Size> Etl_Vector;
+  typedef etl::deque<uint32_t, Size>  Etl_Deque;
+
+  //***************************************************************************
+  template <typename TContainer>
+  uint64_t push_back(size_t repeat)
+  {
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      TContainer container;
+
+      for (uint32_t i = 0U; i < Size; ++i)
+      {
+        container.push_back(i);
+      }
+
+      etl_benchmark::do_not_optimise(&container);
+      sum += container.back();
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  template <typename TContainer>
+  uint64_t iterate(size_t repeat)
+  {
+    TContainer container;
+
+    for (uint32_t i = 0U; i < Size; ++i)
+    {
+      container.push_back(i);
+    }
+
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (typename TContainer::const_iterator itr = container.begin(); itr != container.end(); ++itr)
+      {
+        sum += *itr;
+      }
+
+      etl_benchmark::do_not_optimise(sum);
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  template <typename TContainer>
+  uint64_t insert_erase_middle(size_t repeat)
+  {
+    TContainer container;
+
+    for (uint32_t i = 0U; i < (Size / 2U); ++i)
+    {
+      container.push_back(i);
+    }
+
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (uint32_t i = 0U; i < 100U; ++i)
+      {
+        container.insert(container.begin() + (container.size() / 2U), i);
+      }
+
+      for (uint32_t i = 0U; i < 100U; ++i)
+      {
+        sum += *container.erase(container.begin() + (container.size() / 2U));
+      }
+    }
+
+    return sum;
+  }
+
+  //***************************************************************************
+  template <typename TContainer>
+  uint64_t push_back_pop_front(size_t repeat)
+  {
+    TContainer container;
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (uint32_t i = 0U; i < Size; ++i)
+      {
+        container.push_back(i);
+      }
+
+      while (!container.empty())
+      {
+        sum += container.front();
+        container.pop_front();
+      }
+    }
+
+    return sum;
+  }
+}
+
+ETL_BENCHMARK(vector, etl_push_back, Size)       { return push_back<Etl_Vector>(repeat); }
+ETL_BENCHMARK(vector, std_push_back, Size)       { return push_back<std::vector<uint32_t> >(repeat); }
+ETL_BENCHMARK(vector, etl_iterate, Size)         { return iterate<Etl_Vector>(repeat); }
+ETL_BENCHMARK(vector, std_iterate, Size)         { return iterate<std::vector<uint32_t> >(repeat); }
+ETL_BENCHMARK(vector, etl_insert_erase_middle, 200U) { return insert_erase_middle<Etl_Vector>(repeat); }
+ETL_BENCHMARK(vector, std_insert_erase_middle, 200U) { return insert_erase_middle<std::vector<uint32_t> >(repeat); }
+
+ETL_BENCHMARK(deque, etl_push_back_pop_front, Size) { return push_back_pop_front<Etl_Deque>(repeat); }
+ETL_BENCHMARK(deque, std_push_back_pop_front, Size) { return push_back_pop_front<std::deque<uint32_t> >(repeat); }
+ETL_BENCHMARK(deque, etl_iterate, Size)             { return iterate<Etl_Deque>(repeat); }
+ETL_BENCHMARK(deque, std_iterate, Size)             { return iterate<std::deque<uint32_t> >(repeat); }
@@ -0,0 +1,165 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Sort benchmarks.
+// Compares etl::pdq_sort, the default etl::sort when the STL is not used,
+// with etl::shell_sort, etl::heap_sort, etl::radix_sort and std::sort over
+// random, sorted and sawtooth input, and the stable sorts etl::merge_sort,
+// with and without a scratch buffer, with std::stable_sort.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/algorithm.h"
+#include "etl/radix_sort.h"
+#include "etl/merge_sort.h"
+
+#include <algorithm>
+
+namespace
+{
+  const size_t Size = 50000U;
+
+  uint32_t source[Size];
+  uint32_t work[Size];
+  uint32_t scratch[Size];
+
+  //***************************************************************************
+  enum Pattern
+  {
+    Random,
+    Sorted,
+    Sawtooth
+  };
+
+  //***************************************************************************
+  void fill(Pattern pattern)
+  {
+    etl_benchmark::random random;
+
+    for (size_t i = 0U; i < Size; ++i)
+    {
+      switch (pattern)
+      {
+        case Random: source[i] = random();                 break;
+        case Sorted: source[i] = uint32_t(i);              break;
+        default:     source[i] = uint32_t(i % 1000U);      break;
+      }
+    }
+  }
+
+  //***************************************************************************
+  struct pdq_sort
+  {
+    static void sort(uint32_t* first, uint32_t* last) { etl::pdq_sort(first, last); }
+  };
+
+  struct shell_sort
+  {
+    static void sort(uint32_t* first, uint32_t* last) { etl::shell_sort(first, last); }
+  };
+
+  struct heap_sort
+  {
+    static void sort(uint32_t* first, uint32_t* last) { etl::heap_sort(first, last); }
+  };
+
+  struct radix_sort
+  {
+    static void sort(uint32_t* first, uint32_t* last) { etl::radix_sort(first, last, scratch); }
+  };
+
+  struct merge_sort
+  {
+    static void sort(uint32_t* first, uint32_t* last) { etl::merge_sort(first, last, etl::span<uint32_t>(scratch, Size / 2U)); }
+  };
+
+  struct merge_sort_in_place
+  {
+    static void sort(uint32_t* first, uint32_t* last) { etl::merge_sort(first, last, etl::span<uint32_t>()); }
+  };
+
+  struct std_stable_sort
+  {
+    static void sort(uint32_t* first, uint32_t* last) { std::stable_sort(first, last); }
+  };
+
+  struct std_sort
+  {
+    static void sort(uint32_t* first, uint32_t* last) { std::sort(first, last); }
+  };
+
+  //***************************************************************************
+  /// Sorts a fresh copy of the pattern each repeat.
+  //***************************************************************************
+  template <typename TSort>
+  uint64_t sort(Pattern pattern, size_t repeat)
+  {
+    fill(pattern);
+
+    uint64_t sum = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      std::copy(source, source + Size, work);
+      TSort::sort(work, work + Size);
+      sum += work[r % Size];
+    }
+
+    return sum;
+  }
+}
+
+ETL_BENCHMARK(sort, pdq_sort_random,     Size) { return sort<pdq_sort>(Random, repeat); }
+ETL_BENCHMARK(sort, shell_sort_random,   Size) { return sort<shell_sort>(Random, repeat); }
+ETL_BENCHMARK(sort, heap_sort_random,    Size) { return sort<heap_sort>(Random, repeat); }
+ETL_BENCHMARK(sort, radix_sort_random,   Size) { return sort<radix_sort>(Random, repeat); }
+ETL_BENCHMARK(sort, std_sort_random,     Size) { return sort<std_sort>(Random, repeat); }
+
+ETL_BENCHMARK(sort, pdq_sort_sorted,     Size) { return sort<pdq_sort>(Sorted, repeat); }
+ETL_BENCHMARK(sort, shell_sort_sorted,   Size) { return sort<shell_sort>(Sorted, repeat); }
+ETL_BENCHMARK(sort, heap_sort_sorted,    Size) { return sort<heap_sort>(Sorted, repeat); }
+ETL_BENCHMARK(sort, radix_sort_sorted,   Size) { return sort<radix_sort>(Sorted, repeat); }
+ETL_BENCHMARK(sort, std_sort_sorted,     Size) { return sort<std_sort>(Sorted, repeat); }
+
+ETL_BENCHMARK(sort, pdq_sort_sawtooth,   Size) { return sort<pdq_sort>(Sawtooth, repeat); }
+ETL_BENCHMARK(sort, shell_sort_sawtooth, Size) { return sort<shell_sort>(Sawtooth, repeat); }
+ETL_BENCHMARK(sort, heap_sort_sawtooth,  Size) { return sort<heap_sort>(Sawtooth, repeat); }
+ETL_BENCHMARK(sort, radix_sort_sawtooth, Size) { return sort<radix_sort>(Sawtooth, repeat); }
+ETL_BENCHMARK(sort, std_sort_sawtooth,   Size) { return sort<std_sort>(Sawtooth, repeat); }
+
+ETL_BENCHMARK(stable_sort, merge_sort_random,             Size) { return sort<merge_sort>(Random, repeat); }
+ETL_BENCHMARK(stable_sort, merge_sort_in_place_random,    Size) { return sort<merge_sort_in_place>(Random, repeat); }
+ETL_BENCHMARK(stable_sort, std_stable_sort_random,        Size) { return sort<std_stable_sort>(Random, repeat); }
+
+ETL_BENCHMARK(stable_sort, merge_sort_sawtooth,           Size) { return sort<merge_sort>(Sawtooth, repeat); }
+ETL_BENCHMARK(stable_sort, merge_sort_in_place_sawtooth,  Size) { return sort<merge_sort_in_place>(Sawtooth, repeat); }
+ETL_BENCHMARK(stable_sort, std_stable_sort_sawtooth,      Size) { return sort<std_stable_sort>(Sawtooth, repeat); }
@@ -0,0 +1,103 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Timer benchmarks.
+// Measures restarting timers, as a retransmission scheme would, with the
+// sorted list timers and the timing wheel timers.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include "etl/callback_timer_interrupt.h"
+#include "etl/callback_timer_wheel_interrupt.h"
+#include "etl/delegate.h"
+
+namespace
+{
+  const size_t        Count  = 1000U;
+  const uint_least8_t Timers = 200U;
+
+  //***************************************************************************
+  struct NoGuard
+  {
+  };
+
+  uint64_t expired = 0U;
+
+  void on_expired()
+  {
+    ++expired;
+  }
+
+  //***************************************************************************
+  /// Restarts a random timer, then ticks once.
+  //***************************************************************************
+  template <typename TTimer>
+  uint64_t restart(size_t repeat)
+  {
+    static TTimer timer;
+
+    typename TTimer::callback_type callback = TTimer::callback_type::template create<on_expired>();
+
+    timer.clear();
+
+    for (uint_least8_t i = 0U; i < Timers; ++i)
+    {
+      timer.start(timer.register_timer(callback, 100U + i, false));
+    }
+
+    timer.enable(true);
+
+    etl_benchmark::random random;
+    expired = 0U;
+
+    for (size_t r = 0U; r < repeat; ++r)
+    {
+      for (size_t i = 0U; i < Count; ++i)
+      {
+        timer.start(static_cast<etl::timer::id::type>(random() % Timers));
+        timer.tick(1U);
+      }
+    }
+
+    return expired;
+  }
+}
+
+ETL_BENCHMARK(timer, list_restart, Count)
+{
+  return restart<etl::callback_timer_interrupt<Timers, NoGuard> >(repeat);
+}
+
+ETL_BENCHMARK(timer, wheel_restart, Count)
+{
+  return restart<etl::callback_timer_wheel_interrupt<Timers, NoGuard, 256U> >(repeat);
+}
@@ -0,0 +1,52 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PROFILE_H_INCLUDED
+#define ETL_PROFILE_H_INCLUDED
+
+//*****************************************************************************
+// The profile used by the benchmarks.
+// Uses the library defaults, without the extra checks enabled by the unit
+// tests, so that the results reflect a typical release build.
+//*****************************************************************************
+
+#include "../../../include/etl/profiles/determine_compiler_language_support.h"
+#include "../../../include/etl/profiles/determine_compiler_version.h"
+#include "../../../include/etl/profiles/determine_development_os.h"
+
+#if defined(ETL_DEVELOPMENT_OS_WINDOWS)
+  #define ETL_TARGET_OS_WINDOWS
+#elif defined(ETL_DEVELOPMENT_OS_LINUX)
+  #define ETL_TARGET_OS_LINUX
+#else
+  #define ETL_TARGET_OS_GENERIC
+#endif
+
+#endif
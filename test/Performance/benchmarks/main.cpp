@@ -0,0 +1,150 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// The ETL benchmark suite.
+//
+// Usage: etl_benchmarks [--format=csv|json] [--output=<file>] [--filter=<text>]
+//                       [--min-time=<ms>] [--samples=<n>] [--list]
+//
+// Runs every benchmark whose 'group/name' contains the filter text and writes
+// the results as CSV (the default) or JSON, to stdout or the output file.
+// Progress is written to stderr. Times are the median of the samples, in
+// nanoseconds per operation.
+//*****************************************************************************
+
+#include "benchmark.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+namespace
+{
+  //***************************************************************************
+  bool get_option(const char* arg, const char* name, std::string& value)
+  {
+    const size_t length = strlen(name);
+
+    if (strncmp(arg, name, length) == 0)
+    {
+      value = arg + length;
+      return true;
+    }
+
+    return false;
+  }
+
+  //***************************************************************************
+  void usage()
+  {
+    fprintf(stderr, "Usage: etl_benchmarks [--format=csv|json] [--output=<file>] [--filter=<text>] [--min-time=<ms>] [--samples=<n>] [--list]\n");
+  }
+}
+
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  etl_benchmark::settings s;
+  std::string format = "csv";
+  std::string output;
+  bool        list = false;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    std::string value;
+
+    if (get_option(argv[i], "--format=", format))
+    {
+    }
+    else if (get_option(argv[i], "--output=", output))
+    {
+    }
+    else if (get_option(argv[i], "--filter=", s.filter))
+    {
+    }
+    else if (get_option(argv[i], "--min-time=", value))
+    {
+      s.min_sample_time_ms = atof(value.c_str());
+    }
+    else if (get_option(argv[i], "--samples=", value))
+    {
+      s.samples = size_t(atoi(value.c_str()));
+    }
+    else if (strcmp(argv[i], "--list") == 0)
+    {
+      list = true;
+    }
+    else
+    {
+      usage();
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (((format != "csv") && (format != "json")) || (s.samples == 0U))
+  {
+    usage();
+    return EXIT_FAILURE;
+  }
+
+  if (list)
+  {
+    const std::vector<etl_benchmark::benchmark>& benchmarks = etl_benchmark::registry();
+
+    for (size_t i = 0U; i < benchmarks.size(); ++i)
+    {
+      printf("%s/%s\n", benchmarks[i].group, benchmarks[i].name);
+    }
+
+    return EXIT_SUCCESS;
+  }
+
+  const std::vector<etl_benchmark::result> results = etl_benchmark::run_all(s);
+  const std::string text = (format == "json") ? etl_benchmark::to_json(results) : etl_benchmark::to_csv(results);
+
+  FILE* file = output.empty() ? stdout : fopen(output.c_str(), "w");
+
+  if (file == NULL)
+  {
+    fprintf(stderr, "Cannot open %s\n", output.c_str());
+    return EXIT_FAILURE;
+  }
+
+  fputs(text.c_str(), file);
+
+  if (file != stdout)
+  {
+    fclose(file);
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,157 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Contention benchmark for etl::queue_mpmc_mutex and etl::queue_mpmc_atomic.
+//
+// Usage: queue_mpmc_benchmark [producers] [consumers] [items per producer]
+//
+// Each configuration is run with the same number of producers and consumers
+// hammering a single queue. The result is the number of items transferred per
+// second, which is the figure that collapses when the mutex starts to convoy.
+//*****************************************************************************
+
+#include "etl/queue_mpmc_mutex.h"
+#include "etl/queue_mpmc_atomic.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  const size_t Queue_Size = 256U;
+
+  //***************************************************************************
+  template <typename TQueue>
+  double run(TQueue& queue, size_t producers, size_t consumers, size_t items_per_producer)
+  {
+    const size_t total = producers * items_per_producer;
+
+    std::atomic<size_t> remaining(total);
+    std::atomic<bool>   start(false);
+    std::atomic<size_t> checksum(0U);
+
+    std::vector<std::thread> threads;
+
+    for (size_t p = 0U; p < producers; ++p)
+    {
+      threads.emplace_back([&, p]()
+      {
+        while (!start.load(std::memory_order_acquire)) {}
+
+        for (size_t i = 0U; i < items_per_producer; ++i)
+        {
+          const size_t value = (p * items_per_producer) + i;
+
+          while (!queue.push(value))
+          {
+            std::this_thread::yield();
+          }
+        }
+      });
+    }
+
+    for (size_t c = 0U; c < consumers; ++c)
+    {
+      threads.emplace_back([&]()
+      {
+        size_t sum = 0U;
+
+        while (!start.load(std::memory_order_acquire)) {}
+
+        while (remaining.load(std::memory_order_relaxed) != 0U)
+        {
+          size_t value;
+
+          if (queue.pop(value))
+          {
+            sum += value;
+            remaining.fetch_sub(1U, std::memory_order_relaxed);
+          }
+          else
+          {
+            std::this_thread::yield();
+          }
+        }
+
+        checksum.fetch_add(sum);
+      });
+    }
+
+    const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+
+    for (size_t i = 0U; i < threads.size(); ++i)
+    {
+      threads[i].join();
+    }
+
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    if (checksum.load() != ((total * (total - 1U)) / 2U))
+    {
+      std::printf("Checksum error!\n");
+      std::exit(EXIT_FAILURE);
+    }
+
+    const double seconds = std::chrono::duration<double>(end - begin).count();
+
+    return double(total) / seconds;
+  }
+}
+
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  const size_t max_producers      = (argc > 1) ? size_t(std::atoi(argv[1])) : 8U;
+  const size_t max_consumers      = (argc > 2) ? size_t(std::atoi(argv[2])) : 8U;
+  const size_t items_per_producer = (argc > 3) ? size_t(std::atoi(argv[3])) : 1000000U;
+
+  static etl::queue_mpmc_mutex<size_t, Queue_Size>  queue_mutex;
+  static etl::queue_mpmc_atomic<size_t, Queue_Size> queue_atomic;
+
+  std::printf("producers,consumers,mutex items/s,atomic items/s,ratio\n");
+
+  for (size_t producers = 1U; producers <= max_producers; producers *= 2U)
+  {
+    const size_t consumers = (producers < max_consumers) ? producers : max_consumers;
+
+    const double mutex_rate  = run(queue_mutex,  producers, consumers, items_per_producer);
+    const double atomic_rate = run(queue_atomic, producers, consumers, items_per_producer);
+
+    std::printf("%zu,%zu,%.0f,%.0f,%.2f\n", producers, consumers, mutex_rate, atomic_rate, atomic_rate / mutex_rate);
+  }
+
+  return 0;
+}
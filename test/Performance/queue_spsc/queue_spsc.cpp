@@ -0,0 +1,287 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// Throughput benchmark for the SPSC layout policies.
+//
+// Usage: queue_spsc_benchmark [items]
+//
+// One producer thread and one consumer thread move the items through each
+// container, first with etl::spsc_policy_compact and then with
+// etl::spsc_policy_cached. The result is the number of items transferred per
+// second. The gain from the cached policy is only visible when the two
+// threads run on different cores.
+//*****************************************************************************
+
+#include "etl/queue_spsc_atomic.h"
+#include "etl/queue_spsc_isr.h"
+#include "etl/bip_buffer_spsc_atomic.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+  const size_t Queue_Size = 1024U;
+  const size_t Chunk_Size = 16U;
+
+  //***************************************************************************
+  /// A lock for queue_spsc_isr when used between threads.
+  //***************************************************************************
+  struct Access
+  {
+    static void lock()
+    {
+      mutex.lock();
+    }
+
+    static void unlock()
+    {
+      mutex.unlock();
+    }
+
+    static std::mutex mutex;
+  };
+
+  std::mutex Access::mutex;
+
+  //***************************************************************************
+  template <typename TProducer, typename TConsumer>
+  double run(TProducer producer, TConsumer consumer, size_t items)
+  {
+    std::atomic<bool> start(false);
+
+    std::thread producer_thread([&]()
+    {
+      while (!start.load(std::memory_order_acquire)) {}
+      producer(items);
+    });
+
+    std::thread consumer_thread([&]()
+    {
+      while (!start.load(std::memory_order_acquire)) {}
+
+      if (consumer(items) != ((items * (items - 1U)) / 2U))
+      {
+        std::printf("Checksum error!\n");
+        std::exit(EXIT_FAILURE);
+      }
+    });
+
+    const std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+
+    producer_thread.join();
+    consumer_thread.join();
+
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    return double(items) / std::chrono::duration<double>(end - begin).count();
+  }
+
+  //***************************************************************************
+  template <typename TQueue>
+  double run_queue(TQueue& queue, size_t items)
+  {
+    return run([&](size_t n)
+               {
+                 for (size_t i = 0U; i < n; ++i)
+                 {
+                   while (!queue.push(i))
+                   {
+                     std::this_thread::yield();
+                   }
+                 }
+               },
+               [&](size_t n)
+               {
+                 size_t sum = 0U;
+                 size_t value;
+
+                 for (size_t i = 0U; i < n; ++i)
+                 {
+                   while (!queue.pop(value))
+                   {
+                     std::this_thread::yield();
+                   }
+
+                   sum += value;
+                 }
+
+                 return sum;
+               },
+               items);
+  }
+
+  //***************************************************************************
+  template <typename TQueue>
+  double run_queue_batch(TQueue& queue, size_t items)
+  {
+    return run([&](size_t n)
+               {
+                 size_t data[Chunk_Size];
+                 size_t i = 0U;
+
+                 while (i < n)
+                 {
+                   const size_t count = ((n - i) < Chunk_Size) ? (n - i) : Chunk_Size;
+
+                   for (size_t j = 0U; j < count; ++j)
+                   {
+                     data[j] = i + j;
+                   }
+
+                   size_t pushed = queue.push(data, data + count);
+
+                   if (pushed == 0U)
+                   {
+                     std::this_thread::yield();
+                   }
+
+                   i += pushed;
+                 }
+               },
+               [&](size_t n)
+               {
+                 size_t sum = 0U;
+                 size_t data[Chunk_Size];
+                 size_t i = 0U;
+
+                 while (i < n)
+                 {
+                   size_t popped = queue.pop(data, Chunk_Size);
+
+                   if (popped == 0U)
+                   {
+                     std::this_thread::yield();
+                   }
+
+                   for (size_t j = 0U; j < popped; ++j)
+                   {
+                     sum += data[j];
+                   }
+
+                   i += popped;
+                 }
+
+                 return sum;
+               },
+               items);
+  }
+
+  //***************************************************************************
+  template <typename TBuffer>
+  double run_bip_buffer(TBuffer& buffer, size_t items)
+  {
+    return run([&](size_t n)
+               {
+                 size_t i = 0U;
+
+                 while (i < n)
+                 {
+                   etl::span<size_t> writer = buffer.write_reserve(((n - i) < Chunk_Size) ? (n - i) : Chunk_Size);
+
+                   if (writer.empty())
+                   {
+                     std::this_thread::yield();
+                   }
+
+                   for (size_t j = 0U; j < writer.size(); ++j)
+                   {
+                     writer[j] = i++;
+                   }
+
+                   buffer.write_commit(writer);
+                 }
+               },
+               [&](size_t n)
+               {
+                 size_t sum = 0U;
+                 size_t i = 0U;
+
+                 while (i < n)
+                 {
+                   etl::span<size_t> reader = buffer.read_reserve(Chunk_Size);
+
+                   if (reader.empty())
+                   {
+                     std::this_thread::yield();
+                   }
+
+                   for (size_t j = 0U; j < reader.size(); ++j)
+                   {
+                     sum += reader[j];
+                   }
+
+                   i += reader.size();
+                   buffer.read_commit(reader);
+                 }
+
+                 return sum;
+               },
+               items);
+  }
+
+  //***************************************************************************
+  void print(const char* name, double compact_rate, double cached_rate)
+  {
+    std::printf("%s,%.0f,%.0f,%.2f\n", name, compact_rate, cached_rate, cached_rate / compact_rate);
+  }
+
+  typedef etl::memory_model Memory_Model;
+
+  etl::queue_spsc_atomic<size_t, Queue_Size>                                                          queue_atomic_compact;
+  etl::queue_spsc_atomic<size_t, Queue_Size, Memory_Model::MEMORY_MODEL_LARGE, etl::spsc_policy_cached> queue_atomic_cached;
+
+  etl::queue_spsc_isr<size_t, Queue_Size, Access>                                                          queue_isr_compact;
+  etl::queue_spsc_isr<size_t, Queue_Size, Access, Memory_Model::MEMORY_MODEL_LARGE, etl::spsc_policy_cached> queue_isr_cached;
+
+  etl::bip_buffer_spsc_atomic<size_t, Queue_Size>                                                          bip_buffer_compact;
+  etl::bip_buffer_spsc_atomic<size_t, Queue_Size, Memory_Model::MEMORY_MODEL_LARGE, etl::spsc_policy_cached> bip_buffer_cached;
+}
+
+//*****************************************************************************
+int main(int argc, char* argv[])
+{
+  const size_t items = (argc > 1) ? size_t(std::atoi(argv[1])) : 10000000U;
+
+  std::printf("container,compact items/s,cached items/s,ratio\n");
+
+  print("queue_spsc_atomic",         run_queue(queue_atomic_compact, items),       run_queue(queue_atomic_cached, items));
+  print("queue_spsc_atomic (batch)", run_queue_batch(queue_atomic_compact, items), run_queue_batch(queue_atomic_cached, items));
+  print("queue_spsc_isr",            run_queue(queue_isr_compact, items),          run_queue(queue_isr_cached, items));
+  print("bip_buffer_spsc_atomic",    run_bip_buffer(bip_buffer_compact, items),    run_bip_buffer(bip_buffer_cached, items));
+
+  return 0;
+}
@@ -59,6 +59,10 @@ SOFTWARE.
 #define ETL_POLYMORPHIC_FLAT_MULTIMAP
 #define ETL_POLYMORPHIC_FLAT_SET
 #define ETL_POLYMORPHIC_FLAT_MULTISET
+#define ETL_POLYMORPHIC_FLAT_HASH_MAP
+#define ETL_POLYMORPHIC_FLAT_HASH_SET
+#define ETL_POLYMORPHIC_SOA_FLAT_MAP
+#define ETL_POLYMORPHIC_SOA_FLAT_SET
 #define ETL_POLYMORPHIC_FORWARD_LIST
 #define ETL_POLYMORPHIC_LIST
 #define ETL_POLYMORPHIC_MAP
@@ -88,6 +92,7 @@ SOFTWARE.
   #define ETL_VECTOR_FORCE_CPP03_IMPLEMENTATION
   #define ETL_QUEUE_FORCE_CPP03_IMPLEMENTATION
   #define ETL_QUEUE_MPMC_MUTEX_FORCE_CPP03_IMPLEMENTATION
+  #define ETL_QUEUE_MPMC_ATOMIC_FORCE_CPP03_IMPLEMENTATION
   #define ETL_QUEUE_ISR_FORCE_CPP03_IMPLEMENTATION
   #define ETL_QUEUE_LOCKED_FORCE_CPP03_IMPLEMENTATION
   #define ETL_OPTIONAL_FORCE_CPP03_IMPLEMENTATION
@@ -31,6 +31,7 @@ SOFTWARE.
 #include "etl/algorithm.h"
 #include "etl/container.h"
 #include "etl/binary.h"
+#include "etl/list.h"
 
 #include "data.h"
 #include "iterators_for_unit_tests.h"
@@ -1984,6 +1985,43 @@ namespace
       CHECK(is_same);
     }
 
+    //*************************************************************************
+    TEST(stable_sort_large)
+    {
+      std::vector<NDC> initial_data;
+
+      for (int i = 0; i < 2000; ++i)
+      {
+        initial_data.push_back(NDC(int(urng() % 50), i));
+      }
+
+      std::vector<NDC> data1(initial_data);
+      std::vector<NDC> data2(initial_data);
+
+      std::stable_sort(data1.begin(), data1.end());
+      etl::stable_sort(data2.begin(), data2.end());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+      CHECK(is_same);
+    }
+
+#if ETL_NOT_USING_STL
+    //*************************************************************************
+    TEST(stable_sort_bidirectional_iterators)
+    {
+      std::vector<NDC> initial_data = { NDC(1, 1), NDC(2, 1), NDC(3, 1), NDC(2, 2), NDC(3, 2), NDC(4, 1), NDC(2, 3), NDC(3, 3), NDC(5, 1) };
+
+      std::vector<NDC> data1(initial_data);
+      etl::list<NDC, 9> data2(initial_data.begin(), initial_data.end());
+
+      std::stable_sort(data1.begin(), data1.end());
+      etl::stable_sort(data2.begin(), data2.end());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+      CHECK(is_same);
+    }
+#endif
+
     //*************************************************************************
     TEST(shell_sort_default)
     {
@@ -2026,6 +2064,122 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(pdq_sort_default)
+    {
+      std::vector<int> data(1000, 0);
+      std::iota(data.begin(), data.end(), 1);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        std::shuffle(data.begin(), data.end(), urng);
+
+        std::vector<int> data1 = data;
+        std::vector<int> data2 = data;
+
+        std::sort(data1.begin(), data1.end());
+        etl::pdq_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(pdq_sort_greater)
+    {
+      std::vector<int> data(1000, 0);
+      std::iota(data.begin(), data.end(), 1);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        std::shuffle(data.begin(), data.end(), urng);
+
+        std::vector<int> data1 = data;
+        std::vector<int> data2 = data;
+
+        std::sort(data1.begin(), data1.end(), std::greater<int>());
+        etl::pdq_sort(data2.begin(), data2.end(), std::greater<int>());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(pdq_sort_patterns)
+    {
+      const size_t sizes[] = { 0, 1, 2, 3, 23, 24, 25, 127, 128, 129, 500, 2000 };
+
+      for (size_t s = 0; s < ETL_ARRAY_SIZE(sizes); ++s)
+      {
+        const int size = int(sizes[s]);
+
+        for (int pattern = 0; pattern < 8; ++pattern)
+        {
+          std::vector<int> data(size);
+
+          for (int i = 0; i < size; ++i)
+          {
+            switch (pattern)
+            {
+              case 0:  data[i] = i;                                        break; // Sorted
+              case 1:  data[i] = size - i;                                 break; // Reverse sorted
+              case 2:  data[i] = 42;                                       break; // All equal
+              case 3:  data[i] = i % 16;                                   break; // Sawtooth
+              case 4:  data[i] = (i < size / 2) ? i : size - i;            break; // Organ pipe
+              case 5:  data[i] = int(urng() % 4);                          break; // Few unique
+              case 6:  data[i] = (i == size / 2) ? -1 : i;                 break; // Sorted, one out of place
+              default: data[i] = ((i % 2) == 0) ? i : size + (size - i);   break; // Interleaved
+            }
+          }
+
+          std::vector<int> data1 = data;
+          std::vector<int> data2 = data;
+
+          std::sort(data1.begin(), data1.end());
+          etl::pdq_sort(data2.begin(), data2.end());
+
+          bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+          CHECK(is_same);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(pdq_sort_move_only)
+    {
+      std::vector<std::unique_ptr<int>> data;
+
+      for (int i = 0; i < 200; ++i)
+      {
+        data.push_back(std::unique_ptr<int>(new int((i * 37) % 200)));
+      }
+
+      etl::pdq_sort(data.begin(), data.end(), [](const std::unique_ptr<int>& lhs, const std::unique_ptr<int>& rhs) { return *lhs < *rhs; });
+
+      for (int i = 0; i < 200; ++i)
+      {
+        CHECK_EQUAL(i, *data[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(pdq_sort_c_array)
+    {
+      int data1[SIZE];
+      int data2[SIZE];
+
+      std::copy(std::begin(dataA), std::end(dataA), std::begin(data1));
+      std::copy(std::begin(dataA), std::end(dataA), std::begin(data2));
+
+      std::sort(std::begin(data1), std::end(data1));
+      etl::pdq_sort(std::begin(data2), std::end(data2));
+
+      bool is_same = std::equal(std::begin(data1), std::end(data1), std::begin(data2));
+      CHECK(is_same);
+    }
+
     //*************************************************************************
     TEST(insertion_sort_default)
     {
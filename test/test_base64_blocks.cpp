@@ -0,0 +1,275 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/base64_encoder.h"
+#include "etl/base64_decoder.h"
+
+#include <algorithm>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+
+// The selection of the block implementation is private to the header.
+#if defined(ETL_BASE64_USING_AVX2) || defined(ETL_BASE64_USING_SSSE3) || defined(ETL_BASE64_USING_NEON) || defined(ETL_BASE64_USING_SIMD)
+  #error The base64 block implementation macros leak out of base64_blocks.h
+#endif
+
+//*****************************************************************************
+// Cross checks the block encoding and decoding of contiguous input against
+// the value by value path taken by other iterators, and against a reference
+// encoder, for every character set.
+//*****************************************************************************
+
+namespace
+{
+  std::mt19937 urng(20260);
+
+  std::string   encoded_stream;
+  std::vector<unsigned char> decoded_stream;
+
+  //***************************************************************************
+  void encoded_callback(const etl::ibase64_encoder::span_type& sp)
+  {
+    encoded_stream.append(sp.begin(), sp.end());
+  }
+
+  //***************************************************************************
+  void decoded_callback(const etl::ibase64_decoder::span_type& sp)
+  {
+    decoded_stream.insert(decoded_stream.end(), sp.begin(), sp.end());
+  }
+
+  //***************************************************************************
+  std::vector<unsigned char> make_random(size_t size)
+  {
+    std::vector<unsigned char> data(size);
+
+    for (size_t i = 0U; i < size; ++i)
+    {
+      data[i] = static_cast<unsigned char>(urng());
+    }
+
+    return data;
+  }
+
+  //***************************************************************************
+  std::string reference_encode(const std::vector<unsigned char>& data, char c62, char c63, bool use_padding)
+  {
+    std::string table("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789");
+    table += c62;
+    table += c63;
+
+    std::string text;
+
+    for (size_t i = 0U; i < data.size(); i += 3U)
+    {
+      const size_t   remaining = std::min<size_t>(3U, data.size() - i);
+      const uint32_t octets    = (uint32_t(data[i]) << 16) |
+                                 ((remaining > 1U) ? (uint32_t(data[i + 1U]) << 8) : 0U) |
+                                 ((remaining > 2U) ? uint32_t(data[i + 2U]) : 0U);
+
+      for (size_t j = 0U; j <= remaining; ++j)
+      {
+        text += table[(octets >> (18U - (6U * j))) & 0x3FU];
+      }
+
+      if (use_padding)
+      {
+        text.append(3U - remaining, '=');
+      }
+    }
+
+    return text;
+  }
+
+  //***************************************************************************
+  template <typename TDecoder, typename TIterator>
+  bool decode_final(TDecoder& decoder, TIterator begin, TIterator end)
+  {
+#if ETL_USING_EXCEPTIONS
+    try
+    {
+      return decoder.decode_final(begin, end);
+    }
+    catch (const etl::base64_exception&)
+    {
+      return false;
+    }
+#else
+    return decoder.decode_final(begin, end);
+#endif
+  }
+
+  //***************************************************************************
+  template <template <size_t> class TEncoder>
+  void cross_check_encoder(char c62, char c63, bool use_padding)
+  {
+    for (size_t length = 0U; length < 400U; ++length)
+    {
+      const std::vector<unsigned char> data     = make_random(length);
+      const std::list<unsigned char>   list     = std::list<unsigned char>(data.begin(), data.end());
+      const std::string                expected = reference_encode(data, c62, c63, use_padding);
+
+      TEncoder<1024> by_length;
+      CHECK_TRUE(by_length.encode_final(data.data(), data.size()));
+      CHECK_EQUAL(expected, std::string(by_length.begin(), by_length.end()));
+
+      TEncoder<1024> by_range;
+      CHECK_TRUE(by_range.encode_final(data.data(), data.data() + data.size()));
+      CHECK_EQUAL(expected, std::string(by_range.begin(), by_range.end()));
+
+      TEncoder<1024> by_value;
+      CHECK_TRUE(by_value.encode_final(list.begin(), list.end()));
+      CHECK_EQUAL(expected, std::string(by_value.begin(), by_value.end()));
+
+      // Stream in random sized pieces through a small buffer.
+      encoded_stream.clear();
+      TEncoder<20> streaming(etl::ibase64_encoder::callback_type::create<encoded_callback>());
+
+      size_t i = 0U;
+
+      while (i < data.size())
+      {
+        const size_t piece = std::min<size_t>(urng() % 64U, data.size() - i);
+        CHECK_TRUE(streaming.encode(data.data() + i, piece));
+        i += piece;
+      }
+
+      CHECK_TRUE(streaming.flush());
+      CHECK_EQUAL(expected, encoded_stream);
+    }
+  }
+
+  //***************************************************************************
+  template <template <size_t> class TDecoder>
+  void cross_check_decoder(char c62, char c63, bool use_padding)
+  {
+    for (size_t length = 0U; length < 400U; ++length)
+    {
+      const std::vector<unsigned char> data = make_random(length);
+      const std::string                text = reference_encode(data, c62, c63, use_padding);
+      const std::list<char>            list = std::list<char>(text.begin(), text.end());
+
+      TDecoder<1024> by_length;
+      CHECK_TRUE(by_length.decode_final(text.data(), text.size()));
+      CHECK_TRUE(std::equal(data.begin(), data.end(), by_length.begin()));
+      CHECK_EQUAL(data.size(), by_length.size());
+
+      TDecoder<1024> by_range;
+      CHECK_TRUE(by_range.decode_final(text.data(), text.data() + text.size()));
+      CHECK_TRUE(std::equal(data.begin(), data.end(), by_range.begin()));
+      CHECK_EQUAL(data.size(), by_range.size());
+
+      TDecoder<1024> by_value;
+      CHECK_TRUE(by_value.decode_final(list.begin(), list.end()));
+      CHECK_TRUE(std::equal(data.begin(), data.end(), by_value.begin()));
+      CHECK_EQUAL(data.size(), by_value.size());
+
+      // Stream in random sized pieces through a small buffer.
+      decoded_stream.clear();
+      TDecoder<15> streaming(etl::ibase64_decoder::callback_type::create<decoded_callback>());
+
+      size_t i = 0U;
+
+      while (i < text.size())
+      {
+        const size_t piece = std::min<size_t>(urng() % 64U, text.size() - i);
+        CHECK_TRUE(streaming.decode(text.data() + i, piece));
+        i += piece;
+      }
+
+      CHECK_TRUE(streaming.flush());
+      CHECK_TRUE(decoded_stream == data);
+
+      // Corrupt one character and check that both paths stop in the same state.
+      if (!text.empty())
+      {
+        const char invalid[] = { '#', '=', '\x80', '\xFF', '\0', ' ' };
+
+        std::string corrupt = text;
+        corrupt[urng() % corrupt.size()] = invalid[urng() % sizeof(invalid)];
+
+        const std::list<char> corrupt_list(corrupt.begin(), corrupt.end());
+
+        TDecoder<1024> block_decoder;
+        TDecoder<1024> value_decoder;
+
+        const bool block_result = decode_final(block_decoder, corrupt.data(), corrupt.data() + corrupt.size());
+        const bool value_result = decode_final(value_decoder, corrupt_list.begin(), corrupt_list.end());
+
+        CHECK_EQUAL(value_result, block_result);
+        CHECK_EQUAL(value_decoder.invalid_data(), block_decoder.invalid_data());
+        CHECK_EQUAL(value_decoder.size(), block_decoder.size());
+        CHECK_TRUE(std::equal(value_decoder.begin(), value_decoder.end(), block_decoder.begin()));
+      }
+    }
+  }
+
+  SUITE(test_base64_blocks)
+  {
+    //*************************************************************************
+    TEST(test_encode_cross_check)
+    {
+      cross_check_encoder<etl::base64_rfc2152_encoder>('+', '/', false);
+      cross_check_encoder<etl::base64_rfc3501_encoder>('+', ',', false);
+      cross_check_encoder<etl::base64_rfc4648_encoder>('+', '/', false);
+      cross_check_encoder<etl::base64_rfc4648_padding_encoder>('+', '/', true);
+      cross_check_encoder<etl::base64_rfc4648_url_encoder>('-', '_', false);
+      cross_check_encoder<etl::base64_rfc4648_url_padding_encoder>('-', '_', true);
+    }
+
+    //*************************************************************************
+    TEST(test_decode_cross_check)
+    {
+      cross_check_decoder<etl::base64_rfc2152_decoder>('+', '/', false);
+      cross_check_decoder<etl::base64_rfc3501_decoder>('+', ',', false);
+      cross_check_decoder<etl::base64_rfc4648_decoder>('+', '/', false);
+      cross_check_decoder<etl::base64_rfc4648_padding_decoder>('+', '/', true);
+      cross_check_decoder<etl::base64_rfc4648_url_decoder>('-', '_', false);
+      cross_check_decoder<etl::base64_rfc4648_url_padding_decoder>('-', '_', true);
+    }
+
+    //*************************************************************************
+    TEST(test_decode_rejects_other_character_sets)
+    {
+      const std::string standard(64U, '/');
+      const std::string url(64U, '_');
+
+      etl::base64_rfc4648_url_decoder<64> url_decoder;
+      CHECK_FALSE(decode_final(url_decoder, standard.data(), standard.data() + standard.size()));
+      CHECK_TRUE(url_decoder.invalid_data());
+
+      etl::base64_rfc4648_decoder<64> standard_decoder;
+      CHECK_FALSE(decode_final(standard_decoder, url.data(), url.data() + url.size()));
+      CHECK_TRUE(standard_decoder.invalid_data());
+    }
+  }
+}
@@ -2501,6 +2501,14 @@ namespace
           break;
         }
       }
+
+      // Random values rarely have only the low 32 bits set.
+      for (int bit = 0; bit < 64; ++bit)
+      {
+        const uint64_t value = uint64_t(1U) << bit;
+
+        CHECK_EQUAL(63 - bit, int(etl::count_leading_zeros(value)));
+      }
     }
 
 #if ETL_USING_CPP14
@@ -451,6 +451,127 @@ namespace
       }
     }
 
+    //*************************************************************************
+    TEST(test_write_random_back_pressure_cached_policy)
+    {
+      // Deliberately seeded with fixed number, so that if it fails then always in the same way.
+      std::mt19937 mte(123);
+
+      constexpr size_t N = 256;
+      etl::bip_buffer_spsc_atomic<int, N, etl::memory_model::MEMORY_MODEL_LARGE, etl::spsc_policy_cached> stream;
+      etl::ibip_buffer_spsc_atomic<int, etl::memory_model::MEMORY_MODEL_LARGE, etl::spsc_policy_cached>& istream = stream;
+
+      CHECK(sizeof(stream) > (3 * ETL_CACHE_LINE_SIZE));
+
+      auto makeRandomNumber = [&mte](const size_t n) -> size_t { return mte() % n; };
+
+      int next_write = 0;
+      int next_read  = 0;
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        {
+          const size_t toWrite = makeRandomNumber(N / 16 + 1);
+          const auto reserve = istream.write_reserve(toWrite);
+          const auto written = makeRandomNumber(reserve.size() + 1);
+
+          for (size_t j = 0; j < written; ++j)
+          {
+            reserve[j] = next_write++;
+          }
+
+          istream.write_commit(reserve.first(written));
+        }
+
+        if (const size_t toRead = makeRandomNumber(N / 17 + 1))
+        {
+          const auto reserve = istream.read_reserve(toRead);
+          const auto read = makeRandomNumber(reserve.size() + 1);
+
+          for (size_t j = 0; j < read; ++j)
+          {
+            CHECK_EQUAL(next_read, reserve[j]);
+            ++next_read;
+          }
+
+          istream.read_commit(reserve.first(read));
+        }
+      }
+
+      for (auto reserve = istream.read_reserve(); reserve.size() > 0; reserve = istream.read_reserve())
+      {
+        for (size_t j = 0; j < reserve.size(); ++j)
+        {
+          CHECK_EQUAL(next_read, reserve[j]);
+          ++next_read;
+        }
+
+        istream.read_commit(reserve);
+      }
+
+      CHECK_EQUAL(next_write, next_read);
+      CHECK(istream.empty());
+    }
+
+    //*************************************************************************
+    etl::bip_buffer_spsc_atomic<int, 64, etl::memory_model::MEMORY_MODEL_LARGE, etl::spsc_policy_cached> cached_stream;
+
+    const int CACHED_LENGTH = 10000;
+
+    void cached_writer()
+    {
+      int value = 0;
+
+      while (value < CACHED_LENGTH)
+      {
+        const size_t remaining = size_t(CACHED_LENGTH - value);
+        auto writer = cached_stream.write_reserve((remaining < 7U) ? remaining : 7U);
+
+        if (writer.empty())
+        {
+          std::this_thread::yield();
+        }
+
+        for (auto& item : writer)
+        {
+          item = value++;
+        }
+
+        cached_stream.write_commit(writer);
+      }
+    }
+
+    TEST(bip_buffer_threads_cached_policy)
+    {
+      std::thread writer(cached_writer);
+
+      int  expected = 0;
+      bool in_order = true;
+
+      while (expected < CACHED_LENGTH)
+      {
+        etl::span<int> reader = cached_stream.read_reserve(11U);
+
+        if (reader.empty())
+        {
+          std::this_thread::yield();
+        }
+
+        for (size_t i = 0U; i < reader.size(); ++i)
+        {
+          in_order = in_order && (reader[i] == expected);
+          ++expected;
+        }
+
+        cached_stream.read_commit(reader);
+      }
+
+      writer.join();
+
+      CHECK(in_order);
+      CHECK(cached_stream.empty());
+    }
+
     //*************************************************************************
 #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
     #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
@@ -38,6 +38,11 @@ SOFTWARE.
 #include "etl/u16string.h"
 #include "etl/u32string.h"
 
+// The selection of the scan implementation is private to the header.
+#if defined(ETL_BITSET_USING_SSE2) || defined(ETL_BITSET_USING_NEON)
+  #error The bitset scan implementation macros leak out of bitset_new.h
+#endif
+
 namespace
 {
   using ull = unsigned long long;
@@ -2073,6 +2078,123 @@ namespace
       CHECK_EQUAL(4U, bs4find_next_true1);
     }
 
+    //*************************************************************************
+    template <size_t Size, typename TElement>
+    bool scanning_is_correct(const etl::bitset<Size, TElement>& bs)
+    {
+      size_t count = 0U;
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        count += bs.test(i) ? 1U : 0U;
+      }
+
+      bool correct = (bs.count() == count) &&
+                     (bs.any()   == (count != 0U)) &&
+                     (bs.none()  == (count == 0U)) &&
+                     (bs.all()   == (count == Size));
+
+      for (int state = 0; state < 2; ++state)
+      {
+        // The expected result of find_next(state, position) for every position, working backwards.
+        size_t expected = etl::bitset<Size, TElement>::npos;
+
+        for (size_t position = Size; position-- != 0U;)
+        {
+          if (bs.test(position) == (state == 1))
+          {
+            expected = position;
+          }
+
+          correct = correct && (bs.find_next(state == 1, position) == expected);
+        }
+
+        correct = correct && (bs.find_first(state == 1) == expected);
+        correct = correct && (bs.find_next(state == 1, Size) == etl::bitset<Size, TElement>::npos);
+      }
+
+      return correct;
+    }
+
+    //*************************************************************************
+    template <size_t Size, typename TElement>
+    bool scanning_patterns_are_correct()
+    {
+      etl::bitset<Size, TElement> bs;
+
+      // Empty, full and sparse, as for a slot allocator.
+      bool correct = scanning_is_correct(bs);
+      bs.set();
+      correct = correct && scanning_is_correct(bs);
+
+      bs.reset(Size - 1U);
+      correct = correct && scanning_is_correct(bs);
+      bs.reset(Size / 2U);
+      correct = correct && scanning_is_correct(bs);
+      bs.reset(0U);
+      correct = correct && scanning_is_correct(bs);
+
+      bs.reset();
+      bs.set(Size - 1U);
+      correct = correct && scanning_is_correct(bs);
+      bs.set(Size / 3U);
+      correct = correct && scanning_is_correct(bs);
+
+      // Pseudo random.
+      uint32_t seed = 12345U;
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        bs.set(i, ((seed >> 16U) & 7U) == 0U);
+      }
+
+      return correct && scanning_is_correct(bs);
+    }
+
+    //*************************************************************************
+    TEST(test_scanning_multi_element)
+    {
+      CHECK_TRUE((scanning_patterns_are_correct<4096U, uint8_t>()));
+      CHECK_TRUE((scanning_patterns_are_correct<4096U, uint16_t>()));
+      CHECK_TRUE((scanning_patterns_are_correct<4096U, uint32_t>()));
+      CHECK_TRUE((scanning_patterns_are_correct<4096U, uint64_t>()));
+      CHECK_TRUE((scanning_patterns_are_correct<1001U, uint8_t>()));
+      CHECK_TRUE((scanning_patterns_are_correct<1001U, uint16_t>()));
+      CHECK_TRUE((scanning_patterns_are_correct<1001U, uint32_t>()));
+      CHECK_TRUE((scanning_patterns_are_correct<1001U, uint64_t>()));
+      CHECK_TRUE((scanning_patterns_are_correct<72U, uint8_t>()));
+      CHECK_TRUE((scanning_patterns_are_correct<72U, uint64_t>()));
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    ETL_CONSTEXPR14 etl::bitset<1000> make_sparse_bitset()
+    {
+      etl::bitset<1000> bs;
+
+      bs.set();
+      bs.reset(777U);
+
+      return bs;
+    }
+
+    TEST(test_scanning_multi_element_constexpr)
+    {
+      constexpr etl::bitset<1000> bs = make_sparse_bitset();
+
+      constexpr size_t first_clear = bs.find_first(false);
+      constexpr size_t next_set    = bs.find_next(true, 777U);
+      constexpr size_t count       = bs.count();
+      constexpr bool   all         = bs.all();
+
+      CHECK_EQUAL(777U, first_clear);
+      CHECK_EQUAL(778U, next_set);
+      CHECK_EQUAL(999U, count);
+      CHECK_FALSE(all);
+    }
+#endif
+
     //*************************************************************************
     ETL_CONSTEXPR14 std::pair<etl::bitset<8>, etl::bitset<8>> test_swap_helper()
     {
@@ -0,0 +1,393 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/callback_timer_wheel_atomic.h"
+#include "etl/callback_timer_atomic.h"
+#include "etl/delegate.h"
+
+#if ETL_HAS_ATOMIC
+
+#include <vector>
+#include <atomic>
+#include <random>
+#include <utility>
+
+namespace
+{
+  uint64_t ticks = 0ULL;
+
+  typedef std::pair<int, uint64_t> Event;
+  typedef std::vector<Event>       Log;
+
+  //***************************************************************************
+  /// Records the id and time of each expiry.
+  //***************************************************************************
+  struct Recorder
+  {
+    Recorder(int id_, Log& log_)
+      : id(id_)
+      , p_log(&log_)
+    {
+    }
+
+    void operator()()
+    {
+      p_log->push_back(Event(id, ticks));
+    }
+
+    int  id;
+    Log* p_log;
+  };
+
+  // Four timers on a wheel of four slots, so that most periods wrap or lap the wheel.
+  using Controller          = etl::callback_timer_wheel_atomic<4, std::atomic_uint32_t, 4>;
+  using callback_type       = etl::icallback_timer_wheel_atomic<std::atomic_uint32_t>::callback_type;
+  using event_callback_type = etl::icallback_timer_wheel_atomic<std::atomic_uint32_t>::event_callback_type;
+
+  //***************************************************************************
+  /// Calls tick from an insert or remove callback.
+  //***************************************************************************
+  struct TickFromCallback
+  {
+    explicit TickFromCallback(Controller& controller_)
+      : controller(controller_)
+      , calls(0U)
+      , result(true)
+    {
+    }
+
+    void operator()(etl::timer::id::type)
+    {
+      ++calls;
+      result = controller.tick(1);
+    }
+
+    Controller& controller;
+    size_t      calls;
+    bool        result;
+  };
+
+  //***************************************************************************
+  /// Ticks one unit at a time.
+  //***************************************************************************
+  void tick_by_one(Controller& controller, uint32_t count)
+  {
+    for (uint32_t i = 0U; i < count; ++i)
+    {
+      ++ticks;
+      controller.tick(1U);
+    }
+  }
+
+  SUITE(test_callback_timer_wheel_atomic)
+  {
+    //*************************************************************************
+    TEST(callback_timer_wheel_atomic_register_unregister)
+    {
+      Controller controller;
+
+      Log log;
+      Recorder recorders[5] = { Recorder(0, log), Recorder(1, log), Recorder(2, log), Recorder(3, log), Recorder(4, log) };
+
+      etl::timer::id::type id0 = controller.register_timer(callback_type(recorders[0]), 1, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id1 = controller.register_timer(callback_type(recorders[1]), 1, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id2 = controller.register_timer(callback_type(recorders[2]), 1, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id3 = controller.register_timer(callback_type(recorders[3]), 1, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id4 = controller.register_timer(callback_type(recorders[4]), 1, etl::timer::mode::Single_Shot);
+
+      CHECK(id3 != etl::timer::id::NO_TIMER);
+      CHECK(id4 == etl::timer::id::NO_TIMER);
+
+      controller.start(id1);
+      CHECK_TRUE(controller.unregister_timer(id1));
+      CHECK_FALSE(controller.unregister_timer(id1));
+      CHECK_FALSE(controller.is_active(id1));
+      CHECK_FALSE(controller.has_active_timer());
+      CHECK_FALSE(controller.start(id1));
+      CHECK_FALSE(controller.start(etl::timer::id::NO_TIMER));
+
+      // The freed id is reused.
+      CHECK_EQUAL(id1, controller.register_timer(callback_type(recorders[4]), 1, etl::timer::mode::Single_Shot));
+
+      controller.start(id0);
+      controller.start(id2);
+      controller.clear();
+
+      CHECK_FALSE(controller.has_active_timer());
+      CHECK_EQUAL(0U, controller.register_timer(callback_type(recorders[0]), 1, etl::timer::mode::Single_Shot));
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_wheel_atomic_slot_wrap)
+    {
+      Controller controller;
+
+      Log log;
+      Recorder recorder0(0, log);
+      Recorder recorder1(1, log);
+
+      // Period 3 visits slots 3, 2, 1, 0, 3 ...
+      etl::timer::id::type id0 = controller.register_timer(callback_type(recorder0), 3, etl::timer::mode::Repeating);
+      etl::timer::id::type id1 = controller.register_timer(callback_type(recorder1), 5, etl::timer::mode::Repeating);
+
+      controller.enable(true);
+      controller.start(id0);
+      controller.start(id1);
+
+      ticks = 0U;
+      tick_by_one(controller, 16U);
+
+      // Equal expiry times fire in reverse order of insertion.
+      Log expected = { Event(0, 3), Event(1, 5), Event(0, 6), Event(0, 9), Event(1, 10), Event(0, 12), Event(0, 15), Event(1, 15) };
+      CHECK(log == expected);
+
+      // One tick that wraps the wheel twice fires every expiry in between.
+      log.clear();
+      ticks += 8U;
+      CHECK_TRUE(controller.tick(8U));
+
+      expected = { Event(0, 24), Event(1, 24), Event(0, 24), Event(0, 24) };
+      CHECK(log == expected);
+      CHECK_EQUAL(1U, controller.time_to_next());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_wheel_atomic_multi_lap)
+    {
+      Controller controller;
+
+      Log log;
+      Recorder recorder0(0, log);
+      Recorder recorder1(1, log);
+      Recorder recorder2(2, log);
+
+      // Period 9 shares slot 1 with times 1 and 5, period 4 is exactly one lap.
+      etl::timer::id::type id0 = controller.register_timer(callback_type(recorder0), 9,    etl::timer::mode::Single_Shot);
+      etl::timer::id::type id1 = controller.register_timer(callback_type(recorder1), 4,    etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = controller.register_timer(callback_type(recorder2), 1000, etl::timer::mode::Single_Shot);
+
+      controller.enable(true);
+      controller.start(id0);
+      controller.start(id1);
+      controller.start(id2);
+
+      ticks = 0U;
+      CHECK_EQUAL(4U, controller.time_to_next());
+
+      tick_by_one(controller, 8U);
+
+      Log expected = { Event(1, 4), Event(1, 8) };
+      CHECK(log == expected);
+      CHECK_EQUAL(1U, controller.time_to_next());
+
+      tick_by_one(controller, 1U);
+
+      expected.push_back(Event(0, 9));
+      CHECK(log == expected);
+      CHECK_FALSE(controller.is_active(id0));
+
+      controller.stop(id1);
+      CHECK_EQUAL(991U, controller.time_to_next());
+
+      // Many laps in one tick, stopping just short of the expiry.
+      ticks += 990U;
+      controller.tick(990U);
+      CHECK(log == expected);
+      CHECK_EQUAL(1U, controller.time_to_next());
+
+      tick_by_one(controller, 1U);
+
+      expected.push_back(Event(2, 1000));
+      CHECK(log == expected);
+      CHECK_FALSE(controller.has_active_timer());
+      CHECK_EQUAL(static_cast<uint32_t>(etl::timer::interval::No_Active_Interval), controller.time_to_next());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_wheel_atomic_cancel_restart_across_slots)
+    {
+      Controller controller;
+
+      Log log;
+      Recorder recorder0(0, log);
+      Recorder recorder1(1, log);
+
+      etl::timer::id::type id0 = controller.register_timer(callback_type(recorder0), 3, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id1 = controller.register_timer(callback_type(recorder1), 6, etl::timer::mode::Single_Shot);
+
+      controller.enable(true);
+      controller.start(id0);
+      controller.start(id1);
+
+      ticks = 0U;
+      tick_by_one(controller, 2U);
+
+      // Restarting moves the timer from slot 3 to slot 1.
+      controller.start(id0);
+      tick_by_one(controller, 1U);
+
+      CHECK(log.empty());
+      CHECK_EQUAL(2U, controller.time_to_next());
+
+      // Cancel the timer in slot 2.
+      controller.stop(id1);
+      tick_by_one(controller, 4U);
+
+      Log expected = { Event(0, 5) };
+      CHECK(log == expected);
+
+      // Restart with a new period that wraps, and one immediately.
+      controller.set_period(id1, 2U);
+      controller.start(id1);
+      controller.start(id0, etl::timer::start::Immediate);
+      tick_by_one(controller, 2U);
+
+      expected.push_back(Event(0, 8));
+      expected.push_back(Event(1, 9));
+      CHECK(log == expected);
+
+      // Unregistering removes the timer from its slot.
+      controller.start(id0);
+      CHECK_TRUE(controller.unregister_timer(id0));
+      tick_by_one(controller, 4U);
+
+      CHECK(log == expected);
+      CHECK_FALSE(controller.has_active_timer());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_wheel_atomic_tick_skipped_while_changing)
+    {
+      Controller controller;
+
+      Log      log;
+      Recorder recorder(0, log);
+      TickFromCallback tick_from_callback(controller);
+
+      etl::timer::id::type id0 = controller.register_timer(callback_type(recorder), 1, etl::timer::mode::Single_Shot);
+
+      controller.enable(true);
+
+      // The insert callback is called while the wheel is being changed.
+      controller.set_insert_callback(event_callback_type(tick_from_callback));
+      controller.start(id0);
+      controller.clear_insert_callback();
+
+      CHECK_EQUAL(1U, tick_from_callback.calls);
+      CHECK_FALSE(tick_from_callback.result);
+      CHECK(log.empty());
+
+      ++ticks;
+      CHECK_TRUE(controller.tick(1));
+      CHECK(log == Log{ Event(0, ticks) });
+
+      controller.enable(false);
+      CHECK_FALSE(controller.tick(1));
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_wheel_atomic_matches_list_timer)
+    {
+      const int Timers = 8;
+
+      etl::callback_timer_atomic<Timers, std::atomic_uint32_t>          list_controller;
+      etl::callback_timer_wheel_atomic<Timers, std::atomic_uint32_t, 8> wheel_controller;
+
+      Log list_log;
+      Log wheel_log;
+
+      std::vector<Recorder> list_recorders;
+      std::vector<Recorder> wheel_recorders;
+
+      for (int i = 0; i < Timers; ++i)
+      {
+        list_recorders.push_back(Recorder(i, list_log));
+        wheel_recorders.push_back(Recorder(i, wheel_log));
+      }
+
+      std::mt19937 rng(1234);
+
+      for (int i = 0; i < Timers; ++i)
+      {
+        uint32_t period = 1U + (rng() % 40U);
+        bool repeating  = (i % 2) == 0;
+
+        list_controller.register_timer(callback_type(list_recorders[i]), period, repeating);
+        wheel_controller.register_timer(callback_type(wheel_recorders[i]), period, repeating);
+      }
+
+      list_controller.enable(true);
+      wheel_controller.enable(true);
+
+      ticks = 0;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        etl::timer::id::type id = static_cast<etl::timer::id::type>(rng() % Timers);
+
+        switch (rng() % 4U)
+        {
+          case 0:
+          {
+            bool immediate = (rng() % 4U) == 0U;
+            list_controller.start(id, immediate);
+            wheel_controller.start(id, immediate);
+            break;
+          }
+
+          case 1:
+          {
+            list_controller.stop(id);
+            wheel_controller.stop(id);
+            break;
+          }
+
+          default:
+          {
+            // Mostly short ticks, with the occasional one of several laps.
+            uint32_t count = ((rng() % 50U) == 0U) ? (rng() % 500U) : (rng() % 10U);
+            ticks += count;
+            list_controller.tick(count);
+            wheel_controller.tick(count);
+            break;
+          }
+        }
+
+        CHECK_EQUAL(list_controller.time_to_next(), wheel_controller.time_to_next());
+        CHECK_EQUAL(list_controller.is_active(id), wheel_controller.is_active(id));
+      }
+
+      CHECK(!list_log.empty());
+      CHECK(list_log == wheel_log);
+    }
+  }
+}
+
+#endif
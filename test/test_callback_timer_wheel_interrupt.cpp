@@ -0,0 +1,331 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/callback_timer_wheel_interrupt.h"
+#include "etl/delegate.h"
+
+#include <vector>
+#include <utility>
+
+namespace
+{
+  uint64_t ticks = 0ULL;
+
+  //***************************************************************************
+  struct ScopedGuard
+  {
+    ScopedGuard()
+    {
+      ++guard_count;
+    }
+
+    ~ScopedGuard()
+    {
+      --guard_count;
+    }
+
+    static int guard_count;
+  };
+
+  int ScopedGuard::guard_count = 0;
+
+  typedef std::pair<int, uint64_t> Event;
+  typedef std::vector<Event>       Log;
+
+  //***************************************************************************
+  /// Records the id and time of each expiry.
+  //***************************************************************************
+  struct Recorder
+  {
+    Recorder(int id_, Log& log_)
+      : id(id_)
+      , p_log(&log_)
+    {
+    }
+
+    void operator()()
+    {
+      p_log->push_back(Event(id, ticks));
+    }
+
+    int  id;
+    Log* p_log;
+  };
+
+  // Four timers on a wheel of four slots, so that most periods wrap or lap the wheel.
+  using Controller          = etl::callback_timer_wheel_interrupt<4, ScopedGuard, 4>;
+  using callback_type       = etl::icallback_timer_wheel_interrupt<ScopedGuard>::callback_type;
+  using event_callback_type = etl::icallback_timer_wheel_interrupt<ScopedGuard>::event_callback_type;
+
+  //***************************************************************************
+  /// Checks that insert and remove callbacks are called under the guard.
+  //***************************************************************************
+  struct GuardCount
+  {
+    GuardCount()
+      : calls(0U)
+      , guarded(0U)
+    {
+    }
+
+    void operator()(etl::timer::id::type)
+    {
+      ++calls;
+
+      if (ScopedGuard::guard_count == 1)
+      {
+        ++guarded;
+      }
+    }
+
+    size_t calls;
+    size_t guarded;
+  };
+
+  //***************************************************************************
+  /// Ticks one unit at a time.
+  //***************************************************************************
+  void tick_by_one(Controller& controller, uint32_t count)
+  {
+    for (uint32_t i = 0U; i < count; ++i)
+    {
+      ++ticks;
+      controller.tick(1U);
+    }
+  }
+
+  SUITE(test_callback_timer_wheel_interrupt)
+  {
+    //*************************************************************************
+    TEST(callback_timer_wheel_interrupt_register_unregister)
+    {
+      Controller controller;
+
+      Log log;
+      Recorder recorders[5] = { Recorder(0, log), Recorder(1, log), Recorder(2, log), Recorder(3, log), Recorder(4, log) };
+
+      etl::timer::id::type id0 = controller.register_timer(callback_type(recorders[0]), 1, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id1 = controller.register_timer(callback_type(recorders[1]), 1, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id2 = controller.register_timer(callback_type(recorders[2]), 1, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id3 = controller.register_timer(callback_type(recorders[3]), 1, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id4 = controller.register_timer(callback_type(recorders[4]), 1, etl::timer::mode::Single_Shot);
+
+      CHECK(id3 != etl::timer::id::NO_TIMER);
+      CHECK(id4 == etl::timer::id::NO_TIMER);
+
+      controller.start(id1);
+      CHECK_TRUE(controller.unregister_timer(id1));
+      CHECK_FALSE(controller.unregister_timer(id1));
+      CHECK_FALSE(controller.is_active(id1));
+      CHECK_FALSE(controller.has_active_timer());
+      CHECK_FALSE(controller.start(id1));
+      CHECK_FALSE(controller.start(etl::timer::id::NO_TIMER));
+
+      // The freed id is reused.
+      CHECK_EQUAL(id1, controller.register_timer(callback_type(recorders[4]), 1, etl::timer::mode::Single_Shot));
+
+      controller.start(id0);
+      controller.start(id2);
+      controller.clear();
+
+      CHECK_FALSE(controller.has_active_timer());
+      CHECK_EQUAL(0U, controller.register_timer(callback_type(recorders[0]), 1, etl::timer::mode::Single_Shot));
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_wheel_interrupt_slot_wrap)
+    {
+      Controller controller;
+
+      Log log;
+      Recorder recorder0(0, log);
+      Recorder recorder1(1, log);
+
+      // Period 3 visits slots 3, 2, 1, 0, 3 ...
+      etl::timer::id::type id0 = controller.register_timer(callback_type(recorder0), 3, etl::timer::mode::Repeating);
+      etl::timer::id::type id1 = controller.register_timer(callback_type(recorder1), 5, etl::timer::mode::Repeating);
+
+      controller.enable(true);
+      controller.start(id0);
+      controller.start(id1);
+
+      ticks = 0U;
+      tick_by_one(controller, 16U);
+
+      // Equal expiry times fire in reverse order of insertion.
+      Log expected = { Event(0, 3), Event(1, 5), Event(0, 6), Event(0, 9), Event(1, 10), Event(0, 12), Event(0, 15), Event(1, 15) };
+      CHECK(log == expected);
+
+      // One tick that wraps the wheel twice fires every expiry in between.
+      log.clear();
+      ticks += 8U;
+      CHECK_TRUE(controller.tick(8U));
+
+      expected = { Event(0, 24), Event(1, 24), Event(0, 24), Event(0, 24) };
+      CHECK(log == expected);
+      CHECK_EQUAL(1U, controller.time_to_next());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_wheel_interrupt_multi_lap)
+    {
+      Controller controller;
+
+      Log log;
+      Recorder recorder0(0, log);
+      Recorder recorder1(1, log);
+      Recorder recorder2(2, log);
+
+      // Period 9 shares slot 1 with times 1 and 5, period 4 is exactly one lap.
+      etl::timer::id::type id0 = controller.register_timer(callback_type(recorder0), 9,    etl::timer::mode::Single_Shot);
+      etl::timer::id::type id1 = controller.register_timer(callback_type(recorder1), 4,    etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = controller.register_timer(callback_type(recorder2), 1000, etl::timer::mode::Single_Shot);
+
+      controller.enable(true);
+      controller.start(id0);
+      controller.start(id1);
+      controller.start(id2);
+
+      ticks = 0U;
+      CHECK_EQUAL(4U, controller.time_to_next());
+
+      tick_by_one(controller, 8U);
+
+      Log expected = { Event(1, 4), Event(1, 8) };
+      CHECK(log == expected);
+      CHECK_EQUAL(1U, controller.time_to_next());
+
+      tick_by_one(controller, 1U);
+
+      expected.push_back(Event(0, 9));
+      CHECK(log == expected);
+      CHECK_FALSE(controller.is_active(id0));
+
+      controller.stop(id1);
+      CHECK_EQUAL(991U, controller.time_to_next());
+
+      // Many laps in one tick, stopping just short of the expiry.
+      ticks += 990U;
+      controller.tick(990U);
+      CHECK(log == expected);
+      CHECK_EQUAL(1U, controller.time_to_next());
+
+      tick_by_one(controller, 1U);
+
+      expected.push_back(Event(2, 1000));
+      CHECK(log == expected);
+      CHECK_FALSE(controller.has_active_timer());
+      CHECK_EQUAL(static_cast<uint32_t>(etl::timer::interval::No_Active_Interval), controller.time_to_next());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_wheel_interrupt_cancel_restart_across_slots)
+    {
+      Controller controller;
+
+      Log log;
+      Recorder recorder0(0, log);
+      Recorder recorder1(1, log);
+
+      etl::timer::id::type id0 = controller.register_timer(callback_type(recorder0), 3, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id1 = controller.register_timer(callback_type(recorder1), 6, etl::timer::mode::Single_Shot);
+
+      controller.enable(true);
+      controller.start(id0);
+      controller.start(id1);
+
+      ticks = 0U;
+      tick_by_one(controller, 2U);
+
+      // Restarting moves the timer from slot 3 to slot 1.
+      controller.start(id0);
+      tick_by_one(controller, 1U);
+
+      CHECK(log.empty());
+      CHECK_EQUAL(2U, controller.time_to_next());
+
+      // Cancel the timer in slot 2.
+      controller.stop(id1);
+      tick_by_one(controller, 4U);
+
+      Log expected = { Event(0, 5) };
+      CHECK(log == expected);
+
+      // Restart with a new period that wraps, and one immediately.
+      controller.set_period(id1, 2U);
+      controller.start(id1);
+      controller.start(id0, etl::timer::start::Immediate);
+      tick_by_one(controller, 2U);
+
+      expected.push_back(Event(0, 8));
+      expected.push_back(Event(1, 9));
+      CHECK(log == expected);
+
+      // Unregistering removes the timer from its slot.
+      controller.start(id0);
+      CHECK_TRUE(controller.unregister_timer(id0));
+      tick_by_one(controller, 4U);
+
+      CHECK(log == expected);
+      CHECK_FALSE(controller.has_active_timer());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_wheel_interrupt_changes_are_guarded)
+    {
+      Controller controller;
+
+      Log      log;
+      Recorder recorder(0, log);
+      GuardCount guard_count;
+
+      etl::timer::id::type id0 = controller.register_timer(callback_type(recorder), 3, etl::timer::mode::Single_Shot);
+
+      controller.enable(true);
+      controller.set_insert_callback(event_callback_type(guard_count));
+      controller.set_remove_callback(event_callback_type(guard_count));
+
+      controller.start(id0);
+      controller.start(id0);
+      controller.stop(id0);
+
+      // Insert, remove and insert, remove.
+      CHECK_EQUAL(4U, guard_count.calls);
+      CHECK_EQUAL(4U, guard_count.guarded);
+      CHECK_EQUAL(0, ScopedGuard::guard_count);
+
+      controller.start(id0);
+      ticks += 3U;
+      CHECK_TRUE(controller.tick(3));
+      CHECK(log == Log{ Event(0, ticks) });
+      CHECK_EQUAL(0, ScopedGuard::guard_count);
+    }
+  }
+}
@@ -35,6 +35,7 @@ SOFTWARE.
 
 #include "etl/crc32_c.h"
 #include "etl/endianness.h"
+#include "etl/algorithm.h"
 
 //*****************************************************************************
 // The results for these tests were created from https://crccalc.com/
@@ -316,6 +317,168 @@ namespace
       uint32_t crc3 = etl::crc32_c_t4(data3.rbegin(), data3.rend());
       CHECK_EQUAL(crc1, crc3);
     }
+
+    //*************************************************************************
+    // Combine
+    //*************************************************************************
+    TEST(test_crc32_c_combine)
+    {
+      std::vector<uint8_t> data(67U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 37U) + 11U);
+      }
+
+      uint32_t expected = etl::crc32_c(data.begin(), data.end());
+
+      for (size_t split = 0UL; split <= data.size(); ++split)
+      {
+        uint32_t crc_a = etl::crc32_c(data.begin(), data.begin() + split);
+        uint32_t crc_b = etl::crc32_c(data.begin() + split, data.end());
+
+        uint32_t crc = etl::crc32_c::combine(crc_a, crc_b, data.size() - split);
+
+        CHECK_EQUAL(expected, crc);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c_combine_chunks)
+    {
+      std::vector<uint8_t> data(1000U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 131U) + 7U);
+      }
+
+      const size_t Chunk_Size = 128U;
+
+      uint32_t expected = etl::crc32_c(data.begin(), data.end());
+      uint32_t crc      = etl::crc32_c(data.begin(), data.begin() + Chunk_Size);
+
+      for (size_t start = Chunk_Size; start < data.size(); start += Chunk_Size)
+      {
+        size_t length = etl::min(Chunk_Size, data.size() - start);
+
+        uint32_t crc_chunk = etl::crc32_c(data.begin() + start, data.begin() + start + length);
+
+        crc = etl::crc_combine<etl::crc32_c>(crc, crc_chunk, length);
+      }
+
+      CHECK_EQUAL(expected, crc);
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    // Table size 2048 (slice-by-8)
+    //*************************************************************************
+    TEST(test_crc32_c_2048)
+    {
+      std::string data("123456789");
+
+      uint32_t crc = etl::crc32_c_t2048(data.begin(), data.end());
+
+      CHECK_EQUAL(0xE3069283UL, crc);
+    }
+
+#if !defined(ETL_CRC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_crc32_c_2048_constexpr)
+    {
+      constexpr char data[] = "123456789";
+      constexpr uint32_t crc = etl::crc32_c_t2048(data, data + 9);
+
+      CHECK_EQUAL(0xE3069283UL, crc);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_crc32_c_2048_matches_256_for_all_lengths)
+    {
+      std::vector<uint8_t> data(100U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 131U) + 7U);
+      }
+
+      for (size_t length = 0UL; length <= data.size(); ++length)
+      {
+        uint32_t expected = etl::crc32_c_t256(data.data(), data.data() + length);
+        uint32_t crc      = etl::crc32_c_t2048(data.data(), data.data() + length);
+
+        CHECK_EQUAL(expected, crc);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c_2048_add_values_matches_add_range)
+    {
+      std::vector<uint8_t> data(37U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = uint8_t(i);
+      }
+
+      etl::crc32_c_t2048 crc_calculator1;
+      etl::crc32_c_t2048 crc_calculator2;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        crc_calculator1.add(data[i]);
+      }
+
+      crc_calculator2.add(data.begin(), data.begin() + 5);
+      crc_calculator2.add(data.begin() + 5, data.end());
+
+      CHECK_EQUAL(crc_calculator1.value(), crc_calculator2.value());
+    }
+
+    //*************************************************************************
+    // Table size 4096 (slice-by-16)
+    //*************************************************************************
+    TEST(test_crc32_c_4096)
+    {
+      std::string data("123456789");
+
+      uint32_t crc = etl::crc32_c_t4096(data.begin(), data.end());
+
+      CHECK_EQUAL(0xE3069283UL, crc);
+    }
+
+#if !defined(ETL_CRC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_crc32_c_4096_constexpr)
+    {
+      constexpr char data[] = "123456789";
+      constexpr uint32_t crc = etl::crc32_c_t4096(data, data + 9);
+
+      CHECK_EQUAL(0xE3069283UL, crc);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_crc32_c_4096_matches_256_for_all_lengths)
+    {
+      std::vector<uint8_t> data(100U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 131U) + 7U);
+      }
+
+      for (size_t length = 0UL; length <= data.size(); ++length)
+      {
+        uint32_t expected = etl::crc32_c_t256(data.data(), data.data() + length);
+        uint32_t crc      = etl::crc32_c_t4096(data.data(), data.data() + length);
+
+        CHECK_EQUAL(expected, crc);
+      }
+    }
+#endif
   }
 }
 
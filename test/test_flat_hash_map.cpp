@@ -0,0 +1,819 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <map>
+#include <algorithm>
+#include <utility>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <numeric>
+#include <functional>
+#include <memory>
+
+#include "data.h"
+
+#include "etl/flat_hash_map.h"
+#include "etl/hash.h"
+
+namespace
+{
+  //*************************************************************************
+  struct simple_hash
+  {
+    size_t operator ()(const std::string& text) const
+    {
+      return std::accumulate(text.begin(), text.end(), 0);
+    }
+  };
+
+  //*************************************************************************
+  struct transparent_hash
+  {
+    typedef int is_transparent;
+
+    size_t operator ()(const char* s) const
+    {
+      size_t sum = 0U;
+      size_t length = etl::strlen(s);
+
+      return std::accumulate(s, s + length, sum);
+    }
+
+    size_t operator ()(const std::string& text) const
+    {
+      return std::accumulate(text.begin(), text.end(), 0);
+    }
+  };
+
+  //*************************************************************************
+  // Every key has the same hash.
+  struct colliding_hash
+  {
+    size_t operator ()(int) const
+    {
+      return 42U;
+    }
+  };
+
+  //*************************************************************************
+  // Counts the keys hashed, which includes every element moved by a rehash.
+  struct counting_hash
+  {
+    static size_t calls;
+
+    size_t operator ()(int key) const
+    {
+      ++calls;
+      return etl::hash<int>()(key);
+    }
+  };
+
+  size_t counting_hash::calls = 0U;
+
+  //*************************************************************************
+  // Non-default-constructible hasher
+  struct ndc_hash
+  {
+    int id;
+    ndc_hash(int id_) : id(id_){}
+
+    size_t operator()(size_t val) const
+    {
+      return val;
+    }
+  };
+
+  //*************************************************************************
+  // Non-default-constructible equality checker
+  struct ndc_key_eq
+  {
+    int id;
+    ndc_key_eq(int id_) : id(id_){}
+
+    bool operator()(size_t val1, size_t val2) const
+    {
+      return val1 == val2;
+    }
+  };
+
+  using NDC = TestDataNDC<std::string>;
+  using DC  = TestDataDC<std::string>;
+
+  using ElementNDC = ETL_OR_STD::pair<std::string, NDC>;
+
+  SUITE(test_flat_hash_map)
+  {
+    static const size_t SIZE = 10;
+
+    using DataNDC            = etl::flat_hash_map<std::string, NDC, SIZE, simple_hash>;
+    using IDataNDC           = etl::iflat_hash_map<std::string, NDC, simple_hash>;
+    using DataDC             = etl::flat_hash_map<std::string, DC, SIZE, simple_hash>;
+    using DataDCTransparent  = etl::flat_hash_map<std::string, DC, SIZE, transparent_hash, etl::equal_to<>>;
+    using DataInt            = etl::flat_hash_map<int, int, 100>;
+    using DataColliding      = etl::flat_hash_map<int, int, 40, colliding_hash>;
+    using DataCounting       = etl::flat_hash_map<int, int, 1000, counting_hash>;
+
+    std::string K[] = { "FF", "FG", "FH", "FI", "FJ", "FK", "FL", "FM", "FN", "FO",
+                        "FP", "FQ", "FR", "FS", "FT", "FU", "FV", "FW", "FX", "FY" };
+
+    NDC N[] = { NDC("A"), NDC("B"), NDC("C"), NDC("D"), NDC("E"), NDC("F"), NDC("G"), NDC("H"), NDC("I"), NDC("J"),
+                NDC("K"), NDC("L"), NDC("M"), NDC("N"), NDC("O"), NDC("P"), NDC("Q"), NDC("R"), NDC("S"), NDC("T") };
+
+    std::vector<ElementNDC> initial_data;
+    std::vector<ElementNDC> excess_data;
+    std::vector<ElementNDC> different_data;
+
+    //*************************************************************************
+    struct SetupFixture
+    {
+      SetupFixture()
+      {
+        initial_data.clear();
+        excess_data.clear();
+        different_data.clear();
+
+        for (size_t i = 0UL; i < SIZE; ++i)
+        {
+          initial_data.push_back(ElementNDC(K[i], N[i]));
+          excess_data.push_back(ElementNDC(K[i], N[i]));
+          different_data.push_back(ElementNDC(K[i + SIZE], N[i + SIZE]));
+        }
+
+        excess_data.push_back(ElementNDC(K[SIZE], N[SIZE]));
+      }
+    };
+
+    //*************************************************************************
+    template <typename TMap>
+    bool Check_Contents(const TMap& data, const std::vector<ElementNDC>& expected)
+    {
+      if (data.size() != expected.size())
+      {
+        return false;
+      }
+
+      for (size_t i = 0UL; i < expected.size(); ++i)
+      {
+        typename TMap::const_iterator itr = data.find(expected[i].first);
+
+        if ((itr == data.end()) || (itr->second != expected[i].second))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_default_constructor)
+    {
+      DataNDC data;
+
+      CHECK_EQUAL(0U, data.size());
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.bucket_count() > SIZE);
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_capacity_is_at_least_max_size_over_load_factor)
+    {
+      CHECK(DataInt::MAX_BUCKETS >= ((DataInt::MAX_SIZE * 4U) / 3U));
+      CHECK_EQUAL(0U, DataInt::MAX_BUCKETS % 16U);
+
+      DataInt data;
+
+      CHECK_EQUAL(DataInt::MAX_BUCKETS, data.bucket_count());
+      CHECK_EQUAL(DataInt::MAX_BUCKETS, data.max_bucket_count());
+    }
+
+    //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST && !defined(ETL_TEMPLATE_DEDUCTION_GUIDE_TESTS_DISABLED)
+    TEST_FIXTURE(SetupFixture, test_cpp17_deduced_constructor)
+    {
+      etl::flat_hash_map data{ ETL_OR_STD::pair{1, 10}, ETL_OR_STD::pair{2, 20}, ETL_OR_STD::pair{3, 30} };
+
+      CHECK_EQUAL(3U, data.max_size());
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(10, data.at(1));
+      CHECK_EQUAL(20, data.at(2));
+      CHECK_EQUAL(30, data.at(3));
+    }
+#endif
+
+    //*************************************************************************
+#if ETL_HAS_INITIALIZER_LIST
+    TEST_FIXTURE(SetupFixture, test_make_flat_hash_map)
+    {
+      auto data = etl::make_flat_hash_map<int, int>(ETL_OR_STD::pair<int, int>{1, 10}, ETL_OR_STD::pair<int, int>{2, 20});
+
+      CHECK_EQUAL(2U, data.max_size());
+      CHECK_EQUAL(10, data[1]);
+      CHECK_EQUAL(20, data[2]);
+    }
+#endif
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_constructor_range)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK(data.full());
+      CHECK(Check_Contents(data, initial_data));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_copy_constructor)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2(data1);
+
+      CHECK(data1 == data2);
+      CHECK(Check_Contents(data2, initial_data));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_move_constructor)
+    {
+      using Data = etl::flat_hash_map<int, std::unique_ptr<int>, SIZE>;
+
+      Data data1;
+      data1[1] = std::unique_ptr<int>(new int(10));
+      data1[2] = std::unique_ptr<int>(new int(20));
+
+      Data data2(std::move(data1));
+
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(10, *data2[1]);
+      CHECK_EQUAL(20, *data2[2]);
+      CHECK(!data1[1]);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_destruct_via_iflat_hash_map)
+    {
+      int current_count = NDC::get_instance_count();
+
+      DataNDC* pdata = new DataNDC(initial_data.begin(), initial_data.end());
+      CHECK_EQUAL(int(current_count + initial_data.size()), NDC::get_instance_count());
+
+      IDataNDC* pidata = pdata;
+      delete pidata;
+      CHECK_EQUAL(current_count, NDC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assignment)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2(different_data.begin(), different_data.end());
+
+      data2 = data1;
+
+      CHECK(Check_Contents(data2, initial_data));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assignment_interface)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2;
+
+      IDataNDC& idata1 = data1;
+      IDataNDC& idata2 = data2;
+
+      idata2 = idata1;
+
+      CHECK(Check_Contents(data2, initial_data));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_self_assignment)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      DataNDC& other = data;
+
+      data = other;
+
+      CHECK(Check_Contents(data, initial_data));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_move_assignment)
+    {
+      using Data = etl::flat_hash_map<int, std::unique_ptr<int>, SIZE>;
+
+      Data data1;
+      data1[1] = std::unique_ptr<int>(new int(10));
+      data1[2] = std::unique_ptr<int>(new int(20));
+
+      Data data2;
+      data2[3] = std::unique_ptr<int>(new int(30));
+
+      data2 = std::move(data1);
+
+      CHECK_EQUAL(2U, data2.size());
+      CHECK_EQUAL(10, *data2[1]);
+      CHECK_EQUAL(20, *data2[2]);
+      CHECK(data2.find(3) == data2.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_index_read_write)
+    {
+      DataDC data;
+
+      for (size_t i = 0UL; i < SIZE; ++i)
+      {
+        data[K[i]] = DC(N[i].value);
+      }
+
+      CHECK(data.full());
+
+      for (size_t i = 0UL; i < SIZE; ++i)
+      {
+        CHECK_EQUAL(N[i].value, data[K[i]].value);
+      }
+
+      data[K[0]] = DC("Z");
+      CHECK_EQUAL(std::string("Z"), data[K[0]].value);
+      CHECK_EQUAL(SIZE, data.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_index_using_transparent_comparator_and_hasher)
+    {
+      DataDCTransparent data;
+
+      data["FF"] = DC("A");
+      data[std::string("FG")] = DC("B");
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(std::string("A"), data["FF"].value);
+      CHECK_EQUAL(std::string("B"), data["FG"].value);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_at)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      const DataNDC& cdata = data;
+
+      for (size_t i = 0UL; i < SIZE; ++i)
+      {
+        CHECK_EQUAL(N[i], data.at(K[i]));
+        CHECK_EQUAL(N[i], cdata.at(K[i]));
+      }
+
+      CHECK_THROW(data.at(K[SIZE]), etl::flat_hash_map_out_of_range);
+      CHECK_THROW(cdata.at(K[SIZE]), etl::flat_hash_map_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_at_using_transparent_comparator_and_hasher)
+    {
+      DataDCTransparent data;
+      data["FF"] = DC("A");
+
+      const DataDCTransparent& cdata = data;
+
+      CHECK_EQUAL(std::string("A"), data.at("FF").value);
+      CHECK_EQUAL(std::string("A"), cdata.at("FF").value);
+      CHECK_THROW(data.at("FG"), etl::flat_hash_map_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_assign_range)
+    {
+      DataNDC data(different_data.begin(), different_data.end());
+
+      data.assign(initial_data.begin(), initial_data.end());
+
+      CHECK(Check_Contents(data, initial_data));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_value)
+    {
+      DataNDC data;
+
+      ETL_OR_STD::pair<DataNDC::iterator, bool> result = data.insert(initial_data[0]);
+
+      CHECK(result.second);
+      CHECK_EQUAL(K[0], result.first->first);
+      CHECK_EQUAL(N[0], result.first->second);
+
+      // Duplicate keys are not inserted.
+      result = data.insert(ElementNDC(K[0], N[1]));
+
+      CHECK(!result.second);
+      CHECK_EQUAL(N[0], result.first->second);
+      CHECK_EQUAL(1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_value_excess)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_THROW(data.insert(excess_data[SIZE]), etl::flat_hash_map_full);
+
+      // An existing key can still be found when full.
+      CHECK(!data.insert(initial_data[0]).second);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range)
+    {
+      DataNDC data;
+
+      data.insert(initial_data.begin(), initial_data.end());
+
+      CHECK(Check_Contents(data, initial_data));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_excess)
+    {
+      DataNDC data;
+
+      CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::flat_hash_map_full);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_moved_value)
+    {
+      using Data = etl::flat_hash_map<int, std::unique_ptr<int>, SIZE>;
+
+      Data data;
+
+      data.insert(Data::value_type(1, std::unique_ptr<int>(new int(10))));
+      data.insert(data.begin(), Data::value_type(2, std::unique_ptr<int>(new int(20))));
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(10, *data.at(1));
+      CHECK_EQUAL(20, *data.at(2));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_key)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(1U, data.erase(K[5]));
+      CHECK_EQUAL(0U, data.erase(K[5]));
+
+      CHECK_EQUAL(SIZE - 1U, data.size());
+      CHECK(data.find(K[5]) == data.end());
+
+      std::vector<ElementNDC> expected(initial_data);
+      expected.erase(expected.begin() + 5);
+
+      CHECK(Check_Contents(data, expected));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_key_using_transparent_comparator)
+    {
+      DataDCTransparent data;
+      data["FF"] = DC("A");
+      data["FG"] = DC("B");
+
+      CHECK_EQUAL(1U, data.erase("FF"));
+      CHECK_EQUAL(0U, data.erase("FF"));
+      CHECK_EQUAL(1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_single_iterator)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      DataNDC::iterator itr  = data.find(K[3]);
+      DataNDC::iterator next = itr;
+      ++next;
+
+      DataNDC::iterator result = data.erase(itr);
+
+      CHECK(result == next);
+      CHECK(data.find(K[3]) == data.end());
+      CHECK_EQUAL(SIZE - 1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_range_all)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      DataNDC::iterator result = data.erase(data.cbegin(), data.cend());
+
+      CHECK(result == data.end());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_erase_while_iterating)
+    {
+      DataInt data;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data[i] = i;
+      }
+
+      // Erase the odd values.
+      DataInt::iterator itr = data.begin();
+
+      while (itr != data.end())
+      {
+        if ((itr->second % 2) != 0)
+        {
+          itr = data.erase(itr);
+        }
+        else
+        {
+          ++itr;
+        }
+      }
+
+      CHECK_EQUAL(50U, data.size());
+
+      for (int i = 0; i < 100; ++i)
+      {
+        CHECK_EQUAL((i % 2) == 0, data.contains(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_clear)
+    {
+      int current_count = NDC::get_instance_count();
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+      data.clear();
+
+      CHECK_EQUAL(0U, data.size());
+      CHECK(data.begin() == data.end());
+      CHECK_EQUAL(current_count, NDC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_count_key)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(1U, data.count(K[0]));
+      CHECK_EQUAL(0U, data.count(K[SIZE]));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_count_key_using_transparent_comparator)
+    {
+      DataDCTransparent data;
+      data["FF"] = DC("A");
+
+      CHECK_EQUAL(1U, data.count("FF"));
+      CHECK_EQUAL(0U, data.count("FG"));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_equal_range)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+      const DataNDC& cdata = data;
+
+      ETL_OR_STD::pair<DataNDC::iterator, DataNDC::iterator> result = data.equal_range(K[2]);
+
+      CHECK(result.first == data.find(K[2]));
+      CHECK_EQUAL(1, std::distance(result.first, result.second));
+
+      ETL_OR_STD::pair<DataNDC::const_iterator, DataNDC::const_iterator> cresult = cdata.equal_range(K[SIZE]);
+
+      CHECK(cresult.first == cdata.end());
+      CHECK(cresult.second == cdata.end());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_iterate)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      std::map<std::string, NDC> compare(initial_data.begin(), initial_data.end());
+      std::map<std::string, NDC> result(data.begin(), data.end());
+
+      CHECK(compare == result);
+      CHECK_EQUAL(SIZE, size_t(std::distance(data.cbegin(), data.cend())));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_equal)
+    {
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2(initial_data.rbegin(), initial_data.rend());
+      DataNDC data3(different_data.begin(), different_data.end());
+
+      CHECK(data1 == data2);
+      CHECK(!(data1 != data2));
+      CHECK(data1 != data3);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_load_factor)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_CLOSE(float(SIZE) / float(data.bucket_count()), data.load_factor(), 0.0001f);
+    }
+
+    //*************************************************************************
+    TEST(test_ndc_hasher_and_key_eq)
+    {
+      etl::flat_hash_map<size_t, int, SIZE, ndc_hash, ndc_key_eq> data(ndc_hash(1), ndc_key_eq(2));
+
+      data[1] = 10;
+
+      CHECK_EQUAL(1, data.hash_function().id);
+      CHECK_EQUAL(2, data.key_eq().id);
+      CHECK_EQUAL(10, data.at(1));
+    }
+
+    //*************************************************************************
+    TEST(test_all_keys_colliding)
+    {
+      DataColliding data;
+
+      for (int i = 0; i < 40; ++i)
+      {
+        CHECK(data.insert(DataColliding::value_type(i, i * 10)).second);
+      }
+
+      CHECK(data.full());
+
+      for (int i = 0; i < 40; ++i)
+      {
+        CHECK_EQUAL(i * 10, data.at(i));
+      }
+
+      for (int i = 0; i < 40; i += 2)
+      {
+        CHECK_EQUAL(1U, data.erase(i));
+      }
+
+      for (int i = 0; i < 40; ++i)
+      {
+        CHECK_EQUAL((i % 2) != 0, data.contains(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_insert_erase_churn)
+    {
+      // Repeated insertion and erasure of new keys fills the table with
+      // deleted markers, which must be cleared without losing elements.
+      DataInt data;
+      std::map<int, int> compare;
+
+      uint32_t seed = 12345U;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        const int key = int((seed >> 8U) % 1000U);
+
+        if (compare.count(key) != 0U)
+        {
+          CHECK_EQUAL(1U, data.erase(key));
+          compare.erase(key);
+        }
+        else if (!data.full())
+        {
+          data[key] = i;
+          compare[key] = i;
+        }
+      }
+
+      CHECK_EQUAL(compare.size(), data.size());
+
+      for (std::map<int, int>::const_iterator itr = compare.begin(); itr != compare.end(); ++itr)
+      {
+        CHECK_EQUAL(itr->second, data.at(itr->first));
+      }
+
+      std::map<int, int> result(data.begin(), data.end());
+      CHECK(compare == result);
+    }
+
+    //*************************************************************************
+    TEST(test_churn_destroys_all_elements)
+    {
+      int current_count = NDC::get_instance_count();
+
+      {
+        etl::flat_hash_map<int, NDC, 20> data;
+
+        for (int i = 0; i < 1000; ++i)
+        {
+          data.insert(ETL_OR_STD::make_pair(i, NDC("A")));
+
+          if (data.size() == 20U)
+          {
+            data.erase(i - 19);
+          }
+        }
+
+        CHECK_EQUAL(current_count + 19, NDC::get_instance_count());
+      }
+
+      CHECK_EQUAL(current_count, NDC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST(test_churn_at_full_capacity_rehashes_rarely)
+    {
+      // Each erase at full capacity may leave a deleted marker. There must be
+      // room for enough of them that the cost of clearing them by rehashing
+      // is spread over many operations.
+      DataCounting data;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data[i] = i;
+      }
+
+      CHECK(data.full());
+
+      counting_hash::calls = 0U;
+
+      const int Operations = 10000;
+
+      for (int i = 1000; i < (1000 + Operations); ++i)
+      {
+        CHECK_EQUAL(1U, data.erase(i - 1000));
+        CHECK(data.insert(DataCounting::value_type(i, i)).second);
+      }
+
+      // One hash each for the erase and the insert, plus the rehashes.
+      CHECK(counting_hash::calls < size_t(Operations * 10));
+
+      CHECK(data.full());
+
+      for (int i = Operations; i < (1000 + Operations); ++i)
+      {
+        CHECK_EQUAL(i, data.at(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_contains)
+    {
+      DataInt data;
+      data[1] = 1;
+
+      CHECK(data.contains(1));
+      CHECK(!data.contains(2));
+    }
+
+    //*************************************************************************
+    TEST(test_contains_with_transparent_comparator)
+    {
+      DataDCTransparent data;
+      data["FF"] = DC("A");
+
+      CHECK(data.contains("FF"));
+      CHECK(!data.contains("FG"));
+    }
+  };
+}
@@ -0,0 +1,400 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <set>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <numeric>
+#include <memory>
+#include <functional>
+
+#include "data.h"
+
+#include "etl/flat_hash_set.h"
+#include "etl/hash.h"
+
+namespace
+{
+  //*************************************************************************
+  struct simple_hash
+  {
+    size_t operator ()(const std::string& text) const
+    {
+      return std::accumulate(text.begin(), text.end(), 0);
+    }
+  };
+
+  //*************************************************************************
+  struct transparent_hash
+  {
+    typedef int is_transparent;
+
+    size_t operator ()(const char* s) const
+    {
+      size_t sum = 0U;
+      size_t length = etl::strlen(s);
+
+      return std::accumulate(s, s + length, sum);
+    }
+
+    size_t operator ()(const std::string& text) const
+    {
+      return std::accumulate(text.begin(), text.end(), 0);
+    }
+  };
+
+  //*************************************************************************
+  // Hashes all of the keys to just four values.
+  struct poor_hash
+  {
+    size_t operator ()(int key) const
+    {
+      return size_t(key % 4);
+    }
+  };
+
+  SUITE(test_flat_hash_set)
+  {
+    static const size_t SIZE = 10;
+
+    using DataString            = etl::flat_hash_set<std::string, SIZE, simple_hash>;
+    using IDataString           = etl::iflat_hash_set<std::string, simple_hash>;
+    using DataStringTransparent = etl::flat_hash_set<std::string, SIZE, transparent_hash, etl::equal_to<>>;
+    using DataInt               = etl::flat_hash_set<int, 100>;
+    using DataPoor              = etl::flat_hash_set<int, 50, poor_hash>;
+
+    std::string K[] = { "FF", "FG", "FH", "FI", "FJ", "FK", "FL", "FM", "FN", "FO",
+                        "FP", "FQ", "FR", "FS", "FT", "FU", "FV", "FW", "FX", "FY" };
+
+    std::vector<std::string> initial_data(K, K + SIZE);
+    std::vector<std::string> excess_data(K, K + SIZE + 1);
+    std::vector<std::string> different_data(K + SIZE, K + (2 * SIZE));
+
+    //*************************************************************************
+    template <typename TSet>
+    bool Check_Contents(const TSet& data, const std::vector<std::string>& expected)
+    {
+      std::set<std::string> compare(expected.begin(), expected.end());
+      std::set<std::string> result(data.begin(), data.end());
+
+      return (data.size() == expected.size()) && (compare == result);
+    }
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      DataString data;
+
+      CHECK_EQUAL(0U, data.size());
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST && !defined(ETL_TEMPLATE_DEDUCTION_GUIDE_TESTS_DISABLED)
+    TEST(test_cpp17_deduced_constructor)
+    {
+      etl::flat_hash_set data{ 1, 2, 3, 4 };
+
+      CHECK_EQUAL(4U, data.max_size());
+      CHECK_EQUAL(4U, data.size());
+      CHECK(data.contains(1));
+      CHECK(data.contains(4));
+    }
+#endif
+
+    //*************************************************************************
+#if ETL_HAS_INITIALIZER_LIST
+    TEST(test_make_flat_hash_set)
+    {
+      auto data = etl::make_flat_hash_set<int>(1, 2, 3);
+
+      CHECK_EQUAL(3U, data.max_size());
+      CHECK_EQUAL(3U, data.size());
+      CHECK(data.contains(2));
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_constructor_range)
+    {
+      DataString data(initial_data.begin(), initial_data.end());
+
+      CHECK(data.full());
+      CHECK(Check_Contents(data, initial_data));
+    }
+
+    //*************************************************************************
+    TEST(test_copy_constructor)
+    {
+      DataString data1(initial_data.begin(), initial_data.end());
+      DataString data2(data1);
+
+      CHECK(data1 == data2);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor)
+    {
+      using Data = etl::flat_hash_set<std::string, SIZE, simple_hash>;
+
+      Data data1(initial_data.begin(), initial_data.end());
+      Data data2(std::move(data1));
+
+      CHECK(Check_Contents(data2, initial_data));
+    }
+
+    //*************************************************************************
+    TEST(test_destruct_via_iflat_hash_set)
+    {
+      DataString* pdata = new DataString(initial_data.begin(), initial_data.end());
+
+      IDataString* pidata = pdata;
+      delete pidata;
+    }
+
+    //*************************************************************************
+    TEST(test_assignment)
+    {
+      DataString data1(initial_data.begin(), initial_data.end());
+      DataString data2(different_data.begin(), different_data.end());
+
+      data2 = data1;
+
+      CHECK(Check_Contents(data2, initial_data));
+    }
+
+    //*************************************************************************
+    TEST(test_assignment_interface)
+    {
+      DataString data1(initial_data.begin(), initial_data.end());
+      DataString data2;
+
+      IDataString& idata1 = data1;
+      IDataString& idata2 = data2;
+
+      idata2 = idata1;
+
+      CHECK(Check_Contents(data2, initial_data));
+    }
+
+    //*************************************************************************
+    TEST(test_move_assignment)
+    {
+      DataString data1(initial_data.begin(), initial_data.end());
+      DataString data2(different_data.begin(), different_data.end());
+
+      data2 = std::move(data1);
+
+      CHECK(Check_Contents(data2, initial_data));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_value)
+    {
+      DataString data;
+
+      ETL_OR_STD::pair<DataString::iterator, bool> result = data.insert(K[0]);
+
+      CHECK(result.second);
+      CHECK_EQUAL(K[0], *result.first);
+
+      result = data.insert(K[0]);
+
+      CHECK(!result.second);
+      CHECK_EQUAL(K[0], *result.first);
+      CHECK_EQUAL(1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_moved_value)
+    {
+      using Data = etl::flat_hash_set<std::unique_ptr<int>, SIZE, std::hash<std::unique_ptr<int>>>;
+
+      Data data;
+      std::unique_ptr<int> p(new int(1));
+      int* raw = p.get();
+
+      data.insert(std::move(p));
+
+      CHECK_EQUAL(1U, data.size());
+      CHECK(data.begin()->get() == raw);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_using_transparent_comparator)
+    {
+      DataStringTransparent data;
+
+      CHECK(data.insert("FF").second);
+      CHECK(!data.insert("FF").second);
+      CHECK(data.contains("FF"));
+      CHECK_EQUAL(1U, data.count("FF"));
+      CHECK(data.find("FG") == data.end());
+      CHECK_EQUAL(1U, data.erase("FF"));
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_value_excess)
+    {
+      DataString data(initial_data.begin(), initial_data.end());
+
+      CHECK_THROW(data.insert(K[SIZE]), etl::flat_hash_set_full);
+      CHECK(!data.insert(K[0]).second);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_range_excess)
+    {
+      DataString data;
+
+      CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::flat_hash_set_full);
+    }
+
+    //*************************************************************************
+    TEST(test_erase_key)
+    {
+      DataString data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(1U, data.erase(K[5]));
+      CHECK_EQUAL(0U, data.erase(K[5]));
+
+      std::vector<std::string> expected(initial_data);
+      expected.erase(expected.begin() + 5);
+
+      CHECK(Check_Contents(data, expected));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_range)
+    {
+      DataString data(initial_data.begin(), initial_data.end());
+
+      DataString::iterator first = data.begin();
+      std::advance(first, 2);
+      DataString::iterator last = first;
+      std::advance(last, 5);
+
+      std::vector<std::string> expected(data.begin(), first);
+      expected.insert(expected.end(), last, data.end());
+
+      DataString::iterator result = data.erase(first, last);
+
+      CHECK(result == last);
+      CHECK(Check_Contents(data, expected));
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      DataString data(initial_data.begin(), initial_data.end());
+
+      data.clear();
+
+      CHECK(data.empty());
+      CHECK(data.begin() == data.end());
+
+      data.insert(initial_data.begin(), initial_data.end());
+
+      CHECK(Check_Contents(data, initial_data));
+    }
+
+    //*************************************************************************
+    TEST(test_equal)
+    {
+      DataString data1(initial_data.begin(), initial_data.end());
+      DataString data2(initial_data.rbegin(), initial_data.rend());
+      DataString data3(different_data.begin(), different_data.end());
+
+      CHECK(data1 == data2);
+      CHECK(data1 != data3);
+    }
+
+    //*************************************************************************
+    TEST(test_poor_hash)
+    {
+      DataPoor data;
+
+      for (int i = 0; i < 50; ++i)
+      {
+        CHECK(data.insert(i).second);
+      }
+
+      CHECK(data.full());
+
+      for (int i = 0; i < 50; i += 3)
+      {
+        CHECK_EQUAL(1U, data.erase(i));
+      }
+
+      for (int i = 0; i < 50; ++i)
+      {
+        CHECK_EQUAL((i % 3) != 0, data.contains(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_insert_erase_churn)
+    {
+      DataInt data;
+      std::set<int> compare;
+
+      uint32_t seed = 54321U;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        const int key = int((seed >> 8U) % 500U);
+
+        if (compare.count(key) != 0U)
+        {
+          CHECK_EQUAL(1U, data.erase(key));
+          compare.erase(key);
+        }
+        else if (!data.full())
+        {
+          CHECK(data.insert(key).second);
+          compare.insert(key);
+        }
+      }
+
+      std::set<int> result(data.begin(), data.end());
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(compare == result);
+    }
+  };
+}
@@ -202,10 +202,11 @@ namespace
     {
       etl::string<100> s;
 
-      CHECK_EQUAL("1.0", test_format(s, "{}", 1.0f));
+      CHECK_EQUAL("1", test_format(s, "{}", 1.0f));
       CHECK_EQUAL("1.234567", test_format(s, "{}", 1.234567f));
-      CHECK_EQUAL("1.234567", test_format(s, "{}", 1.2345678f));
+      CHECK_EQUAL("1.2345678", test_format(s, "{}", 1.2345678f));
       CHECK_EQUAL("1.125", test_format(s, "{}", 1.125f));
+      CHECK_EQUAL("190944592", test_format(s, "{}", 190944592.0f));
     }
 
     //*************************************************************************
@@ -213,10 +214,16 @@ namespace
     {
       etl::string<100> s;
 
-      CHECK_EQUAL("1.0", test_format(s, "{}", 1.0));
+      CHECK_EQUAL("1", test_format(s, "{}", 1.0));
       CHECK_EQUAL("1.234564", test_format(s, "{}", 1.234564));
-      CHECK_EQUAL("1.234567", test_format(s, "{}", 1.2345678));
+      CHECK_EQUAL("1.2345678", test_format(s, "{}", 1.2345678));
       CHECK_EQUAL("1.5", test_format(s, "{}", 1.5));
+      CHECK_EQUAL("0.30000000000000004", test_format(s, "{}", 0.1 + 0.2));
+      CHECK_EQUAL("1e+20", test_format(s, "{}", 1e20));
+      CHECK_EQUAL("1e-05", test_format(s, "{}", 1e-5));
+      CHECK_EQUAL("-0", test_format(s, "{}", -0.0));
+      CHECK_EQUAL("+2.5", test_format(s, "{:+}", 2.5));
+      CHECK_EQUAL("  -2.5", test_format(s, "{:>6}", -2.5));
     }
 
     //*************************************************************************
@@ -319,7 +326,7 @@ namespace
 
       CHECK_EQUAL("data1", test_format(s, "{}", sv));
       CHECK_EQUAL("data1", test_format(s, "{:s}", sv));
-      CHECK_THROW(test_format(s, "{:d}", sv), etl::bad_format_string_exception);
+      CHECK_THROW(test_format(s, etl::runtime_format("{:d}"), sv), etl::bad_format_string_exception);
       CHECK_EQUAL("data1     ", test_format(s, "{:10s}", sv));
       CHECK_EQUAL("data1     ", test_format(s, "{:<10s}", sv));
       CHECK_EQUAL("     data1", test_format(s, "{:>10s}", sv));
@@ -348,7 +355,7 @@ namespace
 
       CHECK_EQUAL("data1", test_format(s, "{}", s_arg));
       CHECK_EQUAL("data1", test_format(s, "{:s}", s_arg));
-      CHECK_THROW(test_format(s, "{:d}", s_arg), etl::bad_format_string_exception);
+      CHECK_THROW(test_format(s, etl::runtime_format("{:d}"), s_arg), etl::bad_format_string_exception);
       CHECK_EQUAL("data1     ", test_format(s, "{:10s}", s_arg));
       CHECK_EQUAL("data1     ", test_format(s, "{:<10s}", s_arg));
       CHECK_EQUAL("     data1", test_format(s, "{:>10s}", s_arg));
@@ -381,7 +388,7 @@ namespace
 
       CHECK_EQUAL("data1", test_format(s, "{}", string_t(data)));
       CHECK_EQUAL("data1", test_format(s, "{:s}", string_t(data)));
-      CHECK_THROW(test_format(s, "{:d}", string_t(data)), etl::bad_format_string_exception);
+      CHECK_THROW(test_format(s, etl::runtime_format("{:d}"), string_t(data)), etl::bad_format_string_exception);
       CHECK_EQUAL("data1     ", test_format(s, "{:10s}", string_t(data)));
       CHECK_EQUAL("data1     ", test_format(s, "{:<10s}", string_t(data)));
       CHECK_EQUAL("     data1", test_format(s, "{:>10s}", string_t(data)));
@@ -410,7 +417,7 @@ namespace
 
       CHECK_EQUAL("data1", test_format(s, "{}", chars));
       CHECK_EQUAL("data1", test_format(s, "{:s}", chars));
-      CHECK_THROW(test_format(s, "{:d}", chars), etl::bad_format_string_exception);
+      CHECK_THROW(test_format(s, etl::runtime_format("{:d}"), chars), etl::bad_format_string_exception);
       CHECK_EQUAL("data1     ", test_format(s, "{:10s}", chars));
       CHECK_EQUAL("data1     ", test_format(s, "{:<10s}", chars));
       CHECK_EQUAL("     data1", test_format(s, "{:>10s}", chars));
@@ -555,21 +562,21 @@ namespace
     {
       etl::string<100> s;
 
-      CHECK_THROW(test_format(s, "a{b}", 1), etl::bad_format_string_exception); // bad format index spec
-      // goal: rejected at compile time on C++20, error on <= C++17
+      CHECK_THROW(test_format(s, etl::runtime_format("a{b}"), 1), etl::bad_format_string_exception); // bad format index spec
+      // rejected at compile time without etl::runtime_format
 
-      CHECK_THROW(test_format(s, "a{b"), etl::bad_format_string_exception); // closing brace missing
-      // goal: rejected at compile time on C++20, error on <= C++17
+      CHECK_THROW(test_format(s, etl::runtime_format("a{b")), etl::bad_format_string_exception); // closing brace missing
+      // rejected at compile time without etl::runtime_format
 
-      CHECK_THROW(test_format(s, "a{b}"), etl::bad_format_string_exception); // arg missing
-      // goal: rejected at compile time on C++20, error on <= C++17
+      CHECK_THROW(test_format(s, etl::runtime_format("a{b}")), etl::bad_format_string_exception); // arg missing
+      // rejected at compile time without etl::runtime_format
 
-      CHECK_THROW(test_format(s, "a}b"), etl::bad_format_string_exception); // bad format: only escaped }} allowed
-      // goal: rejected at compile time on C++20, error on <= C++17
+      CHECK_THROW(test_format(s, etl::runtime_format("a}b")), etl::bad_format_string_exception); // bad format: only escaped }} allowed
+      // rejected at compile time without etl::runtime_format
 
       CHECK_EQUAL("123", test_format(s, "{:}", 123)); // valid
-      CHECK_THROW(test_format(s, "{::}", 123), etl::bad_format_string_exception); // bad format spec
-      CHECK_THROW(test_format(s, "{1}", 123), etl::bad_format_string_exception); // bad index
+      CHECK_THROW(test_format(s, etl::runtime_format("{::}"), 123), etl::bad_format_string_exception); // bad format spec
+      CHECK_THROW(test_format(s, etl::runtime_format("{1}"), 123), etl::bad_format_string_exception); // bad index
     }
 
     //*************************************************************************
@@ -627,7 +634,7 @@ namespace
       CHECK_EQUAL(" 34  ", test_format(s, "{:^5}", 34));
       CHECK_EQUAL(" -65 ", test_format(s, "{:^5}", -65));
       CHECK_EQUAL("34  ", test_format(s, "{:<4}", 34));
-      CHECK_THROW(test_format(s, "a{:*5}", 34), etl::bad_format_string_exception);
+      CHECK_THROW(test_format(s, etl::runtime_format("a{:*5}"), 34), etl::bad_format_string_exception);
       CHECK_EQUAL("a*34**", test_format(s, "a{:*^5}", 34));
       CHECK_EQUAL("a*34**", test_format(s, "a{:*^5}", static_cast<unsigned int>(34)));
       CHECK_EQUAL("a***-341234567890****", test_format(s, "a{:*^20}", static_cast<long long int>(-341234567890)));
@@ -680,7 +687,81 @@ namespace
       CHECK_EQUAL("00067", test_format(s, "{:05d}", 67));
       CHECK_EQUAL("+00067", test_format(s, "{:+05d}", 67));
       CHECK_EQUAL("+0X00EF1", test_format(s, "{:+#05X}", 0xEF1));
-      CHECK_THROW(test_format(s, "{:+#05.5X}", 0xEF1), etl::bad_format_string_exception);
+      CHECK_THROW(test_format(s, etl::runtime_format("{:+#05.5X}"), 0xEF1), etl::bad_format_string_exception);
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_format_compile_time_check)
+    {
+      static_assert(etl::check_f<int>("{}"), "Valid");
+      static_assert(etl::check_f<int, int>("{1}{0}{1}"), "Valid");
+      static_assert(etl::check_f<int, int, double>("{:>{}}{:.3f}"), "Valid");
+      static_assert(etl::check_f<>("{{}}"), "Valid");
+
+      static_assert(!etl::check_f<int>("a{b}"), "Bad index");
+      static_assert(!etl::check_f<>("a{b"), "Closing brace missing");
+      static_assert(!etl::check_f<>("a{}"), "Argument missing");
+      static_assert(!etl::check_f<>("a}b"), "Single closing brace");
+      static_assert(!etl::check_f<int>("{::}"), "Bad format spec");
+      static_assert(!etl::check_f<int>("{1}"), "Index out of range");
+      static_assert(!etl::check_f<int, int>("{}{1}"), "Automatic then manual");
+      static_assert(!etl::check_f<int>("{:{}.{}}"), "Not enough arguments for nested replacements");
+      static_assert(!etl::check_f<etl::string_view>("{:d}"), "Bad type for string");
+      static_assert(!etl::check_f<const char*>("{:x}"), "Bad type for string");
+      static_assert(!etl::check_f<double>("{:d}"), "Bad type for floating point");
+      static_assert(!etl::check_f<bool>("{:c}"), "Bad type for bool");
+      static_assert(!etl::check_f<int>("{:.5}"), "Precision for integer");
+      static_assert(!etl::check_f<int>("{:s}"), "Bad type for integer");
+      static_assert(!etl::check_f<char>("{:+}"), "Sign for char");
+      static_assert(!etl::check_f<const void*>("{:x}"), "Bad type for pointer");
+
+      static constexpr etl::format_string<int, unsigned int> fmt("value={} hex={:x}");
+#if ETL_USING_CPP20 || (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1)
+      static_assert(fmt.compiled().valid, "Compiled");
+      static_assert(fmt.compiled().compiled, "Compiled");
+      static_assert(fmt.compiled().n_fields == 2U, "Two fields");
+#endif
+
+      etl::string<100> s;
+      etl::format_to(s, fmt, 12, 255U);
+      CHECK_EQUAL("value=12 hex=ff", s);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_format_runtime_format)
+    {
+      etl::string<100> s;
+
+      CHECK_EQUAL("1 2", test_format(s, etl::runtime_format("{} {}"), 1, 2));
+      CHECK_EQUAL("{2}", test_format(s, etl::runtime_format("{{{}}}"), 2));
+    }
+
+    //*************************************************************************
+    TEST(test_format_compiled_matches_runtime)
+    {
+      etl::string<100> compiled;
+      etl::string<100> runtime;
+
+#define CHECK_COMPILED_MATCHES_RUNTIME(format_text, ...) \
+      CHECK_EQUAL(test_format(runtime, etl::runtime_format(format_text), __VA_ARGS__), test_format(compiled, format_text, __VA_ARGS__))
+
+      CHECK_COMPILED_MATCHES_RUNTIME("{} {} {}", 1, 'a', "text");
+      CHECK_COMPILED_MATCHES_RUNTIME("{{{}}} }}{{", 12);
+      CHECK_COMPILED_MATCHES_RUNTIME("{2}-{1}-{0}-{1}", 1, 2, 3);
+      CHECK_COMPILED_MATCHES_RUNTIME("[{:*^9}]", 123);
+      CHECK_COMPILED_MATCHES_RUNTIME("[{:<6}|{:>6}]", "ab", true);
+      CHECK_COMPILED_MATCHES_RUNTIME("{:+#010x}", 0x3f4);
+      CHECK_COMPILED_MATCHES_RUNTIME("{: d}", 42);
+      CHECK_COMPILED_MATCHES_RUNTIME("{:.3f}", 3.14159);
+      CHECK_COMPILED_MATCHES_RUNTIME("{:e}", 1234.5);
+      CHECK_COMPILED_MATCHES_RUNTIME("{:?}", "a\tb");
+      CHECK_COMPILED_MATCHES_RUNTIME("{:#B}", 5);
+      CHECK_COMPILED_MATCHES_RUNTIME("{:P}", static_cast<const void*>(nullptr));
+      CHECK_COMPILED_MATCHES_RUNTIME("{:{}}", 1, 2);
+
+#undef CHECK_COMPILED_MATCHES_RUNTIME
     }
   }
 }
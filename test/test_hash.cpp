@@ -171,6 +171,15 @@ namespace
     {
       size_t hash = etl::hash<float>()((float)(1.2345));
 
+#if defined(ETL_HASH_USE_WYHASH)
+      if (ETL_PLATFORM_64BIT)
+      {
+        float value = 1.2345f;
+        const uint8_t* p = reinterpret_cast<const uint8_t*>(&value);
+
+        CHECK_EQUAL(size_t(etl::wyhash(p, p + sizeof(value)).value()), hash);
+      }
+#else
       if (ETL_PLATFORM_32BIT)
       {
         CHECK_EQUAL(0X3F9E0419U, hash);
@@ -187,6 +196,7 @@ namespace
           CHECK_EQUAL(15239628249615675935U, hash);
         }
       }
+#endif
     }
 
     //*************************************************************************
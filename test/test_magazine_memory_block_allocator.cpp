@@ -0,0 +1,314 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/magazine_memory_block_allocator.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/reference_counted_message_pool.h"
+#include "etl/shared_message.h"
+#include "etl/message.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace
+{
+  using Shared = etl::fixed_sized_memory_block_allocator<sizeof(uint32_t), alignof(uint32_t), 16>;
+  using Large  = etl::fixed_sized_memory_block_allocator<sizeof(uint64_t) * 4, alignof(uint64_t), 4>;
+
+  //*************************************************************************
+  // The 'thread' is selected by the test.
+  class Magazines : public etl::magazine_memory_block_allocator<sizeof(uint32_t), alignof(uint32_t), 2, 4>
+  {
+  public:
+
+    Magazines(etl::imemory_block_allocator& shared_)
+      : magazine_memory_block_allocator(shared_)
+      , thread(0U)
+      , locks(0)
+      , locked(false)
+      , lock_error(false)
+    {
+    }
+
+    size_t thread;
+    int    locks;
+    bool   locked;
+    bool   lock_error;
+
+  protected:
+
+    size_t thread_index() const override
+    {
+      return thread;
+    }
+
+    void lock() override
+    {
+      lock_error = lock_error || locked;
+      locked = true;
+      ++locks;
+    }
+
+    void unlock() override
+    {
+      lock_error = lock_error || !locked;
+      locked = false;
+    }
+  };
+
+  //*************************************************************************
+  struct Message : public etl::message<1U>
+  {
+    Message(int i_)
+      : i(i_)
+    {
+    }
+
+    int i;
+  };
+
+  SUITE(test_magazine_memory_block_allocator)
+  {
+    //*************************************************************************
+    TEST(test_allocate_refills_half_a_magazine)
+    {
+      Shared shared;
+      Magazines magazines(shared);
+
+      CHECK_EQUAL(2U, Magazines::Batch_Size);
+
+      void* p1 = magazines.allocate(sizeof(uint32_t), alignof(uint32_t));
+      CHECK(p1 != nullptr);
+      CHECK(shared.is_owner_of(p1));
+      CHECK_EQUAL(1, magazines.locks);
+      CHECK_EQUAL(1U, magazines.refills(0));
+      CHECK_EQUAL(0U, magazines.cache_hits(0));
+      CHECK_EQUAL(1U, magazines.cached(0));
+
+      void* p2 = magazines.allocate(sizeof(uint32_t), alignof(uint32_t));
+      CHECK(p2 != nullptr);
+      CHECK(p2 != p1);
+      CHECK_EQUAL(1, magazines.locks);
+      CHECK_EQUAL(1U, magazines.cache_hits(0));
+      CHECK_EQUAL(0U, magazines.cached(0));
+
+      void* p3 = magazines.allocate(sizeof(uint32_t), alignof(uint32_t));
+      CHECK(p3 != nullptr);
+      CHECK_EQUAL(2, magazines.locks);
+      CHECK_EQUAL(2U, magazines.refills(0));
+      CHECK(!magazines.lock_error);
+    }
+
+    //*************************************************************************
+    TEST(test_release_caches_until_full_then_flushes)
+    {
+      Shared shared;
+      Magazines magazines(shared);
+
+      std::vector<void*> blocks;
+
+      for (int i = 0; i < 6; ++i)
+      {
+        blocks.push_back(magazines.allocate(sizeof(uint32_t), alignof(uint32_t)));
+      }
+
+      const int locks = magazines.locks;
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        CHECK(magazines.release(blocks[i]));
+      }
+
+      // The magazine is now full, without taking the lock.
+      CHECK_EQUAL(locks, magazines.locks);
+      CHECK_EQUAL(4U, magazines.cached(0));
+      CHECK_EQUAL(0U, magazines.flushes(0));
+
+      // Half a magazine is returned before the next block is cached.
+      CHECK(magazines.release(blocks[4]));
+      CHECK_EQUAL(locks + 1, magazines.locks);
+      CHECK_EQUAL(1U, magazines.flushes(0));
+      CHECK_EQUAL(3U, magazines.cached(0));
+
+      // The most recently released block is reused first.
+      CHECK(magazines.allocate(sizeof(uint32_t), alignof(uint32_t)) == blocks[4]);
+      CHECK(!magazines.lock_error);
+    }
+
+    //*************************************************************************
+    TEST(test_threads_have_their_own_magazines)
+    {
+      Shared shared;
+      Magazines magazines(shared);
+
+      magazines.thread = 0U;
+      void* p = magazines.allocate(sizeof(uint32_t), alignof(uint32_t));
+
+      // Released by the other thread.
+      magazines.thread = 1U;
+      CHECK(magazines.release(p));
+      CHECK_EQUAL(1U, magazines.cached(0));
+      CHECK_EQUAL(1U, magazines.cached(1));
+
+      CHECK(magazines.allocate(sizeof(uint32_t), alignof(uint32_t)) == p);
+      CHECK_EQUAL(1U, magazines.cache_hits(1));
+      CHECK_EQUAL(0U, magazines.refills(1));
+    }
+
+    //*************************************************************************
+    TEST(test_flush)
+    {
+      Shared shared;
+      Magazines magazines(shared);
+
+      void* p1 = magazines.allocate(sizeof(uint32_t), alignof(uint32_t));
+      CHECK(magazines.release(p1));
+      CHECK_EQUAL(2U, magazines.cached(0));
+
+      magazines.flush();
+      CHECK_EQUAL(0U, magazines.cached(0));
+
+      // All of the blocks are available from the shared allocator again.
+      std::vector<void*> blocks;
+
+      while (void* p = shared.allocate(sizeof(uint32_t), alignof(uint32_t)))
+      {
+        blocks.push_back(p);
+      }
+
+      CHECK_EQUAL(Shared::Size, blocks.size());
+    }
+
+    //*************************************************************************
+    TEST(test_shared_allocator_exhausted)
+    {
+      Shared shared;
+      Magazines magazines(shared);
+
+      std::vector<void*> blocks;
+
+      for (size_t i = 0U; i < Shared::Size; ++i)
+      {
+        void* p = magazines.allocate(sizeof(uint32_t), alignof(uint32_t));
+        CHECK(p != nullptr);
+        blocks.push_back(p);
+      }
+
+      const size_t refills = magazines.refills(0);
+
+      CHECK(magazines.allocate(sizeof(uint32_t), alignof(uint32_t)) == nullptr);
+      CHECK(magazines.allocate(sizeof(uint32_t), alignof(uint32_t)) == nullptr);
+
+      // The failed attempts to refill are not counted.
+      CHECK_EQUAL(Shared::Size / Magazines::Batch_Size, refills);
+      CHECK_EQUAL(refills, magazines.refills(0));
+
+      std::sort(blocks.begin(), blocks.end());
+      CHECK(std::unique(blocks.begin(), blocks.end()) == blocks.end());
+    }
+
+    //*************************************************************************
+    TEST(test_requests_it_cannot_serve_go_to_the_successor)
+    {
+      Shared shared;
+      Large  large;
+      Magazines magazines(shared);
+      magazines.set_successor(large);
+
+      void* p = magazines.allocate(sizeof(uint64_t) * 4, alignof(uint64_t));
+      CHECK(p != nullptr);
+      CHECK(large.is_owner_of(p));
+      CHECK_EQUAL(0, magazines.locks);
+      CHECK(magazines.is_owner_of(p));
+
+      CHECK(magazines.release(p));
+      CHECK_EQUAL(0U, magazines.cached(0));
+
+      int not_owned;
+      CHECK(!magazines.release(&not_owned));
+      CHECK(!magazines.is_owner_of(&not_owned));
+    }
+
+    //*************************************************************************
+    TEST(test_thread_index_out_of_range)
+    {
+      Shared shared;
+      Magazines magazines(shared);
+      magazines.thread = 2U;
+
+      CHECK_THROW(magazines.allocate(sizeof(uint32_t), alignof(uint32_t)), etl::magazine_memory_block_allocator_thread_index);
+    }
+
+    //*************************************************************************
+    TEST(test_reference_counted_message_pool)
+    {
+      using Pool      = etl::reference_counted_message_pool<int>;
+      using Rcm       = etl::reference_counted_message<Message, int>;
+      using Blocks    = etl::fixed_sized_memory_block_allocator<sizeof(Rcm), alignof(Rcm), 8>;
+
+      class MessageMagazines : public etl::magazine_memory_block_allocator<sizeof(Rcm), alignof(Rcm), 1, 4>
+      {
+      public:
+
+        MessageMagazines(etl::imemory_block_allocator& shared_)
+          : magazine_memory_block_allocator(shared_)
+          , locks(0)
+        {
+        }
+
+        int locks;
+
+      protected:
+
+        size_t thread_index() const override { return 0U; }
+        void lock() override { ++locks; }
+        void unlock() override {}
+      };
+
+      Blocks blocks;
+      MessageMagazines magazines(blocks);
+      Pool pool(magazines);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        etl::shared_message sm1(pool, Message(i));
+        etl::shared_message sm2(pool, Message(i + 1));
+
+        CHECK_EQUAL(i, static_cast<const Message&>(sm1.get_message()).i);
+        CHECK_EQUAL(i + 1, static_cast<const Message&>(sm2.get_message()).i);
+      }
+
+      // The shared allocator was only locked for the first refill.
+      CHECK_EQUAL(1, magazines.locks);
+      CHECK_EQUAL(1U, magazines.refills(0));
+      CHECK_EQUAL(199U, magazines.cache_hits(0));
+    }
+  }
+}
@@ -0,0 +1,190 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/merge_sort.h"
+#include "etl/vector.h"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+#include <stdint.h>
+
+namespace
+{
+  std::mt19937 urng(54321);
+
+  struct Event
+  {
+    int key;
+    int sequence;
+  };
+
+  bool operator <(const Event& lhs, const Event& rhs)
+  {
+    return lhs.key < rhs.key;
+  }
+
+  bool operator >(const Event& lhs, const Event& rhs)
+  {
+    return lhs.key > rhs.key;
+  }
+
+  bool are_identical(const Event& lhs, const Event& rhs)
+  {
+    return (lhs.key == rhs.key) && (lhs.sequence == rhs.sequence);
+  }
+
+  //***************************************************************************
+  std::vector<Event> make_events(size_t size, int keys)
+  {
+    std::vector<Event> data(size);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+      data[i].key      = int(urng() % keys);
+      data[i].sequence = int(i);
+    }
+
+    return data;
+  }
+
+  SUITE(test_merge_sort)
+  {
+    //*************************************************************************
+    TEST(test_merge_sort_is_stable_for_all_buffer_sizes)
+    {
+      const size_t lengths[] = { 0, 1, 2, 15, 16, 17, 33, 100, 1000, 3001 };
+
+      for (size_t l = 0; l < ETL_ARRAY_SIZE(lengths); ++l)
+      {
+        const size_t length = lengths[l];
+
+        const size_t buffer_sizes[] = { 0, 1, 7, length / 4, length / 2, length };
+
+        for (size_t b = 0; b < ETL_ARRAY_SIZE(buffer_sizes); ++b)
+        {
+          std::vector<Event> data = make_events(length, 20);
+          std::vector<Event> compare(data);
+          std::vector<Event> scratch(buffer_sizes[b]);
+
+          std::stable_sort(compare.begin(), compare.end());
+          etl::merge_sort(data.begin(), data.end(), etl::span<Event>(scratch.data(), scratch.size()));
+
+          CHECK(std::equal(compare.begin(), compare.end(), data.begin(), are_identical));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_merge_sort_greater)
+    {
+      std::vector<Event> data = make_events(1000, 50);
+      std::vector<Event> compare(data);
+      std::vector<Event> scratch(500);
+
+      std::stable_sort(compare.begin(), compare.end(), std::greater<Event>());
+      etl::merge_sort(data.begin(), data.end(), etl::span<Event>(scratch.data(), scratch.size()), std::greater<Event>());
+
+      CHECK(std::equal(compare.begin(), compare.end(), data.begin(), are_identical));
+    }
+
+    //*************************************************************************
+    TEST(test_merge_sort_patterns)
+    {
+      std::vector<int> scratch(500);
+
+      for (int pattern = 0; pattern < 4; ++pattern)
+      {
+        std::vector<int> data(1000);
+
+        for (int i = 0; i < 1000; ++i)
+        {
+          switch (pattern)
+          {
+            case 0:  data[i] = i;         break; // Sorted
+            case 1:  data[i] = 1000 - i;  break; // Reverse sorted
+            case 2:  data[i] = 7;         break; // All equal
+            default: data[i] = i % 37;    break; // Sawtooth
+          }
+        }
+
+        std::vector<int> compare(data);
+
+        std::sort(compare.begin(), compare.end());
+        etl::merge_sort(data.begin(), data.end(), etl::span<int>(scratch.data(), scratch.size()));
+
+        CHECK(compare == data);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_merge_sort_etl_vector_scratch)
+    {
+      std::vector<int> data(200);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = int(urng() % 1000U);
+      }
+
+      std::vector<int> compare(data);
+
+      etl::vector<int, 100> scratch(100U);
+
+      std::sort(compare.begin(), compare.end());
+      etl::merge_sort(data.begin(), data.end(), scratch);
+
+      CHECK(compare == data);
+    }
+
+    //*************************************************************************
+    TEST(test_merge_sort_move_only)
+    {
+      std::vector<std::unique_ptr<int>> data;
+
+      for (int i = 0; i < 300; ++i)
+      {
+        data.push_back(std::unique_ptr<int>(new int((i * 37) % 300)));
+      }
+
+      std::vector<std::unique_ptr<int>> scratch(50);
+
+      etl::merge_sort(data.begin(), data.end(), etl::span<std::unique_ptr<int>>(scratch.data(), scratch.size()),
+                      [](const std::unique_ptr<int>& lhs, const std::unique_ptr<int>& rhs) { return *lhs < *rhs; });
+
+      for (int i = 0; i < 300; ++i)
+      {
+        CHECK_EQUAL(i, *data[i]);
+      }
+    }
+  }
+}
@@ -31,6 +31,7 @@ SOFTWARE.
 #include "etl/message_router.h"
 #include "etl/queue.h"
 #include "etl/largest.h"
+#include "etl/integral_limits.h"
 
 //***************************************************************************
 // The set of messages.
@@ -345,6 +346,103 @@ namespace
 
   etl::imessage_router* p_router;
 
+  //***************************************************************************
+  // Routers for message ids that are not contiguous.
+  //***************************************************************************
+  template <etl::message_id_t Id>
+  struct IdMessage : public etl::message<Id>
+  {
+  };
+
+  template <etl::message_id_t Id1, etl::message_id_t Id2, etl::message_id_t Id3>
+  class SparseRouter : public etl::message_router<SparseRouter<Id1, Id2, Id3>, IdMessage<Id1>, IdMessage<Id2>, IdMessage<Id3>>
+  {
+  public:
+
+    SparseRouter()
+      : message_id1_count(0)
+      , message_id2_count(0)
+      , message_id3_count(0)
+      , message_unknown_count(0)
+    {
+    }
+
+    void on_receive(const IdMessage<Id1>&) { ++message_id1_count; }
+    void on_receive(const IdMessage<Id2>&) { ++message_id2_count; }
+    void on_receive(const IdMessage<Id3>&) { ++message_id3_count; }
+    void on_receive_unknown(const etl::imessage&) { ++message_unknown_count; }
+
+    int message_id1_count;
+    int message_id2_count;
+    int message_id3_count;
+    int message_unknown_count;
+  };
+
+  //***************************************************************************
+  // A message with a run time id.
+  //***************************************************************************
+  struct AnyMessage : public etl::imessage
+  {
+    explicit AnyMessage(etl::message_id_t id_)
+#if ETL_HAS_VIRTUAL_MESSAGES
+      : id(id_)
+    {
+    }
+
+    etl::message_id_t get_message_id() const ETL_NOEXCEPT ETL_OVERRIDE
+    {
+      return id;
+    }
+
+    etl::message_id_t id;
+#else
+      : imessage(id_)
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  template <etl::message_id_t Id1, etl::message_id_t Id2, etl::message_id_t Id3>
+  void check_sparse_router()
+  {
+    SparseRouter<Id1, Id2, Id3> router;
+
+    const IdMessage<Id1> message_id1;
+    const IdMessage<Id2> message_id2;
+    const IdMessage<Id3> message_id3;
+
+    int accepted = 0;
+
+    for (size_t i = 0U; i <= etl::integral_limits<etl::message_id_t>::max; ++i)
+    {
+      const etl::message_id_t id = static_cast<etl::message_id_t>(i);
+      const AnyMessage        message_other(id);
+
+      const etl::imessage& msg = (id == Id1) ? static_cast<const etl::imessage&>(message_id1)
+                               : (id == Id2) ? static_cast<const etl::imessage&>(message_id2)
+                               : (id == Id3) ? static_cast<const etl::imessage&>(message_id3)
+                               :               static_cast<const etl::imessage&>(message_other);
+
+      router.receive(msg);
+
+      const bool accepts = router.accepts(id);
+      CHECK_EQUAL((id == Id1) || (id == Id2) || (id == Id3), accepts);
+
+      accepted += accepts ? 1 : 0;
+    }
+
+    CHECK_EQUAL(3, accepted);
+    CHECK_EQUAL(1, router.message_id1_count);
+    CHECK_EQUAL(1, router.message_id2_count);
+    CHECK_EQUAL(1, router.message_id3_count);
+    CHECK_EQUAL(static_cast<int>(etl::integral_limits<etl::message_id_t>::max) - 2, router.message_unknown_count);
+  }
+
+  typedef SparseRouter<1U,  3U,   7U>   DenseIdRouter;  // Looked up by id offset.
+  typedef SparseRouter<1U,  100U, 200U> HashedIdRouter; // Looked up by perfect hash.
+  typedef SparseRouter<10U, 178U, 208U> SearchIdRouter; // No perfect hash within the table size, so binary searched.
+
   SUITE(test_message_router)
   {
     //*************************************************************************
@@ -829,5 +927,42 @@ namespace
 
       CHECK_FALSE(router.unknown_message_received);
     }
+    //*************************************************************************
+    TEST(message_router_dense_ids)
+    {
+      check_sparse_router<1U, 3U, 7U>();
+    }
+
+    //*************************************************************************
+    TEST(message_router_hashed_ids)
+    {
+      check_sparse_router<1U, 100U, 200U>();
+    }
+
+    //*************************************************************************
+    TEST(message_router_searched_ids)
+    {
+      check_sparse_router<10U, 178U, 208U>();
+    }
+
+#if ETL_USING_CPP11 && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(message_router_id_lookup_selection)
+    {
+      using dense_lookup  = etl::private_message_router::message_id_lookup<DenseIdRouter::sorted_message_types>;
+      using hashed_lookup = etl::private_message_router::message_id_lookup<HashedIdRouter::sorted_message_types>;
+      using search_lookup = etl::private_message_router::message_id_lookup<SearchIdRouter::sorted_message_types>;
+
+      CHECK_TRUE(dense_lookup::Use_Dense_Table);
+      CHECK_EQUAL(7U, dense_lookup::Dense_Table_Size);
+
+      CHECK_FALSE(hashed_lookup::Use_Dense_Table);
+      CHECK_TRUE(hashed_lookup::Use_Hash_Table);
+      CHECK_EQUAL(6U, hashed_lookup::Hash_Modulus);
+
+      CHECK_FALSE(search_lookup::Use_Dense_Table);
+      CHECK_FALSE(search_lookup::Use_Hash_Table);
+    }
+#endif
   }
 }
@@ -0,0 +1,370 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/message_router.h"
+#include "etl/message_bus.h"
+#include "etl/message_timer_wheel_locked.h"
+
+#include <vector>
+#include <utility>
+
+namespace
+{
+  uint64_t ticks = 0ULL;
+
+  //***************************************************************************
+  /// A non-recursive lock.
+  //***************************************************************************
+  struct Locks
+  {
+    Locks()
+      : locked(false)
+    {
+    }
+
+    bool try_lock()
+    {
+      if (locked)
+      {
+        return false;
+      }
+
+      locked = true;
+      return true;
+    }
+
+    void lock()
+    {
+      locked = true;
+    }
+
+    void unlock()
+    {
+      locked = false;
+    }
+
+    bool locked;
+  };
+
+  Locks locks;
+
+  typedef std::pair<int, uint64_t> Event;
+  typedef std::vector<Event>       Log;
+
+  enum
+  {
+    MESSAGE0,
+    MESSAGE1,
+    MESSAGE2
+  };
+
+  enum
+  {
+    ROUTER1 = 1,
+    ROUTER2 = 2
+  };
+
+  struct Message0 : public etl::message<MESSAGE0>
+  {
+  };
+
+  struct Message1 : public etl::message<MESSAGE1>
+  {
+  };
+
+  struct Message2 : public etl::message<MESSAGE2>
+  {
+  };
+
+  Message0 message0;
+  Message1 message1;
+  Message2 message2;
+
+  //***************************************************************************
+  /// Records the id of each message received, and the time.
+  //***************************************************************************
+  class Router1 : public etl::message_router<Router1, Message0, Message1, Message2>
+  {
+  public:
+
+    Router1()
+      : message_router(ROUTER1)
+    {
+    }
+
+    void on_receive(const Message0&)
+    {
+      log.push_back(Event(MESSAGE0, ticks));
+    }
+
+    void on_receive(const Message1&)
+    {
+      log.push_back(Event(MESSAGE1, ticks));
+    }
+
+    void on_receive(const Message2&)
+    {
+      log.push_back(Event(MESSAGE2, ticks));
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+
+    Log log;
+  };
+
+  // Four timers on a wheel of four slots, so that most periods wrap or lap the wheel.
+  using Controller          = etl::message_timer_wheel_locked<4, 4>;
+  using event_callback_type = etl::imessage_timer_wheel_locked::event_callback_type;
+  using try_lock_type = Controller::try_lock_type;
+  using lock_type     = Controller::lock_type;
+  using unlock_type   = Controller::unlock_type;
+
+  //***************************************************************************
+  /// Ticks one unit at a time.
+  //***************************************************************************
+  void tick_by_one(Controller& controller, uint32_t count)
+  {
+    for (uint32_t i = 0U; i < count; ++i)
+    {
+      ++ticks;
+      controller.tick(1U);
+    }
+  }
+
+  SUITE(test_message_timer_wheel_locked)
+  {
+    //*************************************************************************
+    TEST(message_timer_wheel_locked_register_unregister)
+    {
+      Controller controller(try_lock_type::create<Locks, locks, &Locks::try_lock>(),
+                            lock_type::create<Locks, locks, &Locks::lock>(),
+                            unlock_type::create<Locks, locks, &Locks::unlock>());
+
+      Router1 router;
+      etl::null_message_router null_router;
+
+      CHECK(controller.register_timer(message0, null_router, 1, etl::timer::mode::Single_Shot) == etl::timer::id::NO_TIMER);
+
+      etl::timer::id::type id0 = controller.register_timer(message0, router, 1, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id1 = controller.register_timer(message1, router, 1, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id2 = controller.register_timer(message2, router, 1, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id3 = controller.register_timer(message0, router, 1, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id4 = controller.register_timer(message1, router, 1, etl::timer::mode::Single_Shot);
+
+      CHECK(id3 != etl::timer::id::NO_TIMER);
+      CHECK(id4 == etl::timer::id::NO_TIMER);
+
+      controller.start(id1);
+      CHECK_TRUE(controller.unregister_timer(id1));
+      CHECK_FALSE(controller.unregister_timer(id1));
+      CHECK_FALSE(controller.is_active(id1));
+      CHECK_FALSE(controller.has_active_timer());
+      CHECK_FALSE(controller.start(id1));
+
+      // The freed id is reused.
+      CHECK_EQUAL(id1, controller.register_timer(message1, router, 1, etl::timer::mode::Single_Shot));
+
+      controller.start(id0);
+      controller.start(id2);
+      controller.clear();
+
+      CHECK_FALSE(controller.has_active_timer());
+      CHECK_EQUAL(0U, controller.register_timer(message0, router, 1, etl::timer::mode::Single_Shot));
+    }
+
+    //*************************************************************************
+    TEST(message_timer_wheel_locked_slot_wrap)
+    {
+      Controller controller(try_lock_type::create<Locks, locks, &Locks::try_lock>(),
+                            lock_type::create<Locks, locks, &Locks::lock>(),
+                            unlock_type::create<Locks, locks, &Locks::unlock>());
+
+      Router1 router;
+
+      // Period 3 visits slots 3, 2, 1, 0, 3 ...
+      etl::timer::id::type id0 = controller.register_timer(message0, router, 3, etl::timer::mode::Repeating);
+      etl::timer::id::type id1 = controller.register_timer(message1, router, 5, etl::timer::mode::Repeating);
+
+      controller.enable(true);
+      controller.start(id0);
+      controller.start(id1);
+
+      ticks = 0U;
+      tick_by_one(controller, 16U);
+
+      // Equal expiry times fire in reverse order of insertion.
+      Log expected = { Event(0, 3), Event(1, 5), Event(0, 6), Event(0, 9), Event(1, 10), Event(0, 12), Event(0, 15), Event(1, 15) };
+      CHECK(router.log == expected);
+
+      // One tick that wraps the wheel twice sends every message in between.
+      router.log.clear();
+      ticks += 8U;
+      CHECK_TRUE(controller.tick(8U));
+
+      expected = { Event(0, 24), Event(1, 24), Event(0, 24), Event(0, 24) };
+      CHECK(router.log == expected);
+      CHECK_EQUAL(1U, controller.time_to_next());
+    }
+
+    //*************************************************************************
+    TEST(message_timer_wheel_locked_multi_lap)
+    {
+      Controller controller(try_lock_type::create<Locks, locks, &Locks::try_lock>(),
+                            lock_type::create<Locks, locks, &Locks::lock>(),
+                            unlock_type::create<Locks, locks, &Locks::unlock>());
+
+      Router1 router;
+
+      // Period 9 shares slot 1 with times 1 and 5, period 4 is exactly one lap.
+      etl::timer::id::type id0 = controller.register_timer(message0, router, 9,    etl::timer::mode::Single_Shot);
+      etl::timer::id::type id1 = controller.register_timer(message1, router, 4,    etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = controller.register_timer(message2, router, 1000, etl::timer::mode::Single_Shot);
+
+      controller.enable(true);
+      controller.start(id0);
+      controller.start(id1);
+      controller.start(id2);
+
+      ticks = 0U;
+      CHECK_EQUAL(4U, controller.time_to_next());
+
+      tick_by_one(controller, 8U);
+
+      Log expected = { Event(1, 4), Event(1, 8) };
+      CHECK(router.log == expected);
+      CHECK_EQUAL(1U, controller.time_to_next());
+
+      tick_by_one(controller, 1U);
+
+      expected.push_back(Event(0, 9));
+      CHECK(router.log == expected);
+      CHECK_FALSE(controller.is_active(id0));
+
+      controller.stop(id1);
+      CHECK_EQUAL(991U, controller.time_to_next());
+
+      // Many laps in one tick, stopping just short of the expiry.
+      ticks += 990U;
+      controller.tick(990U);
+      CHECK(router.log == expected);
+      CHECK_EQUAL(1U, controller.time_to_next());
+
+      tick_by_one(controller, 1U);
+
+      expected.push_back(Event(2, 1000));
+      CHECK(router.log == expected);
+      CHECK_FALSE(controller.has_active_timer());
+      CHECK_EQUAL(static_cast<uint32_t>(etl::timer::interval::No_Active_Interval), controller.time_to_next());
+    }
+
+    //*************************************************************************
+    TEST(message_timer_wheel_locked_cancel_restart_across_slots)
+    {
+      Controller controller(try_lock_type::create<Locks, locks, &Locks::try_lock>(),
+                            lock_type::create<Locks, locks, &Locks::lock>(),
+                            unlock_type::create<Locks, locks, &Locks::unlock>());
+
+      Router1 router;
+
+      etl::timer::id::type id0 = controller.register_timer(message0, router, 3, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id1 = controller.register_timer(message1, router, 6, etl::timer::mode::Single_Shot);
+
+      controller.enable(true);
+      controller.start(id0);
+      controller.start(id1);
+
+      ticks = 0U;
+      tick_by_one(controller, 2U);
+
+      // Restarting moves the timer from slot 3 to slot 1.
+      controller.start(id0);
+      tick_by_one(controller, 1U);
+
+      CHECK(router.log.empty());
+      CHECK_EQUAL(2U, controller.time_to_next());
+
+      // Cancel the timer in slot 2.
+      controller.stop(id1);
+      tick_by_one(controller, 4U);
+
+      Log expected = { Event(0, 5) };
+      CHECK(router.log == expected);
+
+      // Restart with a new period that wraps, and one immediately.
+      controller.set_period(id1, 2U);
+      controller.start(id1);
+      controller.start(id0, etl::timer::start::Immediate);
+      tick_by_one(controller, 2U);
+
+      expected.push_back(Event(0, 8));
+      expected.push_back(Event(1, 9));
+      CHECK(router.log == expected);
+
+      // Unregistering removes the timer from its slot.
+      controller.start(id0);
+      CHECK_TRUE(controller.unregister_timer(id0));
+      tick_by_one(controller, 4U);
+
+      CHECK(router.log == expected);
+      CHECK_FALSE(controller.has_active_timer());
+    }
+
+    //*************************************************************************
+    TEST(message_timer_wheel_locked_route_through_bus)
+    {
+      Controller controller(try_lock_type::create<Locks, locks, &Locks::try_lock>(),
+                            lock_type::create<Locks, locks, &Locks::lock>(),
+                            unlock_type::create<Locks, locks, &Locks::unlock>());
+
+      Router1 router;
+      etl::message_bus<1> bus;
+
+      bus.subscribe(router);
+
+      etl::timer::id::type id0 = controller.register_timer(message0, bus, 2, etl::timer::mode::Single_Shot, ROUTER1);
+      etl::timer::id::type id1 = controller.register_timer(message1, bus, 3, etl::timer::mode::Single_Shot, ROUTER2);
+      etl::timer::id::type id2 = controller.register_timer(message2, bus, 5, etl::timer::mode::Single_Shot);
+
+      controller.enable(true);
+      controller.start(id0);
+      controller.start(id1);
+      controller.start(id2);
+
+      ticks = 0U;
+      tick_by_one(controller, 6U);
+
+      // Only the messages for this router, or for all routers, arrive.
+      Log expected = { Event(0, 2), Event(2, 5) };
+      CHECK(router.log == expected);
+    }
+  }
+}
@@ -31,6 +31,7 @@ SOFTWARE.
 #include "murmurhash3.h" // The 'C' reference implementation.
 
 #include <iterator>
+#include <list>
 #include <string>
 #include <vector>
 #include <type_traits>
@@ -135,6 +136,157 @@ namespace
       MurmurHash3_x86_32((uint8_t*)&data2[0], data2.size() * sizeof(uint32_t), 0, &compare2);
       CHECK_EQUAL(compare2, hash2);
     }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    TEST(test_murmur3_x64_128_constructor)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t length = 0U; length <= 100U; ++length)
+      {
+        const uint8_t* begin = data.data();
+
+        etl::murmur3_x64_128::value_type hash = etl::murmur3_x64_128(begin, begin + data.size(), 0x12345678UL);
+
+        uint64_t compare[2];
+        MurmurHash3_x64_128(begin, int(data.size()), 0x12345678UL, compare);
+
+        CHECK_EQUAL(compare[0], hash.low);
+        CHECK_EQUAL(compare[1], hash.high);
+
+        data.push_back(uint8_t(length * 37U + 11U));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_x64_128_add_values)
+    {
+      std::string data("The quick brown fox jumps over the lazy dog");
+
+      etl::murmur3_x64_128 murmur3_128_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        murmur3_128_calculator.add(data[i]);
+      }
+
+      etl::murmur3_x64_128::value_type hash = murmur3_128_calculator;
+
+      uint64_t compare[2];
+      MurmurHash3_x64_128(data.data(), int(data.size()), 0, compare);
+
+      CHECK_EQUAL(compare[0], hash.low);
+      CHECK_EQUAL(compare[1], hash.high);
+      CHECK_EQUAL(compare[0], murmur3_128_calculator.value64());
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_x64_128_add_range_in_pieces)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0U; i < 200U; ++i)
+      {
+        data.push_back(uint8_t(i * 101U + 7U));
+      }
+
+      uint64_t compare[2];
+      MurmurHash3_x64_128(data.data(), int(data.size()), 0, compare);
+
+      const etl::murmur3_x64_128_value expected = { compare[0], compare[1] };
+
+      // Split the data at every combination of block phase.
+      for (size_t first = 0U; first <= 40U; ++first)
+      {
+        for (size_t second = first; second <= 80U; second += 3U)
+        {
+          etl::murmur3_x64_128 murmur3_128_calculator;
+
+          murmur3_128_calculator.add(data.begin(), data.begin() + first);
+          murmur3_128_calculator.add(data.begin() + first, data.begin() + second);
+          murmur3_128_calculator.add(data[second]);
+          murmur3_128_calculator.add(data.begin() + second + 1, data.end());
+
+          CHECK_TRUE(expected == murmur3_128_calculator.value());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_x64_128_non_random_access_range)
+    {
+      std::list<uint8_t> data;
+
+      for (size_t i = 0U; i < 77U; ++i)
+      {
+        data.push_back(uint8_t(i * 13U));
+      }
+
+      std::vector<uint8_t> copy(data.begin(), data.end());
+
+      CHECK_TRUE(etl::murmur3_x64_128(copy.begin(), copy.end()).value() == etl::murmur3_x64_128(data.begin(), data.end()).value());
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_x64_128_value_then_add_and_reset)
+    {
+      std::string data("0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+
+      etl::murmur3_x64_128 murmur3_128_calculator(data.begin(), data.begin() + 20);
+
+      CHECK_TRUE(etl::murmur3_x64_128(data.begin(), data.begin() + 20).value() == murmur3_128_calculator.value());
+
+      murmur3_128_calculator.add(data.begin() + 20, data.end());
+
+      CHECK_TRUE(etl::murmur3_x64_128(data.begin(), data.end()).value() == murmur3_128_calculator.value());
+
+      murmur3_128_calculator.reset();
+      murmur3_128_calculator.add(data.begin(), data.end());
+
+      CHECK_TRUE(etl::murmur3_x64_128(data.begin(), data.end()).value() == murmur3_128_calculator.value());
+      CHECK_TRUE(etl::murmur3_x64_128(data.begin(), data.end()).value() != etl::murmur3_x64_128(data.begin(), data.end(), 1U).value());
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_x64_64)
+    {
+      std::string data("The quick brown fox jumps over the lazy dog");
+
+      for (uint32_t seed = 0U; seed < 3U; ++seed)
+      {
+        uint64_t hash = etl::murmur3_x64_64(data.begin(), data.end(), seed);
+
+        uint64_t compare[2];
+        MurmurHash3_x64_128(data.data(), int(data.size()), seed, compare);
+
+        CHECK_EQUAL(compare[0], hash);
+
+        etl::murmur3_x64_64 murmur3_64_calculator(seed);
+
+        for (size_t i = 0UL; i < data.size(); ++i)
+        {
+          murmur3_64_calculator.add(data[i]);
+        }
+
+        CHECK_EQUAL(compare[0], murmur3_64_calculator.value());
+      }
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_murmur3_x64_64_constexpr)
+    {
+      constexpr char data[] = "The quick brown fox jumps over the lazy dog";
+      constexpr uint64_t hash = etl::murmur3_x64_64(data, data + sizeof(data) - 1U).value();
+
+      uint64_t compare[2];
+      MurmurHash3_x64_128(data, int(sizeof(data) - 1U), 0, compare);
+
+      CHECK_EQUAL(compare[0], hash);
+    }
+#endif
+#endif
   }
 }
 
@@ -392,6 +392,27 @@ namespace
       CHECK(!pool.is_in_pool(&not_in_pool));
     }
 
+    //*************************************************************************
+    TEST(test_is_allocated)
+    {
+      etl::pool<Test_Data, 4> pool;
+      Test_Data not_in_pool;
+
+      CHECK(!pool.has_occupancy_bitmap());
+
+      Test_Data* p1 = pool.allocate();
+      Test_Data* p2 = pool.allocate();
+      Test_Data* p3 = pool.allocate();
+
+      pool.release(p2);
+
+      CHECK(pool.is_allocated(p1));
+      CHECK(!pool.is_allocated(p2));
+      CHECK(pool.is_allocated(p3));
+      CHECK(!pool.is_allocated(p3 + 1));
+      CHECK(!pool.is_allocated(&not_in_pool));
+    }
+
     //*************************************************************************
     TEST(test_type_error)
     {
@@ -0,0 +1,253 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/pool_atomic.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/reference_counted_message_pool.h"
+#include "etl/shared_message.h"
+#include "etl/message.h"
+
+#include <set>
+#include <vector>
+#include <thread>
+#include <atomic>
+
+#include "data.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  typedef TestDataDC<std::string>  Test_Data;
+  typedef TestDataNDC<std::string> Test_Data2;
+
+  //*************************************************************************
+  struct Message : public etl::message<1U>
+  {
+    Message(int i_)
+      : i(i_)
+    {
+    }
+
+    int i;
+  };
+
+  //*************************************************************************
+  // Every thread allocates a batch of items, marks them as its own, checks
+  // that nobody else has written to them, then releases them.
+  template <typename TPool>
+  bool no_item_is_shared(TPool& pool, int thread_id, int iterations)
+  {
+    bool ok = true;
+
+    for (int i = 0; (i < iterations) && ok; ++i)
+    {
+      uint32_t* items[4];
+
+      for (size_t j = 0U; j < 4U; ++j)
+      {
+        items[j] = pool.allocate();
+
+        if (items[j] != nullptr)
+        {
+          *items[j] = uint32_t(thread_id);
+        }
+      }
+
+      std::this_thread::yield();
+
+      for (size_t j = 0U; j < 4U; ++j)
+      {
+        if (items[j] != nullptr)
+        {
+          ok = ok && (*items[j] == uint32_t(thread_id));
+          pool.release(items[j]);
+        }
+      }
+    }
+
+    return ok;
+  }
+
+  SUITE(test_pool_atomic)
+  {
+    //*************************************************************************
+    TEST(test_allocate)
+    {
+      etl::pool_atomic<Test_Data, 4> pool;
+
+      CHECK(pool.empty());
+      CHECK_EQUAL(4U, pool.available());
+
+      std::set<Test_Data*> items;
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        Test_Data* p = pool.allocate();
+        CHECK(p != nullptr);
+        CHECK(pool.is_in_pool(p));
+        items.insert(p);
+      }
+
+      CHECK_EQUAL(4U, items.size());
+      CHECK(pool.full());
+      CHECK_EQUAL(4U, pool.size());
+
+      // No error, just a null pointer.
+      CHECK(pool.allocate() == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_release)
+    {
+      etl::pool_atomic<Test_Data, 4> pool;
+
+      Test_Data* p1 = pool.allocate();
+      Test_Data* p2 = pool.allocate();
+
+      pool.release(p1);
+      CHECK_EQUAL(1U, pool.size());
+
+      // The most recently released item is reused first.
+      CHECK(pool.allocate() == p1);
+
+      pool.release(p1);
+      pool.release(p2);
+      CHECK(pool.empty());
+
+      Test_Data not_in_pool;
+      CHECK_THROW(pool.release(&not_in_pool), etl::pool_object_not_in_pool);
+    }
+
+    //*************************************************************************
+    TEST(test_create_destroy)
+    {
+      etl::pool_atomic<Test_Data2, 4> pool;
+
+      Test_Data2* p = pool.create("ABC", 3);
+
+      CHECK(p != nullptr);
+      CHECK_EQUAL(std::string("ABC"), p->value);
+      CHECK_EQUAL(1U, pool.size());
+
+      pool.destroy(p);
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_generic_pool_atomic)
+    {
+      etl::generic_pool_atomic<sizeof(double), etl::alignment_of<double>::value, 2> pool;
+
+      double* pd = pool.allocate<double>();
+      int*    pi = pool.create<int>(42);
+
+      CHECK(pd != nullptr);
+      CHECK(pi != nullptr);
+      CHECK_EQUAL(42, *pi);
+      CHECK_EQUAL(sizeof(double), pool.max_item_size());
+
+      pool.release(pd);
+      pool.destroy(pi);
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      static etl::pool_atomic<uint32_t, 8> pool;
+
+      std::atomic<bool> ok(true);
+      std::vector<std::thread> threads;
+
+      for (int t = 0; t < 4; ++t)
+      {
+        threads.push_back(std::thread([t, &ok]()
+        {
+          if (!no_item_is_shared(pool, t, 20000))
+          {
+            ok = false;
+          }
+        }));
+      }
+
+      for (size_t t = 0U; t < threads.size(); ++t)
+      {
+        threads[t].join();
+      }
+
+      CHECK(ok);
+      CHECK(pool.empty());
+      CHECK_EQUAL(8U, pool.available());
+
+      // Every item is still in the free stack.
+      std::set<uint32_t*> items;
+
+      while (uint32_t* p = pool.allocate())
+      {
+        items.insert(p);
+      }
+
+      CHECK_EQUAL(8U, items.size());
+    }
+
+    //*************************************************************************
+    TEST(test_fixed_sized_memory_block_allocator)
+    {
+      using Rcm       = etl::reference_counted_message<Message, etl::atomic_int>;
+      using Pool      = etl::generic_pool_atomic<sizeof(Rcm), alignof(Rcm), 4>;
+      using Allocator = etl::fixed_sized_memory_block_allocator<sizeof(Rcm), alignof(Rcm), 4, Pool>;
+
+      Allocator allocator;
+      etl::atomic_counted_message_pool message_pool(allocator);
+
+      {
+        etl::shared_message sm1(message_pool, Message(1));
+        etl::shared_message sm2(sm1);
+        etl::shared_message sm3(message_pool, Message(3));
+
+        CHECK_EQUAL(1, static_cast<const Message&>(sm2.get_message()).i);
+        CHECK_EQUAL(3, static_cast<const Message&>(sm3.get_message()).i);
+      }
+
+      // All of the blocks have been returned.
+      std::vector<void*> blocks;
+
+      while (void* p = allocator.allocate(sizeof(Rcm), alignof(Rcm)))
+      {
+        blocks.push_back(p);
+      }
+
+      CHECK_EQUAL(4U, blocks.size());
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,259 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <set>
+#include <vector>
+
+#include "etl/pool.h"
+#include "etl/generic_pool.h"
+#include "etl/variant_pool.h"
+
+namespace
+{
+  struct Slot
+  {
+    uint32_t id;
+    char     data[20];
+  };
+
+  struct Small
+  {
+    uint16_t value;
+  };
+
+  struct Large
+  {
+    uint32_t values[9];
+  };
+
+  const size_t Size = 100U;
+
+  typedef etl::pool<Slot, Size, true> Pool;
+
+  //***************************************************************************
+  /// Checks the pool's view of allocated items against a reference set.
+  //***************************************************************************
+  bool pool_matches(const Pool& pool, const std::set<const Slot*>& allocated, const Slot* first)
+  {
+    for (size_t i = 0U; i < Size; ++i)
+    {
+      if (pool.is_allocated(first + i) != (allocated.count(first + i) != 0U))
+      {
+        return false;
+      }
+    }
+
+    std::vector<const Slot*> iterated;
+
+    for (Pool::const_iterator itr = pool.begin(); itr != pool.end(); ++itr)
+    {
+      iterated.push_back(static_cast<const Slot*>(*itr));
+    }
+
+    return (iterated.size() == allocated.size()) &&
+           std::equal(iterated.begin(), iterated.end(), allocated.begin());
+  }
+
+  SUITE(test_pool_occupancy_bitmap)
+  {
+    //*************************************************************************
+    TEST(test_has_occupancy_bitmap)
+    {
+      Pool pool;
+      etl::generic_pool<sizeof(Large), etl::alignment_of<Large>::value, 33U, true> gpool;
+      etl::variant_pool_with_occupancy<45U, Small, Large> vpool;
+
+      CHECK(pool.has_occupancy_bitmap());
+      CHECK(gpool.has_occupancy_bitmap());
+      CHECK(vpool.has_occupancy_bitmap());
+
+      // The default is still no bitmap, and no storage for one.
+      etl::pool<Slot, Size> plain_pool;
+      etl::variant_pool<45U, Small, Large> plain_vpool;
+
+      CHECK(!plain_pool.has_occupancy_bitmap());
+      CHECK(!plain_vpool.has_occupancy_bitmap());
+      CHECK(sizeof(Pool) > sizeof(plain_pool));
+
+#if defined(ETL_POLYMORPHIC_POOL) || defined(ETL_POLYMORPHIC_CONTAINERS)
+      const size_t vtable_size = sizeof(void*);
+#else
+      const size_t vtable_size = 0U;
+#endif
+
+      // No bitmap pointer in etl::ipool.
+      CHECK_EQUAL(vtable_size + (2U * sizeof(char*)) + (4U * sizeof(uint32_t)), sizeof(etl::ipool));
+      CHECK_EQUAL(sizeof(etl::ipool) + (Size * sizeof(Slot)), sizeof(plain_pool));
+
+#if ETL_USING_CPP11
+      // The bitmap would be bypassed through an etl::ipool.
+      CHECK((!etl::is_convertible<Pool*, etl::ipool*>::value));
+      CHECK((etl::is_convertible<Pool*, etl::ipool_with_occupancy*>::value));
+#endif
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_release_iterate)
+    {
+      Pool pool;
+      std::set<const Slot*> allocated;
+
+      CHECK(pool.begin() == pool.end());
+
+      // Fill the pool, so that all of the items are initialised.
+      const Slot* first = pool.allocate();
+      allocated.insert(first);
+
+      while (!pool.full())
+      {
+        allocated.insert(pool.allocate());
+      }
+
+      CHECK(pool_matches(pool, allocated, first));
+
+      // Release and reallocate in a scattered order.
+      uint32_t seed = 12345U;
+
+      for (size_t i = 0U; i < 2000U; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        const Slot* p = first + ((seed >> 16U) % Size);
+
+        if (allocated.count(p) != 0U)
+        {
+          pool.release(p);
+          allocated.erase(p);
+        }
+        else
+        {
+          allocated.insert(pool.allocate());
+        }
+
+        if ((i % 97U) == 0U)
+        {
+          CHECK(pool_matches(pool, allocated, first));
+        }
+      }
+
+      CHECK(pool_matches(pool, allocated, first));
+      CHECK_EQUAL(allocated.size(), pool.size());
+
+      // Leave items only in the last bitmap word.
+      for (size_t i = 0U; i < (Size - 3U); ++i)
+      {
+        if (allocated.count(first + i) != 0U)
+        {
+          pool.release(first + i);
+          allocated.erase(first + i);
+        }
+      }
+
+      CHECK(pool_matches(pool, allocated, first));
+
+      pool.release_all();
+      allocated.clear();
+
+      CHECK(pool_matches(pool, allocated, first));
+      CHECK(pool.begin() == pool.end());
+    }
+
+    //*************************************************************************
+    TEST(test_partially_initialised)
+    {
+      Pool pool;
+      std::set<const Slot*> allocated;
+
+      const Slot* first = pool.allocate();
+      allocated.insert(first);
+
+      for (size_t i = 0U; i < 40U; ++i)
+      {
+        allocated.insert(pool.allocate());
+      }
+
+      pool.release(first + 35);
+      allocated.erase(first + 35);
+      pool.release(first + 40);
+      allocated.erase(first + 40);
+
+      CHECK(pool_matches(pool, allocated, first));
+    }
+
+    //*************************************************************************
+    TEST(test_double_release)
+    {
+      Pool pool;
+
+      Slot* p1 = pool.allocate();
+      Slot* p2 = pool.allocate();
+
+      pool.release(p1);
+
+      CHECK_THROW(pool.release(p1), etl::pool_object_not_allocated);
+      CHECK_EQUAL(1U, pool.size());
+      CHECK(pool.is_allocated(p2));
+
+      // The free list is still intact.
+      CHECK(pool.allocate() == p1);
+      CHECK(pool.allocate() != p2);
+    }
+
+    //*************************************************************************
+    TEST(test_release_not_in_pool)
+    {
+      Pool pool;
+      Slot not_in_pool = Slot();
+
+      pool.allocate();
+
+      CHECK_THROW(pool.release(&not_in_pool), etl::pool_object_not_in_pool);
+      CHECK(!pool.is_allocated(&not_in_pool));
+      CHECK_EQUAL(1U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_variant_pool)
+    {
+      etl::variant_pool_with_occupancy<45U, Small, Large> vpool;
+
+      Small* ps = vpool.create<Small>();
+      Large* pl = vpool.create<Large>();
+
+      CHECK(vpool.is_allocated(ps));
+      CHECK(vpool.is_allocated(pl));
+
+      vpool.destroy(ps);
+
+      CHECK(!vpool.is_allocated(ps));
+      CHECK(vpool.is_allocated(pl));
+      CHECK(*vpool.begin() == static_cast<void*>(pl));
+    }
+  }
+}
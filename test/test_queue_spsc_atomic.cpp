@@ -31,6 +31,7 @@ SOFTWARE.
 #include <thread>
 #include <chrono>
 #include <vector>
+#include <iterator>
 
 #include "etl/queue_spsc_atomic.h"
 
@@ -394,6 +395,432 @@ namespace
       CHECK(queue.full());
     }
 
+    //*************************************************************************
+    TEST(test_push_range)
+    {
+      etl::queue_spsc_atomic<int, 5> queue;
+
+      int data[] = { 1, 2, 3, 4, 5, 6, 7 };
+
+      CHECK_EQUAL(3U, queue.push(data, data + 3));
+      CHECK_EQUAL(3U, queue.size());
+
+      // Only two more will fit.
+      CHECK_EQUAL(2U, queue.push(data + 3, data + 7));
+      CHECK_EQUAL(5U, queue.size());
+      CHECK(queue.full());
+
+      CHECK_EQUAL(0U, queue.push(data + 5, data + 7));
+
+      // Empty range.
+      CHECK_EQUAL(0U, queue.push(data, data));
+
+      int value;
+
+      for (int i = 1; i <= 5; ++i)
+      {
+        CHECK(queue.pop(value));
+        CHECK_EQUAL(i, value);
+      }
+
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_pop_range)
+    {
+      etl::queue_spsc_atomic<int, 5> queue;
+
+      int output[7] = { 0, 0, 0, 0, 0, 0, 0 };
+
+      CHECK_EQUAL(0U, queue.pop(output, 7U));
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+
+      CHECK_EQUAL(2U, queue.pop(output, 2U));
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+      CHECK_EQUAL(2U, queue.size());
+
+      CHECK_EQUAL(2U, queue.pop(output, 7U));
+      CHECK_EQUAL(3, output[0]);
+      CHECK_EQUAL(4, output[1]);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_range_wrap_around)
+    {
+      etl::queue_spsc_atomic<int, 5> queue;
+
+      int data[5];
+      int output[5];
+      int next_push = 0;
+      int next_pop  = 0;
+
+      for (int lap = 0; lap < 20; ++lap)
+      {
+        for (int i = 0; i < 5; ++i)
+        {
+          data[i] = next_push + i;
+        }
+
+        next_push += queue.push(data, data + 3);
+
+        size_t count = queue.pop(output, 2U);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+          CHECK_EQUAL(next_pop, output[i]);
+          ++next_pop;
+        }
+      }
+
+      size_t count = queue.pop(output, 5U);
+
+      for (size_t i = 0; i < count; ++i)
+      {
+        CHECK_EQUAL(next_pop, output[i]);
+        ++next_pop;
+      }
+
+      CHECK_EQUAL(next_push, next_pop);
+      CHECK(queue.empty());
+    }
+
+#if !defined(ETL_FORCE_TEST_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_move_pop_range)
+    {
+      etl::queue_spsc_atomic<ItemM, 4> queue;
+
+      queue.emplace(1);
+      queue.emplace(2);
+
+      std::vector<ItemM> output;
+
+      CHECK_EQUAL(2U, queue.pop(std::back_inserter(output), 4U));
+      CHECK_EQUAL(2U, output.size());
+      CHECK_EQUAL(1, output[0].value);
+      CHECK_EQUAL(2, output[1].value);
+      CHECK(queue.empty());
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_reserve_write_commit)
+    {
+      etl::queue_spsc_atomic<Data, 5> queue;
+
+      etl::span<Data> reserve = queue.reserve_write(3U);
+      CHECK_EQUAL(3U, reserve.size());
+
+      for (size_t i = 0U; i < reserve.size(); ++i)
+      {
+        ::new (&reserve[i]) Data(int(i), 2, 3, 4);
+      }
+
+      // Nothing is visible until committed.
+      CHECK(queue.empty());
+
+      queue.commit(3U);
+      CHECK_EQUAL(3U, queue.size());
+
+      // Asking for more than is free.
+      reserve = queue.reserve_write(10U);
+      CHECK_EQUAL(2U, reserve.size());
+
+      ::new (&reserve[0]) Data(3, 2, 3, 4);
+      queue.commit(1U);
+      CHECK_EQUAL(4U, queue.size());
+
+      Data popped;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK(queue.pop(popped));
+        CHECK(popped == Data(i, 2, 3, 4));
+      }
+
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_reserve_write_wrap_around)
+    {
+      etl::queue_spsc_atomic<int, 5> queue;
+
+      // Move the indexes to near the end of the buffer.
+      queue.push(0);
+      queue.push(0);
+      queue.push(0);
+      queue.push(0);
+      queue.pop();
+      queue.pop();
+      queue.pop();
+      queue.pop();
+
+      // Only the slots up to the end of the buffer are contiguous.
+      etl::span<int> reserve = queue.reserve_write(5U);
+      CHECK_EQUAL(2U, reserve.size());
+
+      reserve[0] = 1;
+      reserve[1] = 2;
+      queue.commit(2U);
+
+      // The remainder is at the start of the buffer.
+      reserve = queue.reserve_write(5U);
+      CHECK_EQUAL(3U, reserve.size());
+
+      reserve[0] = 3;
+      reserve[1] = 4;
+      reserve[2] = 5;
+      queue.commit(3U);
+
+      CHECK(queue.full());
+      CHECK_EQUAL(0U, queue.reserve_write(5U).size());
+
+      int output[5];
+      CHECK_EQUAL(5U, queue.pop(output, 5U));
+
+      for (int i = 0; i < 5; ++i)
+      {
+        CHECK_EQUAL(i + 1, output[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_commit_too_many)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      etl::span<int> reserve = queue.reserve_write(4U);
+      CHECK_EQUAL(4U, reserve.size());
+
+      CHECK_THROW(queue.commit(5U), etl::queue_spsc_atomic_reserve_invalid);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_cached_policy_layout)
+    {
+      typedef etl::queue_spsc_atomic<char, 4, etl::memory_model::MEMORY_MODEL_SMALL>                           Compact;
+      typedef etl::queue_spsc_atomic<char, 4, etl::memory_model::MEMORY_MODEL_SMALL, etl::spsc_policy_cached> Cached;
+
+      CHECK(sizeof(Compact) < ETL_CACHE_LINE_SIZE);
+      CHECK(sizeof(Cached) > (3 * ETL_CACHE_LINE_SIZE));
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop_cached_policy)
+    {
+      etl::queue_spsc_atomic<int, 4, etl::memory_model::MEMORY_MODEL_LARGE, etl::spsc_policy_cached> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+      CHECK_EQUAL(4U, queue.available());
+
+      CHECK(queue.push(1));
+      CHECK(queue.push(2));
+      CHECK(queue.push(3));
+      CHECK(queue.push(4));
+      CHECK_EQUAL(4U, queue.size());
+      CHECK_EQUAL(0U, queue.available());
+
+      // Queue full.
+      CHECK(!queue.push(5));
+
+      // The producer's copy of the read index is now out of date.
+      CHECK(queue.pop());
+      CHECK(queue.push(5));
+      CHECK(!queue.push(6));
+
+      CHECK(queue.pop());
+      CHECK(queue.push(6));
+
+      int i;
+
+      for (int expected = 3; expected <= 6; ++expected)
+      {
+        CHECK(queue.pop(i));
+        CHECK_EQUAL(expected, i);
+      }
+
+      CHECK(!queue.pop(i));
+
+      // The consumer's copy of the write index is now out of date.
+      CHECK(queue.push(7));
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(7, i);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_range_cached_policy)
+    {
+      etl::queue_spsc_atomic<int, 5, etl::memory_model::MEMORY_MODEL_LARGE, etl::spsc_policy_cached> queue;
+      etl::iqueue_spsc_atomic<int, etl::memory_model::MEMORY_MODEL_LARGE, etl::spsc_policy_cached>& iqueue = queue;
+
+      int data[5];
+      int output[5];
+      int next_push = 0;
+      int next_pop  = 0;
+
+      for (int lap = 0; lap < 20; ++lap)
+      {
+        for (int i = 0; i < 5; ++i)
+        {
+          data[i] = next_push + i;
+        }
+
+        next_push += iqueue.push(data, data + 3);
+
+        size_t count = iqueue.pop(output, 2U);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+          CHECK_EQUAL(next_pop, output[i]);
+          ++next_pop;
+        }
+      }
+
+      size_t count = iqueue.pop(output, 5U);
+
+      for (size_t i = 0; i < count; ++i)
+      {
+        CHECK_EQUAL(next_pop, output[i]);
+        ++next_pop;
+      }
+
+      CHECK_EQUAL(next_push, next_pop);
+      CHECK(iqueue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_reserve_write_commit_cached_policy)
+    {
+      etl::queue_spsc_atomic<int, 5, etl::memory_model::MEMORY_MODEL_LARGE, etl::spsc_policy_cached> queue;
+
+      etl::span<int> reserve = queue.reserve_write(5U);
+      CHECK_EQUAL(5U, reserve.size());
+
+      for (size_t i = 0U; i < reserve.size(); ++i)
+      {
+        reserve[i] = int(i);
+      }
+
+      queue.commit(5U);
+      CHECK(queue.full());
+      CHECK_EQUAL(0U, queue.reserve_write(5U).size());
+
+      int output[5];
+      CHECK_EQUAL(4U, queue.pop(output, 4U));
+
+      // The space at the end of the buffer is found after reloading the read index.
+      reserve = queue.reserve_write(5U);
+      CHECK_EQUAL(1U, reserve.size());
+      reserve[0] = 5;
+      queue.commit(1U);
+
+      reserve = queue.reserve_write(5U);
+      CHECK_EQUAL(3U, reserve.size());
+
+      CHECK_EQUAL(2U, queue.pop(output, 5U));
+      CHECK_EQUAL(4, output[0]);
+      CHECK_EQUAL(5, output[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_clear_cached_policy)
+    {
+      etl::queue_spsc_atomic<int, 4, etl::memory_model::MEMORY_MODEL_LARGE, etl::spsc_policy_cached> queue;
+
+      queue.push(1);
+      queue.push(2);
+      queue.pop();
+      queue.clear();
+      CHECK(queue.empty());
+
+      // The cached indexes must have been reset too.
+      CHECK(queue.push(3));
+      CHECK(queue.push(4));
+      CHECK(queue.push(5));
+      CHECK(queue.push(6));
+      CHECK(!queue.push(7));
+      CHECK_EQUAL(4U, queue.size());
+
+      int i;
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(3, i);
+    }
+
+    //*************************************************************************
+    etl::queue_spsc_atomic<int, 16, etl::memory_model::MEMORY_MODEL_LARGE, etl::spsc_policy_cached> cached_queue;
+
+    const int CACHED_LENGTH = 10000;
+
+    void cached_producer()
+    {
+      int value = 0;
+      int data[7];
+
+      while (value < CACHED_LENGTH)
+      {
+        if ((value % 3) == 0)
+        {
+          // Batch push.
+          int count = ((CACHED_LENGTH - value) < 7) ? (CACHED_LENGTH - value) : 7;
+
+          for (int i = 0; i < count; ++i)
+          {
+            data[i] = value + i;
+          }
+
+          value += int(cached_queue.push(data, data + count));
+        }
+        else if (cached_queue.push(value))
+        {
+          ++value;
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+    }
+
+    TEST(queue_threads_cached_policy)
+    {
+      std::thread producer(cached_producer);
+
+      int  expected = 0;
+      bool in_order = true;
+      int  output[5];
+
+      while (expected < CACHED_LENGTH)
+      {
+        size_t count = cached_queue.pop(output, 5U);
+
+        if (count == 0U)
+        {
+          std::this_thread::yield();
+        }
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+          in_order = in_order && (output[i] == expected);
+          ++expected;
+        }
+      }
+
+      producer.join();
+
+      CHECK(in_order);
+      CHECK(cached_queue.empty());
+    }
+
     //*************************************************************************
 #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
     #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
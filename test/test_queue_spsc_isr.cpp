@@ -624,6 +624,41 @@ namespace
       CHECK(!Access::called_unlock);
     }
 
+    //*************************************************************************
+    TEST(test_size_push_pop_cached_policy)
+    {
+      typedef etl::queue_spsc_isr<int, 4, Access, etl::memory_model::MEMORY_MODEL_LARGE, etl::spsc_policy_cached> Queue;
+
+      CHECK(sizeof(Queue) > (3 * ETL_CACHE_LINE_SIZE));
+
+      Queue queue;
+      etl::iqueue_spsc_isr<int, Access, etl::memory_model::MEMORY_MODEL_LARGE, etl::spsc_policy_cached>& iqueue = queue;
+
+      CHECK_EQUAL(0U, iqueue.size());
+
+      CHECK(iqueue.push(1));
+      CHECK(iqueue.push(2));
+      CHECK(iqueue.push_from_isr(3));
+      CHECK(iqueue.push_from_isr(4));
+      CHECK(!iqueue.push(5));
+      CHECK_EQUAL(4U, iqueue.size());
+
+      int i;
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(1, i);
+      CHECK(iqueue.push(5));
+
+      for (int expected = 2; expected <= 5; ++expected)
+      {
+        CHECK(iqueue.pop_from_isr(i));
+        CHECK_EQUAL(expected, i);
+      }
+
+      CHECK(!iqueue.pop(i));
+      CHECK(iqueue.empty());
+    }
+
     //*************************************************************************
 #if REALTIME_TEST
   #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
@@ -0,0 +1,301 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/radix_sort.h"
+#include "etl/vector.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+#include <stdint.h>
+
+namespace
+{
+  std::mt19937 urng(12345);
+
+  struct Record
+  {
+    uint32_t timestamp;
+    int      sequence;
+  };
+
+  bool operator <(const Record& lhs, const Record& rhs)
+  {
+    return lhs.timestamp < rhs.timestamp;
+  }
+
+  //***************************************************************************
+  template <typename T>
+  std::vector<T> make_random(size_t size)
+  {
+    std::vector<T> data(size);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+      data[i] = T(urng());
+    }
+
+    return data;
+  }
+
+  SUITE(test_radix_sort)
+  {
+    //*************************************************************************
+    TEST(test_radix_sort_uint32)
+    {
+      std::vector<uint32_t> data = make_random<uint32_t>(5000);
+      std::vector<uint32_t> compare(data);
+      std::vector<uint32_t> scratch(data.size());
+
+      std::sort(compare.begin(), compare.end());
+      etl::radix_sort(data.begin(), data.end(), etl::span<uint32_t>(scratch.data(), scratch.size()));
+
+      CHECK(compare == data);
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_uint64)
+    {
+      std::vector<uint64_t> data(5000);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = (uint64_t(urng()) << 32) | urng();
+      }
+
+      std::vector<uint64_t> compare(data);
+      std::vector<uint64_t> scratch(data.size());
+
+      std::sort(compare.begin(), compare.end());
+      etl::radix_sort(data.begin(), data.end(), etl::span<uint64_t>(scratch.data(), scratch.size()));
+
+      CHECK(compare == data);
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_int32)
+    {
+      std::vector<int32_t> data = make_random<int32_t>(5000);
+      data.push_back(std::numeric_limits<int32_t>::min());
+      data.push_back(std::numeric_limits<int32_t>::max());
+      data.push_back(0);
+      data.push_back(-1);
+
+      std::vector<int32_t> compare(data);
+      std::vector<int32_t> scratch(data.size());
+
+      std::sort(compare.begin(), compare.end());
+      etl::radix_sort(data.begin(), data.end(), etl::span<int32_t>(scratch.data(), scratch.size()));
+
+      CHECK(compare == data);
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_int8)
+    {
+      int8_t data[256];
+      int8_t scratch[256];
+
+      for (int i = 0; i < 256; ++i)
+      {
+        data[i] = int8_t(127 - i);
+      }
+
+      etl::radix_sort(data, data + 256, scratch);
+
+      CHECK(std::is_sorted(data, data + 256));
+      CHECK_EQUAL(-128, data[0]);
+      CHECK_EQUAL(127,  data[255]);
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_float)
+    {
+      std::uniform_real_distribution<float> distribution(-1000.0f, 1000.0f);
+
+      std::vector<float> data(5000);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = distribution(urng);
+      }
+
+      data.push_back(std::numeric_limits<float>::infinity());
+      data.push_back(-std::numeric_limits<float>::infinity());
+      data.push_back(std::numeric_limits<float>::max());
+      data.push_back(std::numeric_limits<float>::lowest());
+      data.push_back(0.0f);
+
+      std::vector<float> compare(data);
+      std::vector<float> scratch(data.size());
+
+      std::sort(compare.begin(), compare.end());
+      etl::radix_sort(data.begin(), data.end(), etl::span<float>(scratch.data(), scratch.size()));
+
+      CHECK(compare == data);
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_double_negative_zero)
+    {
+      double data[]    = { 1.0, 0.0, -0.0, -1.0, -2.5, 2.5 };
+      double scratch[] = { 0.0, 0.0,  0.0,  0.0,  0.0, 0.0 };
+
+      etl::radix_sort(std::begin(data), std::end(data), scratch);
+
+      CHECK_EQUAL(-2.5, data[0]);
+      CHECK_EQUAL(-1.0, data[1]);
+      CHECK(std::signbit(data[2]));
+      CHECK(!std::signbit(data[3]));
+      CHECK_EQUAL(1.0, data[4]);
+      CHECK_EQUAL(2.5, data[5]);
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_identical_digits_are_skipped)
+    {
+      // Only the lowest and highest bytes differ.
+      std::vector<uint32_t> data(1000);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = 0x00ABCD00UL | (urng() & 0xFF0000FFUL);
+      }
+
+      std::vector<uint32_t> compare(data);
+      std::vector<uint32_t> scratch(data.size());
+
+      std::sort(compare.begin(), compare.end());
+      etl::radix_sort(data.begin(), data.end(), etl::span<uint32_t>(scratch.data(), scratch.size()));
+
+      CHECK(compare == data);
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_already_sorted)
+    {
+      std::vector<uint32_t> data(1000);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = uint32_t(i * 1000U);
+      }
+
+      std::vector<uint32_t> compare(data);
+      std::vector<uint32_t> scratch(data.size());
+
+      etl::radix_sort(data.begin(), data.end(), etl::span<uint32_t>(scratch.data(), scratch.size()));
+
+      CHECK(compare == data);
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_key_projection_is_stable)
+    {
+      std::vector<Record> data(2000);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i].timestamp = urng() % 100U;
+        data[i].sequence  = int(i);
+      }
+
+      std::vector<Record> compare(data);
+      std::vector<Record> scratch(data.size());
+
+      std::stable_sort(compare.begin(), compare.end());
+      etl::radix_sort(data.begin(), data.end(), etl::span<Record>(scratch.data(), scratch.size()),
+                      [](const Record& record) { return record.timestamp; });
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(compare[i].timestamp, data[i].timestamp);
+        CHECK_EQUAL(compare[i].sequence,  data[i].sequence);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_key_projection_signed)
+    {
+      std::vector<Record> data(500);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i].timestamp = 0U;
+        data[i].sequence  = int(urng() % 1000U) - 500;
+      }
+
+      std::vector<Record> scratch(data.size());
+
+      etl::radix_sort(data.begin(), data.end(), etl::span<Record>(scratch.data(), scratch.size()),
+                      [](const Record& record) { return record.sequence; });
+
+      CHECK(std::is_sorted(data.begin(), data.end(), [](const Record& lhs, const Record& rhs) { return lhs.sequence < rhs.sequence; }));
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_etl_vector_scratch)
+    {
+      std::vector<uint16_t> data = make_random<uint16_t>(100);
+      std::vector<uint16_t> compare(data);
+
+      etl::vector<uint16_t, 100> scratch(100U);
+
+      std::sort(compare.begin(), compare.end());
+      etl::radix_sort(data.begin(), data.end(), scratch);
+
+      CHECK(compare == data);
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_empty_and_single)
+    {
+      uint32_t data[1]    = { 5U };
+      uint32_t scratch[1] = { 0U };
+
+      etl::radix_sort(data, data, scratch);
+      CHECK_EQUAL(5U, data[0]);
+
+      etl::radix_sort(data, data + 1, scratch);
+      CHECK_EQUAL(5U, data[0]);
+    }
+
+    //*************************************************************************
+    TEST(test_radix_sort_buffer_too_small)
+    {
+      uint32_t data[4]    = { 4U, 3U, 2U, 1U };
+      uint32_t scratch[3] = { 0U, 0U, 0U };
+
+      CHECK_THROW(etl::radix_sort(data, data + 4, scratch), etl::radix_sort_buffer_too_small);
+    }
+  }
+}
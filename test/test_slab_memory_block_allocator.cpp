@@ -0,0 +1,278 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/slab_memory_block_allocator.h"
+#include "etl/reference_counted_message_pool.h"
+#include "etl/shared_message.h"
+#include "etl/message.h"
+
+#include <vector>
+
+namespace
+{
+  // Classes of 32, 64, 128, 256 and 512 bytes, with 4 blocks in each.
+  using Slab = etl::slab_memory_block_allocator<32U, 5U, 4U, alignof(uint64_t)>;
+
+  //*************************************************************************
+  struct Small : public etl::message<1U>
+  {
+    Small(int i_)
+      : i(i_)
+    {
+    }
+
+    int i;
+  };
+
+  //*************************************************************************
+  struct Large : public etl::message<2U>
+  {
+    Large(int i_)
+      : i(i_)
+      , data()
+    {
+    }
+
+    int  i;
+    char data[200];
+  };
+
+  SUITE(test_slab_memory_block_allocator)
+  {
+    //*************************************************************************
+    TEST(test_sizes)
+    {
+      CHECK_EQUAL(32U,  Slab::Min_Block_Size);
+      CHECK_EQUAL(512U, Slab::Max_Block_Size);
+      CHECK_EQUAL(5U,   Slab::Classes);
+
+      CHECK_EQUAL(32U,  Slab::block_size(0U));
+      CHECK_EQUAL(512U, Slab::block_size(4U));
+
+      CHECK_EQUAL(0U, Slab::size_class(0U));
+      CHECK_EQUAL(0U, Slab::size_class(1U));
+      CHECK_EQUAL(0U, Slab::size_class(32U));
+      CHECK_EQUAL(1U, Slab::size_class(33U));
+      CHECK_EQUAL(1U, Slab::size_class(64U));
+      CHECK_EQUAL(2U, Slab::size_class(65U));
+      CHECK_EQUAL(3U, Slab::size_class(256U));
+      CHECK_EQUAL(4U, Slab::size_class(257U));
+      CHECK_EQUAL(4U, Slab::size_class(512U));
+      CHECK_EQUAL(5U, Slab::size_class(513U));
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_from_best_fit_class)
+    {
+      Slab slab;
+
+      for (size_t i = 0U; i < Slab::Classes; ++i)
+      {
+        const size_t size = Slab::block_size(i);
+
+        void* p = slab.allocate(size, 1U);
+        CHECK(p != nullptr);
+        CHECK(slab.is_owner_of(p));
+        CHECK_EQUAL(0U, reinterpret_cast<uintptr_t>(p) % alignof(uint64_t));
+        CHECK_EQUAL(1U, slab.allocated(i));
+        CHECK_EQUAL(3U, slab.available(i));
+      }
+
+      // Too large, or too strictly aligned.
+      CHECK(slab.allocate(513U, 1U) == nullptr);
+      CHECK(slab.allocate(8U, alignof(uint64_t) * 2U) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_blocks_do_not_overlap)
+    {
+      Slab slab;
+
+      std::vector<std::pair<char*, size_t>> blocks;
+
+      for (size_t i = 0U; i < Slab::Classes; ++i)
+      {
+        for (size_t j = 0U; j < Slab::Blocks_Per_Class; ++j)
+        {
+          char* p = static_cast<char*>(slab.allocate(Slab::block_size(i), 1U));
+          CHECK(p != nullptr);
+          blocks.push_back(std::make_pair(p, Slab::block_size(i)));
+        }
+      }
+
+      for (size_t i = 0U; i < blocks.size(); ++i)
+      {
+        for (size_t j = i + 1U; j < blocks.size(); ++j)
+        {
+          const bool overlap = (blocks[i].first < (blocks[j].first + blocks[j].second)) &&
+                               (blocks[j].first < (blocks[i].first + blocks[i].second));
+          CHECK(!overlap);
+        }
+      }
+
+      CHECK(slab.allocate(1U, 1U) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_release_returns_block_to_its_class)
+    {
+      Slab slab;
+
+      std::vector<void*> blocks;
+
+      for (size_t i = 0U; i < Slab::Classes; ++i)
+      {
+        for (size_t j = 0U; j < Slab::Blocks_Per_Class; ++j)
+        {
+          blocks.push_back(slab.allocate(Slab::block_size(i), 1U));
+        }
+      }
+
+      for (size_t i = 0U; i < blocks.size(); ++i)
+      {
+        CHECK(slab.release(blocks[i]));
+      }
+
+      for (size_t i = 0U; i < Slab::Classes; ++i)
+      {
+        CHECK_EQUAL(0U, slab.allocated(i));
+        CHECK_EQUAL(4U, slab.high_water_mark(i));
+      }
+
+      // The most recently released block of the class is reused.
+      void* p = slab.allocate(100U, 1U);
+      CHECK(p == blocks[(2U * Slab::Blocks_Per_Class) + 3U]);
+
+      int not_owned;
+      CHECK(!slab.release(&not_owned));
+      CHECK(!slab.is_owner_of(&not_owned));
+    }
+
+    //*************************************************************************
+    TEST(test_exhausted_class_uses_larger_class)
+    {
+      Slab slab;
+
+      for (size_t i = 0U; i < Slab::Blocks_Per_Class; ++i)
+      {
+        slab.allocate(20U, 1U);
+      }
+
+      void* p = slab.allocate(20U, 1U);
+      CHECK(p != nullptr);
+      CHECK_EQUAL(4U, slab.allocated(0U));
+      CHECK_EQUAL(1U, slab.allocated(1U));
+
+      slab.release(p);
+      CHECK_EQUAL(0U, slab.allocated(1U));
+    }
+
+    //*************************************************************************
+    TEST(test_high_water_mark)
+    {
+      Slab slab;
+
+      void* p1 = slab.allocate(64U, 1U);
+      void* p2 = slab.allocate(64U, 1U);
+      void* p3 = slab.allocate(64U, 1U);
+
+      slab.release(p1);
+      slab.release(p2);
+
+      CHECK_EQUAL(1U, slab.allocated(1U));
+      CHECK_EQUAL(3U, slab.high_water_mark(1U));
+      CHECK_EQUAL(0U, slab.high_water_mark(0U));
+
+      slab.reset_high_water_marks();
+      CHECK_EQUAL(1U, slab.high_water_mark(1U));
+
+      slab.release(p3);
+      CHECK_EQUAL(1U, slab.high_water_mark(1U));
+    }
+
+    //*************************************************************************
+    TEST(test_successor)
+    {
+      Slab slab;
+      Slab successor;
+
+      slab.set_successor(successor);
+
+      std::vector<void*> blocks;
+
+      for (size_t i = 0U; i < (2U * Slab::Blocks_Per_Class); ++i)
+      {
+        blocks.push_back(slab.allocate(512U, 1U));
+      }
+
+      CHECK(slab.allocate(512U, 1U) == nullptr);
+      CHECK_EQUAL(4U, slab.allocated(4U));
+      CHECK_EQUAL(4U, successor.allocated(4U));
+
+      for (size_t i = 0U; i < blocks.size(); ++i)
+      {
+        CHECK(slab.release(blocks[i]));
+      }
+
+      CHECK_EQUAL(0U, successor.allocated(4U));
+    }
+
+    //*************************************************************************
+    TEST(test_shared_message)
+    {
+      using Pool = etl::reference_counted_message_pool<int>;
+
+      Slab slab;
+      Pool pool(slab);
+
+      const size_t small_class = Slab::size_class(sizeof(etl::reference_counted_message<Small, int>));
+      const size_t large_class = Slab::size_class(sizeof(etl::reference_counted_message<Large, int>));
+
+      CHECK(small_class != large_class);
+
+      {
+        etl::shared_message sm1(pool, Small(1));
+        etl::shared_message sm2(pool, Large(2));
+        etl::shared_message sm3(sm1);
+
+        CHECK_EQUAL(1, static_cast<const Small&>(sm3.get_message()).i);
+        CHECK_EQUAL(2, static_cast<const Large&>(sm2.get_message()).i);
+
+        CHECK_EQUAL(1U, slab.allocated(small_class));
+        CHECK_EQUAL(1U, slab.allocated(large_class));
+      }
+
+      CHECK_EQUAL(0U, slab.allocated(small_class));
+      CHECK_EQUAL(0U, slab.allocated(large_class));
+      CHECK_EQUAL(1U, slab.high_water_mark(small_class));
+      CHECK_EQUAL(1U, slab.high_water_mark(large_class));
+    }
+  }
+}
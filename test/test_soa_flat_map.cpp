@@ -0,0 +1,424 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <map>
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "data.h"
+
+#include "etl/soa_flat_map.h"
+
+namespace
+{
+  using NDC = TestDataNDC<std::string>;
+
+  //*************************************************************************
+  // Random insertion, lookup and erasure, checked against std::map.
+  template <typename TMap>
+  bool churn_matches_std_map()
+  {
+    TMap data;
+    std::map<int, int> compare;
+
+    uint32_t seed = 12345U;
+
+    for (int i = 0; i < 5000; ++i)
+    {
+      seed = (seed * 1103515245U) + 12345U;
+      const int key = int((seed >> 8U) % 200U);
+
+      if (((seed >> 4U) & 1U) != 0U)
+      {
+        if (data.erase(key) != compare.erase(key))
+        {
+          return false;
+        }
+      }
+      else if (!data.full() || data.contains(key))
+      {
+        data[key] = i;
+        compare[key] = i;
+      }
+
+      const int probe = int((seed >> 16U) % 210U);
+
+      typename TMap::const_iterator itr = data.find(probe);
+      std::map<int, int>::const_iterator citr = compare.find(probe);
+
+      if ((itr == data.end()) != (citr == compare.end()))
+      {
+        return false;
+      }
+
+      if ((itr != data.end()) && ((itr.key() != citr->first) || (itr.mapped() != citr->second)))
+      {
+        return false;
+      }
+
+      if ((data.lower_bound(probe) - data.begin()) != std::distance(compare.begin(), compare.lower_bound(probe)) ||
+          (data.upper_bound(probe) - data.begin()) != std::distance(compare.begin(), compare.upper_bound(probe)))
+      {
+        return false;
+      }
+    }
+
+    if (data.size() != compare.size())
+    {
+      return false;
+    }
+
+    std::map<int, int>::const_iterator citr = compare.begin();
+
+    for (typename TMap::const_iterator itr = data.begin(); itr != data.end(); ++itr, ++citr)
+    {
+      if (((*itr).first != citr->first) || (itr->second != citr->second))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  SUITE(test_soa_flat_map)
+  {
+    static const size_t SIZE = 10;
+
+    using DataInt          = etl::soa_flat_map<int, int, SIZE>;
+    using DataIntEytzinger = etl::soa_flat_map<int, int, SIZE, etl::less<int>, etl::soa_flat_search::eytzinger>;
+    using IDataInt         = etl::isoa_flat_map<int, int>;
+    using DataNDC          = etl::soa_flat_map<std::string, NDC, SIZE>;
+    using DataNDCEytzinger = etl::soa_flat_map<std::string, NDC, SIZE, etl::less<std::string>, etl::soa_flat_search::eytzinger>;
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      DataInt data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_keeps_keys_sorted_and_contiguous)
+    {
+      DataInt data;
+
+      CHECK(data.insert(std::make_pair(5, 50)).second);
+      CHECK(data.insert(std::make_pair(1, 10)).second);
+      CHECK(data.insert(std::make_pair(3, 30)).second);
+      CHECK(!data.insert(std::make_pair(3, 99)).second);
+
+      const int expected_keys[]   = { 1, 3, 5 };
+      const int expected_values[] = { 10, 30, 50 };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_ARRAY_EQUAL(expected_keys,   data.keys(),   3);
+      CHECK_ARRAY_EQUAL(expected_values, data.values(), 3);
+    }
+
+    //*************************************************************************
+    TEST(test_range_constructor)
+    {
+      std::vector<std::pair<int, int>> initial = { { 4, 40 }, { 2, 20 }, { 8, 80 }, { 2, 99 }, { 6, 60 } };
+
+      DataIntEytzinger data(initial.begin(), initial.end());
+
+      CHECK_EQUAL(4U, data.size());
+      CHECK_EQUAL(20, data.at(2));
+      CHECK_EQUAL(40, data.at(4));
+      CHECK_EQUAL(60, data.at(6));
+      CHECK_EQUAL(80, data.at(8));
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    TEST(test_initializer_list_constructor)
+    {
+      DataInt data = { { 3, 30 }, { 1, 10 }, { 2, 20 } };
+
+      const int expected_keys[] = { 1, 2, 3 };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_ARRAY_EQUAL(expected_keys, data.keys(), 3);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_insert_full)
+    {
+      DataInt data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[i] = i;
+      }
+
+      CHECK(data.full());
+      CHECK_THROW(data.insert(std::make_pair(int(SIZE), 0)), etl::soa_flat_map_full);
+      CHECK_THROW(data[int(SIZE)], etl::soa_flat_map_full);
+
+      // Existing keys do not need space.
+      CHECK(!data.insert(std::make_pair(0, 1)).second);
+      data[0] = 1;
+      CHECK_EQUAL(1, data.at(0));
+    }
+
+    //*************************************************************************
+    TEST(test_range_insert_full_keeps_search_consistent)
+    {
+      std::vector<std::pair<int, int>> excess;
+
+      for (int i = 0; i < int(SIZE + 2U); ++i)
+      {
+        excess.push_back(std::make_pair(i, i * 10));
+      }
+
+      DataIntEytzinger data;
+
+      CHECK_THROW(data.insert(excess.begin(), excess.end()), etl::soa_flat_map_full);
+      CHECK(data.full());
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        CHECK(data.contains(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_at)
+    {
+      DataInt data;
+      data[2] = 20;
+
+      const DataInt& cdata = data;
+
+      CHECK_EQUAL(20, data.at(2));
+      CHECK_EQUAL(20, cdata.at(2));
+      CHECK_THROW(data.at(1), etl::soa_flat_map_out_of_range);
+      CHECK_THROW(cdata.at(3), etl::soa_flat_map_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_or_assign)
+    {
+      DataInt data;
+
+      CHECK(data.insert_or_assign(1, 10).second);
+      CHECK(!data.insert_or_assign(1, 11).second);
+      CHECK_EQUAL(11, data.at(1));
+    }
+
+    //*************************************************************************
+    TEST(test_try_emplace)
+    {
+      DataNDC data;
+
+      CHECK(data.try_emplace("B", "b").second);
+      CHECK(!data.try_emplace("B", "x").second);
+      CHECK(data.try_emplace("A", "a").second);
+
+      CHECK(data.begin().mapped() == NDC("a"));
+      CHECK(data.at("B") == NDC("b"));
+    }
+
+    //*************************************************************************
+    TEST(test_iterators)
+    {
+      DataInt data = { { 1, 10 }, { 2, 20 }, { 3, 30 } };
+
+      DataInt::iterator itr = data.begin();
+
+      CHECK_EQUAL(1, itr->first);
+      CHECK_EQUAL(10, itr->second);
+
+      itr->second = 11;
+      (*(itr + 1)).second = 21;
+      itr[2].second = 31;
+
+      CHECK_EQUAL(11, data.at(1));
+      CHECK_EQUAL(21, data.at(2));
+      CHECK_EQUAL(31, data.at(3));
+
+      CHECK_EQUAL(3, data.end() - data.begin());
+      CHECK(data.begin() < data.end());
+
+      DataInt::const_iterator citr = data.end();
+      --citr;
+      CHECK_EQUAL(3, citr.key());
+      CHECK(citr == (data.begin() + 2));
+
+      DataInt::reverse_iterator ritr = data.rbegin();
+      CHECK_EQUAL(3, ritr->first);
+      ++ritr;
+      CHECK_EQUAL(2, (*ritr).first);
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      DataIntEytzinger data = { { 1, 10 }, { 2, 20 }, { 3, 30 }, { 4, 40 }, { 5, 50 } };
+
+      CHECK_EQUAL(1U, data.erase(3));
+      CHECK_EQUAL(0U, data.erase(3));
+      CHECK(!data.contains(3));
+
+      DataIntEytzinger::iterator itr = data.erase(data.find(1));
+      CHECK_EQUAL(2, itr->first);
+
+      itr = data.erase(data.find(2), data.find(5));
+      CHECK_EQUAL(5, itr->first);
+
+      CHECK_EQUAL(1U, data.size());
+      CHECK(data.contains(5));
+      CHECK(!data.contains(4));
+
+      data.clear();
+      CHECK(data.empty());
+      CHECK(data.find(5) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_equal_range)
+    {
+      DataInt data = { { 2, 20 }, { 4, 40 } };
+
+      std::pair<DataInt::iterator, DataInt::iterator> range = data.equal_range(2);
+      CHECK_EQUAL(1, std::distance(range.first, range.second));
+      CHECK_EQUAL(2, range.first->first);
+
+      range = data.equal_range(3);
+      CHECK(range.first == range.second);
+      CHECK_EQUAL(4, range.first->first);
+    }
+
+    //*************************************************************************
+    TEST(test_churn_binary)
+    {
+      CHECK((churn_matches_std_map<etl::soa_flat_map<int, int, 100>>()));
+    }
+
+    //*************************************************************************
+    TEST(test_churn_eytzinger)
+    {
+      CHECK((churn_matches_std_map<etl::soa_flat_map<int, int, 100, etl::less<int>, etl::soa_flat_search::eytzinger>>()));
+    }
+
+    //*************************************************************************
+    TEST(test_eytzinger_all_sizes)
+    {
+      etl::soa_flat_map<int, int, 40, etl::less<int>, etl::soa_flat_search::eytzinger> data;
+
+      for (int size = 0; size < 40; ++size)
+      {
+        for (int key = -1; key <= (2 * size); ++key)
+        {
+          const int expected_lower = (key < 0) ? 0 : (key / 2);
+
+          CHECK_EQUAL(expected_lower, std::distance(data.begin(), data.lower_bound(key)));
+          CHECK_EQUAL(((key >= 0) && ((key % 2) == 1) && (key < (2 * size))), data.contains(key));
+        }
+
+        data[(2 * size) + 1] = size;
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_move)
+    {
+      DataNDCEytzinger data;
+      data.insert(std::make_pair(std::string("B"), NDC("b")));
+      data.insert(std::make_pair(std::string("A"), NDC("a")));
+
+      DataNDCEytzinger copy(data);
+      CHECK(copy == data);
+
+      DataNDCEytzinger moved(std::move(copy));
+      CHECK(moved == data);
+      CHECK(copy.empty());
+      CHECK(moved.find("A") != moved.end());
+
+      DataNDCEytzinger assigned;
+      assigned = data;
+      CHECK(assigned == data);
+
+      assigned.erase("A");
+      CHECK(assigned != data);
+
+      assigned = std::move(moved);
+      CHECK(assigned == data);
+      CHECK(moved.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_interface)
+    {
+      DataInt data;
+      IDataInt& idata = data;
+
+      idata[2] = 20;
+      idata[1] = 10;
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(1, data.begin()->first);
+    }
+
+    //*************************************************************************
+    TEST(test_destroys_all_elements)
+    {
+      int current_count = NDC::get_instance_count();
+
+      {
+        DataNDCEytzinger data;
+
+        for (int i = 0; i < 100; ++i)
+        {
+          data.insert(std::make_pair(std::to_string(i), NDC("A")));
+
+          if (data.size() == SIZE)
+          {
+            data.erase(data.begin() + (i % SIZE));
+          }
+        }
+
+        CHECK_EQUAL(current_count + int(SIZE) - 1, NDC::get_instance_count());
+      }
+
+      CHECK_EQUAL(current_count, NDC::get_instance_count());
+    }
+  }
+}
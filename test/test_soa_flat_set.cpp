@@ -0,0 +1,249 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "data.h"
+
+#include "etl/soa_flat_set.h"
+
+namespace
+{
+  using NDC = TestDataNDC<std::string>;
+
+  //*************************************************************************
+  // Random insertion, lookup and erasure, checked against std::set.
+  template <typename TSet>
+  bool churn_matches_std_set()
+  {
+    TSet data;
+    std::set<int> compare;
+
+    uint32_t seed = 54321U;
+
+    for (int i = 0; i < 5000; ++i)
+    {
+      seed = (seed * 1103515245U) + 12345U;
+      const int key = int((seed >> 8U) % 200U);
+
+      if (((seed >> 4U) & 1U) != 0U)
+      {
+        if (data.erase(key) != compare.erase(key))
+        {
+          return false;
+        }
+      }
+      else if (!data.full())
+      {
+        if (data.insert(key).second != compare.insert(key).second)
+        {
+          return false;
+        }
+      }
+
+      const int probe = int((seed >> 16U) % 210U);
+
+      if ((data.find(probe) == data.end()) != (compare.find(probe) == compare.end()))
+      {
+        return false;
+      }
+
+      if ((data.lower_bound(probe) - data.begin()) != std::distance(compare.begin(), compare.lower_bound(probe)) ||
+          (data.upper_bound(probe) - data.begin()) != std::distance(compare.begin(), compare.upper_bound(probe)))
+      {
+        return false;
+      }
+    }
+
+    return (data.size() == compare.size()) && std::equal(data.begin(), data.end(), compare.begin());
+  }
+
+  SUITE(test_soa_flat_set)
+  {
+    static const size_t SIZE = 10;
+
+    using DataInt          = etl::soa_flat_set<int, SIZE>;
+    using DataIntEytzinger = etl::soa_flat_set<int, SIZE, etl::less<int>, etl::soa_flat_search::eytzinger>;
+    using IDataInt         = etl::isoa_flat_set<int>;
+    using DataNDCEytzinger = etl::soa_flat_set<NDC, SIZE, etl::less<NDC>, etl::soa_flat_search::eytzinger>;
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      DataInt data;
+
+      CHECK(data.empty());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_keeps_keys_sorted)
+    {
+      DataIntEytzinger data;
+
+      CHECK(data.insert(5).second);
+      CHECK(data.insert(1).second);
+      CHECK(data.insert(3).second);
+      CHECK(!data.insert(3).second);
+
+      const int expected[] = { 1, 3, 5 };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_ARRAY_EQUAL(expected, data.data(), 3);
+      CHECK_EQUAL(3, *data.find(3));
+      CHECK(data.find(4) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_full)
+    {
+      std::vector<int> excess = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+
+      DataIntEytzinger data;
+
+      CHECK_THROW(data.insert(excess.begin(), excess.end()), etl::soa_flat_set_full);
+      CHECK(data.full());
+      CHECK(data.contains(10));
+      CHECK(!data.contains(11));
+      CHECK_THROW(data.insert(11), etl::soa_flat_set_full);
+      CHECK(!data.insert(1).second);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    TEST(test_initializer_list_constructor)
+    {
+      DataInt data = { 3, 1, 2, 1 };
+
+      const int expected[] = { 1, 2, 3 };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_ARRAY_EQUAL(expected, data.data(), 3);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      DataInt data = { 1, 2, 3, 4, 5 };
+
+      CHECK_EQUAL(1U, data.erase(3));
+      CHECK_EQUAL(0U, data.erase(3));
+
+      DataInt::iterator itr = data.erase(data.find(1));
+      CHECK_EQUAL(2, *itr);
+
+      itr = data.erase(data.find(2), data.find(5));
+      CHECK_EQUAL(5, *itr);
+      CHECK_EQUAL(1U, data.size());
+
+      data.clear();
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_churn_binary)
+    {
+      CHECK((churn_matches_std_set<etl::soa_flat_set<int, 100>>()));
+    }
+
+    //*************************************************************************
+    TEST(test_churn_eytzinger)
+    {
+      CHECK((churn_matches_std_set<etl::soa_flat_set<int, 100, etl::less<int>, etl::soa_flat_search::eytzinger>>()));
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_move)
+    {
+      DataNDCEytzinger data;
+      data.insert(NDC("B"));
+      data.insert(NDC("A"));
+
+      DataNDCEytzinger copy(data);
+      CHECK(copy == data);
+
+      DataNDCEytzinger moved(std::move(copy));
+      CHECK(moved == data);
+      CHECK(copy.empty());
+      CHECK(moved.contains(NDC("A")));
+
+      DataNDCEytzinger assigned;
+      assigned = data;
+      CHECK(assigned == data);
+
+      assigned.erase(NDC("A"));
+      CHECK(assigned != data);
+    }
+
+    //*************************************************************************
+    TEST(test_interface)
+    {
+      DataInt data;
+      IDataInt& idata = data;
+
+      idata.insert(2);
+      idata.insert(1);
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(1, *data.begin());
+      CHECK_EQUAL(2, *data.rbegin());
+    }
+
+    //*************************************************************************
+    TEST(test_destroys_all_elements)
+    {
+      int current_count = NDC::get_instance_count();
+
+      {
+        DataNDCEytzinger data;
+
+        for (int i = 0; i < 100; ++i)
+        {
+          data.insert(NDC(std::to_string(i)));
+
+          if (data.size() == SIZE)
+          {
+            data.erase(data.begin() + (i % SIZE));
+          }
+        }
+
+        // The Eytzinger copy holds a second instance of each key.
+        CHECK_EQUAL(current_count + (2 * (int(SIZE) - 1)), NDC::get_instance_count());
+      }
+
+      CHECK_EQUAL(current_count, NDC::get_instance_count());
+    }
+  }
+}
@@ -185,6 +185,18 @@ namespace
       ss << etl::setprecision(4) << 3.1415927;
       CHECK_EQUAL(String(STR("3.1416")), ss.str());
 
+      ss.str().clear();
+      ss << etl::shortest << 3.1415927 << STR(" ") << 0.1f;
+      CHECK_EQUAL(String(STR("3.1415927 0.1")), ss.str());
+
+      ss.str().clear();
+      ss << etl::setnotation(etl::float_notation::shortest_scientific) << 1234.5;
+      CHECK_EQUAL(String(STR("1.2345e+03")), ss.str());
+
+      ss.str().clear();
+      ss << etl::setnotation(etl::float_notation::fixed_precision) << 3.1415927;
+      CHECK_EQUAL(String(STR("3.1416")), ss.str());
+
       ss.str().clear();
       ss << STR("abcdef") << STR(" ") << etl::uppercase << STR("abcdef");
       CHECK_EQUAL(String(STR("abcdef abcdef")), ss.str());
@@ -1027,6 +1027,115 @@ namespace
       CHECK_EQUAL(83, int(etl::to_arithmetic<int8_t>(ETLText(text.c_str(), text.size()), etl::radix::decimal).value()));
     }
 
+    //*************************************************************************
+    TEST(test_long_decimal_numerics)
+    {
+      // Runs of eight or more digits are converted a block at a time.
+      const Text valid(STR("18446744073709551615"));
+      CHECK_EQUAL(UINT64_MAX, etl::to_arithmetic<uint64_t>(valid.c_str(), valid.size()).value());
+
+      const Text overflow(STR("18446744073709551616"));
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<uint64_t>(overflow.c_str(), overflow.size()).error());
+
+      const Text minimum(STR("-9223372036854775808"));
+      CHECK_EQUAL(INT64_MIN, etl::to_arithmetic<int64_t>(minimum.c_str(), minimum.size()).value());
+
+      const Text leading_zeros(STR("00000000000000004294967295"));
+      CHECK_EQUAL(UINT32_MAX, etl::to_arithmetic<uint32_t>(leading_zeros.c_str(), leading_zeros.size()).value());
+
+      const Text overflow32(STR("4294967296"));
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<uint32_t>(overflow32.c_str(), overflow32.size()).error());
+
+      const Text overflow8(STR("12345678"));
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<int8_t>(overflow8.c_str(), overflow8.size()).error());
+
+      // An invalid character in any position of a block.
+      for (size_t i = 0U; i < 16U; ++i)
+      {
+        Text invalid(STR("1234567812345678"));
+        invalid[i] = STR('/');
+        CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<uint64_t>(invalid.c_str(), invalid.size()).error());
+
+        invalid[i] = STR(':');
+        CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<uint64_t>(invalid.c_str(), invalid.size()).error());
+      }
+
+      // Overflow is reported before a later invalid character.
+      const Text overflow_then_invalid(STR("99999999999999999999x"));
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<uint64_t>(overflow_then_invalid.c_str(), overflow_then_invalid.size()).error());
+    }
+
+    //*************************************************************************
+    TEST(test_long_hex_numerics)
+    {
+      const Text mixed_case(STR("DeadBeefCafeF00d"));
+      CHECK_EQUAL(0xDEADBEEFCAFEF00DULL, etl::to_arithmetic<uint64_t>(mixed_case.c_str(), mixed_case.size(), etl::radix::hexadecimal).value());
+
+      const Text all_digits(STR("0123456789abcdef"));
+      CHECK_EQUAL(0x0123456789ABCDEFULL, etl::to_arithmetic<uint64_t>(all_digits.c_str(), all_digits.size(), etl::radix::hexadecimal).value());
+
+      const Text max32(STR("FFFFFFFF"));
+      CHECK_EQUAL(UINT32_MAX, etl::to_arithmetic<uint32_t>(max32.c_str(), max32.size(), etl::radix::hexadecimal).value());
+      CHECK_EQUAL(-1, etl::to_arithmetic<int32_t>(max32.c_str(), max32.size(), etl::radix::hexadecimal).value());
+
+      const Text overflow32(STR("1FFFFFFFF"));
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<uint32_t>(overflow32.c_str(), overflow32.size(), etl::radix::hexadecimal).error());
+
+      const Text overflow64(STR("10000000000000000"));
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<uint64_t>(overflow64.c_str(), overflow64.size(), etl::radix::hexadecimal).error());
+
+      const Text invalid(STR("12345g78"));
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<uint32_t>(invalid.c_str(), invalid.size(), etl::radix::hexadecimal).error());
+
+      const Text not_letter(STR("1234567@"));
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<uint32_t>(not_letter.c_str(), not_letter.size(), etl::radix::hexadecimal).error());
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_correctly_rounded)
+    {
+      Text text;
+
+      text = STR("0.1");
+      CHECK_EQUAL(0.1, etl::to_arithmetic<double>(text.c_str(), text.size()).value());
+      CHECK_EQUAL(0.1f, etl::to_arithmetic<float>(text.c_str(), text.size()).value());
+
+      text = STR("1.7976931348623157e308");
+      CHECK_EQUAL(std::numeric_limits<double>::max(), etl::to_arithmetic<double>(text.c_str(), text.size()).value());
+
+      text = STR("1.8e308");
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<double>(text.c_str(), text.size()).error());
+
+      text = STR("2.2250738585072014E-308");
+      CHECK_EQUAL(std::numeric_limits<double>::min(), etl::to_arithmetic<double>(text.c_str(), text.size()).value());
+
+      text = STR("4.9406564584124654e-324");
+      CHECK_EQUAL(std::numeric_limits<double>::denorm_min(), etl::to_arithmetic<double>(text.c_str(), text.size()).value());
+
+      text = STR("3.4028235e38");
+      CHECK_EQUAL(std::numeric_limits<float>::max(), etl::to_arithmetic<float>(text.c_str(), text.size()).value());
+
+      text = STR("1e39");
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow, etl::to_arithmetic<float>(text.c_str(), text.size()).error());
+
+      // Half way between two doubles rounds to even.
+      text = STR("9007199254740993");
+      CHECK_EQUAL(9007199254740992.0, etl::to_arithmetic<double>(text.c_str(), text.size()).value());
+
+      text = STR("9007199254740995");
+      CHECK_EQUAL(9007199254740996.0, etl::to_arithmetic<double>(text.c_str(), text.size()).value());
+
+      // More than 19 significant digits.
+      text = STR("3.14159265358979323846264338327950288");
+      CHECK_EQUAL(3.14159265358979323846, etl::to_arithmetic<double>(text.c_str(), text.size()).value());
+
+      text = STR("0.000000000000000000000000000000000012345678901234567");
+      CHECK_EQUAL(1.2345678901234567e-35, etl::to_arithmetic<double>(text.c_str(), text.size()).value());
+
+      text = STR("123,456");
+      CHECK_EQUAL(123.456, etl::to_arithmetic<double>(text.c_str(), text.size()).value());
+    }
+
     //*************************************************************************
 #if ETL_USING_CPP14
     TEST(test_constexpr_integral)
@@ -1038,6 +1147,19 @@ namespace
 
       CHECK_EQUAL(123, i);
     }
+
+    //*************************************************************************
+    TEST(test_constexpr_integral_blocks)
+    {
+      constexpr Text::const_pointer decimal_text{ STR("1234567890123456") };
+      constexpr Text::const_pointer hex_text{ STR("0123456789aBcDeF") };
+
+      constexpr uint64_t decimal = etl::to_arithmetic<uint64_t>(decimal_text, 16U, etl::radix::decimal).value();
+      constexpr uint64_t hex     = etl::to_arithmetic<uint64_t>(hex_text, 16U, etl::radix::hexadecimal).value();
+
+      CHECK_EQUAL(1234567890123456ULL, decimal);
+      CHECK_EQUAL(0x0123456789ABCDEFULL, hex);
+    }
 #endif
   }
 }
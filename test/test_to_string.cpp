@@ -31,6 +31,10 @@ SOFTWARE.
 #include <ostream>
 #include <sstream>
 #include <iomanip>
+#include <string>
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
 
 #include "etl/to_string.h"
 #include "etl/string.h"
@@ -106,6 +110,42 @@ namespace
       CHECK(etl::string<120>(STR("000012832768214748364892233720368547758081273276721474836479223372036854775807-128-32768-2147483648-9223372036854775808")) == etl::to_string(INT64_MIN, str, true));
     }
 
+    //*************************************************************************
+    TEST(test_decimal_digit_count_boundaries)
+    {
+      etl::string<20> str;
+      etl::string<20> nines;
+      etl::string<20> power(STR("1"));
+
+      uint64_t value = 1U;
+
+      for (int digits = 1; digits < 20; ++digits)
+      {
+        CHECK(power == etl::to_string(value, str));
+        CHECK(nines == etl::to_string(value - 1U, str) || (digits == 1));
+
+        nines.push_back(STR('9'));
+        power.push_back(STR('0'));
+        value *= 10U;
+      }
+
+      CHECK(etl::string<20>(STR("18446744073709551615")) == etl::to_string(UINT64_MAX, str));
+      CHECK(etl::string<20>(STR("4294967295")) == etl::to_string(UINT32_MAX, str));
+      CHECK(etl::string<20>(STR("4294967296")) == etl::to_string(uint64_t(4294967296ull), str));
+      CHECK(etl::string<20>(STR("-1")) == etl::to_string(int64_t(-1), str));
+    }
+
+    //*************************************************************************
+    TEST(test_decimal_does_not_fit)
+    {
+      etl::string<4> str(STR("ab"));
+
+      // Only the trailing digits that fit are kept.
+      CHECK(etl::string<4>(STR("ab45")) == etl::to_string(12345, str, true));
+      CHECK(etl::string<4>(STR("1234")) == etl::to_string(-1234, str));
+      CHECK(etl::string<4>(STR("-123")) == etl::to_string(-123, str));
+    }
+
     //*************************************************************************
     TEST(test_format_right_justified_no_append)
     {
@@ -326,6 +366,107 @@ namespace
       CHECK(etl::string<20>(STR("20.0")) ==    etl::to_string(19.999999, str, Format().precision(1).width(4).right()));
     }
 
+    //*************************************************************************
+    TEST(test_floating_point_shortest)
+    {
+      etl::string<40> str;
+
+      CHECK(etl::string<40>(STR("0.1")) ==                     etl::to_string(0.1, str, Format().shortest()));
+      CHECK(etl::string<40>(STR("0.30000000000000004")) ==     etl::to_string(0.1 + 0.2, str, Format().shortest()));
+      CHECK(etl::string<40>(STR("-12.345678")) ==              etl::to_string(-12.345678, str, Format().shortest()));
+      CHECK(etl::string<40>(STR("1.2345678")) ==               etl::to_string(1.2345678f, str, Format().shortest()));
+      CHECK(etl::string<40>(STR("0.1")) ==                     etl::to_string(0.1f, str, Format().shortest()));
+      CHECK(etl::string<40>(STR("100")) ==                     etl::to_string(100.0, str, Format().shortest()));
+      CHECK(etl::string<40>(STR("1e+20")) ==                   etl::to_string(1e20, str, Format().shortest()));
+      CHECK(etl::string<40>(STR("1e-05")) ==                   etl::to_string(1e-5, str, Format().shortest()));
+      CHECK(etl::string<40>(STR("1e-04")) ==                   etl::to_string(1e-4, str, Format().shortest()));
+      CHECK(etl::string<40>(STR("0.001")) ==                   etl::to_string(1e-3, str, Format().shortest()));
+      CHECK(etl::string<40>(STR("1.7976931348623157e+308")) == etl::to_string(1.7976931348623157e308, str, Format().shortest()));
+      CHECK(etl::string<40>(STR("5e-324")) ==                  etl::to_string(5e-324, str, Format().shortest()));
+      CHECK(etl::string<40>(STR("1e-45")) ==                   etl::to_string(1e-45f, str, Format().shortest()));
+      CHECK(etl::string<40>(STR("0")) ==                       etl::to_string(0.0, str, Format().shortest()));
+      CHECK(etl::string<40>(STR("-0")) ==                      etl::to_string(-0.0, str, Format().shortest()));
+      CHECK(etl::string<40>(STR("      1.25")) ==              etl::to_string(1.25, str, Format().shortest().width(10).right()));
+      CHECK(etl::string<40>(STR("190944592")) ==               etl::to_string(190944592.0f, str, Format().shortest()));
+      CHECK(etl::string<40>(STR("123456789012345683968")) ==   etl::to_string(1.2345678901234568e20, str, Format().shortest()));
+
+      // Notations.
+      CHECK(etl::string<40>(STR("123456789")) ==               etl::to_string(1.23456789e8, str, Format().notation(etl::float_notation::shortest_fixed)));
+      CHECK(etl::string<40>(STR("100000000000000000000")) ==   etl::to_string(1e20, str, Format().notation(etl::float_notation::shortest_fixed)));
+      CHECK(etl::string<40>(STR("99999999999999991611392")) == etl::to_string(1e23, str, Format().notation(etl::float_notation::shortest_fixed)));
+      CHECK(etl::string<40>(STR("190944592")) ==               etl::to_string(190944592.0f, str, Format().notation(etl::float_notation::shortest_fixed)));
+      CHECK(etl::string<40>(STR("0.00001")) ==                 etl::to_string(1e-5, str, Format().notation(etl::float_notation::shortest_fixed)));
+      CHECK(etl::string<40>(STR("1.23456789e+08")) ==          etl::to_string(1.23456789e8, str, Format().notation(etl::float_notation::shortest_scientific)));
+      CHECK(etl::string<40>(STR("1.5E-300")) ==                etl::to_string(1.5e-300, str, Format().notation(etl::float_notation::shortest_scientific).upper_case(true)));
+      CHECK(etl::string<40>(STR("2e+00")) ==                   etl::to_string(2.0, str, Format().notation(etl::float_notation::shortest_scientific)));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_shortest_round_trip)
+    {
+      etl::string<40> str;
+
+      // Values spread over the whole exponent range.
+      double value = 1.0e-300;
+
+      while (value < 1.0e300)
+      {
+        etl::to_string(value, str, Format().shortest());
+        CHECK_EQUAL(value, strtod(std::string(str.begin(), str.end()).c_str(), ETL_NULLPTR));
+
+        etl::to_string(-value, str, Format().notation(etl::float_notation::shortest_scientific));
+        CHECK_EQUAL(-value, strtod(std::string(str.begin(), str.end()).c_str(), ETL_NULLPTR));
+
+        value *= 1.7182818284590452;
+      }
+
+      float fvalue = 1.0e-37f;
+
+      while (fvalue < 1.0e37f)
+      {
+        etl::to_string(fvalue, str, Format().shortest());
+        CHECK_EQUAL(fvalue, strtof(std::string(str.begin(), str.end()).c_str(), ETL_NULLPTR));
+
+        fvalue *= 1.7182818f;
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_shortest_fixed_whole_numbers)
+    {
+      // Whole numbers are written with their exact digits, as printf does.
+      etl::string<400> str;
+      char expected[400];
+
+      double value = 2.0;
+
+      while (value < 1.0e308)
+      {
+        etl::to_string(value, str, Format().notation(etl::float_notation::shortest_fixed));
+        snprintf(expected, sizeof(expected), "%.0f", value);
+        CHECK_EQUAL(std::string(expected), std::string(str.begin(), str.end()));
+
+        value *= 1.7182818284590452;
+        value = floor(value);
+      }
+
+      etl::to_string(1.7976931348623157e308, str, Format().notation(etl::float_notation::shortest_fixed));
+      snprintf(expected, sizeof(expected), "%.0f", 1.7976931348623157e308);
+      CHECK_EQUAL(std::string(expected), std::string(str.begin(), str.end()));
+
+      float fvalue = 2.0f;
+
+      while (fvalue < 1.0e38f)
+      {
+        etl::to_string(fvalue, str, Format().notation(etl::float_notation::shortest_fixed));
+        snprintf(expected, sizeof(expected), "%.0f", double(fvalue));
+        CHECK_EQUAL(std::string(expected), std::string(str.begin(), str.end()));
+
+        fvalue *= 1.7182818f;
+        fvalue = floorf(fvalue);
+      }
+    }
+
     //*************************************************************************
     TEST(test_bool_no_append)
     {
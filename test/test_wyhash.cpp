@@ -0,0 +1,224 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2026 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <list>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+#include "etl/wyhash.h"
+
+namespace
+{
+  struct Vector
+  {
+    const char* text;
+    uint64_t    seed;
+    uint64_t    hash;
+  };
+
+  // The reference test vectors of wyhash final version 4, with seeds 0 to 6.
+  // They cover each of the length paths. Any change that alters these values
+  // breaks compatibility with the reference implementation.
+  const Vector vectors[] =
+  {
+    { "",                                                                                 0U, 0x93228A4DE0EEC5A2ULL },
+    { "a",                                                                                1U, 0xC5BAC3DB178713C4ULL },
+    { "abc",                                                                              2U, 0xA97F2F7B1D9B3314ULL },
+    { "message digest",                                                                   3U, 0x786D1F1DF3801DF4ULL },
+    { "abcdefghijklmnopqrstuvwxyz",                                                       4U, 0xDCA5A8138AD37C87ULL },
+    { "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",                   5U, 0xB9E734F117CFAF70ULL },
+    { "12345678901234567890123456789012345678901234567890123456789012345678901234567890", 6U, 0x6CC5EAB49A92D617ULL }
+  };
+
+  std::vector<uint8_t> make_data(size_t length)
+  {
+    std::vector<uint8_t> data(length);
+
+    uint32_t x = 0x12345678UL;
+
+    for (size_t i = 0UL; i < length; ++i)
+    {
+      x ^= x << 13;
+      x ^= x >> 17;
+      x ^= x << 5;
+      data[i] = uint8_t(x);
+    }
+
+    return data;
+  }
+
+  SUITE(test_wyhash)
+  {
+    //*************************************************************************
+    TEST(test_wyhash_constructor)
+    {
+      for (size_t i = 0UL; i < ETL_ARRAY_SIZE(vectors); ++i)
+      {
+        std::string text(vectors[i].text);
+
+        uint64_t hash = etl::wyhash(text.begin(), text.end(), vectors[i].seed);
+
+        CHECK_EQUAL(vectors[i].hash, hash);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_add_values)
+    {
+      for (size_t i = 0UL; i < ETL_ARRAY_SIZE(vectors); ++i)
+      {
+        std::string text(vectors[i].text);
+
+        etl::wyhash wyhash_calculator(vectors[i].seed);
+
+        for (size_t j = 0UL; j < text.size(); ++j)
+        {
+          wyhash_calculator.add(uint8_t(text[j]));
+        }
+
+        CHECK_EQUAL(vectors[i].hash, wyhash_calculator.value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_add_range)
+    {
+      for (size_t i = 0UL; i < ETL_ARRAY_SIZE(vectors); ++i)
+      {
+        std::string text(vectors[i].text);
+
+        etl::wyhash wyhash_calculator(vectors[i].seed);
+
+        wyhash_calculator.add(text.begin(), text.end());
+
+        CHECK_EQUAL(vectors[i].hash, uint64_t(wyhash_calculator));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_add_range_non_random_access)
+    {
+      for (size_t i = 0UL; i < ETL_ARRAY_SIZE(vectors); ++i)
+      {
+        std::string text(vectors[i].text);
+        std::list<char> data(text.begin(), text.end());
+
+        uint64_t hash = etl::wyhash(data.begin(), data.end(), vectors[i].seed);
+
+        CHECK_EQUAL(vectors[i].hash, hash);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_split_additions_match_single_range)
+    {
+      // Covers every combination of partial buffer, whole blocks and tail.
+      std::vector<uint8_t> data = make_data(200);
+
+      for (size_t length = 0UL; length <= data.size(); ++length)
+      {
+        uint64_t expected = etl::wyhash(data.begin(), data.begin() + length, 42U);
+
+        for (size_t split = 0UL; split <= length; ++split)
+        {
+          etl::wyhash wyhash_calculator(42U);
+
+          wyhash_calculator.add(data.begin(), data.begin() + split);
+          wyhash_calculator.add(data.begin() + split, data.begin() + length);
+
+          CHECK_EQUAL(expected, wyhash_calculator.value());
+
+          wyhash_calculator.reset();
+
+          for (size_t i = 0UL; i < split; ++i)
+          {
+            wyhash_calculator.add(data[i]);
+          }
+
+          wyhash_calculator.add(data.begin() + split, data.begin() + length);
+
+          CHECK_EQUAL(expected, wyhash_calculator.value());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_value_does_not_finalise)
+    {
+      std::vector<uint8_t> data = make_data(100);
+
+      etl::wyhash wyhash_calculator;
+
+      wyhash_calculator.add(data.begin(), data.begin() + 50);
+      uint64_t partial = wyhash_calculator.value();
+      wyhash_calculator.add(data.begin() + 50, data.end());
+
+      CHECK_EQUAL(etl::wyhash(data.begin(), data.begin() + 50), partial);
+      CHECK_EQUAL(etl::wyhash(data.begin(), data.end()), wyhash_calculator.value());
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_seed)
+    {
+      std::vector<uint8_t> data = make_data(64);
+
+      uint64_t hash1 = etl::wyhash(data.begin(), data.end(), 1U);
+      uint64_t hash2 = etl::wyhash(data.begin(), data.end(), 2U);
+
+      CHECK(hash1 != hash2);
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_reset)
+    {
+      std::vector<uint8_t> data = make_data(100);
+
+      etl::wyhash wyhash_calculator(3U);
+
+      wyhash_calculator.add(data.begin(), data.end());
+      wyhash_calculator.reset();
+      wyhash_calculator.add(data.begin(), data.begin() + 20);
+
+      CHECK_EQUAL(etl::wyhash(data.begin(), data.begin() + 20, 3U), wyhash_calculator.value());
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_wyhash_constexpr)
+    {
+      constexpr char text[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789";
+      constexpr uint64_t hash = etl::wyhash(text, text + sizeof(text) - 1, 5U).value();
+
+      CHECK_EQUAL(vectors[5].hash, hash);
+    }
+#endif
+  };
+}